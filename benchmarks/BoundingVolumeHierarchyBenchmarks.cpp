@@ -0,0 +1,126 @@
+//
+//  BoundingVolumeHierarchyBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <random>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+#include "SUAPI-CppWrapper/BoundingVolumeHierarchy.hpp"
+
+namespace CW::Benchmarks {
+
+namespace {
+
+/**
+* Boxes scattered over a 10000" square site, as the instances of a site model would be.
+*/
+std::vector<SUBoundingBox3D> site_boxes(size_t count) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> position(0.0, 10000.0);
+  std::uniform_real_distribution<double> size(10.0, 200.0);
+  std::vector<SUBoundingBox3D> boxes(count);
+  for (SUBoundingBox3D& box : boxes) {
+    box.min_point = SUPoint3D{position(generator), position(generator), 0.0};
+    box.max_point = SUPoint3D{box.min_point.x + size(generator), box.min_point.y + size(generator), size(generator)};
+  }
+  return boxes;
+}
+
+} // namespace
+
+
+BENCHMARK(BoundingVolumeHierarchy, BoxQuery)
+{
+  constexpr size_t NUM_BOXES = 50000;
+  constexpr size_t NUM_QUERIES = 100;
+  const std::vector<SUBoundingBox3D> boxes = site_boxes(NUM_BOXES);
+  std::vector<SUBoundingBox3D> queries = site_boxes(NUM_QUERIES);
+  for (SUBoundingBox3D& query : queries) {
+    query.max_point = SUPoint3D{query.min_point.x + 500.0, query.min_point.y + 500.0, 100.0};
+  }
+  double ns = time_ns(5, [&]() {
+    size_t found = 0;
+    for (const SUBoundingBox3D& query : queries) {
+      for (const SUBoundingBox3D& box : boxes) {
+        found += BoundingVolumeHierarchy::overlaps(box, query);
+      }
+    }
+    do_not_optimize(found);
+  });
+  report("50000 boxes, testing every box", ns / NUM_QUERIES, "ns/query");
+  ns = time_ns(5, [&]() {
+    BoundingVolumeHierarchy hierarchy(boxes);
+    do_not_optimize(hierarchy);
+  });
+  report("50000 boxes, building the hierarchy", ns, "ns");
+  const BoundingVolumeHierarchy hierarchy(boxes);
+  ns = time_ns(5, [&]() {
+    size_t found = 0;
+    for (const SUBoundingBox3D& query : queries) {
+      hierarchy.traverse([&](const SUBoundingBox3D& bounds) {
+        return BoundingVolumeHierarchy::overlaps(bounds, query);
+      }, [&](size_t item) {
+        found += BoundingVolumeHierarchy::overlaps(boxes[item], query);
+      });
+    }
+    do_not_optimize(found);
+  });
+  report("50000 boxes, hierarchy", ns / NUM_QUERIES, "ns/query");
+}
+
+
+BENCHMARK(BoundingVolumeHierarchy, Refit)
+{
+  constexpr size_t NUM_BOXES = 50000;
+  std::vector<SUBoundingBox3D> boxes = site_boxes(NUM_BOXES);
+  BoundingVolumeHierarchy hierarchy(boxes);
+  // Move 1% of the boxes, as when a few instances are moved.
+  std::vector<size_t> changed;
+  for (size_t i=0; i < NUM_BOXES; i += 100) {
+    changed.push_back(i);
+  }
+  double offset = 1.0;
+  double ns = time_ns(20, [&]() {
+    offset = -offset;
+    for (size_t i : changed) {
+      boxes[i].min_point.x += offset;
+      boxes[i].max_point.x += offset;
+    }
+    hierarchy.refit(boxes, changed);
+  });
+  report("50000 boxes, refit after moving 500", ns, "ns");
+  ns = time_ns(20, [&]() {
+    hierarchy.refit(boxes);
+  });
+  report("50000 boxes, refit of every node", ns, "ns");
+}
+
+} /* namespace CW::Benchmarks */
@@ -0,0 +1,129 @@
+//
+//  ClassifierBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/LoopClassifier.hpp"
+#include "SUAPI-CppWrapper/model/FaceClassifier.hpp"
+
+namespace CW::Benchmarks {
+
+namespace {
+
+constexpr size_t NUM_TESTS = 1000;
+
+/**
+* A loop with a wavy outline of the given number of vertices, centred on the point, with a radius of roughly 100".
+*/
+std::vector<Point3D> wavy_loop(size_t num_points, double centre_x, double centre_y, double radius) {
+  std::vector<Point3D> points(num_points);
+  const double pi = std::acos(-1.0);
+  for (size_t i=0; i < num_points; ++i) {
+    const double angle = 2.0 * pi * static_cast<double>(i) / static_cast<double>(num_points);
+    const double wave = radius * (1.0 + 0.1 * std::sin(angle * 17.0));
+    points[i] = Point3D(centre_x + wave * std::cos(angle), centre_y + wave * std::sin(angle), 0.0);
+  }
+  return points;
+}
+
+std::vector<Point3D> random_test_points() {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-120.0, 120.0);
+  std::vector<Point3D> points(NUM_TESTS);
+  for (Point3D& point : points) {
+    point = Point3D(distribution(generator), distribution(generator), 0.0);
+  }
+  return points;
+}
+
+} // namespace
+
+
+BENCHMARK(LoopClassifier, RepeatedQueries)
+{
+  const std::vector<Point3D> test_points = random_test_points();
+  for (size_t num_points : {16, 256, 4096}) {
+    const std::vector<Point3D> loop_points = wavy_loop(num_points, 0.0, 0.0, 100.0);
+    const size_t iterations = num_points > 1000 ? 2 : 20;
+    const std::string label = std::to_string(num_points) + " sided loop";
+    double ns = time_ns(iterations, [&]() {
+      size_t inside = 0;
+      for (const Point3D& point : test_points) {
+        inside += Loop::classify_point(loop_points, point) == PointLoopClassify::PointInside;
+      }
+      do_not_optimize(inside);
+    });
+    report(label + ", Loop::classify_point()", ns / NUM_TESTS, "ns/point");
+    ns = time_ns(iterations, [&]() {
+      LoopClassifier classifier(loop_points);
+      do_not_optimize(classifier);
+    });
+    report(label + ", LoopClassifier construction", ns, "ns");
+    const LoopClassifier classifier(loop_points);
+    ns = time_ns(iterations, [&]() {
+      size_t inside = 0;
+      for (const Point3D& point : test_points) {
+        inside += classifier.classify(point) == PointLoopClassify::PointInside;
+      }
+      do_not_optimize(inside);
+    });
+    report(label + ", LoopClassifier::classify()", ns / NUM_TESTS, "ns/point");
+  }
+}
+
+
+BENCHMARK(FaceClassifier, RepeatedQueries)
+{
+  // A face with a grid of holes, as in a perforated panel.
+  const std::vector<Point3D> outer_loop = wavy_loop(256, 0.0, 0.0, 100.0);
+  std::vector<std::vector<Point3D>> inner_loops;
+  for (int i=-3; i <= 3; ++i) {
+    for (int j=-3; j <= 3; ++j) {
+      inner_loops.push_back(wavy_loop(32, i * 20.0, j * 20.0, 5.0));
+    }
+  }
+  const std::vector<Point3D> test_points = random_test_points();
+  const FaceClassifier classifier(outer_loop, inner_loops);
+  double ns = time_ns(20, [&]() {
+    size_t inside = 0;
+    for (const Point3D& point : test_points) {
+      inside += classifier.classify(point) == FacePointClass::PointInside;
+    }
+    do_not_optimize(inside);
+  });
+  report("256 sided face with 49 holes, FaceClassifier::classify()", ns / NUM_TESTS, "ns/point");
+}
+
+} /* namespace CW::Benchmarks */
@@ -0,0 +1,119 @@
+//
+//  ConvexHullBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "SUAPI-CppWrapper/ConvexHull.hpp"
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW::Benchmarks {
+
+namespace {
+
+/**
+* Adds the triangles of a closed torus, which has no good single hull, to a mesh.
+*/
+void torus(double major_radius, double minor_radius, size_t segments, std::vector<Point3D>& vertices, std::vector<size_t>& indices) {
+  const double pi = std::acos(-1.0);
+  for (size_t i=0; i < segments; ++i) {
+    const double u = (2.0 * pi * i) / segments;
+    for (size_t j=0; j < segments; ++j) {
+      const double v = (2.0 * pi * j) / segments;
+      const double radius = major_radius + (minor_radius * std::cos(v));
+      vertices.push_back(Point3D(radius * std::cos(u), radius * std::sin(u), minor_radius * std::sin(v)));
+    }
+  }
+  for (size_t i=0; i < segments; ++i) {
+    for (size_t j=0; j < segments; ++j) {
+      const size_t a = (i * segments) + j;
+      const size_t b = (((i + 1) % segments) * segments) + j;
+      const size_t c = (((i + 1) % segments) * segments) + ((j + 1) % segments);
+      const size_t d = (i * segments) + ((j + 1) % segments);
+      indices.insert(indices.end(), {a, b, c, a, c, d});
+    }
+  }
+}
+
+} // namespace
+
+
+BENCHMARK(ConvexHull, RandomPoints)
+{
+  std::vector<Point3D> points;
+  std::mt19937 random(3);
+  std::normal_distribution<double> coordinate(0.0, 100.0);
+  for (size_t i=0; i < 1000000; ++i) {
+    points.push_back(Point3D(coordinate(random), coordinate(random), coordinate(random)));
+  }
+  size_t num_vertices = 0;
+  const double ns = time_ns(3, [&]() {
+    ConvexHull hull(points);
+    num_vertices = hull.vertices().size();
+    do_not_optimize(num_vertices);
+  });
+  const std::string label = std::to_string(points.size()) + " points, " + std::to_string(num_vertices) + " hull vertices";
+  report(label, ns / 1e6, "ms");
+  report(label, 1e9 * static_cast<double>(points.size()) / ns, "points/s");
+}
+
+
+BENCHMARK(ConvexHull, OrientedBoundingBox)
+{
+  std::vector<Point3D> points;
+  std::mt19937 random(5);
+  std::normal_distribution<double> coordinate(0.0, 100.0);
+  for (size_t i=0; i < 100000; ++i) {
+    points.push_back(Point3D(coordinate(random), coordinate(random) * 0.5, coordinate(random) * 0.25));
+  }
+  const ConvexHull hull(points);
+  const double ns = time_ns(5, [&]() {
+    do_not_optimize(hull.oriented_bounding_box().volume());
+  });
+  report(std::to_string(hull.indices().size() / 3) + " hull triangles", ns / 1e6, "ms");
+}
+
+
+BENCHMARK(ConvexHull, Decompose)
+{
+  std::vector<Point3D> vertices;
+  std::vector<size_t> indices;
+  torus(100.0, 25.0, 64, vertices, indices);
+  size_t num_hulls = 0;
+  const double ns = time_ns(3, [&]() {
+    num_hulls = ConvexHull::decompose(vertices, indices).size();
+    do_not_optimize(num_hulls);
+  });
+  report("torus of " + std::to_string(indices.size() / 3) + " triangles to " + std::to_string(num_hulls) + " hulls", ns / 1e6, "ms");
+}
+
+} /* namespace CW::Benchmarks */
@@ -0,0 +1,631 @@
+//
+//  EntitiesBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#ifdef CPP_API_MODELS_PATH
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Initialize.hpp"
+#include "SUAPI-CppWrapper/TessellationFileCache.hpp"
+#include "SUAPI-CppWrapper/model/BillOfMaterials.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/DefinitionGraph.hpp"
+#include "SUAPI-CppWrapper/model/DrawingElementTable.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/EntityRefs.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
+#include "SUAPI-CppWrapper/model/GeometryInput.hpp"
+#include "SUAPI-CppWrapper/model/HalfEdgeMesh.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/LoopInput.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+#include "SUAPI-CppWrapper/model/MeshHelper.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+#include "SUAPI-CppWrapper/model/ModelWalker.hpp"
+#include "SUAPI-CppWrapper/model/PolygonMesh.hpp"
+#include "SUAPI-CppWrapper/model/TessellationCache.hpp"
+#include "SUAPI-CppWrapper/model/Vertex.hpp"
+
+namespace {
+
+/**
+* The number of allocations made with operator new by this program, for measuring the allocations made by enumerating entities.  Allocations made within the SketchUp API are not counted.
+*/
+std::atomic<size_t> num_allocations(0);
+
+} // namespace
+
+void* operator new(std::size_t size) {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* pointer = std::malloc(size > 0 ? size : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace CW::Benchmarks {
+
+namespace {
+
+/**
+* Reports the time per face and the allocations per call of a way of enumerating faces.
+*/
+template <typename Func>
+void report_enumeration(const std::string& label, size_t num_faces, Func&& func) {
+  constexpr size_t ITERATIONS = 5;
+  const size_t allocations_before = num_allocations.load();
+  const double ns = time_ns(ITERATIONS, func);
+  const double allocations = static_cast<double>(num_allocations.load() - allocations_before) / static_cast<double>(ITERATIONS + 1);
+  report(label, ns / static_cast<double>(std::max<size_t>(num_faces, 1)), "ns/face");
+  report(label, allocations, "allocations/call");
+}
+
+/**
+* Compares enumerating the faces of a set of entities with faces(), face_range(), for_each_face() and FaceRef handles.
+*/
+void enumerate_faces(const std::string& name, const std::vector<Entities>& sources) {
+  size_t num_faces = 0;
+  for (const Entities& entities : sources) {
+    num_faces += entities.face_range().size();
+  }
+  uintptr_t checksum = 0;
+  report_enumeration(name + ", faces()", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      for (const Face& face : entities.faces()) {
+        checksum ^= reinterpret_cast<uintptr_t>(face.ref().ptr);
+      }
+    }
+    do_not_optimize(checksum);
+  });
+  report_enumeration(name + ", face_range()", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      for (const Face& face : entities.face_range()) {
+        checksum ^= reinterpret_cast<uintptr_t>(face.ref().ptr);
+      }
+    }
+    do_not_optimize(checksum);
+  });
+  report_enumeration(name + ", for_each_face()", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      entities.for_each_face([&checksum](const Face& face) {
+        checksum ^= reinterpret_cast<uintptr_t>(face.ref().ptr);
+      });
+    }
+    do_not_optimize(checksum);
+  });
+  report_enumeration(name + ", FaceRef", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      for (FaceRef face : entities.face_range().as<FaceRef>()) {
+        checksum ^= reinterpret_cast<uintptr_t>(face.ref().ptr);
+      }
+    }
+    do_not_optimize(checksum);
+  });
+}
+
+/**
+* Compares reading the area, normal and material of each face through Face wrappers and FaceRef handles.
+*/
+void read_faces(const std::string& name, const std::vector<Entities>& sources) {
+  size_t num_faces = 0;
+  for (const Entities& entities : sources) {
+    num_faces += entities.face_range().size();
+  }
+  double total = 0.0;
+  report_enumeration(name + ", Face properties", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      for (const Face& face : entities.faces()) {
+        total += face.area() + face.normal().z + (face.material().ref().ptr != nullptr ? 1.0 : 0.0);
+      }
+    }
+    do_not_optimize(total);
+  });
+  report_enumeration(name + ", FaceRef properties", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      for (FaceRef face : entities.face_range().as<FaceRef>()) {
+        total += face.area() + face.normal().z + (face.material().ref().ptr != nullptr ? 1.0 : 0.0);
+      }
+    }
+    do_not_optimize(total);
+  });
+}
+
+/**
+* Compares reading the loops and edge properties of each face through Loop wrappers (as the copy paths did) and a FaceData snapshot.
+*/
+void snapshot_faces(const std::string& name, const std::vector<Entities>& sources) {
+  size_t num_faces = 0;
+  for (const Entities& entities : sources) {
+    num_faces += entities.face_range().size();
+  }
+  double total = 0.0;
+  report_enumeration(name + ", Loop points and edges", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      for (const Face& face : entities.faces()) {
+        std::vector<Loop> loops = face.inner_loops();
+        loops.insert(loops.begin(), face.outer_loop());
+        for (const Loop& loop : loops) {
+          for (const Point3D& point : loop.points()) {
+            total += point.x;
+          }
+          for (const Edge& edge : loop.edges()) {
+            total += (edge.soft() ? 1.0 : 0.0) + (edge.material().ref().ptr != nullptr ? 1.0 : 0.0);
+          }
+        }
+      }
+    }
+    do_not_optimize(total);
+  });
+  report_enumeration(name + ", FaceData", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      FaceData data(entities.faces());
+      for (size_t i=0; i < data.size(); ++i) {
+        FaceData::FaceView face = data[i];
+        for (size_t j=0; j <= face.num_inner_loops(); ++j) {
+          FaceData::LoopView loop = j == 0 ? face.outer_loop() : face.inner_loop(j - 1);
+          for (size_t k=0; k < loop.size(); ++k) {
+            total += loop.point(k).x + (loop.edge(k).soft() ? 1.0 : 0.0) + (loop.edge(k).material.ptr != nullptr ? 1.0 : 0.0);
+          }
+        }
+      }
+    }
+    do_not_optimize(total);
+  });
+}
+
+/**
+* Compares reading the drawing element properties of each face through the DrawingElement accessors and a DrawingElementTable.
+*/
+void tabulate_faces(const std::string& name, const Model& model, const std::vector<Entities>& sources) {
+  size_t num_faces = 0;
+  for (const Entities& entities : sources) {
+    num_faces += entities.face_range().size();
+  }
+  double total = 0.0;
+  report_enumeration(name + ", DrawingElement properties", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      for (Face& face : entities.faces()) {
+        total += (face.material().ref().ptr != nullptr ? 1.0 : 0.0) + (face.layer().ref().ptr != nullptr ? 1.0 : 0.0);
+        total += (face.hidden() ? 1.0 : 0.0) + (face.casts_shadows() ? 1.0 : 0.0) + (face.receives_shadows() ? 1.0 : 0.0);
+        total += face.bounds().max().z;
+      }
+    }
+    do_not_optimize(total);
+  });
+  report_enumeration(name + ", DrawingElementTable", num_faces, [&]() {
+    DrawingElementTable table(model);
+    table.reserve(num_faces);
+    for (const Entities& entities : sources) {
+      table.add_all(entities.face_range().as<FaceRef>());
+    }
+    for (size_t i=0; i < table.size(); ++i) {
+      total += (table.material_indices()[i] != DrawingElementTable::NO_INDEX ? 1.0 : 0.0) + (table.layer_indices()[i] != DrawingElementTable::NO_INDEX ? 1.0 : 0.0);
+      total += static_cast<double>(table.flags()[i]) + table.bounds()[i].max_point.z;
+    }
+    do_not_optimize(total);
+  });
+}
+
+/**
+* Compares collecting the points of every loop by walking faces, loops and vertices with extracting a PolygonMesh, which stores each shared vertex once.
+*/
+void extract_meshes(const std::string& name, const std::vector<Entities>& sources) {
+  size_t num_faces = 0;
+  for (const Entities& entities : sources) {
+    num_faces += entities.face_range().size();
+  }
+  size_t num_points = 0;
+  report_enumeration(name + ", faces, loops and vertices", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      std::vector<Point3D> points;
+      for (const Face& face : entities.faces()) {
+        for (const Loop& loop : face.loops()) {
+          for (const Vertex& vertex : loop.vertices()) {
+            points.push_back(vertex.position());
+          }
+        }
+      }
+      num_points += points.size();
+    }
+    do_not_optimize(num_points);
+  });
+  report_enumeration(name + ", PolygonMesh", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      PolygonMesh mesh(entities);
+      num_points += mesh.num_points();
+    }
+    do_not_optimize(num_points);
+  });
+}
+
+/**
+* Compares counting the neighbours of each face through Edge::faces() with building a HalfEdgeMesh and counting them with its partners.
+*/
+void walk_topology(const std::string& name, const std::vector<Entities>& sources) {
+  size_t num_faces = 0;
+  for (const Entities& entities : sources) {
+    num_faces += entities.face_range().size();
+  }
+  size_t num_neighbours = 0;
+  report_enumeration(name + ", Edge::faces()", num_faces, [&]() {
+    for (const Entities& entities : sources) {
+      for (Face& face : entities.faces()) {
+        for (const Edge& edge : face.edges()) {
+          num_neighbours += edge.faces().size() - 1;
+        }
+      }
+    }
+    do_not_optimize(num_neighbours);
+  });
+  size_t memory = 0;
+  report_enumeration(name + ", HalfEdgeMesh", num_faces, [&]() {
+    memory = 0;
+    for (const Entities& entities : sources) {
+      HalfEdgeMesh mesh(entities);
+      for (uint32_t h=0; h < mesh.num_half_edges(); ++h) {
+        for (uint32_t other = mesh.partner(h); other != HalfEdgeMesh::NO_ID && other != h; other = mesh.partner(other)) {
+          ++num_neighbours;
+        }
+      }
+      memory += mesh.memory_usage();
+    }
+    do_not_optimize(num_neighbours);
+  });
+  report(name + ", HalfEdgeMesh", static_cast<double>(memory) / static_cast<double>(std::max<size_t>(num_faces, 1)), "bytes/face");
+}
+
+
+/**
+* Returns the area of a loop by Newell's method.
+*/
+double loop_area(const FaceData::LoopView& loop) {
+  Vector3D normal(0.0, 0.0, 0.0);
+  for (size_t i=0; i < loop.size(); ++i) {
+    const Point3D& current = loop.point(i);
+    const Point3D& next = loop.point((i + 1) % loop.size());
+    normal.x += (current.y - next.y) * (current.z + next.z);
+    normal.y += (current.z - next.z) * (current.x + next.x);
+    normal.z += (current.x - next.x) * (current.y + next.y);
+  }
+  return normal.length() / 2.0;
+}
+
+
+double face_data_area(const FaceData& data) {
+  double area = 0.0;
+  for (size_t f=0; f < data.size(); ++f) {
+    const FaceData::FaceView face = data[f];
+    area += loop_area(face.outer_loop());
+    for (size_t i=0; i < face.num_inner_loops(); ++i) {
+      area -= loop_area(face.inner_loop(i));
+    }
+  }
+  return area;
+}
+
+
+double recursive_area(const Entities& entities) {
+  double area = 0.0;
+  for (const Face& face : entities.face_range()) {
+    area += face.area();
+  }
+  auto add_instance = [&](const ComponentInstance& instance) {
+    area += recursive_area(instance.definition().entities());
+  };
+  for (const Group& group : entities.group_range()) {
+    add_instance(group);
+  }
+  for (const ComponentInstance& instance : entities.instance_range()) {
+    add_instance(instance);
+  }
+  return area;
+}
+
+
+/**
+* Sums the area of the faces of every occurrence of the model's entities, by recursion and with a ModelWalker.
+*/
+void walk_model(const std::string& name, const Model& model) {
+  const Entities entities = model.entities();
+  const size_t num_faces = ModelWalker(model).node(0).total_faces;
+  double area = 0.0;
+  report_enumeration(name + ", recursion", num_faces, [&]() {
+    area = recursive_area(entities);
+    do_not_optimize(area);
+  });
+  report_enumeration(name + ", ModelWalker::map_definitions()", num_faces, [&]() {
+    ModelWalker walker(model);
+    const std::vector<double> areas = walker.map_definitions(
+      [&](size_t index) {
+        return FaceData(walker.entities(index).faces());
+      },
+      [](FaceData& data) {
+        return face_data_area(data);
+      });
+    const std::vector<size_t> counts = walker.occurrence_counts();
+    area = 0.0;
+    for (size_t i=0; i < areas.size(); ++i) {
+      area += areas[i] * static_cast<double>(counts[i]);
+    }
+    do_not_optimize(area);
+  });
+  ModelWalker walker(model);
+  std::vector<size_t> thread_faces(walker.num_threads(), 0);
+  report_enumeration(name + ", ModelWalker::walk_parallel()", num_faces, [&]() {
+    walker.walk_parallel([&](const ModelWalker::Occurrence& occurrence, size_t thread_index) {
+      thread_faces[thread_index] += walker.node(occurrence.node).num_faces;
+    });
+    do_not_optimize(thread_faces);
+  });
+}
+
+
+/**
+* Builds the definition graph of the model, and sums the faces of each definition bottom-up.
+*/
+void order_definitions(const std::string& name, const Model& model) {
+  const size_t num_faces = ModelWalker(model).node(0).total_faces;
+  report_enumeration(name + ", Model::definition_graph()", num_faces, [&]() {
+    const DefinitionGraph graph = model.definition_graph();
+    do_not_optimize(graph);
+  });
+  const DefinitionGraph graph = model.definition_graph();
+  report_enumeration(name + ", DefinitionGraph::bottom_up()", num_faces, [&]() {
+    const std::vector<size_t> total_faces = graph.bottom_up<size_t>([&](uint32_t node, const std::vector<size_t>& results) {
+      size_t total = graph.num_faces(node);
+      const IdRange children = graph.children(node);
+      const IdRange counts = graph.instance_counts(node);
+      for (size_t i=0; i < children.size(); ++i) {
+        total += results[children[i]] * counts[i];
+      }
+      return total;
+    });
+    do_not_optimize(total_faces);
+  });
+}
+
+
+/**
+* Reports the time to build a bill of materials of the model, and to write it as CSV and JSON.
+*/
+void bill_materials(const std::string& name, const Model& model) {
+  constexpr size_t ITERATIONS = 3;
+  const DefinitionGraph graph = model.definition_graph();
+  report(name + ", " + std::to_string(graph.num_nodes()) + " definitions, BillOfMaterials", time_ns(ITERATIONS, [&]() {
+    const BillOfMaterials bill(model);
+    do_not_optimize(bill);
+  }) / 1e6, "ms");
+  const BillOfMaterials bill(model, graph);
+  report(name + ", BillOfMaterials::write_csv() and write_json()", time_ns(ITERATIONS, [&]() {
+    std::ostringstream stream;
+    bill.write_csv(stream);
+    bill.write_json(stream);
+    do_not_optimize(stream);
+  }) / 1e6, "ms");
+}
+
+
+/**
+* Tessellates every occurrence of the model's entities, as an exporter would, with a MeshHelper for each face of each occurrence and with a TessellationCache.
+*/
+void export_meshes(const std::string& name, const Model& model) {
+  const ModelWalker walker(model);
+  const size_t num_faces = walker.node(0).total_faces;
+  const Entities entities = model.entities();
+  size_t num_triangles = 0;
+  report_enumeration(name + ", MeshHelper for each occurrence", num_faces, [&]() {
+    num_triangles = 0;
+    walker.walk([&](const ModelWalker::Occurrence& occurrence, const InstancePath&) {
+      for (const Face& face : walker.entities(occurrence.node).face_range()) {
+        num_triangles += MeshHelper(face).num_triangles();
+      }
+    });
+    do_not_optimize(num_triangles);
+  });
+  TessellationCache cache;
+  report_enumeration(name + ", TessellationCache", num_faces, [&]() {
+    cache.clear();
+    num_triangles = cache.tessellate(entities).num_triangles();
+    walker.walk([&](const ModelWalker::Occurrence& occurrence, const InstancePath&) {
+      if (occurrence.node > 0) {
+        num_triangles += cache.mesh(walker.definition(occurrence.node)).num_triangles();
+      }
+    });
+    do_not_optimize(num_triangles);
+  });
+  const TessellationCache::Stats stats = cache.stats();
+  report(name + ", TessellationCache hit rate", stats.hit_rate() * 100.0, "%");
+  report(name + ", TessellationCache", static_cast<double>(stats.memory_usage) / static_cast<double>(std::max<size_t>(stats.num_triangles, 1)), "bytes/triangle");
+}
+
+
+/**
+* Compares tessellating every definition with reusing the meshes of an earlier run from a TessellationFileCache, which only needs the content hashes.
+*/
+void reexport_meshes(const std::string& name, const Model& model) {
+  std::vector<Entities> sources;
+  size_t num_faces = 0;
+  for (const ComponentDefinition& definition : model.definitions()) {
+    sources.push_back(definition.entities());
+    num_faces += sources.back().faces().size();
+  }
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "cw_tessellation_cache_benchmark";
+  std::filesystem::remove_all(directory);
+  TessellationFileCache file_cache(directory.string(), uint64_t(1) << 30);
+  std::vector<std::string> material_names;
+  size_t num_triangles = 0;
+  report_enumeration(name + ", content_hash", num_faces, [&]() {
+    uint64_t hash = 0;
+    for (const Entities& entities : sources) {
+      hash ^= TessellationCache::content_hash(entities);
+    }
+    do_not_optimize(hash);
+  });
+  report_enumeration(name + ", load_or_tessellate, cold", num_faces, [&]() {
+    file_cache.clear();
+    num_triangles = 0;
+    for (const Entities& entities : sources) {
+      num_triangles += TessellationCache::load_or_tessellate(entities, file_cache, material_names).num_triangles();
+    }
+    do_not_optimize(num_triangles);
+  });
+  report_enumeration(name + ", load_or_tessellate, warm", num_faces, [&]() {
+    num_triangles = 0;
+    for (const Entities& entities : sources) {
+      num_triangles += TessellationCache::load_or_tessellate(entities, file_cache, material_names).num_triangles();
+    }
+    do_not_optimize(num_triangles);
+  });
+  report(name + ", TessellationFileCache", static_cast<double>(file_cache.stats().size_bytes), "bytes");
+  file_cache.clear();
+  std::filesystem::remove_all(directory);
+}
+
+} // namespace
+
+
+BENCHMARK(Entities, BundledModels)
+{
+  CW::initialize();
+  for (const std::string& name : {"box and box.skp", "issue-48.skp"}) {
+    Model model(std::string(CPP_API_MODELS_PATH) + "/" + name);
+    std::vector<Entities> sources = {model.entities()};
+    for (const ComponentDefinition& definition : model.definitions()) {
+      sources.push_back(definition.entities());
+    }
+    enumerate_faces(name, sources);
+    read_faces(name, sources);
+    snapshot_faces(name, sources);
+    tabulate_faces(name, model, sources);
+    extract_meshes(name, sources);
+    walk_topology(name, sources);
+    walk_model(name, model);
+    order_definitions(name, model);
+    bill_materials(name, model);
+    export_meshes(name, model);
+    reexport_meshes(name, model);
+  }
+  CW::terminate();
+}
+
+
+BENCHMARK(Entities, MillionFaces)
+{
+  // A grid of 1000 x 1000 squares.
+  constexpr size_t GRID_SIZE = 1000;
+  CW::initialize();
+  {
+    Model model;
+    GeometryInput geom_input;
+    for (size_t j=0; j <= GRID_SIZE; ++j) {
+      for (size_t i=0; i <= GRID_SIZE; ++i) {
+        geom_input.add_vertex(Point3D(i * 10.0, j * 10.0, 0.0));
+      }
+    }
+    for (size_t j=0; j < GRID_SIZE; ++j) {
+      for (size_t i=0; i < GRID_SIZE; ++i) {
+        const size_t corner = (j * (GRID_SIZE + 1)) + i;
+        LoopInput loop;
+        loop.add_vertex_index(corner);
+        loop.add_vertex_index(corner + 1);
+        loop.add_vertex_index(corner + GRID_SIZE + 2);
+        loop.add_vertex_index(corner + GRID_SIZE + 1);
+        geom_input.add_face(loop);
+      }
+    }
+    Entities entities = model.entities();
+    entities.fill(geom_input);
+    enumerate_faces("1000000 faces", {entities});
+    read_faces("1000000 faces", {entities});
+    snapshot_faces("1000000 faces", {entities});
+    tabulate_faces("1000000 faces", model, {entities});
+    extract_meshes("1000000 faces", {entities});
+    walk_topology("1000000 faces", {entities});
+    walk_model("1000000 faces", model);
+    order_definitions("1000000 faces", model);
+  }
+  CW::terminate();
+}
+
+
+
+BENCHMARK(Entities, ManyDefinitions)
+{
+  // 50000 definitions of a square, each placed twice in its parent, which has four children, to a depth of eight.
+  constexpr size_t NUM_DEFINITIONS = 50000;
+  CW::initialize();
+  {
+    Model model;
+    std::vector<ComponentDefinition> definitions(NUM_DEFINITIONS);
+    for (size_t i=0; i < NUM_DEFINITIONS; ++i) {
+      model.add_definition(definitions[i]);
+      GeometryInput geom_input;
+      LoopInput loop;
+      for (const Point3D& point : {Point3D(0.0, 0.0, 0.0), Point3D(10.0, 0.0, 0.0), Point3D(10.0, 10.0, 0.0), Point3D(0.0, 10.0, 0.0)}) {
+        loop.add_vertex_index(geom_input.add_vertex(point));
+      }
+      geom_input.add_face(loop);
+      Entities entities = definitions[i].entities();
+      entities.fill(geom_input);
+    }
+    model.entities().add_instance(definitions[0], Transformation());
+    for (size_t i=1; i < NUM_DEFINITIONS; ++i) {
+      Entities parent = definitions[(i - 1) / 4].entities();
+      parent.add_instance(definitions[i], Transformation(Point3D(20.0, 0.0, 0.0), 1.0));
+      parent.add_instance(definitions[i], Transformation(Point3D(0.0, 20.0, 0.0), 1.0));
+    }
+    order_definitions("50000 definitions", model);
+    bill_materials("50000 definitions", model);
+  }
+  CW::terminate();
+}
+
+} /* namespace CW::Benchmarks */
+#endif
@@ -0,0 +1,210 @@
+//
+//  GeometryBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW::Benchmarks {
+
+namespace {
+
+constexpr size_t NUM_POINTS = 1000000;
+constexpr size_t NUM_ITERATIONS = 20;
+
+/**
+* Reproduction of the previous Point3D layout, which held reference members into its own SUPoint3D struct. Kept for before/after comparison.
+*/
+class ReferencePoint3D {
+  private:
+  SUPoint3D m_point;
+  bool is_null = false;
+
+  public:
+  double &x;
+  double &y;
+  double &z;
+
+  ReferencePoint3D(double x, double y, double z):
+    m_point(SUPoint3D{x, y, z}), x(m_point.x), y(m_point.y), z(m_point.z)
+  {}
+
+  ReferencePoint3D(const ReferencePoint3D& other):
+    m_point(other.m_point), is_null(other.is_null), x(m_point.x), y(m_point.y), z(m_point.z)
+  {}
+
+  ReferencePoint3D& operator=(const ReferencePoint3D& other) {
+    if (this == &other) {
+      return *this;
+    }
+    x = other.x;
+    y = other.y;
+    z = other.z;
+    is_null = other.is_null;
+    return *this;
+  }
+
+  operator SUPoint3D() const { return m_point; }
+};
+
+template <typename PointType>
+std::vector<PointType> make_points() {
+  std::vector<PointType> points;
+  points.reserve(NUM_POINTS);
+  for (size_t i=0; i < NUM_POINTS; ++i) {
+    double value = static_cast<double>(i);
+    points.push_back(PointType(value, value * 0.5, value * 0.25));
+  }
+  return points;
+}
+
+template <typename PointType>
+void report_copy(const std::string& name) {
+  std::vector<PointType> source = make_points<PointType>();
+  double ns = time_ns(NUM_ITERATIONS, [&]() {
+    std::vector<PointType> copy(source);
+    do_not_optimize(copy.back());
+  });
+  report(name + " vector copy", ns / NUM_POINTS, "ns/point");
+  report(name + " vector copy throughput", (sizeof(PointType) * NUM_POINTS) / ns, "GB/s");
+}
+
+#if defined(_MSC_VER)
+#define CW_BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define CW_BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+/**
+* Out of line versions of the arithmetic operators, reproducing the previous calls into Geometry.cpp.  Kept for before/after comparison.
+*/
+CW_BENCHMARK_NOINLINE Vector3D out_of_line_subtract(const Point3D& lhs, const Point3D& rhs) {
+  return lhs - rhs;
+}
+
+CW_BENCHMARK_NOINLINE Vector3D out_of_line_cross(const Vector3D& lhs, const Vector3D& rhs) {
+  return lhs.cross(rhs);
+}
+
+CW_BENCHMARK_NOINLINE Vector3D out_of_line_add(const Vector3D& lhs, const Vector3D& rhs) {
+  return lhs + rhs;
+}
+
+} // namespace
+
+
+BENCHMARK(Point3D, BytesPerPoint)
+{
+  report("SUPoint3D", sizeof(SUPoint3D), "bytes/point");
+  report("CW::Point3D (reference members, before)", sizeof(ReferencePoint3D), "bytes/point");
+  report("CW::Point3D (value layout)", sizeof(Point3D), "bytes/point");
+}
+
+
+BENCHMARK(Point3D, CopyThroughput)
+{
+  report_copy<ReferencePoint3D>("reference members (before)");
+  report_copy<Point3D>("value layout");
+}
+
+
+BENCHMARK(Point3D, PassToCAPI)
+{
+  // Before: points had to be staged into a std::vector<SUPoint3D> for SUFaceCreate / SUGeometryInputSetVertices.
+  std::vector<ReferencePoint3D> reference_points = make_points<ReferencePoint3D>();
+  double staged_ns = time_ns(NUM_ITERATIONS, [&]() {
+    std::vector<SUPoint3D> su_points(reference_points.size());
+    std::transform(reference_points.begin(), reference_points.end(), su_points.begin(),
+      [](const ReferencePoint3D& value) {
+        return static_cast<SUPoint3D>(value);
+      });
+    do_not_optimize(su_points.back());
+  });
+  report("std::transform staging (before)", staged_ns / NUM_POINTS, "ns/point");
+  // After: the Point3D array is passed directly.
+  std::vector<Point3D> points = make_points<Point3D>();
+  double direct_ns = time_ns(NUM_ITERATIONS, [&]() {
+    const SUPoint3D* su_points = reinterpret_cast<const SUPoint3D*>(points.data());
+    do_not_optimize(su_points[points.size() - 1]);
+  });
+  report("direct pointer (value layout)", direct_ns / NUM_POINTS, "ns/point");
+}
+
+
+
+BENCHMARK(Vector3D, InlineArithmetic)
+{
+  // Area weighted normal of a triangle fan around the first point, as used when finding the plane of a loop.
+  std::vector<Point3D> points = make_points<Point3D>();
+  for (size_t i=0; i < points.size(); ++i) {
+    points[i].z = static_cast<double>(i % 7);
+  }
+  double out_of_line_ns = time_ns(NUM_ITERATIONS, [&]() {
+    Vector3D normal = Vector3D::zero_vector();
+    for (size_t i=1; i + 1 < points.size(); ++i) {
+      normal = out_of_line_add(normal, out_of_line_cross(out_of_line_subtract(points[i], points[0]), out_of_line_subtract(points[i + 1], points[0])));
+    }
+    do_not_optimize(normal);
+  });
+  report("out of line calls (before)", out_of_line_ns / NUM_POINTS, "ns/point");
+  double inline_ns = time_ns(NUM_ITERATIONS, [&]() {
+    Vector3D normal = Vector3D::zero_vector();
+    for (size_t i=1; i + 1 < points.size(); ++i) {
+      normal = normal + (points[i] - points[0]).cross(points[i + 1] - points[0]);
+    }
+    do_not_optimize(normal);
+  });
+  report("inline constexpr core", inline_ns / NUM_POINTS, "ns/point");
+}
+
+
+BENCHMARK(Plane3D, OnPlaneTolerance)
+{
+  std::vector<Point3D> points = make_points<Point3D>();
+  const Plane3D plane(Point3D(0.0, 0.0, 0.0), Vector3D(1.0, -2.0, 0.0));
+  double sketchup_ns = time_ns(NUM_ITERATIONS, [&]() {
+    size_t count = static_cast<size_t>(std::count_if(points.begin(), points.end(), [&](const Point3D& point) {
+      return plane.on_plane(point);
+    }));
+    do_not_optimize(count);
+  });
+  report("on_plane<SketchUpTolerance>", sketchup_ns / NUM_POINTS, "ns/point");
+  double exact_ns = time_ns(NUM_ITERATIONS, [&]() {
+    size_t count = static_cast<size_t>(std::count_if(points.begin(), points.end(), [&](const Point3D& point) {
+      return plane.on_plane<ExactTolerance>(point);
+    }));
+    do_not_optimize(count);
+  });
+  report("on_plane<ExactTolerance>", exact_ns / NUM_POINTS, "ns/point");
+}
+
+} /* namespace CW::Benchmarks */
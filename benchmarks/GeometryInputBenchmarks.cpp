@@ -0,0 +1,122 @@
+//
+//  GeometryInputBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <string>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/VertexWelder.hpp"
+
+#ifdef CPP_API_MODELS_PATH
+#include "SUAPI-CppWrapper/Initialize.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/GeometryInputHelper.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+#endif
+
+namespace CW::Benchmarks {
+
+BENCHMARK(GeometryInput, VertexWelder)
+{
+  // The corners of each quad of a 300 x 300 grid, as add_face() gives them: most points are given four times.
+  constexpr size_t GRID_SIZE = 300;
+  std::vector<Point3D> points;
+  points.reserve(GRID_SIZE * GRID_SIZE * 4);
+  for (size_t i=0; i < GRID_SIZE; ++i) {
+    for (size_t j=0; j < GRID_SIZE; ++j) {
+      points.push_back(Point3D(i * 10.0, j * 10.0, 0.0));
+      points.push_back(Point3D((i + 1) * 10.0, j * 10.0, 0.0));
+      points.push_back(Point3D((i + 1) * 10.0, (j + 1) * 10.0, 0.0));
+      points.push_back(Point3D(i * 10.0, (j + 1) * 10.0, 0.0));
+    }
+  }
+  size_t num_vertices = 0;
+  const double ns = time_ns(5, [&]() {
+    VertexWelder welder;
+    num_vertices = 0;
+    for (const Point3D& point : points) {
+      if (welder.weld(point, num_vertices) == num_vertices) {
+        ++num_vertices;
+      }
+    }
+    do_not_optimize(num_vertices);
+  });
+  report("360000 quad corners", ns / static_cast<double>(points.size()), "ns/point");
+  report("360000 quad corners, vertices after welding", static_cast<double>(num_vertices), "vertices");
+}
+
+
+#ifdef CPP_API_MODELS_PATH
+/**
+* Copies the faces of each bundled model, and of its component definitions, into a new model with and without welding vertices.
+*/
+BENCHMARK(GeometryInput, CopyBundledModels)
+{
+  CW::initialize();
+  for (const std::string& name : {"box and box.skp", "issue-48.skp"}) {
+    Model model(std::string(CPP_API_MODELS_PATH) + "/" + name);
+    std::vector<Entities> sources = {model.entities()};
+    for (const ComponentDefinition& definition : model.definitions()) {
+      sources.push_back(definition.entities());
+    }
+    for (bool weld : {false, true}) {
+      GeometryInput::WeldStatistics statistics;
+      size_t num_vertices = 0;
+      const double ns = time_ns(3, [&]() {
+        Model* target = new Model();
+        for (const Entities& source : sources) {
+          GeometryInputPlus geom_input(target);
+          geom_input.weld_vertices(weld);
+          for (const Face& face : source.faces()) {
+            geom_input.add_face(face, false);
+          }
+          num_vertices += geom_input.counts()[0];
+          statistics.points += geom_input.weld_statistics().points;
+          statistics.vertices += geom_input.weld_statistics().vertices;
+          Entities entities = target->entities();
+          entities.fill(geom_input);
+        }
+        delete target;
+      });
+      const std::string label = name + (weld ? ", welded" : ", not welded");
+      report(label, ns / 1e3, "us/copy");
+      report(label + ", vertices added", static_cast<double>(num_vertices) / 4.0, "vertices");
+      if (weld) {
+        report(label + ", points welded", 100.0 * statistics.ratio(), "%");
+      }
+    }
+  }
+  CW::terminate();
+}
+#endif
+
+} /* namespace CW::Benchmarks */
@@ -0,0 +1,158 @@
+//
+//  KdTreeBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/KdTree.hpp"
+
+#ifdef CPP_API_MODELS_PATH
+#include "SUAPI-CppWrapper/Initialize.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+#include "SUAPI-CppWrapper/model/VertexTree.hpp"
+#endif
+
+namespace CW::Benchmarks {
+
+namespace {
+
+std::vector<Point3D> random_points(size_t count, double size, unsigned int seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> coordinate(0.0, size);
+  std::vector<Point3D> points;
+  points.reserve(count);
+  for (size_t i=0; i < count; ++i) {
+    points.push_back(Point3D(coordinate(generator), coordinate(generator), coordinate(generator)));
+  }
+  return points;
+}
+
+} // namespace
+
+
+BENCHMARK(KdTree, Build)
+{
+  const std::vector<Point3D> points = random_points(1000000, 10000.0, 42);
+  double ns = time_ns(3, [&]() {
+    do_not_optimize(KdTree(points, 1).size());
+  });
+  report("build 1M points, 1 thread", ns / 1e6, "ms");
+  ns = time_ns(3, [&]() {
+    do_not_optimize(KdTree(points, 0).size());
+  });
+  report("build 1M points, " + std::to_string(std::thread::hardware_concurrency()) + " threads", ns / 1e6, "ms");
+}
+
+
+BENCHMARK(KdTree, Nearest)
+{
+  // Queries near the points, as when snapping, so that most find a point within the radius.
+  const std::vector<Point3D> points = random_points(100000, 10000.0, 42);
+  std::vector<Point3D> queries = random_points(100000, 10000.0, 7);
+  for (size_t i=0; i < queries.size(); i += 2) {
+    queries[i] = points[(i * 7919) % points.size()] + Vector3D(0.0001, 0.0, 0.0);
+  }
+  const KdTree tree(points);
+
+  // A linear scan over a sample of the queries, for comparison.
+  double ns = time_ns(1, [&]() {
+    size_t found = 0;
+    for (size_t i=0; i < 1000; ++i) {
+      double best = std::numeric_limits<double>::infinity();
+      for (const Point3D& point : points) {
+        const Vector3D offset = point - queries[i];
+        const double squared = (offset.x * offset.x) + (offset.y * offset.y) + (offset.z * offset.z);
+        if (squared < best) {
+          best = squared;
+          found = &point - points.data();
+        }
+      }
+    }
+    do_not_optimize(found);
+  });
+  report("nearest of 100k points, linear scan", ns / 1000.0, "ns/query");
+
+  ns = time_ns(3, [&]() {
+    size_t found = 0;
+    for (const Point3D& query : queries) {
+      found += tree.nearest(query);
+    }
+    do_not_optimize(found);
+  });
+  report("nearest of 100k points", ns / static_cast<double>(queries.size()), "ns/query");
+  ns = time_ns(3, [&]() {
+    size_t found = 0;
+    for (const Point3D& query : queries) {
+      found += tree.nearest(query, Point3D::EPSILON);
+    }
+    do_not_optimize(found);
+  });
+  report("nearest of 100k points within EPSILON", ns / static_cast<double>(queries.size()), "ns/query");
+  ns = time_ns(3, [&]() {
+    do_not_optimize(tree.nearest(queries, Point3D::EPSILON, 1));
+  });
+  report("batch within EPSILON, 1 thread", ns / static_cast<double>(queries.size()), "ns/query");
+  ns = time_ns(3, [&]() {
+    do_not_optimize(tree.nearest(queries, Point3D::EPSILON, 0));
+  });
+  report("batch within EPSILON, " + std::to_string(std::thread::hardware_concurrency()) + " threads", ns / static_cast<double>(queries.size()), "ns/query");
+  ns = time_ns(3, [&]() {
+    size_t found = 0;
+    for (size_t i=0; i < queries.size(); i += 10) {
+      found += tree.k_nearest(queries[i], 8).size();
+    }
+    do_not_optimize(found);
+  });
+  report("8 nearest of 100k points", ns / static_cast<double>(queries.size() / 10), "ns/query");
+}
+
+
+#ifdef CPP_API_MODELS_PATH
+BENCHMARK(KdTree, BundledModels)
+{
+  CW::initialize();
+  for (const std::string& name : {"box and box.skp", "issue-48.skp"}) {
+    Model model(std::string(CPP_API_MODELS_PATH) + "/" + name);
+    const Entities entities = model.entities();
+    double ns = time_ns(3, [&]() {
+      do_not_optimize(VertexTree(entities).size());
+    });
+    report(name + ", vertex tree", ns / 1e3, "us");
+  }
+  CW::terminate();
+}
+#endif
+
+} /* namespace CW::Benchmarks */
@@ -0,0 +1,112 @@
+//
+//  MeshDecimatorBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/MeshDecimator.hpp"
+
+namespace CW::Benchmarks {
+
+namespace {
+
+/**
+* A sphere of latitude and longitude bands, with 4 * bands * (bands - 1) triangles.
+*/
+MeshDecimator::Mesh sphere(double radius, size_t bands) {
+  MeshDecimator::Mesh mesh;
+  const double pi = std::acos(-1.0);
+  mesh.vertices.push_back(Point3D(0.0, 0.0, radius));
+  for (size_t j=1; j < bands; ++j) {
+    const double latitude = (pi * j) / bands;
+    for (size_t i=0; i < 2 * bands; ++i) {
+      const double longitude = (pi * i) / bands;
+      mesh.vertices.push_back(Point3D(radius * std::sin(latitude) * std::cos(longitude), radius * std::sin(latitude) * std::sin(longitude), radius * std::cos(latitude)));
+    }
+  }
+  mesh.vertices.push_back(Point3D(0.0, 0.0, -radius));
+  const size_t ring = 2 * bands;
+  const size_t bottom = mesh.vertices.size() - 1;
+  for (size_t i=0; i < ring; ++i) {
+    const size_t next = (i + 1) % ring;
+    mesh.indices.insert(mesh.indices.end(), {0, 1 + i, 1 + next});
+    mesh.indices.insert(mesh.indices.end(), {bottom, 1 + ((bands - 2) * ring) + next, 1 + ((bands - 2) * ring) + i});
+    for (size_t j=0; j + 2 < bands; ++j) {
+      const size_t a = 1 + (j * ring) + i;
+      const size_t b = 1 + (j * ring) + next;
+      mesh.indices.insert(mesh.indices.end(), {a, a + ring, b + ring, a, b + ring, b});
+    }
+  }
+  // Bands of latitude alternate in material, so that there are boundaries to keep.
+  for (size_t t=0; t < mesh.num_triangles(); ++t) {
+    mesh.attributes.push_back((mesh.indices[t * 3] / (ring * 8)) % 2);
+  }
+  return mesh;
+}
+
+} // namespace
+
+
+BENCHMARK(MeshDecimator, Sphere)
+{
+  const MeshDecimator::Mesh mesh = sphere(100.0, 224);
+  const std::vector<MeshDecimator::Target> targets = {MeshDecimator::Target(mesh.num_triangles() / 4), MeshDecimator::Target(mesh.num_triangles() / 16), MeshDecimator::Target(mesh.num_triangles() / 64)};
+  const double ns = time_ns(3, [&]() {
+    MeshDecimator decimator;
+    do_not_optimize(decimator.decimate(mesh, targets).size());
+  });
+  const std::string label = std::to_string(mesh.num_triangles()) + " triangles to 3 levels";
+  report(label, ns / 1e6, "ms");
+  report(label, 1e9 * static_cast<double>(mesh.num_triangles()) / ns, "triangles/s");
+}
+
+
+BENCHMARK(MeshDecimator, Definitions)
+{
+  // 32 definitions of 12k triangles each, as from a library of furniture.
+  std::vector<MeshDecimator::Mesh> meshes;
+  for (size_t i=0; i < 32; ++i) {
+    meshes.push_back(sphere(50.0 + i, 55));
+  }
+  const std::vector<MeshDecimator::Target> targets = {MeshDecimator::Target(2000), MeshDecimator::Target(500)};
+  double ns = time_ns(3, [&]() {
+    do_not_optimize(MeshDecimator::decimate(meshes, targets, 1).size());
+  });
+  report("32 definitions, 1 thread", ns / 1e6, "ms");
+  ns = time_ns(3, [&]() {
+    do_not_optimize(MeshDecimator::decimate(meshes, targets, 0).size());
+  });
+  report("32 definitions, " + std::to_string(std::thread::hardware_concurrency()) + " threads", ns / 1e6, "ms");
+}
+
+} /* namespace CW::Benchmarks */
@@ -0,0 +1,119 @@
+//
+//  PolygonClipperBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/PolygonClipper.hpp"
+
+namespace CW::Benchmarks {
+
+namespace {
+
+/**
+* A star shaped polygon in the xy plane about the point, with vertices at random distances.
+*/
+PolygonClipper::Polygon star(std::mt19937& generator, double x, double y, size_t num_points) {
+  std::uniform_real_distribution<double> radius(50.0, 100.0);
+  const double pi = std::acos(-1.0);
+  std::vector<Point3D> outer_loop;
+  for (size_t i=0; i < num_points; ++i) {
+    const double angle = (2.0 * pi * i) / num_points;
+    const double r = radius(generator);
+    outer_loop.push_back(Point3D(x + (r * std::cos(angle)), y + (r * std::sin(angle)), 0.0));
+  }
+  return PolygonClipper::Polygon(outer_loop);
+}
+
+/**
+* A wall in the xz plane with a grid of windows.
+*/
+PolygonClipper::Polygon facade(size_t bays, size_t storeys) {
+  PolygonClipper::Polygon polygon({Point3D(0.0, 0.0, 0.0), Point3D(bays * 100.0, 0.0, 0.0), Point3D(bays * 100.0, 0.0, storeys * 120.0), Point3D(0.0, 0.0, storeys * 120.0)});
+  for (size_t i=0; i < bays; ++i) {
+    for (size_t j=0; j < storeys; ++j) {
+      const double x = (i * 100.0) + 30.0;
+      const double z = (j * 120.0) + 30.0;
+      polygon.inner_loops.push_back({Point3D(x, 0.0, z), Point3D(x, 0.0, z + 60.0), Point3D(x + 40.0, 0.0, z + 60.0), Point3D(x + 40.0, 0.0, z)});
+    }
+  }
+  return polygon;
+}
+
+} // namespace
+
+
+BENCHMARK(PolygonClipper, StarPairs)
+{
+  // 10000 pairs of overlapping polygons of 32 vertices.
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<double> offset(-60.0, 60.0);
+  std::vector<PolygonClipper::Polygon> subjects;
+  std::vector<PolygonClipper::Polygon> clips;
+  for (size_t i=0; i < 10000; ++i) {
+    subjects.push_back(star(generator, 0.0, 0.0, 32));
+    clips.push_back(star(generator, offset(generator), offset(generator), 32));
+  }
+  for (PolygonClipper::Operation operation : {PolygonClipper::Operation::Union, PolygonClipper::Operation::Difference}) {
+    const std::string name = operation == PolygonClipper::Operation::Union ? "union" : "difference";
+    double ns = time_ns(3, [&]() {
+      PolygonClipper clipper;
+      size_t count = 0;
+      for (size_t i=0; i < subjects.size(); ++i) {
+        count += clipper.clip(subjects[i], clips[i], operation).size();
+      }
+      do_not_optimize(count);
+    });
+    report("10000 " + name + "s of 32-gons, 1 thread", 1e9 * static_cast<double>(subjects.size()) / ns, "pairs/s");
+    ns = time_ns(3, [&]() {
+      do_not_optimize(PolygonClipper::clip(subjects, clips, operation, 0).size());
+    });
+    report("10000 " + name + "s of 32-gons, " + std::to_string(std::thread::hardware_concurrency()) + " threads", 1e9 * static_cast<double>(subjects.size()) / ns, "pairs/s");
+  }
+}
+
+
+BENCHMARK(PolygonClipper, Facade)
+{
+  // Cutting a band across a façade of 800 windows, which splits many of them.
+  const PolygonClipper::Polygon wall = facade(40, 20);
+  const PolygonClipper::Polygon band({Point3D(-10.0, 0.0, 1000.0), Point3D(5000.0, 0.0, 1000.0), Point3D(5000.0, 0.0, 1300.0), Point3D(-10.0, 0.0, 1300.0)});
+  PolygonClipper clipper;
+  double ns = time_ns(10, [&]() {
+    do_not_optimize(clipper.clip(wall, band, PolygonClipper::Operation::Difference).size());
+  });
+  report("facade of 800 windows less a band", ns / 1e6, "ms");
+}
+
+} /* namespace CW::Benchmarks */
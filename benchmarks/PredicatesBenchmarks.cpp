@@ -0,0 +1,169 @@
+//
+//  PredicatesBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Predicates.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+
+namespace CW::Benchmarks {
+
+namespace {
+
+constexpr size_t NUM_POINTS = 100000;
+constexpr size_t NUM_ITERATIONS = 20;
+
+/**
+* Random points in a 1000" square, as would be found in a typical model.
+*/
+std::vector<SUPoint2D> random_points() {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1000.0);
+  std::vector<SUPoint2D> points(NUM_POINTS);
+  for (SUPoint2D& point : points) {
+    point = SUPoint2D{distribution(generator), distribution(generator)};
+  }
+  return points;
+}
+
+/**
+* Points within a few ulps of the line y = x, where the floating point evaluation cannot decide the orientation.
+*/
+std::vector<SUPoint2D> nearly_collinear_points() {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1000.0);
+  std::uniform_int_distribution<int> ulps(-4, 4);
+  std::vector<SUPoint2D> points(NUM_POINTS);
+  for (SUPoint2D& point : points) {
+    double value = distribution(generator);
+    double ulp = std::nextafter(value, 2000.0) - value;
+    point = SUPoint2D{value, value + (ulps(generator) * ulp)};
+  }
+  return points;
+}
+
+// The predicates are passed as lambdas so that they are inlined into the timing loops.
+const auto NAIVE_ORIENT2D = [](const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c) {
+  return ((a.x - c.x) * (b.y - c.y)) - ((a.y - c.y) * (b.x - c.x));
+};
+const auto ORIENT2D = [](const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c) {
+  return Predicates::orient2d(a, b, c);
+};
+const auto INCIRCLE = [](const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c, const SUPoint2D& d) {
+  return Predicates::incircle(a, b, c, d);
+};
+
+template <typename Predicate>
+double time_orient2d(const std::vector<SUPoint2D>& points, Predicate predicate) {
+  return time_ns(NUM_ITERATIONS, [&]() {
+    int positive = 0;
+    for (size_t i=2; i < points.size(); ++i) {
+      positive += predicate(points[i - 2], points[i - 1], points[i]) > 0.0;
+    }
+    do_not_optimize(positive);
+  }) / (points.size() - 2);
+}
+
+template <typename Predicate>
+double time_incircle(const std::vector<SUPoint2D>& points, Predicate predicate) {
+  return time_ns(NUM_ITERATIONS, [&]() {
+    int positive = 0;
+    for (size_t i=3; i < points.size(); ++i) {
+      positive += predicate(points[i - 3], points[i - 2], points[i - 1], points[i]) > 0.0;
+    }
+    do_not_optimize(positive);
+  }) / (points.size() - 3);
+}
+
+/**
+* A regular polygon, offset from the origin.
+*/
+std::vector<Point3D> polygon(size_t num_sides, double offset) {
+  std::vector<Point3D> points;
+  for (size_t i=0; i < num_sides; ++i) {
+    double angle = (2.0 * Radians::PI * static_cast<double>(i)) / static_cast<double>(num_sides);
+    points.push_back(Point3D(offset + (100.0 * std::cos(angle)), offset + (100.0 * std::sin(angle)), 0.0));
+  }
+  return points;
+}
+
+} // namespace
+
+
+BENCHMARK(Predicates, Orient2d)
+{
+  std::vector<SUPoint2D> typical = random_points();
+  report("naive determinant, random points", time_orient2d(typical, NAIVE_ORIENT2D), "ns/test");
+  report("orient2d, random points (fast path)", time_orient2d(typical, ORIENT2D), "ns/test");
+  std::vector<SUPoint2D> degenerate = nearly_collinear_points();
+  report("orient2d, nearly collinear points (exact path)", time_orient2d(degenerate, ORIENT2D), "ns/test");
+}
+
+
+BENCHMARK(Predicates, InCircle)
+{
+  std::vector<SUPoint2D> typical = random_points();
+  report("incircle, random points (fast path)", time_incircle(typical, INCIRCLE), "ns/test");
+  // Points on a circle far from the origin are cocircular, so every test needs exact arithmetic.
+  std::vector<SUPoint2D> cocircular(NUM_POINTS / 10);
+  for (size_t i=0; i < cocircular.size(); ++i) {
+    const double offset = 1048576.0;
+    cocircular[i] = (i % 2 == 0) ? SUPoint2D{offset + 3.0, offset + 4.0 * ((i % 4 == 0) ? 1.0 : -1.0)} : SUPoint2D{offset - 5.0 * ((i % 3 == 0) ? 1.0 : -1.0), offset};
+  }
+  report("incircle, cocircular points (exact path)", time_incircle(cocircular, INCIRCLE), "ns/test");
+}
+
+
+BENCHMARK(Loop, ClassifyPoint)
+{
+  constexpr size_t NUM_TESTS = 1000;
+  for (const double offset : {0.0, 2.0e7}) {
+    std::vector<Point3D> loop_points = polygon(64, offset);
+    std::vector<Point3D> test_points;
+    for (size_t i=0; i < NUM_TESTS; ++i) {
+      double value = static_cast<double>(i % 200) - 100.0;
+      test_points.push_back(Point3D(offset + value, offset + (value * 0.37), 0.0));
+    }
+    double ns = time_ns(NUM_ITERATIONS, [&]() {
+      size_t inside = 0;
+      for (const Point3D& point : test_points) {
+        inside += Loop::classify_point(loop_points, point) == PointLoopClassify::PointInside;
+      }
+      do_not_optimize(inside);
+    });
+    report("64 sided loop, offset " + std::to_string(offset), ns / NUM_TESTS, "ns/point");
+  }
+}
+
+} /* namespace CW::Benchmarks */
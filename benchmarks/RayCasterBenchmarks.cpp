@@ -0,0 +1,166 @@
+//
+//  RayCasterBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/RayCaster.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+
+#ifdef CPP_API_MODELS_PATH
+#include "SUAPI-CppWrapper/Initialize.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+#include "SUAPI-CppWrapper/model/ModelRayCaster.hpp"
+#endif
+
+namespace CW::Benchmarks {
+
+namespace {
+
+/**
+* A sphere of radius 50" made of (2 * segments * segments) triangles.
+*/
+void sphere(size_t segments, std::vector<Point3D>& vertices, std::vector<size_t>& indices) {
+  const double pi = std::acos(-1.0);
+  for (size_t i=0; i <= segments; ++i) {
+    const double latitude = pi * static_cast<double>(i) / static_cast<double>(segments);
+    for (size_t j=0; j < segments; ++j) {
+      const double longitude = 2.0 * pi * static_cast<double>(j) / static_cast<double>(segments);
+      vertices.push_back(Point3D(50.0 * std::sin(latitude) * std::cos(longitude), 50.0 * std::sin(latitude) * std::sin(longitude), 50.0 * std::cos(latitude)));
+    }
+  }
+  for (size_t i=0; i < segments; ++i) {
+    for (size_t j=0; j < segments; ++j) {
+      const size_t a = (i * segments) + j;
+      const size_t b = (i * segments) + ((j + 1) % segments);
+      indices.insert(indices.end(), {a, a + segments, b, b, a + segments, b + segments});
+    }
+  }
+}
+
+/**
+* Rays from a viewpoint through each pixel of a view, in rows, as a renderer or a view analysis would cast them.
+*/
+std::vector<RayCaster::Ray> view_rays(const Point3D& eye, const Point3D& target, size_t width, size_t height) {
+  const Vector3D forward = Vector3D(target - eye).unit();
+  const Vector3D right = forward.cross(Vector3D(0.0, 0.0, 1.0)).unit();
+  const Vector3D up = right.cross(forward);
+  std::vector<RayCaster::Ray> rays;
+  rays.reserve(width * height);
+  for (size_t y=0; y < height; ++y) {
+    for (size_t x=0; x < width; ++x) {
+      const double u = (static_cast<double>(x) + 0.5) / static_cast<double>(width) - 0.5;
+      const double v = (static_cast<double>(y) + 0.5) / static_cast<double>(height) - 0.5;
+      rays.push_back(RayCaster::Ray{eye, forward + (right * u) + (up * (v * static_cast<double>(height) / static_cast<double>(width)))});
+    }
+  }
+  return rays;
+}
+
+/**
+* Reports the rays per second of casting the rays one at a time, in packets on one thread, and in packets on every hardware thread.
+*/
+template <typename Caster>
+void report_rays(const std::string& name, const Caster& caster, const std::vector<RayCaster::Ray>& rays) {
+  double ns = time_ns(1, [&]() {
+    size_t hits = 0;
+    for (const RayCaster::Ray& ray : rays) {
+      hits += !caster.cast(ray) ? 0 : 1;
+    }
+    do_not_optimize(hits);
+  });
+  report(name + ", single rays", 1e9 * static_cast<double>(rays.size()) / ns, "rays/s");
+  ns = time_ns(1, [&]() {
+    do_not_optimize(caster.cast(rays, 1));
+  });
+  report(name + ", packets, 1 thread", 1e9 * static_cast<double>(rays.size()) / ns, "rays/s");
+  ns = time_ns(1, [&]() {
+    do_not_optimize(caster.cast(rays, 0));
+  });
+  report(name + ", packets, " + std::to_string(std::thread::hardware_concurrency()) + " threads", 1e9 * static_cast<double>(rays.size()) / ns, "rays/s");
+}
+
+} // namespace
+
+
+BENCHMARK(RayCaster, SyntheticSite)
+{
+  // 2500 instances of a 20000 triangle sphere, scattered over a 10000" square site: 50 million triangles in all.
+  std::vector<Point3D> vertices;
+  std::vector<size_t> indices;
+  sphere(100, vertices, indices);
+  RayCaster caster;
+  const size_t mesh = caster.add_mesh(vertices, indices);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> jitter(-50.0, 50.0);
+  std::uniform_real_distribution<double> scale(0.5, 2.0);
+  for (size_t i=0; i < 50; ++i) {
+    for (size_t j=0; j < 50; ++j) {
+      SUTransformation t{};
+      const double s = scale(generator);
+      t.values[0] = s;
+      t.values[5] = s;
+      t.values[10] = s * scale(generator);
+      t.values[12] = (i * 200.0) + jitter(generator);
+      t.values[13] = (j * 200.0) + jitter(generator);
+      t.values[15] = 1.0;
+      caster.add_instance(mesh, Transformation(t));
+    }
+  }
+  caster.build();
+  report_rays("view of 2500 x 20000 triangles", caster, view_rays(Point3D(-2000.0, -2000.0, 1500.0), Point3D(5000.0, 5000.0, 0.0), 640, 480));
+}
+
+
+#ifdef CPP_API_MODELS_PATH
+/**
+* Casts a view of each of the bundled models, from above one corner of its bounds towards the centre.
+*/
+BENCHMARK(RayCaster, BundledModels)
+{
+  CW::initialize();
+  for (const std::string& name : {"box and box.skp", "issue-48.skp"}) {
+    Model model(std::string(CPP_API_MODELS_PATH) + "/" + name);
+    const ModelRayCaster caster(model);
+    const BoundingBox3D bounds = model.entities().bounding_box();
+    const Point3D centre = (bounds.min() + bounds.max()) / 2.0;
+    const Point3D eye = bounds.min() + (Vector3D(bounds.min() - bounds.max()) * 0.5) + Vector3D(0.0, 0.0, 2.0 * (bounds.max().z - bounds.min().z));
+    report_rays(name, caster.caster(), view_rays(eye, centre, 640, 480));
+  }
+  CW::terminate();
+}
+#endif
+
+} /* namespace CW::Benchmarks */
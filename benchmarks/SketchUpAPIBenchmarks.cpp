@@ -0,0 +1,40 @@
+// SketchUpAPIBenchmarks.cpp : Defines the entry point for the benchmark application.
+//
+// Usage: SketchUpAPIBenchmarks [filter]
+// Only benchmarks whose name contains the filter string are run.
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+namespace CW::Benchmarks {
+
+static std::vector<std::pair<std::string, BenchmarkFunction>>& registry() {
+  static std::vector<std::pair<std::string, BenchmarkFunction>> benchmarks;
+  return benchmarks;
+}
+
+BenchmarkRegistration::BenchmarkRegistration(const char* name, BenchmarkFunction function) {
+  registry().emplace_back(name, function);
+}
+
+void report(const std::string& label, double value, const std::string& unit) {
+  std::cout << "  " << std::left << std::setw(56) << label << std::right << std::setw(14) << std::fixed << std::setprecision(3) << value << " " << unit << std::endl;
+}
+
+} /* namespace CW::Benchmarks */
+
+
+int main(int argc, char **argv) {
+  std::string filter = argc > 1 ? argv[1] : "";
+  for (auto& benchmark : CW::Benchmarks::registry()) {
+    if (benchmark.first.find(filter) == std::string::npos) {
+      continue;
+    }
+    std::cout << "[ RUN      ] " << benchmark.first << std::endl;
+    benchmark.second();
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+//
+//  SketchUpAPIBenchmarks.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace CW::Benchmarks {
+
+/**
+* A benchmark is a plain function that is registered by name with the BENCHMARK macro, and reports its own measurements with report().
+*/
+using BenchmarkFunction = void (*)();
+
+struct BenchmarkRegistration {
+  BenchmarkRegistration(const char* name, BenchmarkFunction function);
+};
+
+/**
+* Prints a single measurement of the currently running benchmark.
+* @param label - description of what was measured.
+* @param value - the measured value.
+* @param unit - the unit of the measured value (e.g. "ns/point").
+*/
+void report(const std::string& label, double value, const std::string& unit);
+
+/**
+* Prevents the compiler from optimising away the computation of a value.
+*/
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if !defined(_MSC_VER) || defined(__clang__)
+  // The memory clobber also stops the compiler hoisting loop invariant work out of the timed function.
+  asm volatile("" : : "r"(&value) : "memory");
+#else
+  static const volatile void* sink;
+  sink = &value;
+  (void)sink;
+  _ReadWriteBarrier();
+#endif
+}
+
+/**
+* Runs the function the given number of times, and returns the average time taken in nanoseconds.
+* The function is run once before timing begins, to warm the caches.
+*/
+template <typename Func>
+double time_ns(size_t iterations, Func&& func) {
+  func();
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i=0; i < iterations; ++i) {
+    func();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+}
+
+} /* namespace CW::Benchmarks */
+
+#define BENCHMARK(group, name) \
+  static void group##_##name##_benchmark(); \
+  static CW::Benchmarks::BenchmarkRegistration group##_##name##_registration(#group "." #name, group##_##name##_benchmark); \
+  static void group##_##name##_benchmark()
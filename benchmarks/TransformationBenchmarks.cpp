@@ -0,0 +1,162 @@
+//
+//  TransformationBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <string>
+#include <vector>
+
+#include <SketchUpAPI/geometry/transformation.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+
+namespace CW::Benchmarks {
+
+namespace {
+
+constexpr size_t NUM_POINTS = 1000000;
+constexpr size_t NUM_ITERATIONS = 20;
+
+Transformation benchmark_transformation() {
+  Transformation rotation(Point3D(1.0, 2.0, 3.0), Vector3D(0.0, 0.0, 1.0), 0.5);
+  Transformation translation(Vector3D(10.0, 20.0, 30.0));
+  return translation * rotation;
+}
+
+std::vector<Point3D> benchmark_points() {
+  std::vector<Point3D> points;
+  points.reserve(NUM_POINTS);
+  for (size_t i=0; i < NUM_POINTS; ++i) {
+    double value = static_cast<double>(i);
+    points.push_back(Point3D(value, value * 0.5, value * 0.25));
+  }
+  return points;
+}
+
+/**
+* Returns a chain of instance transformations, as found when walking down a component hierarchy.
+*/
+std::vector<Transformation> transformation_chain(size_t depth, bool rigid) {
+  std::vector<Transformation> chain;
+  for (size_t i=0; i < depth; ++i) {
+    double value = static_cast<double>(i);
+    if (i % 3 == 0) {
+      // Many instances are only moved.
+      chain.push_back(Transformation(Vector3D(value, 1.0, -value)));
+    }
+    else if (rigid || i % 3 == 1) {
+      chain.push_back(Transformation(Point3D(value, 0.0, 1.0), Vector3D(0.0, 0.3, 1.0), 0.1 * value));
+    }
+    else {
+      chain.push_back(Transformation(1.0 + (0.1 * value), 1.0, 0.5));
+    }
+  }
+  return chain;
+}
+
+void report_chain(const std::string& name, const std::vector<Transformation>& chain) {
+  constexpr size_t NUM_CHAINS = 100000;
+  double c_api_ns = time_ns(NUM_CHAINS, [&]() {
+    SUTransformation total = chain[0];
+    for (size_t i=1; i < chain.size(); ++i) {
+      SUTransformation product;
+      SUTransformationMultiply(&total, chain[i], &product);
+      total = product;
+    }
+    SUTransformation inverse;
+    SUTransformationGetInverse(&total, &inverse);
+    do_not_optimize(inverse);
+  });
+  report(name + " SUTransformationMultiply + inverse", c_api_ns, "ns/chain");
+  double native_ns = time_ns(NUM_CHAINS, [&]() {
+    Transformation total = chain[0];
+    for (size_t i=1; i < chain.size(); ++i) {
+      total = total * chain[i];
+    }
+    Transformation inverse = total.inverse();
+    do_not_optimize(inverse);
+  });
+  report(name + " Transformation::operator* + inverse", native_ns, "ns/chain");
+}
+
+} // namespace
+
+
+BENCHMARK(Transformation, TransformPoints)
+{
+  const Transformation transformation = benchmark_transformation();
+  std::vector<Point3D> points = benchmark_points();
+  double per_point_ns = time_ns(NUM_ITERATIONS, [&]() {
+    for (size_t i=0; i < points.size(); ++i) {
+      points[i] = transformation * points[i];
+    }
+    do_not_optimize(points.back());
+  });
+  report("operator* per point (SUPoint3DTransform)", per_point_ns / NUM_POINTS, "ns/point");
+  double batch_ns = time_ns(NUM_ITERATIONS, [&]() {
+    transformation.transform_points(points);
+    do_not_optimize(points.back());
+  });
+  report("transform_points", batch_ns / NUM_POINTS, "ns/point");
+}
+
+
+BENCHMARK(Transformation, TransformVectors)
+{
+  const Transformation transformation = benchmark_transformation();
+  std::vector<Point3D> points = benchmark_points();
+  std::vector<Vector3D> vectors(points.begin(), points.end());
+  double per_vector_ns = time_ns(NUM_ITERATIONS, [&]() {
+    for (size_t i=0; i < vectors.size(); ++i) {
+      vectors[i] = transformation * vectors[i];
+    }
+    do_not_optimize(vectors.back());
+  });
+  report("operator* per vector (SUVector3DTransform)", per_vector_ns / NUM_POINTS, "ns/vector");
+  double batch_ns = time_ns(NUM_ITERATIONS, [&]() {
+    transformation.transform_vectors(vectors);
+    do_not_optimize(vectors.back());
+  });
+  report("transform_vectors", batch_ns / NUM_POINTS, "ns/vector");
+  double normals_ns = time_ns(NUM_ITERATIONS, [&]() {
+    transformation.transform_normals(vectors);
+    do_not_optimize(vectors.back());
+  });
+  report("transform_normals", normals_ns / NUM_POINTS, "ns/vector");
+}
+
+
+BENCHMARK(Transformation, CompositionChain)
+{
+  for (size_t depth : {10, 20}) {
+    report_chain("rigid depth " + std::to_string(depth), transformation_chain(depth, true));
+    report_chain("scaled depth " + std::to_string(depth), transformation_chain(depth, false));
+  }
+}
+
+} /* namespace CW::Benchmarks */
@@ -0,0 +1,188 @@
+//
+//  TriangulatorBenchmarks.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SketchUpAPIBenchmarks.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Triangulator.hpp"
+
+#ifdef CPP_API_MODELS_PATH
+#include "SUAPI-CppWrapper/Initialize.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/GeometryInput.hpp"
+#include "SUAPI-CppWrapper/model/LoopInput.hpp"
+#include "SUAPI-CppWrapper/model/MeshHelper.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+#endif
+
+namespace CW::Benchmarks {
+
+namespace {
+
+constexpr double BAY_WIDTH = 100.0;
+constexpr double STOREY_HEIGHT = 120.0;
+
+/**
+* The outer loop and window openings of a façade in the xz plane, offset along y, with a window in each bay of each storey.
+*/
+void facade_loops(size_t bays, size_t storeys, double y, std::vector<Point3D>& outer_loop, std::vector<std::vector<Point3D>>& inner_loops) {
+  const double width = bays * BAY_WIDTH;
+  const double height = storeys * STOREY_HEIGHT;
+  outer_loop = {Point3D(0.0, y, 0.0), Point3D(width, y, 0.0), Point3D(width, y, height), Point3D(0.0, y, height)};
+  inner_loops.clear();
+  for (size_t i=0; i < bays; ++i) {
+    for (size_t j=0; j < storeys; ++j) {
+      const double x = (i * BAY_WIDTH) + 30.0;
+      const double z = (j * STOREY_HEIGHT) + 30.0;
+      inner_loops.push_back({Point3D(x, y, z), Point3D(x, y, z + 60.0), Point3D(x + 40.0, y, z + 60.0), Point3D(x + 40.0, y, z)});
+    }
+  }
+}
+
+size_t num_triangles(const std::vector<std::vector<size_t>>& results) {
+  size_t count = 0;
+  for (const std::vector<size_t>& indices : results) {
+    count += indices.size() / 3;
+  }
+  return count;
+}
+
+} // namespace
+
+
+BENCHMARK(Triangulator, SyntheticFacades)
+{
+  // 200 façades of 40 bays and 20 storeys: 800 windows and 3204 vertices each.
+  std::vector<Triangulator::Polygon> polygons;
+  std::vector<Point3D> outer_loop;
+  std::vector<std::vector<Point3D>> inner_loops;
+  for (size_t i=0; i < 200; ++i) {
+    facade_loops(40, 20, i * 10.0, outer_loop, inner_loops);
+    polygons.push_back(Triangulator::Polygon(outer_loop, inner_loops));
+  }
+  size_t triangles = 0;
+  double ns = time_ns(3, [&]() {
+    Triangulator triangulator;
+    std::vector<size_t> indices;
+    triangles = 0;
+    for (const Triangulator::Polygon& polygon : polygons) {
+      indices.clear();
+      triangulator.triangulate(polygon, indices);
+      triangles += indices.size() / 3;
+    }
+    do_not_optimize(triangles);
+  });
+  report("200 facades of 800 windows, 1 thread", ns / 1e6, "ms");
+  report("200 facades of 800 windows, 1 thread", 1e9 * static_cast<double>(triangles) / ns, "triangles/s");
+  ns = time_ns(3, [&]() {
+    do_not_optimize(num_triangles(Triangulator::triangulate(polygons, 0)));
+  });
+  report("200 facades of 800 windows, " + std::to_string(std::thread::hardware_concurrency()) + " threads", ns / 1e6, "ms");
+
+  // A single large façade, where the z-order index matters most.
+  facade_loops(200, 50, 0.0, outer_loop, inner_loops);
+  const Triangulator::Polygon large(outer_loop, inner_loops);
+  ns = time_ns(3, [&]() {
+    Triangulator triangulator;
+    do_not_optimize(triangulator.triangulate(large).size());
+  });
+  report("1 facade of 10000 windows", ns / 1e6, "ms");
+}
+
+
+#ifdef CPP_API_MODELS_PATH
+/**
+* Tessellates the faces of a model of façades with MeshHelper, and with Triangulator on one and on every hardware thread.  The times with Triangulator include fetching the loops of the faces.
+*/
+BENCHMARK(Triangulator, FacadesModel)
+{
+  CW::initialize();
+  {
+    Model model;
+    GeometryInput geom_input;
+    std::vector<Point3D> outer_loop;
+    std::vector<std::vector<Point3D>> inner_loops;
+    for (size_t i=0; i < 50; ++i) {
+      facade_loops(20, 10, i * 200.0, outer_loop, inner_loops);
+      LoopInput outer_input;
+      for (const Point3D& point : outer_loop) {
+        outer_input.add_vertex_index(geom_input.add_vertex(point));
+      }
+      const size_t face_index = geom_input.add_face(outer_input);
+      for (const std::vector<Point3D>& inner_loop : inner_loops) {
+        LoopInput inner_input;
+        for (const Point3D& point : inner_loop) {
+          inner_input.add_vertex_index(geom_input.add_vertex(point));
+        }
+        geom_input.face_add_inner_loop(face_index, inner_input);
+      }
+    }
+    Entities entities = model.entities();
+    entities.fill(geom_input);
+    const std::vector<Face> faces = entities.faces();
+    report("faces", static_cast<double>(faces.size()), "faces");
+
+    double ns = time_ns(3, [&]() {
+      size_t triangles = 0;
+      for (const Face& face : faces) {
+        MeshHelper mesh(face);
+        triangles += mesh.vertex_indices().size() / 3;
+        do_not_optimize(mesh.vertices().size());
+      }
+      do_not_optimize(triangles);
+    });
+    report("MeshHelper", ns / 1e6, "ms");
+    ns = time_ns(3, [&]() {
+      Triangulator triangulator;
+      size_t triangles = 0;
+      for (const Face& face : faces) {
+        triangles += triangulator.triangulate(Triangulator::Polygon(face)).size() / 3;
+      }
+      do_not_optimize(triangles);
+    });
+    report("Triangulator, 1 thread", ns / 1e6, "ms");
+    ns = time_ns(3, [&]() {
+      std::vector<Triangulator::Polygon> polygons;
+      polygons.reserve(faces.size());
+      for (const Face& face : faces) {
+        polygons.push_back(Triangulator::Polygon(face));
+      }
+      do_not_optimize(num_triangles(Triangulator::triangulate(polygons, 0)));
+    });
+    report("Triangulator, " + std::to_string(std::thread::hardware_concurrency()) + " threads", ns / 1e6, "ms");
+  }
+  CW::terminate();
+}
+#endif
+
+} /* namespace CW::Benchmarks */
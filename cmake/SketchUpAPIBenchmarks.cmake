@@ -0,0 +1,32 @@
+message(STATUS "================= SketchUp API C++ Wrapper Benchmarks =================")
+set(CPP_API_BENCHMARKS_PATH "${PROJECT_SOURCE_DIR}/benchmarks")
+
+file(GLOB_RECURSE BENCHMARKS_HEADERS ${CPP_API_BENCHMARKS_PATH}/*.hpp)
+file(GLOB_RECURSE BENCHMARKS_SOURCES ${CPP_API_BENCHMARKS_PATH}/*.cpp)
+
+add_executable(SketchUpAPIBenchmarks ${BENCHMARKS_HEADERS} ${BENCHMARKS_SOURCES})
+
+target_include_directories(SketchUpAPIBenchmarks PRIVATE "${CPP_API_BENCHMARKS_PATH}")
+target_link_libraries(SketchUpAPIBenchmarks ${TEST_LIBRARY_NAME} ${SLAPI_LIB})
+
+# Benchmarks are only meaningful with optimisations enabled, regardless of the
+# project's build type. Note that the sanitizer used by the tests is not enabled.
+# Assertions are disabled as the geometry arithmetic is inlined from the headers.
+if ( MSVC )
+  target_compile_options(SketchUpAPIBenchmarks PRIVATE /O2)
+else()
+  target_compile_options(SketchUpAPIBenchmarks PRIVATE -O2)
+endif()
+target_compile_definitions(SketchUpAPIBenchmarks PRIVATE NDEBUG)
+# The ray casting benchmarks also load the bundled models.
+target_compile_definitions(SketchUpAPIBenchmarks PRIVATE CPP_API_MODELS_PATH="${PROJECT_SOURCE_DIR}/models")
+
+source_group(
+  "Benchmarks"
+  REGULAR_EXPRESSION "${CPP_API_BENCHMARKS_PATH}/[^\//]+Benchmarks.cpp"
+)
+# Force the CPP file that define `main` to not appear in the Benchmarks list.
+source_group(
+  "Source Files"
+  FILES "${CPP_API_BENCHMARKS_PATH}/SketchUpAPIBenchmarks.cpp"
+)
@@ -45,6 +45,11 @@ target_link_libraries(${TEST_LIBRARY_NAME} PUBLIC
   SketchUp::SketchUpAPI
 )
 
+# RayCaster casts batches of rays on several threads.
+find_package(Threads REQUIRED)
+target_link_libraries(${LIBRARY_NAME} PUBLIC Threads::Threads)
+target_link_libraries(${TEST_LIBRARY_NAME} PUBLIC Threads::Threads)
+
 # The projects include paths:
 target_include_directories(${LIBRARY_NAME} PUBLIC ${CMAKE_CURRENT_LIST_DIR})
 target_include_directories(${TEST_LIBRARY_NAME} PUBLIC ${CMAKE_CURRENT_LIST_DIR})
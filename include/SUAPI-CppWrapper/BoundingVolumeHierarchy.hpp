@@ -0,0 +1,160 @@
+//
+//  BoundingVolumeHierarchy.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef BoundingVolumeHierarchy_hpp
+#define BoundingVolumeHierarchy_hpp
+
+#include <cstddef>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+namespace CW {
+
+/**
+* A bounding volume hierarchy over a set of axis aligned boxes, for finding the boxes that meet a query volume without testing every one.
+*
+* The hierarchy is built once with a binned surface area heuristic.  When the boxes move, refit() updates the bounds of the nodes without changing the tree, which is much cheaper than building it again, although the tree becomes less efficient if the boxes move far from where they were when it was built.
+*
+* Items are referred to by their index in the vector of boxes given to the constructor.  The hierarchy does not keep the boxes themselves.
+*/
+class BoundingVolumeHierarchy {
+  public:
+  /**
+  * A node of the tree.  The children of an interior node are always stored together, after their parent.
+  */
+  struct Node {
+    SUBoundingBox3D bounds;
+    size_t first; // for a leaf, the position of its first item in items(); for an interior node, the index of its first child
+    size_t count; // the number of items in a leaf, or zero for an interior node
+  };
+
+  constexpr static size_t DEFAULT_LEAF_SIZE = 4;
+
+  private:
+  std::vector<Node> m_nodes;
+  std::vector<size_t> m_parents;
+  std::vector<size_t> m_items;
+  std::vector<size_t> m_item_leaves;
+
+  /**
+  * Sets the bounds of a node from its items or children.  Returns true if the bounds changed.
+  */
+  bool update_bounds(size_t node, const std::vector<SUBoundingBox3D>& boxes);
+
+  public:
+  BoundingVolumeHierarchy();
+
+  /**
+  * Builds the hierarchy over the boxes.
+  * @param boxes - the bounds of each item.  Boxes with a minimum point greater than their maximum point are never returned by queries.
+  * @param leaf_size - the number of items below which a node is not split further.
+  */
+  BoundingVolumeHierarchy(const std::vector<SUBoundingBox3D>& boxes, size_t leaf_size = DEFAULT_LEAF_SIZE);
+
+  /**
+  * Updates the bounds of every node after the boxes have changed.  The number of boxes must be the same as when the hierarchy was built.
+  */
+  void refit(const std::vector<SUBoundingBox3D>& boxes);
+
+  /**
+  * Updates the bounds of the nodes containing the changed items, and their ancestors.  The other boxes must not have changed since the last refit.
+  * @param boxes - the bounds of every item.
+  * @param changed_items - the indices of the items whose boxes changed.
+  */
+  void refit(const std::vector<SUBoundingBox3D>& boxes, const std::vector<size_t>& changed_items);
+
+  /**
+  * Visits the items in every leaf reached by descending through the nodes which pass the test.
+  * @param node_test - called with the bounds of a node (as a const SUBoundingBox3D&), returns false if none of the node's items can be of interest.
+  * @param visit - called with the index of each item in the leaves reached.  The caller should test the item's own box if necessary, as only the leaf's bounds have been tested.
+  */
+  template <typename NodeTest, typename ItemVisitor>
+  void traverse(NodeTest&& node_test, ItemVisitor&& visit) const;
+
+  /**
+  * Returns the number of items in the hierarchy.
+  */
+  size_t size() const;
+
+  bool empty() const;
+
+  /**
+  * Returns the nodes of the tree, with the root first.
+  */
+  const std::vector<Node>& nodes() const;
+
+  /**
+  * Returns the item indices, ordered so that the items of each leaf are together.
+  */
+  const std::vector<size_t>& items() const;
+
+  /**
+  * Returns true if the boxes overlap.  Boxes that touch are treated as overlapping.
+  */
+  static bool overlaps(const SUBoundingBox3D& a, const SUBoundingBox3D& b);
+
+  /**
+  * Enlarges the box to contain the other box.
+  */
+  static void expand(SUBoundingBox3D& box, const SUBoundingBox3D& other);
+
+  /**
+  * Returns a box containing nothing, which becomes the other box when expanded by it.
+  */
+  static SUBoundingBox3D empty_box();
+};
+
+
+template <typename NodeTest, typename ItemVisitor>
+void BoundingVolumeHierarchy::traverse(NodeTest&& node_test, ItemVisitor&& visit) const {
+  if (m_nodes.empty()) {
+    return;
+  }
+  std::vector<size_t> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty()) {
+    const Node& node = m_nodes[stack.back()];
+    stack.pop_back();
+    if (!node_test(node.bounds)) {
+      continue;
+    }
+    if (node.count == 0) {
+      stack.push_back(node.first + 1);
+      stack.push_back(node.first);
+      continue;
+    }
+    for (size_t i=node.first; i < node.first + node.count; ++i) {
+      visit(m_items[i]);
+    }
+  }
+}
+
+} /* namespace CW */
+#endif /* BoundingVolumeHierarchy_hpp */
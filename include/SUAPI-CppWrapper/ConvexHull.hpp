@@ -0,0 +1,154 @@
+//
+//  ConvexHull.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ConvexHull_hpp
+#define ConvexHull_hpp
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class GeometryInput;
+class Transformation;
+
+/**
+* A box that need not be aligned with the axes, given by its centre, three orthonormal axes and its half sizes along them.  Unlike BoundingBox3D, it can fit tightly around rotated geometry.
+*/
+struct OrientedBoundingBox {
+  Point3D centre;
+  std::array<Vector3D, 3> axes;
+  std::array<double, 3> half_sizes;
+
+  /**
+  * Constructs an empty box at the origin, aligned with the axes.
+  */
+  OrientedBoundingBox();
+
+  double volume() const;
+
+  /**
+  * Returns the corners of the box.  Corner i is on the positive side of axis j where bit j of i is set.
+  */
+  std::array<Point3D, 8> corners() const;
+
+  /**
+  * Adds the faces of the box to a GeometryInput object.  A box with no thickness is added as a single face, and a box with no area adds nothing.
+  * @return the number of faces added.
+  */
+  size_t add_to(GeometryInput& geom_input) const;
+};
+
+/**
+* The convex hull of a set of points, as a closed triangle mesh with its triangles counter-clockwise when viewed from outside.
+*
+* Hulls are built with the quickhull algorithm.  Points within a small tolerance, relative to the size of the points, of a face of the hull are taken to be on it.  The hull of coplanar points is flat, with triangles facing both ways, and the hull of collinear points has two vertices and no triangles.
+*
+* As no SketchUp API functions are called, hulls can be built on any thread (@see ConvexHullCache for the hulls of definitions).
+*/
+class ConvexHull {
+  public:
+  /**
+  * Options for decompose().
+  */
+  struct DecompositionOptions {
+    size_t resolution = 32; // the number of voxels along the longest side of the geometry
+    double max_concavity = 0.02; // the volume of a hull not filled by the geometry, as a fraction of the geometry's volume, below which the hull is not split
+    size_t max_hulls = 16;
+
+    DecompositionOptions();
+  };
+
+  private:
+  std::vector<Point3D> m_vertices;
+  std::vector<size_t> m_indices;
+
+  public:
+  /**
+  * Constructs an empty hull.
+  */
+  ConvexHull();
+
+  /**
+  * Builds the hull of the points.
+  */
+  explicit ConvexHull(const std::vector<Point3D>& points);
+
+  /**
+  * Returns the vertices of the hull, each of which is one of the points.
+  */
+  const std::vector<Point3D>& vertices() const;
+
+  /**
+  * Returns three vertex indices for each triangle of the hull.
+  */
+  const std::vector<size_t>& indices() const;
+
+  /**
+  * Returns true if the hull has no vertices.
+  */
+  bool empty() const;
+
+  double volume() const;
+
+  /**
+  * Returns true if the point is inside the hull, or within SketchUp's tolerance of its surface.  A hull with no triangles contains no points.
+  */
+  bool contains(const Point3D& point) const;
+
+  /**
+  * Returns the hull of the transformed vertices, which is the transformed hull.
+  */
+  ConvexHull transformed(const Transformation& transformation) const;
+
+  /**
+  * Returns an oriented box around the hull, of least volume among the boxes with a face parallel to a face of the hull.  This is the least volume box in most cases, and otherwise close to it.
+  */
+  OrientedBoundingBox oriented_bounding_box() const;
+
+  /**
+  * Adds the hull to a GeometryInput object, merging coplanar triangles into a face for each side of the hull.
+  * @return the number of faces added.
+  */
+  size_t add_to(GeometryInput& geom_input) const;
+
+  /**
+  * Approximates a closed triangle mesh by a set of convex hulls, as for collision proxies.
+  *
+  * The mesh is voxelized, and its voxels are split by planes until the hull of each part fills its voxels closely enough, or there are options.max_hulls parts.  The hull of each part is then built from the mesh clipped to the part, so that the hulls fit the mesh rather than its voxels.  Meshes that are not closed are treated as hollow shells.
+  * @param vertices - the vertices of the mesh.
+  * @param indices - three vertex indices for each triangle.
+  */
+  static std::vector<ConvexHull> decompose(const std::vector<Point3D>& vertices, const std::vector<size_t>& indices, const DecompositionOptions& options = DecompositionOptions());
+};
+
+} /* namespace CW */
+#endif /* ConvexHull_hpp */
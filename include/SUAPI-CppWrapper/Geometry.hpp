@@ -35,8 +35,14 @@
 #define Geometry_h
 
 #include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <vector>
 #include <ostream>
+#include <stdexcept>
+#include <type_traits>
 
 #include <SketchUpAPI/geometry.h>
 #include <SketchUpAPI/model/edge.h>
@@ -101,11 +107,38 @@ public:
    bool closest(const Radians& value);
 };
 
+/**
+* Tolerance policies used by the geometry comparisons.  The policy is a template parameter, so the choice between exact and tolerance-aware comparisons is made at compile time.
+*
+* A policy provides EPSILON, and is_zero(value), which returns true if the difference between two values should be treated as zero.
+*/
+struct SketchUpTolerance {
+  constexpr static double EPSILON = 0.0005; // Sketchup Tolerance is 1/1000"
+
+  constexpr static bool is_zero(double value) noexcept {
+    return value < EPSILON && value > -EPSILON;
+  }
+};
+
+/**
+* Compares values exactly.  Useful for fast paths where the values are known to come from the same calculation.
+*/
+struct ExactTolerance {
+  constexpr static double EPSILON = 0.0;
+
+  constexpr static bool is_zero(double value) noexcept {
+    return value == 0.0;
+  }
+};
+
 class Point3D;
 
 /*
 * Vector3D class is analagous to SUVector3D struct, and holds the same member variables.
 *
+* Vector3D has the same memory layout as SUVector3D (three contiguous doubles), and is trivially copyable, so arrays of Vector3D objects can be passed directly to C API functions expecting SUVector3D arrays.
+* Null vectors are represented by NaN coordinates, so no extra storage is needed for the validity flag.
+*
 * Class methods are included to allow easy vector mathematics.
 * Initialisation:
 * - Vector3D(SUVector3D vec)
@@ -113,27 +146,23 @@ class Point3D;
 */
 class Vector3D {
 
-  protected:
-  SUVector3D m_vector;
-  bool is_null = false; // Invalid flag
-
   public:
-  double &x;
-  double &y;
-  double &z;
-  constexpr static double EPSILON = 0.0005; // Sketchup Tolerance is 1/1000"
+  double x;
+  double y;
+  double z;
+  constexpr static double EPSILON = SketchUpTolerance::EPSILON;
 
-  Vector3D();
+  constexpr Vector3D() noexcept;
   /**
   * SUVector3D objects are easily converted to Vector3D without data loss
   */
-  Vector3D( SUVector3D su_vector);
-  Vector3D( double x, double y, double z);
+  constexpr Vector3D( SUVector3D su_vector) noexcept;
+  constexpr Vector3D( double x, double y, double z) noexcept;
 
   /**
   * Invaid, or NULL Vector3D objects can be simulated with this constructor.
   */
-  Vector3D(bool valid);
+  constexpr Vector3D(bool valid) noexcept;
 
   /**
   * Returns the vector between start and end points of an edge.
@@ -143,75 +172,96 @@ class Vector3D {
   /**
   * Allow conversion from Point3D.
   */
-  explicit Vector3D( const Point3D& point);
+  constexpr explicit Vector3D( const Point3D& point) noexcept;
 
   /**
   * Cast to SUVector3D object
   */
-  operator SUVector3D() const;
+  constexpr operator SUVector3D() const noexcept;
 
   /**
   * Pointer to internal SUVector3D object
   */
-  operator const SUVector3D*() const;
+  operator const SUVector3D*() const noexcept;
 
   /**
   * Cast to Point3D object
   */
-  operator Point3D() const;
+  constexpr operator Point3D() const noexcept;
 
   /**
-  * Copy constructor
+  * Assignment from SUVector3D struct
   */
-  Vector3D(const Vector3D &vector);
+  constexpr Vector3D &operator=(const SUVector3D &vector) noexcept;
 
   /**
-  * Copy assignment operator
+  * Arithmetic operator overloads
   */
-  Vector3D &operator=(const Vector3D &vector);
-  Vector3D &operator=(const SUVector3D &vector);
+  constexpr Vector3D operator+(const Vector3D &vector) const noexcept;
+  constexpr Vector3D operator+(const SUVector3D &vector) const noexcept {return *this + Vector3D(vector);}
+  friend constexpr Point3D operator+(const Vector3D &lhs, const Point3D& rhs) noexcept;
+
+  constexpr Vector3D operator-() const noexcept;
+  constexpr Vector3D operator-(const Vector3D &vector) const noexcept;
+  constexpr Vector3D operator-(const SUVector3D &vector) const noexcept {return *this - Vector3D(vector);}
+  constexpr Vector3D operator*(const double &scalar) const noexcept;
 
   /**
-  * Arithmetic operator overloads
+  * @throws std::invalid_argument if the scalar is smaller than EPSILON.
   */
-  Vector3D operator+(const Vector3D &vector) const;
-  Vector3D operator+(const SUVector3D &vector) const {return *this + Vector3D(vector);}
-  friend Point3D operator+(const Vector3D &lhs, const Point3D& rhs);
-
-  Vector3D operator-() const;
-  Vector3D operator-(const Vector3D &vector) const;
-  Vector3D operator-(const SUVector3D &vector) const {return *this - Vector3D(vector);}
-  Vector3D operator*(const double &scalar) const;
-  Vector3D operator/(const double &scalar) const;
+  constexpr Vector3D operator/(const double &scalar) const;
 
   /**
   * Allows the multiplication operator to be on the other side of the vector.
   */
-  friend Vector3D operator*(const double &lhs, const Vector3D &rhs);
+  friend constexpr Vector3D operator*(const double &lhs, const Vector3D &rhs) noexcept;
 
   /**
-  * Comparator operator overloads
+  * Comparator operator overloads.  Coordinates are compared within SketchUp's tolerance.
   */
-  friend bool operator==(const Vector3D& lhs, const Vector3D& rhs);
+  friend constexpr bool operator==(const Vector3D& lhs, const Vector3D& rhs) noexcept;
+
+  friend constexpr bool operator!=(const Vector3D& lhs, const Vector3D& rhs) noexcept;
 
-  friend bool operator!=(const Vector3D& lhs, const Vector3D& rhs);
+  /**
+  * Compares the vector with another using the given tolerance policy (SketchUpTolerance or ExactTolerance).  Two null vectors are equal.
+  */
+  template <typename Tolerance = SketchUpTolerance>
+  constexpr bool equals(const Vector3D& other) const noexcept;
+
+  /**
+  * Returns true if the vector has zero length, using the given tolerance policy for each coordinate.
+  */
+  template <typename Tolerance = SketchUpTolerance>
+  constexpr bool is_zero() const noexcept;
 
   /**
   * Validty check
   */
-  bool operator!() const;
+  constexpr bool operator!() const noexcept;
 
 
   /**
   * Returns the length of the vector
   */
-  double length() const;
+  double length() const noexcept;
+
+  /**
+  * Returns the square of the length of the vector, which avoids the square root when only comparing lengths.
+  */
+  constexpr double squared_length() const noexcept;
 
   /**
   * Returns the unit vector
+  * @throws std::invalid_argument if the vector has zero length.
   */
   Vector3D unit() const;
 
+  /**
+  * Returns the unit vector, or a zero vector if the vector has zero length.  Unlike unit(), no tolerance is applied, so vectors shorter than SketchUp's tolerance (such as the normals of small faces, whose length scales with their area) are still normalised.
+  */
+  Vector3D normalized() const noexcept;
+
   /**
   * Returns the angle between this vector and that of another.
   */
@@ -220,13 +270,13 @@ class Vector3D {
   /**
   * Returns dot product with another vector
   */
-  double dot(const Vector3D& vector2) const;
-  double dot(const Point3D& point) const;
+  constexpr double dot(const Vector3D& vector2) const noexcept;
+  constexpr double dot(const Point3D& point) const noexcept;
 
   /**
   * Returns cross product with another vector
   */
-  Vector3D cross(const Vector3D& vector2) const;
+  constexpr Vector3D cross(const Vector3D& vector2) const noexcept;
 
   enum class Colinearity {
     UNDEFINED,
@@ -249,7 +299,7 @@ class Vector3D {
   /**
   * Returns a valid vector that has zero length.
   */
-  static Vector3D zero_vector();
+  constexpr static Vector3D zero_vector() noexcept;
 
   /**
    * @brief custom iostream output for printing Vector3D objects
@@ -267,44 +317,40 @@ class Vector3D {
 /**
 * Point3D class is analagous to SUPoint3D struct, and holds the same variables.
 *
-* Class methods are given to allow easy vector mathematics.
+* Point3D has the same memory layout as SUPoint3D (three contiguous doubles), and is trivially copyable, so a std::vector<Point3D> can be passed directly to C API functions expecting SUPoint3D arrays.
+* Null points are represented by NaN coordinates, so no extra storage is needed for the validity flag.
 *
-* Point3D inherits from Vector3D, as the concept of a point and a vector is interchangeable in vector mathematics.
+* Class methods are given to allow easy vector mathematics.
 */
 class Point3D {
-  private:
-  SUPoint3D m_point;
-  bool is_null = false; // Invalid flag
-  //constexpr static double EPSILON = 0.001; // Sketchup Tolerance is 1/1000"
-
   public:
-  constexpr static double EPSILON = 0.0005; // Sketchup Tolerance is 1/1000"
-  double &x;
-  double &y;
-  double &z;
+  constexpr static double EPSILON = SketchUpTolerance::EPSILON;
+  double x;
+  double y;
+  double z;
 
   /**
   * Invaid, or NULL Point3D objects can be simulated with this constructor.
   */
-  Point3D();
+  constexpr Point3D() noexcept;
 
   /**
   * Constructs a NULL object, or a point with zero values as coordinates.
   * @param valid - true for an object with zero values, or false for a null object.
   */
-  Point3D(bool valid);
+  constexpr Point3D(bool valid) noexcept;
 
   /**
   * Constructs a Point3D object from a SUPoint3D object.
   * @param su_point - SUPoint3D object to be wrapped in this object.
   */
-  Point3D(SUPoint3D su_point);
+  constexpr Point3D(SUPoint3D su_point) noexcept;
 
   /**
   * Constructs a Point3D object from a SUVector3D object.
   * @param su_vector - SUVector3D object to be converted to this object.
   */
-  Point3D(SUVector3D su_vector);
+  constexpr Point3D(SUVector3D su_vector) noexcept;
 
   /**
   * Constructs a Point3D object from given x y z coordinates.
@@ -312,53 +358,53 @@ class Point3D {
   * @param y - the Y coordinate of the point.
   * @param z - the Z coordinate of the point.
   */
-  Point3D(double x, double y, double z);
+  constexpr Point3D(double x, double y, double z) noexcept;
 
   /**
-  * Copy Constructor
+  * Allows conversion from Vector3D
   */
-  Point3D(const Point3D& other);
+  constexpr explicit Point3D( const Vector3D& vector) noexcept;
 
   /**
-  * Allows conversion from Vector3D
+  * Cast to SUPoint3D struct
   */
-  explicit Point3D( const Vector3D& vector);
+  constexpr operator SUPoint3D() const noexcept;
+  operator const SUPoint3D*() const noexcept;
 
   /**
-  * Copy assignment operator
+  * Cast to Vector3D
   */
-  Point3D &operator=(const Point3D &point);
+  constexpr operator Vector3D() const noexcept;
 
   /**
-  * Cast to SUPoint3D struct
+  * Arithmetic operator overloads
   */
-  operator SUPoint3D() const;
-  operator const SUPoint3D*() const;
+  constexpr Point3D operator+(const Point3D &point) const noexcept;
+  constexpr Point3D operator+(const Vector3D &vector) const noexcept;
+  constexpr Point3D operator+(const SUPoint3D &point) const noexcept;
+  constexpr Vector3D operator-(const Point3D &point) const noexcept;
+  constexpr Point3D operator-(const Vector3D &vector) const noexcept;
+  constexpr Point3D operator-(const SUPoint3D &point) const noexcept;
+  constexpr Point3D operator*(const double &scalar) const noexcept;
 
   /**
-  * Cast to Vector3D
+  * @throws std::invalid_argument if the scalar is smaller than EPSILON.
   */
-  operator Vector3D() const;
+  constexpr Point3D operator/(const double &scalar) const;
 
   /**
-  * Arithmetic operator overloads
+  * Comparative operators.  Coordinates are compared within SketchUp's tolerance.
   */
-  Point3D operator+(const Point3D &point) const;
-  Point3D operator+(const Vector3D &vector) const;
-  Point3D operator+(const SUPoint3D &point) const;
-  Vector3D operator-(const Point3D &point) const;
-  Point3D operator-(const Vector3D &vector) const;
-  Point3D operator-(const SUPoint3D &point) const;
-  Point3D operator*(const double &scalar) const;
-  Point3D operator/(const double &scalar) const;
+  constexpr bool operator!() const noexcept;
+
+  friend constexpr bool operator==(const Point3D& lhs, const Point3D& rhs) noexcept;
+  friend constexpr bool operator!=(const Point3D& lhs, const Point3D& rhs) noexcept;
 
   /**
-  * Comparative operators
+  * Compares the point with another using the given tolerance policy (SketchUpTolerance or ExactTolerance).  Two null points are equal.
   */
-  bool operator!() const;
-
-  friend bool operator==(const Point3D& lhs, const Point3D& rhs);
-  friend bool operator!=(const Point3D& lhs, const Point3D& rhs);
+  template <typename Tolerance = SketchUpTolerance>
+  constexpr bool equals(const Point3D& other) const noexcept;
 
 
   /**
@@ -389,6 +435,282 @@ class Point3D {
 
 };
 
+// Point3D and Vector3D are passed to the C API in place of SUPoint3D and SUVector3D arrays, so their layouts must match exactly.
+static_assert(std::is_standard_layout<Point3D>::value && std::is_trivially_copyable<Point3D>::value, "Point3D must be a plain value type");
+static_assert(sizeof(Point3D) == sizeof(SUPoint3D) && alignof(Point3D) == alignof(SUPoint3D), "Point3D must have the same layout as SUPoint3D");
+static_assert(offsetof(Point3D, x) == offsetof(SUPoint3D, x) && offsetof(Point3D, y) == offsetof(SUPoint3D, y) && offsetof(Point3D, z) == offsetof(SUPoint3D, z), "Point3D must have the same layout as SUPoint3D");
+static_assert(std::is_standard_layout<Vector3D>::value && std::is_trivially_copyable<Vector3D>::value, "Vector3D must be a plain value type");
+static_assert(sizeof(Vector3D) == sizeof(SUVector3D) && alignof(Vector3D) == alignof(SUVector3D), "Vector3D must have the same layout as SUVector3D");
+static_assert(offsetof(Vector3D, x) == offsetof(SUVector3D, x) && offsetof(Vector3D, y) == offsetof(SUVector3D, y) && offsetof(Vector3D, z) == offsetof(SUVector3D, z), "Vector3D must have the same layout as SUVector3D");
+
+
+/********
+* Vector3D and Point3D inline definitions.  These are kept in the header so that the arithmetic can be inlined into loops over large numbers of points.
+*********/
+
+constexpr Vector3D::Vector3D() noexcept:
+  Vector3D(false)
+{}
+
+constexpr Vector3D::Vector3D(SUVector3D su_vector) noexcept:
+  x(su_vector.x),
+  y(su_vector.y),
+  z(su_vector.z)
+{}
+
+constexpr Vector3D::Vector3D( double x, double y, double z) noexcept:
+  x(x),
+  y(y),
+  z(z)
+{}
+
+constexpr Vector3D::Vector3D(bool valid) noexcept:
+  x(valid ? 0.0 : std::numeric_limits<double>::quiet_NaN()),
+  y(valid ? 0.0 : std::numeric_limits<double>::quiet_NaN()),
+  z(valid ? 0.0 : std::numeric_limits<double>::quiet_NaN())
+{}
+
+constexpr Vector3D::Vector3D(const Point3D& point) noexcept:
+  Vector3D(point.x, point.y, point.z)
+{}
+
+constexpr Vector3D& Vector3D::operator=(const SUVector3D &vector) noexcept {
+  x = vector.x;
+  y = vector.y;
+  z = vector.z;
+  return *this;
+}
+
+constexpr Vector3D::operator SUVector3D() const noexcept {
+  assert(!!(*this));
+  return SUVector3D{x, y, z};
+}
+
+inline Vector3D::operator const SUVector3D*() const noexcept {
+  assert(!!(*this));
+  // Vector3D is layout compatible with SUVector3D (see static assertions above)
+  return reinterpret_cast<const SUVector3D*>(this);
+}
+
+constexpr Vector3D::operator Point3D() const noexcept {
+  // Null vectors have NaN coordinates, so the resulting point will also be null
+  return Point3D(x, y, z);
+}
+
+constexpr Vector3D Vector3D::operator+(const Vector3D &vector) const noexcept {
+  assert(!!vector && !!(*this));
+  return Vector3D(x + vector.x, y + vector.y, z + vector.z);
+}
+
+constexpr Vector3D Vector3D::operator-() const noexcept {
+  return Vector3D(-x, -y, -z);
+}
+
+constexpr Vector3D Vector3D::operator-(const Vector3D &vector) const noexcept {
+  assert(!!vector && !!(*this));
+  return Vector3D(x - vector.x, y - vector.y, z - vector.z);
+}
+
+constexpr Vector3D Vector3D::operator*(const double &scalar) const noexcept {
+  assert(!!(*this));
+  return Vector3D( x * scalar, y * scalar, z * scalar);
+}
+
+constexpr Vector3D Vector3D::operator/(const double &scalar) const {
+  assert(!!(*this));
+  if (SketchUpTolerance::is_zero(scalar)) {
+    throw std::invalid_argument("CW::Vector3D::operator/() - cannot divide by zero");
+  }
+  return Vector3D( x / scalar, y / scalar, z / scalar);
+}
+
+constexpr Vector3D operator*(const double &lhs, const Vector3D &rhs) noexcept {
+  return rhs * lhs;
+}
+
+template <typename Tolerance>
+constexpr bool Vector3D::equals(const Vector3D& other) const noexcept {
+  if (!(*this) || !other) {
+    return !(*this) && !other;
+  }
+  return Tolerance::is_zero(x - other.x) &&
+         Tolerance::is_zero(y - other.y) &&
+         Tolerance::is_zero(z - other.z);
+}
+
+template <typename Tolerance>
+constexpr bool Vector3D::is_zero() const noexcept {
+  return Tolerance::is_zero(x) && Tolerance::is_zero(y) && Tolerance::is_zero(z);
+}
+
+constexpr bool operator==(const Vector3D &lhs, const Vector3D &rhs) noexcept {
+  return lhs.equals(rhs);
+}
+
+constexpr bool operator!=(const Vector3D &lhs, const Vector3D &rhs) noexcept {
+  return !lhs.equals(rhs);
+}
+
+constexpr bool Vector3D::operator!() const noexcept {
+  // Null vectors are stored as NaN coordinates.  NaN is the only value that does not equal itself (std::isnan is not constexpr).
+  return x != x || y != y || z != z;
+}
+
+inline double Vector3D::length() const noexcept {
+  assert(!!(*this));
+  return std::sqrt(squared_length());
+}
+
+constexpr double Vector3D::squared_length() const noexcept {
+  return (x * x) + (y * y) + (z * z);
+}
+
+inline Vector3D Vector3D::unit() const {
+  assert(!!(*this));
+  return *this / length();
+}
+
+inline Vector3D Vector3D::normalized() const noexcept {
+  const double vector_length = length();
+  if (!(vector_length > 0.0)) {
+    return Vector3D(0.0, 0.0, 0.0);
+  }
+  const double inverse_length = 1.0 / vector_length;
+  return Vector3D(x * inverse_length, y * inverse_length, z * inverse_length);
+}
+
+constexpr double Vector3D::dot(const Vector3D& vector2) const noexcept {
+  assert(!!vector2 && !!(*this));
+  return (x * vector2.x) + (y * vector2.y) + (z * vector2.z);
+}
+
+constexpr double Vector3D::dot(const Point3D& point) const noexcept {
+  assert(!!point && !!(*this));
+  return (x * point.x) + (y * point.y) + (z * point.z);
+}
+
+constexpr Vector3D Vector3D::cross(const Vector3D& vector2) const noexcept {
+  assert(!!vector2 && !!(*this));
+  return Vector3D{y * vector2.z - z * vector2.y,
+                z * vector2.x - x * vector2.z,
+                x * vector2.y - y * vector2.x};
+}
+
+constexpr Vector3D Vector3D::zero_vector() noexcept {
+  return Vector3D(0.0, 0.0, 0.0);
+}
+
+
+constexpr Point3D::Point3D() noexcept:
+  Point3D(false)
+{}
+
+constexpr Point3D::Point3D(bool valid) noexcept:
+  x(valid ? 0.0 : std::numeric_limits<double>::quiet_NaN()),
+  y(valid ? 0.0 : std::numeric_limits<double>::quiet_NaN()),
+  z(valid ? 0.0 : std::numeric_limits<double>::quiet_NaN())
+{}
+
+constexpr Point3D::Point3D( SUPoint3D su_point) noexcept:
+  x(su_point.x),
+  y(su_point.y),
+  z(su_point.z)
+{}
+
+constexpr Point3D::Point3D( SUVector3D su_vector) noexcept:
+  x(su_vector.x),
+  y(su_vector.y),
+  z(su_vector.z)
+{}
+
+constexpr Point3D::Point3D(double x, double y, double z) noexcept:
+  x(x),
+  y(y),
+  z(z)
+{}
+
+constexpr Point3D::Point3D( const Vector3D& vector) noexcept:
+  Point3D(vector.x, vector.y, vector.z)
+{}
+
+constexpr Point3D::operator SUPoint3D() const noexcept { return SUPoint3D {x, y, z}; }
+
+inline Point3D::operator const SUPoint3D*() const noexcept {
+  // Point3D is layout compatible with SUPoint3D (see static assertions above)
+  return reinterpret_cast<const SUPoint3D*>(this);
+}
+
+constexpr Point3D::operator Vector3D() const noexcept { return Vector3D(x, y, z); }
+
+constexpr Point3D Point3D::operator+(const Point3D &point) const noexcept {
+  assert(!!point && !!(*this));
+  return Point3D(x + point.x, y + point.y, z + point.z);
+}
+
+constexpr Point3D Point3D::operator+(const Vector3D &vector) const noexcept {
+  assert(!!vector && !!(*this));
+  return Point3D(x + vector.x, y + vector.y, z + vector.z);
+}
+
+constexpr Point3D Point3D::operator+(const SUPoint3D &point) const noexcept {
+  return (*this) + Point3D(point);
+}
+
+constexpr Point3D operator+(const Vector3D &lhs, const Point3D& rhs) noexcept {
+  return rhs + lhs;
+}
+
+constexpr Vector3D Point3D::operator-(const Point3D &point) const noexcept {
+  assert(!!point && !!(*this));
+  return Vector3D(x - point.x, y - point.y, z - point.z);
+}
+
+constexpr Point3D Point3D::operator-(const Vector3D &vector) const noexcept {
+  assert(!!vector && !!(*this));
+  return Point3D(x - vector.x, y - vector.y, z - vector.z);
+}
+
+constexpr Point3D Point3D::operator-(const SUPoint3D &point) const noexcept {
+  assert(!!(*this));
+  return Point3D(x - point.x, y - point.y, z - point.z);
+}
+
+constexpr Point3D Point3D::operator*(const double &scalar) const noexcept {
+  assert(!!(*this));
+  return Point3D(x * scalar, y * scalar, z * scalar);
+}
+
+constexpr Point3D Point3D::operator/(const double &scalar) const {
+  assert(!!(*this));
+  if (SketchUpTolerance::is_zero(scalar)) {
+    throw std::invalid_argument("Point3D::operator/: cannot divide by zero");
+  }
+  return Point3D(x / scalar, y / scalar, z / scalar);
+}
+
+constexpr bool Point3D::operator!() const noexcept {
+  // Null points are stored as NaN coordinates.  NaN is the only value that does not equal itself (std::isnan is not constexpr).
+  return x != x || y != y || z != z;
+}
+
+template <typename Tolerance>
+constexpr bool Point3D::equals(const Point3D& other) const noexcept {
+  if (!(*this) || !other) {
+    return !(*this) && !other;
+  }
+  return Tolerance::is_zero(x - other.x) &&
+         Tolerance::is_zero(y - other.y) &&
+         Tolerance::is_zero(z - other.z);
+}
+
+constexpr bool operator==(const Point3D &lhs, const Point3D &rhs) noexcept {
+  return lhs.equals(rhs);
+}
+
+constexpr bool operator!=(const Point3D &lhs, const Point3D &rhs) noexcept {
+  return !lhs.equals(rhs);
+}
+
 
 // Forward declaration
 class Line3D;
@@ -452,7 +774,7 @@ class Plane3D {
   /**
   * Returns the normal of the plane
   */
-  Vector3D normal() const;
+  Vector3D normal() const noexcept;
 
   /**
   * Returns line of intersection between two planes
@@ -486,12 +808,13 @@ class Plane3D {
   /**
   * Returns the distance of a point from the plane.  It can be negative as the plane has a front and back side.
   */
-  double distance(const Point3D& point) const;
+  double distance(const Point3D& point) const noexcept;
 
   /**
-  * Returns true if the point is on the plane, within SketchUp's tolerance.
+  * Returns true if the point is on the plane, within SketchUp's tolerance (or the given tolerance policy).
   */
-  bool on_plane(const Point3D& point) const;
+  template <typename Tolerance = SketchUpTolerance>
+  bool on_plane(const Point3D& point) const noexcept;
 
   /**
   * Returns a plane moved along normal by given amount.
@@ -669,5 +992,41 @@ class Line3D {
 
 };
 
+
+/********
+* Plane3D and Line3D inline definitions
+*********/
+
+inline Vector3D Plane3D::normal() const noexcept {
+  return Vector3D{m_plane.a, m_plane.b, m_plane.c};
+}
+
+inline double Plane3D::distance(const Point3D& point) const noexcept {
+  return (m_plane.a * point.x) + (m_plane.b * point.y) + (m_plane.c * point.z) + m_plane.d;
+}
+
+template <typename Tolerance>
+bool Plane3D::on_plane(const Point3D& point) const noexcept {
+  return Tolerance::is_zero(distance(point));
+}
+
+inline Point3D Line3D::closest_point(const Point3D& point) const {
+  if (!point) {
+    throw std::invalid_argument("CW::Line3D::closest_point(): given point is null");
+  }
+  if (!(*this)) {
+    throw std::logic_error("CW::Line3D::closest_point(): this line is null");
+  }
+  // @see http://paulbourke.net/geometry/pointlineplane/
+  // [P3 - P1 - u(P2 - P1)] dot (P2 - P1) = 0 - where U is the factor
+  Vector3D start_to_point = point - m_point;
+  double factor = start_to_point.dot(m_direction);
+  return m_point + (factor * m_direction);
+}
+
+inline double Line3D::distance(const Point3D& point) const {
+  return Vector3D(point - closest_point(point)).length();
+}
+
 } /* namespace CW */
 #endif /* Geometry_h */
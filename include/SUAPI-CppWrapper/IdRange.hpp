@@ -0,0 +1,56 @@
+//
+//  IdRange.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef IdRange_hpp
+#define IdRange_hpp
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CW {
+
+/**
+* A range of ids or counts, held in one of the flat arrays of a snapshot such as HalfEdgeMesh or DefinitionGraph.  The range refers to the array, so must not outlive the object it came from.
+*/
+class IdRange {
+  private:
+  const uint32_t* m_begin;
+  const uint32_t* m_end;
+
+  public:
+  IdRange(const uint32_t* begin, const uint32_t* end) : m_begin(begin), m_end(end) {}
+
+  const uint32_t* begin() const { return m_begin; }
+  const uint32_t* end() const { return m_end; }
+  size_t size() const { return static_cast<size_t>(m_end - m_begin); }
+  bool empty() const { return m_begin == m_end; }
+  uint32_t operator[](size_t index) const { return m_begin[index]; }
+};
+
+} /* namespace CW */
+#endif /* IdRange_hpp */
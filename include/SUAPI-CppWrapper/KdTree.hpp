@@ -0,0 +1,118 @@
+//
+//  KdTree.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef KdTree_hpp
+#define KdTree_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+/**
+* A static k-d tree over a set of points, for finding the points nearest to a query point without testing every one.
+*
+* The tree has an implicit layout: the points are reordered so that the point splitting each range of points is at the middle of the range, with the points before it on one side of its splitting plane and the points after it on the other.  No nodes or pointers are stored, only the axis of each split.  Ranges of LEAF_SIZE points or fewer are not split, and are searched in full.
+*
+* Points are referred to by their index in the vector given to the constructor.  Distances are Euclidean.
+*/
+class KdTree {
+  public:
+  constexpr static size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+  constexpr static size_t LEAF_SIZE = 8;
+
+  private:
+  std::vector<Point3D> m_points; // in the order of the tree
+  std::vector<size_t> m_indices; // the original index of each point
+  std::vector<uint8_t> m_axes; // the axis splitting the range whose middle point is at each position
+
+  /**
+  * A point and its original index, as partitioned while building the tree.
+  */
+  struct Entry {
+    double coordinates[3];
+    size_t index;
+  };
+
+  /**
+  * Splits the range of entries, and the ranges on either side of the split.  Ranges larger than parallel_size are split on two threads.
+  */
+  void build(std::vector<Entry>& entries, size_t begin, size_t end, size_t parallel_size);
+
+  void nearest(const Point3D& point, size_t begin, size_t end, size_t& best, double& best_squared_distance) const;
+  void k_nearest(const Point3D& point, size_t k, size_t begin, size_t end, std::vector<std::pair<double, size_t>>& heap) const;
+  void within(const Point3D& point, double radius, size_t begin, size_t end, std::vector<size_t>& results) const;
+
+  public:
+  /**
+  * Constructs an empty tree.
+  */
+  KdTree();
+
+  /**
+  * Builds a tree over the points.
+  * @param num_threads - the number of threads to build the tree with.  With zero, one thread is used for each of the CPU's hardware threads.
+  * @throws std::invalid_argument if any of the points are null.
+  */
+  explicit KdTree(const std::vector<Point3D>& points, size_t num_threads = 0);
+
+  /**
+  * Returns the number of points in the tree.
+  */
+  size_t size() const;
+
+  bool empty() const;
+
+  /**
+  * Returns the index of the point nearest to the point, or NOT_FOUND if no point is within the maximum distance.  Of points at the same distance, the one with the lowest index is returned.
+  */
+  size_t nearest(const Point3D& point, double max_distance = std::numeric_limits<double>::infinity()) const;
+
+  /**
+  * Returns the index of the nearest point to each of the points, or NOT_FOUND for those with no point within the maximum distance.
+  * @param num_threads - the number of threads to search with, or zero for one per hardware thread.
+  */
+  std::vector<size_t> nearest(const std::vector<Point3D>& points, double max_distance, size_t num_threads = 0) const;
+
+  /**
+  * Returns the indices of the k points nearest to the point, within the maximum distance, nearest first.
+  */
+  std::vector<size_t> k_nearest(const Point3D& point, size_t k, double max_distance = std::numeric_limits<double>::infinity()) const;
+
+  /**
+  * Returns the indices of the points within the radius of the point, including any at exactly the radius.  The order of the results is not defined.
+  */
+  std::vector<size_t> within(const Point3D& point, double radius) const;
+};
+
+} /* namespace CW */
+#endif /* KdTree_hpp */
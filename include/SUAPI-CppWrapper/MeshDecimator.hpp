@@ -0,0 +1,155 @@
+//
+//  MeshDecimator.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef MeshDecimator_hpp
+#define MeshDecimator_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+/**
+* MeshDecimator reduces the number of triangles in a mesh by collapsing edges, choosing each time the collapse that least changes the shape of the mesh (Garland and Heckbert's quadric error metric).
+*
+* Boundary edges, edges between triangles of different attributes (such as materials) and edges of the source geometry that are not soft are kept in place by adding planes through them to the error of their vertices, so that outlines, material boundaries and visible creases survive decimation.  The hidden, soft and smooth flags of the source edges are carried over to the edges that remain.
+*
+* As no SketchUp API functions are called, meshes can be decimated on any thread (@see DefinitionDecimator for reading the mesh of a ComponentDefinition).
+*/
+class MeshDecimator {
+  public:
+  /**
+  * An edge of the source geometry, with its flags.
+  */
+  struct Edge {
+    size_t start;
+    size_t end;
+    bool hidden = false;
+    bool soft = false;
+    bool smooth = false;
+  };
+
+  /**
+  * A triangle mesh.  Each triangle has an attribute, such as the index of its material, and triangles with different attributes are not merged.  Edges of the triangles that are not listed in edges are taken to be interior to a face of the source geometry, such as the diagonals of a tessellated face.
+  */
+  struct Mesh {
+    std::vector<Point3D> vertices;
+    std::vector<size_t> indices; // three per triangle, counter-clockwise about its normal
+    std::vector<size_t> attributes; // one per triangle
+    std::vector<Edge> edges;
+
+    size_t num_triangles() const;
+  };
+
+  /**
+  * The level of detail to decimate a mesh to.  Edges are collapsed until the mesh has no more than max_triangles, or until any further collapse would move the surface by more than about max_error.
+  */
+  struct Target {
+    size_t max_triangles = 0;
+    double max_error = std::numeric_limits<double>::infinity();
+
+    Target();
+    Target(size_t max_triangles, double max_error = std::numeric_limits<double>::infinity());
+  };
+
+  private:
+  /**
+  * A symmetric 4x4 matrix, giving the sum of squared distances of a point from a set of planes.
+  */
+  struct Quadric {
+    std::array<double, 10> m = {}; // xx, xy, xz, xw, yy, yz, yw, zz, zw, ww
+
+    void add_plane(const Vector3D& normal, double offset, double weight);
+    Quadric& operator+=(const Quadric& other);
+    double error(const Point3D& point) const;
+    /**
+    * Finds the point of least error, returning false if there is no single such point.
+    */
+    bool minimum(Point3D& point) const;
+  };
+
+  /**
+  * A queued edge collapse.  The position of the kept vertex is found again when the collapse is made, to keep the queue small.
+  */
+  struct Collapse {
+    double cost;
+    uint32_t from; // the vertex that is removed
+    uint32_t to; // the vertex that is kept
+    uint32_t from_version;
+    uint32_t to_version;
+
+    bool operator>(const Collapse& other) const;
+  };
+
+  std::vector<Point3D> m_positions;
+  std::vector<std::array<size_t, 3>> m_triangles;
+  std::vector<size_t> m_attributes;
+  std::vector<bool> m_removed;
+  std::vector<std::vector<size_t>> m_vertex_triangles;
+  std::vector<Quadric> m_quadrics;
+  std::vector<uint32_t> m_versions;
+  std::unordered_map<uint64_t, Edge> m_edges;
+  std::vector<Collapse> m_queue; // a heap, with the least cost first
+  size_t m_num_triangles;
+  std::vector<size_t> m_neighbours;
+
+  static uint64_t edge_key(size_t a, size_t b);
+  void load(const Mesh& mesh);
+  void add_constraints();
+  double best_position(size_t a, size_t b, Point3D& position) const;
+  void push_collapse(size_t a, size_t b);
+  bool collapse_allowed(size_t from, size_t to, const Point3D& position);
+  void collapse(size_t from, size_t to, const Point3D& position);
+  void neighbours(size_t vertex, std::vector<size_t>& result) const;
+  Mesh result() const;
+
+  public:
+  MeshDecimator();
+
+  /**
+  * Decimates a mesh to each target in turn, returning a mesh for each.  Each target continues from the mesh of the previous one, so the targets should be given from finest to coarsest.
+  * Meshes are limited to 2^32 vertices.
+  * @throws std::invalid_argument if the mesh indices or attributes are inconsistent.
+  */
+  std::vector<Mesh> decimate(const Mesh& mesh, const std::vector<Target>& targets);
+
+  /**
+  * Decimates each mesh to each target, decimating the meshes in parallel.
+  * @param num_threads - the number of threads to use, or zero for one per hardware thread.
+  * @throws std::invalid_argument if any mesh cannot be decimated.
+  */
+  static std::vector<std::vector<Mesh>> decimate(const std::vector<Mesh>& meshes, const std::vector<Target>& targets, size_t num_threads = 0);
+};
+
+} /* namespace CW */
+#endif /* MeshDecimator_hpp */
@@ -0,0 +1,177 @@
+//
+//  PolygonClipper.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef PolygonClipper_hpp
+#define PolygonClipper_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/VertexWelder.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Face;
+class GeometryInput;
+
+/**
+* PolygonClipper finds the union, intersection, difference or exclusive or of two coplanar polygons, which may have holes.
+*
+* The edges of the two polygons are split where they cross or touch, and each piece is classified as inside or outside the other polygon, or as shared with it.  The pieces that bound the result are then joined into loops, which are sorted into outer loops and the holes within them.  Vertices within SketchUp's tolerance of each other are merged, and vertices within tolerance of an edge split it, so that shared vertices and edges of adjoining faces are handled as SketchUp would.  Crossings are found with the exact predicates (@see Predicates).
+*
+* The polygons are projected onto the coordinate plane most nearly parallel to them, so faces that are not quite planar are clipped as their projection.  The vertices of the polygons keep their positions, and new vertices are placed on the edges of the first polygon.
+*
+* As no SketchUp API functions are called, polygons can be clipped on any thread once their loops have been fetched.  A PolygonClipper keeps its working memory between calls, so each thread should use its own PolygonClipper for a series of polygons.
+*/
+class PolygonClipper {
+  public:
+  enum class Operation {
+    Union,
+    Intersection,
+    Difference, // the first polygon less the second
+    Xor // the areas covered by one polygon but not the other
+  };
+
+  /**
+  * A polygon given by the points of its loops.  The outer loop of each result is counter-clockwise about the normal of the first polygon, and the inner loops are clockwise, as for SketchUp faces.
+  */
+  struct Polygon {
+    std::vector<Point3D> outer_loop;
+    std::vector<std::vector<Point3D>> inner_loops;
+
+    Polygon();
+    Polygon(const std::vector<Point3D>& outer_loop, const std::vector<std::vector<Point3D>>& inner_loops = {});
+
+    /**
+    * Fetches the loops of a face.
+    * @throws std::logic_error if the face is null.
+    */
+    Polygon(const Face& face);
+
+    /**
+    * Returns the area of the polygon.
+    */
+    double area() const;
+
+    /**
+    * Adds the polygon to a GeometryInput object as a face, with a LoopInput for each loop.
+    * @return the index of the face in the GeometryInput object.
+    */
+    size_t add_to(GeometryInput& geom_input) const;
+  };
+
+  private:
+  constexpr static size_t NONE_SELECTED = std::numeric_limits<size_t>::max();
+
+  /**
+  * An edge of one of the polygons, split at the vertices where the other polygon meets it.
+  */
+  struct InputEdge {
+    size_t start;
+    size_t end;
+    std::vector<std::pair<double, size_t>> splits; // the parameter along the edge and the vertex of each split
+  };
+
+  /**
+  * A piece of an edge between two vertices, and how it lies relative to the other polygon.
+  */
+  enum class Side : uint8_t {
+    Outside,
+    Inside,
+    SharedSame, // the other polygon has the same edge, in the same direction
+    SharedOpposite // the other polygon has the same edge, in the opposite direction
+  };
+
+  struct Piece {
+    size_t start;
+    size_t end;
+    Side side;
+  };
+
+  /**
+  * Holds the edges of a polygon in horizontal bands, to find whether points are inside it.
+  */
+  struct Bands {
+    double min_y;
+    double scale;
+    std::vector<size_t> offsets;
+    std::vector<size_t> edges;
+  };
+
+  VertexWelder m_welder;
+  std::vector<Point3D> m_positions; // the position of each vertex
+  std::vector<SUPoint2D> m_points; // the projection of each vertex
+  std::vector<InputEdge> m_edges[2];
+  std::vector<Piece> m_pieces[2];
+  Bands m_bands[2];
+  std::unordered_map<uint64_t, size_t> m_shared;
+  std::vector<std::pair<size_t, size_t>> m_selected;
+  std::vector<std::vector<size_t>> m_outgoing;
+  size_t m_axis;
+  bool m_mirror;
+
+  size_t add_vertex(const Point3D& position);
+  void add_loop(const std::vector<Point3D>& loop, size_t polygon, bool outer);
+  void split_edges();
+  void split(size_t a, size_t b);
+  void make_pieces(size_t polygon);
+  void classify_pieces();
+  void build_bands(size_t polygon);
+  bool inside(const SUPoint2D& point, size_t polygon) const;
+  void select(Operation operation);
+  std::vector<std::vector<size_t>> trace_loops();
+  std::vector<Polygon> assemble(const std::vector<std::vector<size_t>>& loops) const;
+  double signed_area(const std::vector<size_t>& loop) const;
+
+  public:
+  PolygonClipper();
+
+  /**
+  * Returns the result of an operation on two polygons, as a list of polygons.
+  * @throws std::invalid_argument if the polygons are not coplanar, or the first polygon has no area.
+  */
+  std::vector<Polygon> clip(const Polygon& subject, const Polygon& clip, Operation operation);
+
+  /**
+  * Returns the result of an operation on each pair of polygons, clipping the pairs in parallel.
+  * @param subjects - the first polygon of each pair.
+  * @param clips - the second polygon of each pair, the same number as there are subjects.
+  * @param num_threads - the number of threads to use, or zero for one per hardware thread.
+  * @throws std::invalid_argument if the numbers of polygons differ, or any pair cannot be clipped.
+  */
+  static std::vector<std::vector<Polygon>> clip(const std::vector<Polygon>& subjects, const std::vector<Polygon>& clips, Operation operation, size_t num_threads = 0);
+};
+
+} /* namespace CW */
+#endif /* PolygonClipper_hpp */
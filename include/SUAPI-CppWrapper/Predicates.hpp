@@ -0,0 +1,173 @@
+//
+//  Predicates.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef Predicates_hpp
+#define Predicates_hpp
+
+#include <cmath>
+#include <cstddef>
+
+#include <SketchUpAPI/geometry.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+/**
+* Robust geometric predicates, after Shewchuk's "Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric Predicates".
+*
+* Each predicate first evaluates its determinant in ordinary floating point arithmetic, along with a bound on the rounding error.  Only if the result is too close to zero for its sign to be trusted is the determinant evaluated again with exact arithmetic (in Predicates.cpp).  The sign of the returned value is always correct, so no tolerance is needed when deciding which side of a line or plane a point lies.
+*
+* Unlike the rest of the wrapper, these functions do not use SketchUp's tolerance.  Their inputs should be the original coordinates (not differences or unit vectors), as any rounding before the call is not accounted for.
+*/
+namespace Predicates {
+
+/**
+* Relative error bounds of the floating point evaluations.  EPSILON is half an ulp of 1.0.
+*/
+constexpr double EPSILON = 1.1102230246251565e-16;
+constexpr double ORIENT2D_ERROR_BOUND = (3.0 + 16.0 * EPSILON) * EPSILON;
+constexpr double ORIENT3D_ERROR_BOUND = (7.0 + 56.0 * EPSILON) * EPSILON;
+constexpr double INCIRCLE_ERROR_BOUND = (10.0 + 96.0 * EPSILON) * EPSILON;
+
+/**
+* Exact evaluations of the predicates below.  These are called when the floating point evaluation cannot determine the sign.
+*/
+double orient2d_exact(const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c);
+double orient3d_exact(const Point3D& a, const Point3D& b, const Point3D& c, const Point3D& d);
+double incircle_exact(const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c, const SUPoint2D& d);
+
+/**
+* Returns a positive value if the points a, b and c are in counter-clockwise order, a negative value if they are in clockwise order, and zero if they are collinear.
+* The value is approximately twice the signed area of the triangle.
+*/
+inline double orient2d(const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c) {
+  const double det_left = (a.x - c.x) * (b.y - c.y);
+  const double det_right = (a.y - c.y) * (b.x - c.x);
+  const double det = det_left - det_right;
+  // If the products have opposite signs there can be no cancellation, so the bound is always met.  This is not tested separately, as the branch would be unpredictable.
+  const double error_bound = ORIENT2D_ERROR_BOUND * (std::abs(det_left) + std::abs(det_right));
+  if (det >= error_bound || -det >= error_bound) {
+    return det;
+  }
+  return orient2d_exact(a, b, c);
+}
+
+/**
+* Returns a positive value if the point d lies below the plane through a, b and c (where a, b and c appear counter-clockwise when viewed from above), a negative value if it lies above, and zero if the four points are coplanar.
+* The value is approximately six times the signed volume of the tetrahedron.
+*/
+inline double orient3d(const Point3D& a, const Point3D& b, const Point3D& c, const Point3D& d) {
+  const double adx = a.x - d.x;
+  const double bdx = b.x - d.x;
+  const double cdx = c.x - d.x;
+  const double ady = a.y - d.y;
+  const double bdy = b.y - d.y;
+  const double cdy = c.y - d.y;
+  const double adz = a.z - d.z;
+  const double bdz = b.z - d.z;
+  const double cdz = c.z - d.z;
+  const double bdxcdy = bdx * cdy;
+  const double cdxbdy = cdx * bdy;
+  const double cdxady = cdx * ady;
+  const double adxcdy = adx * cdy;
+  const double adxbdy = adx * bdy;
+  const double bdxady = bdx * ady;
+  const double det = (adz * (bdxcdy - cdxbdy)) + (bdz * (cdxady - adxcdy)) + (cdz * (adxbdy - bdxady));
+  const double permanent = ((std::abs(bdxcdy) + std::abs(cdxbdy)) * std::abs(adz)) +
+                           ((std::abs(cdxady) + std::abs(adxcdy)) * std::abs(bdz)) +
+                           ((std::abs(adxbdy) + std::abs(bdxady)) * std::abs(cdz));
+  const double error_bound = ORIENT3D_ERROR_BOUND * permanent;
+  if (det > error_bound || -det > error_bound) {
+    return det;
+  }
+  return orient3d_exact(a, b, c, d);
+}
+
+/**
+* Returns a positive value if the point d lies inside the circle passing through a, b and c, a negative value if it lies outside, and zero if the four points are cocircular.
+* The points a, b and c must be in counter-clockwise order, or the sign of the result is reversed.
+*/
+inline double incircle(const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c, const SUPoint2D& d) {
+  const double adx = a.x - d.x;
+  const double bdx = b.x - d.x;
+  const double cdx = c.x - d.x;
+  const double ady = a.y - d.y;
+  const double bdy = b.y - d.y;
+  const double cdy = c.y - d.y;
+  const double bdxcdy = bdx * cdy;
+  const double cdxbdy = cdx * bdy;
+  const double a_lift = (adx * adx) + (ady * ady);
+  const double cdxady = cdx * ady;
+  const double adxcdy = adx * cdy;
+  const double b_lift = (bdx * bdx) + (bdy * bdy);
+  const double adxbdy = adx * bdy;
+  const double bdxady = bdx * ady;
+  const double c_lift = (cdx * cdx) + (cdy * cdy);
+  const double det = (a_lift * (bdxcdy - cdxbdy)) + (b_lift * (cdxady - adxcdy)) + (c_lift * (adxbdy - bdxady));
+  const double permanent = ((std::abs(bdxcdy) + std::abs(cdxbdy)) * a_lift) +
+                           ((std::abs(cdxady) + std::abs(adxcdy)) * b_lift) +
+                           ((std::abs(adxbdy) + std::abs(bdxady)) * c_lift);
+  const double error_bound = INCIRCLE_ERROR_BOUND * permanent;
+  if (det > error_bound || -det > error_bound) {
+    return det;
+  }
+  return incircle_exact(a, b, c, d);
+}
+
+/**
+* Returns the index (0 for x, 1 for y, 2 for z) of the largest component of the vector.  Dropping this coordinate gives the projection of a plane with this normal onto a coordinate plane with the least distortion.
+*/
+inline size_t dominant_axis(const Vector3D& normal) {
+  const double x = std::abs(normal.x);
+  const double y = std::abs(normal.y);
+  const double z = std::abs(normal.z);
+  if (x > y && x > z) {
+    return 0;
+  }
+  return y > z ? 1 : 2;
+}
+
+/**
+* Projects a point onto a coordinate plane by dropping the given axis (@see dominant_axis()).  No arithmetic is performed, so the predicates remain exact for the projected points.
+* The remaining coordinates are kept in cyclic order, so that counter-clockwise points when viewed from the positive side of the dropped axis are counter-clockwise in 2D.
+*/
+inline SUPoint2D project(const Point3D& point, size_t axis) {
+  switch (axis) {
+    case 0:
+      return SUPoint2D{point.y, point.z};
+    case 1:
+      return SUPoint2D{point.z, point.x};
+    default:
+      return SUPoint2D{point.x, point.y};
+  }
+}
+
+} /* namespace Predicates */
+
+} /* namespace CW */
+#endif /* Predicates_hpp */
@@ -0,0 +1,183 @@
+//
+//  RayCaster.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef RayCaster_hpp
+#define RayCaster_hpp
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+#include "SUAPI-CppWrapper/BoundingVolumeHierarchy.hpp"
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+
+namespace CW {
+
+/**
+* RayCaster finds the first triangle hit by each of a batch of rays, in a scene made of instances of triangle meshes.
+*
+* The scene is held as a two-level bounding volume hierarchy.  Each mesh has its own hierarchy over its triangles, built once however many times the mesh is instanced.  The top level hierarchy is over the world space bounds of the instances, and is built by build().  Rays are transformed into the coordinates of each instance they reach, so instances may be scaled, sheared or mirrored.
+*
+* Batches of rays are cast in packets of PACKET_SIZE consecutive rays, which are traversed together so that the nodes and triangles are fetched once for the whole packet.  Packets are fastest when their rays start near each other and point in similar directions, as with rays through neighbouring pixels, or from one point towards neighbouring points.  Batches are also divided between several threads.
+*
+* Once built, the RayCaster is not modified by casting rays, so rays may be cast from several threads at once.
+*/
+class RayCaster {
+  public:
+  constexpr static size_t NO_HIT = std::numeric_limits<size_t>::max();
+  constexpr static size_t PACKET_SIZE = 4;
+
+  struct Ray {
+    Point3D origin;
+    Vector3D direction; // need not be a unit vector
+  };
+
+  /**
+  * The first triangle hit by a ray.
+  */
+  struct Hit {
+    double distance = std::numeric_limits<double>::infinity(); // the distance from the origin of the ray in world space
+    Vector3D normal = Vector3D(0.0, 0.0, 0.0); // the unit normal of the triangle in world space, on the side given by the order of its vertices
+    size_t instance = NO_HIT; // the index of the instance hit, as returned by add_instance()
+    size_t triangle = NO_HIT; // the index of the triangle hit within the instance's mesh
+
+    /**
+    * Returns true if the ray hit nothing.
+    */
+    bool operator!() const;
+  };
+
+  private:
+  /**
+  * A triangle stored in the form used by the intersection test.
+  */
+  struct Triangle {
+    Point3D v0;
+    Vector3D edge1; // v1 - v0
+    Vector3D edge2; // v2 - v0
+  };
+
+  struct Mesh {
+    BoundingVolumeHierarchy hierarchy;
+    std::vector<Triangle> triangles; // in the order of the hierarchy's items, so that each leaf's triangles are together
+    SUBoundingBox3D bounds;
+  };
+
+  /**
+  * An instance stores the transformation from world space into the coordinates of its mesh, as the 3x4 matrix [A b] in row-major order.
+  */
+  struct Instance {
+    size_t mesh;
+    double to_local[12];
+  };
+
+  struct Packet;
+
+  /**
+  * A node waiting to be visited, with the distance at which the nearest ray of the packet enters it.
+  */
+  struct StackEntry {
+    size_t node;
+    double entry;
+  };
+
+  std::vector<Mesh> m_meshes;
+  std::vector<Instance> m_instances;
+  std::vector<SUBoundingBox3D> m_instance_bounds;
+  BoundingVolumeHierarchy m_hierarchy;
+  bool m_built;
+
+  /**
+  * Casts up to PACKET_SIZE rays together, storing each ray's hit.
+  */
+  void cast_packet(const Ray* rays, Hit* hits, size_t count, std::vector<StackEntry>& stack) const;
+
+  /**
+  * Intersects the rays of a packet, transformed into the coordinates of an instance, with the instance's mesh.
+  */
+  void intersect_mesh(const Mesh& mesh, size_t instance, Packet& packet, std::vector<StackEntry>& stack) const;
+
+  public:
+  /**
+  * Constructs a RayCaster with no meshes.
+  */
+  RayCaster();
+
+  /**
+  * Adds a triangle mesh, which can then be placed in the scene with add_instance().
+  * @param vertices - the positions of the vertices.
+  * @param triangle_indices - three indices into the vertices for each triangle.  The order of the vertices gives the side of the triangle that its normal points from.
+  * @return the index of the mesh.
+  * @throws std::invalid_argument if the number of indices is not a multiple of three.
+  * @throws std::out_of_range if an index is out of range.
+  */
+  size_t add_mesh(const std::vector<Point3D>& vertices, const std::vector<size_t>& triangle_indices);
+
+  /**
+  * Places a mesh in the scene.  build() must be called before casting rays.
+  * @param mesh - the index returned by add_mesh().
+  * @param transformation - the transformation from the mesh's coordinates to world space.
+  * @return the index of the instance.
+  * @throws std::out_of_range if the mesh does not exist.
+  * @throws std::invalid_argument if the transformation is not affine or cannot be inverted.
+  */
+  size_t add_instance(size_t mesh, const Transformation& transformation);
+
+  /**
+  * Builds the top level hierarchy over the instances.  This must be called again after adding instances.
+  */
+  void build();
+
+  /**
+  * Returns the number of meshes.
+  */
+  size_t num_meshes() const;
+
+  /**
+  * Returns the number of instances.
+  */
+  size_t num_instances() const;
+
+  /**
+  * Returns the first triangle hit by the ray, at a distance greater than zero.  Triangles are hit from either side.
+  * @throws std::logic_error if build() has not been called since the last instance was added.
+  */
+  Hit cast(const Ray& ray) const;
+
+  /**
+  * Casts a batch of rays, returning the hit of each ray in the same order.
+  * @param num_threads - the number of threads to cast the rays with.  With zero, one thread is used for each of the CPU's hardware threads.
+  * @throws std::logic_error if build() has not been called since the last instance was added.
+  */
+  std::vector<Hit> cast(const std::vector<Ray>& rays, size_t num_threads = 0) const;
+};
+
+} /* namespace CW */
+#endif /* RayCaster_hpp */
@@ -0,0 +1,130 @@
+//
+//  TessellatedMesh.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef TessellatedMesh_hpp
+#define TessellatedMesh_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+namespace CW {
+
+/**
+* A triangle mesh held in one contiguous buffer, for handing tessellated geometry to exporters and renderers.
+*
+* The buffer holds a small header, then the vertices with their positions, normals and front and back STQ texture coordinates interleaved, then the triangles' vertex indices, then the material ranges.  The indices are grouped by the front and back materials of their faces, so each material range is a contiguous run of triangles that can be drawn with one material.  The materials are given as indices into a dictionary held by whatever built the mesh (such as a TessellationCache), so the buffer holds no references to the SketchUp API, and can be copied or stored as it is.
+*
+* A mesh either owns its buffer, or is a view of a buffer held elsewhere, such as a file mapped into memory by a TessellationFileCache.
+*/
+class TessellatedMesh {
+  public:
+  /**
+  * The material index of faces with the default material.
+  */
+  static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+  struct Vertex {
+    SUPoint3D position;
+    SUVector3D normal;
+    SUPoint3D front_stq;
+    SUPoint3D back_stq;
+  };
+
+  /**
+  * A run of triangles with the same materials: the indices from first_index to first_index + num_indices - 1.
+  */
+  struct MaterialRange {
+    uint32_t front_material;
+    uint32_t back_material;
+    uint32_t first_index;
+    uint32_t num_indices;
+  };
+
+  private:
+  struct Header {
+    uint32_t num_vertices;
+    uint32_t num_indices;
+    uint32_t num_ranges;
+    uint32_t reserved;
+  };
+
+  // Kept as 8 byte words, so that the vertices are aligned.
+  std::vector<uint64_t> m_buffer;
+  // The buffer of a view, and whatever keeps it alive.  m_view is null when the mesh owns its buffer.
+  const unsigned char* m_view;
+  size_t m_view_size;
+  std::shared_ptr<const void> m_view_owner;
+
+  const unsigned char* bytes() const;
+  const Header& header() const;
+  static size_t indices_offset(size_t num_vertices);
+  static size_t ranges_offset(size_t num_vertices, size_t num_indices);
+
+  public:
+  /**
+  * Constructs an empty mesh.
+  */
+  TessellatedMesh();
+
+  /**
+  * Packs the vertices, indices and ranges into a buffer.
+  * @throws std::invalid_argument if an index is not that of a vertex, or a range is not within the indices.
+  */
+  TessellatedMesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const std::vector<MaterialRange>& ranges);
+
+  /**
+  * Returns a mesh that views a buffer in the layout of data(), without copying it.  The sizes in the buffer and its ranges are checked, but its indices are not, so the buffer should be one written from data().
+  * @param data - the buffer, which must be aligned to 8 bytes.
+  * @param owner - keeps the buffer alive for as long as the mesh, or any copy of it, exists.
+  * @throws std::invalid_argument if the buffer is misaligned or its sizes do not match.
+  */
+  static TessellatedMesh view(const void* data, size_t size, std::shared_ptr<const void> owner);
+
+  size_t num_vertices() const;
+  size_t num_indices() const;
+  size_t num_triangles() const;
+  size_t num_ranges() const;
+  bool empty() const;
+
+  const Vertex* vertices() const;
+  const uint32_t* indices() const;
+  const MaterialRange* ranges() const;
+
+  /**
+  * Returns the buffer, of size_bytes() bytes.
+  */
+  const void* data() const;
+  size_t size_bytes() const;
+};
+
+} /* namespace CW */
+#endif /* TessellatedMesh_hpp */
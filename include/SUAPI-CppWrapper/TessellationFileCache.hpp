@@ -0,0 +1,152 @@
+//
+//  TessellationFileCache.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef TessellationFileCache_hpp
+#define TessellationFileCache_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "SUAPI-CppWrapper/TessellatedMesh.hpp"
+
+namespace CW {
+
+/**
+* TessellationFileCache keeps TessellatedMeshes in a directory, so that meshes made in one run can be reused by the next.  It does not use the SketchUp API, so it can be read and managed without SketchUp running.
+*
+* Each mesh is kept in a file named after a 64 bit key chosen by the caller, which should be a hash of whatever the mesh was made from (@see TessellationCache::content_hash()).  As the meshes are found by their content, a changed definition simply gets a new key, and its old mesh is left to be evicted.  The file holds the mesh's buffer as it is, followed by the names of the materials that its ranges index, as the material indices of a mesh are only meaningful to whatever made it.
+*
+* The meshes returned by find() are views of the file, mapped into memory, so reading a mesh costs no more than the pages that are touched.  The mapping is kept alive by the mesh and its copies, even after the file is evicted.
+*
+* The cache is kept within a total size and number of files by evicting the least recently used files, where a use is a find() or store().  The time of the last use is kept as the file's modification time, so the order survives between runs.  Only one TessellationFileCache should use a directory at a time, and it should only be used from one thread.
+*/
+class TessellationFileCache {
+  public:
+  /**
+  * The statistics of a cache.  The counts are for the lifetime of this object, whereas the entries and size are of the directory.
+  */
+  struct Stats {
+    size_t hits;
+    size_t misses; // including files that could not be read
+    size_t stores;
+    size_t evictions;
+    size_t num_entries;
+    uint64_t size_bytes;
+    size_t max_entries;
+    uint64_t max_size_bytes;
+
+    /**
+    * Returns the proportion of calls to find() that were hits, or zero if there were none.
+    */
+    double hit_rate() const;
+  };
+
+  private:
+  struct Entry {
+    std::list<uint64_t>::iterator position;
+    uint64_t size_bytes;
+  };
+
+  std::filesystem::path m_directory;
+  uint64_t m_max_size_bytes;
+  size_t m_max_entries;
+  // The keys from the most to the least recently used.
+  std::list<uint64_t> m_order;
+  std::unordered_map<uint64_t, Entry> m_entries;
+  uint64_t m_size_bytes;
+  size_t m_hits;
+  size_t m_misses;
+  size_t m_stores;
+  size_t m_evictions;
+
+  std::filesystem::path path(uint64_t key) const;
+
+  /**
+  * Makes the entry the most recently used, in memory and on disk.
+  */
+  void touch(uint64_t key);
+
+  void remove(uint64_t key);
+
+  /**
+  * Removes the least recently used files until the cache is within its limits.
+  */
+  void evict();
+
+  public:
+  /**
+  * Opens the cache in the directory, creating the directory if it does not exist.  Files left by earlier runs are kept, and evicted if they do not fit the limits.
+  * @param max_size_bytes - the most bytes the files may take in total.
+  * @param max_entries - the most files that may be kept.
+  * @throws std::runtime_error if the directory cannot be created or read.
+  */
+  TessellationFileCache(const std::string& directory, uint64_t max_size_bytes, size_t max_entries = SIZE_MAX);
+
+  /**
+  * Looks for the mesh with the given key.  A file that cannot be read, or does not hold a valid mesh (checking its sizes, ranges and indices), is removed and counted as a miss.
+  * @param mesh - set to a view of the file if it is found.
+  * @param material_names - set to the names of the materials indexed by the mesh's ranges if it is found.
+  * @return true if the mesh was found.
+  */
+  bool find(uint64_t key, TessellatedMesh& mesh, std::vector<std::string>& material_names);
+
+  /**
+  * Writes the mesh under the key, replacing any mesh already kept under it, and evicts files until the cache is within its limits.  The file is written under a temporary name and then renamed, so a reader never sees a partly written file.
+  * @param material_names - the names of the materials indexed by the mesh's ranges.
+  * @return true if the mesh was written, or false if it could not be, or is larger than the cache.
+  */
+  bool store(uint64_t key, const TessellatedMesh& mesh, const std::vector<std::string>& material_names);
+
+  bool contains(uint64_t key) const;
+
+  /**
+  * Removes the file of the key, if there is one.
+  */
+  void erase(uint64_t key);
+
+  /**
+  * Removes every file, and resets the statistics.
+  */
+  void clear();
+
+  Stats stats() const;
+
+  /**
+  * Writes the statistics as lines of text, for logging at the end of an export.
+  */
+  void write_report(std::ostream& stream) const;
+};
+
+} /* namespace CW */
+#endif /* TessellationFileCache_hpp */
@@ -29,6 +29,7 @@
 #define Transformation_hpp
 
 #include <array>
+#include <vector>
 
 #include <SketchUpAPI/geometry/transformation.h>
 
@@ -53,6 +54,36 @@ class Transformation {
   private:
   SUTransformation m_transformation;
   constexpr static double EPSILON = 0.001; // Sketchup Tolerance is 1/1000"
+  constexpr static double CLASSIFICATION_EPSILON = 1.0e-10; // Tolerance for treating matrix components as exactly 0 or 1.
+
+  /**
+  * Flags describing the kind of transformation held, used to select faster paths when multiplying and inverting.
+  */
+  enum ClassificationFlags : unsigned int {
+    CLASSIFIED = 1 << 0, // Flags are up to date
+    AFFINE = 1 << 1, // Bottom row is (0,0,0,w)
+    IDENTITY = 1 << 2,
+    TRANSLATION = 1 << 3, // No rotation or scaling, only a translation
+    RIGID = 1 << 4, // Rotation (possibly mirrored) and translation only
+    UNIFORM_SCALE = 1 << 5, // Rigid transformation combined with a uniform scale
+    MIRRORED = 1 << 6 // Negative determinant
+  };
+  unsigned int m_flags = 0;
+
+  /**
+  * Private constructor for results of multiplication or inversion, where the classification is already known.
+  */
+  Transformation(const SUTransformation& transformation, unsigned int flags);
+
+  /**
+  * Returns the classification flags of the given matrix.
+  */
+  static unsigned int classify(const SUTransformation& transformation);
+
+  /**
+  * Returns the classification flags, computing them if the matrix has been modified through operator[].
+  */
+  unsigned int flags() const;
 
   /**
   * Multiplies 4x1 matrix by this transformation matrix
@@ -61,11 +92,6 @@ class Transformation {
   */
   std::array<double, 4> multiply4x1(std::array<double, 4> matrix4_1) const;
 
-  /**
-  * Returns the determinant of the matrix.
-  */
-  double determinant() const;
-
   public:
   /**
   * Construct a Transformation with a simple scale of 1 (no change).
@@ -140,6 +166,7 @@ class Transformation {
 
   /**
   * Allows access to the array of numbers in the SUTransformation struct.
+  * Note that modifying the matrix through the non-const operator resets the cached classification of the transformation, which will be recalculated when needed.
   */
   double operator[](size_t i) const;
   double& operator[](size_t i);
@@ -151,14 +178,55 @@ class Transformation {
   operator SUTransformation() const;
   operator const SUTransformation*() const;
 
+  /**
+  * Returns the determinant of the matrix.
+  */
+  double determinant() const;
+
   /**
   * Returns true if this Transformation is identity (no change).
   */
   bool is_identity() const;
 
+  /**
+  * Returns true if the bottom row of the matrix is (0,0,0,w), i.e. there is no perspective component.
+  */
+  bool is_affine() const;
+
+  /**
+  * Returns true if the Transformation only moves geometry, without rotating or scaling.  The identity transformation is also a translation.
+  */
+  bool is_translation() const;
+
+  /**
+  * Returns true if the Transformation only rotates (or mirrors) and moves geometry, without scaling.
+  */
+  bool is_rigid() const;
+
+  /**
+  * Returns true if the Transformation is made of rotations, translations and a uniform scale.  Rigid transformations are also uniform scales.
+  */
+  bool is_uniform_scale() const;
+
+  /**
+  * Returns true if the Transformation flips geometry inside out (has a negative determinant).
+  */
+  bool is_mirrored() const;
+
+  /**
+  * Decomposes an affine transformation into translation, rotation and scale, such that this = translation * rotation * scale.
+  *
+  * Mirroring is represented as a negative X scale, so that the rotation is always a proper rotation.  If the transformation has a shear or perspective component, the closest rotation and scale are returned.  If it has a zero scale along any axis, that scale is returned as zero, and the rotation is completed with an axis perpendicular to the others.
+  * @param translation - returns the translation component.
+  * @param rotation - returns the rotation component.
+  * @param scale - returns the scale along each axis.
+  * @return true if the transformation could be decomposed exactly, or false if it has a shear, perspective or zero scale.
+  */
+  bool decompose(Vector3D& translation, Transformation& rotation, Vector3D& scale) const;
+
   /**
   * Return the inverse Transformation object (see inverse Transformation matrices)
-  * @since SketchUp 2018, API v6.0
+  * @throws std::logic_error if the transformation cannot be inverted.
   */
   Transformation inverse() const;
 
@@ -193,7 +261,6 @@ class Transformation {
 
   /**
   * Retrieves the origin of a rigid transformation.
-  * @since SketchUp 2018, API v6.0
   */
   Point3D origin() const;
 
@@ -204,9 +271,8 @@ class Transformation {
 
   /**
   * Mulitplication of Transformation matrices.
-  * @since SketchUp 2018, API v6.0
   */
-  Transformation operator*(Transformation transform);
+  Transformation operator*(const Transformation& transform) const;
 
   /**
   * Return transformed vectors.
@@ -236,6 +302,34 @@ class Transformation {
   */
   friend Face operator*(const Face &lhs, const Transformation &rhs);
 
+  /**
+  * Transforms an array of points in place.
+  *
+  * This is much faster than transforming each point with operator*, as the C API is not called for every point, and SIMD instructions are used where the CPU supports them.  Unlike operator*, the points are not checked for validity: null points remain null after the transformation.
+  * @param points - pointer to the first point of a contiguous array of points.
+  * @param num_points - the number of points in the array.
+  */
+  void transform_points(SUPoint3D* points, size_t num_points) const;
+  void transform_points(std::vector<Point3D>& points) const;
+
+  /**
+  * Transforms an array of vectors in place.  The translation component of the transformation is not applied to vectors.
+  * @see transform_points()
+  * @param vectors - pointer to the first vector of a contiguous array of vectors.
+  * @param num_vectors - the number of vectors in the array.
+  */
+  void transform_vectors(SUVector3D* vectors, size_t num_vectors) const;
+  void transform_vectors(std::vector<Vector3D>& vectors) const;
+
+  /**
+  * Transforms an array of surface normals in place.  Normals are transformed by the inverse transpose of the transformation, so that they remain perpendicular to transformed surfaces under non-uniform scaling, and are returned as unit vectors.
+  * @see transform_points()
+  * @param normals - pointer to the first normal of a contiguous array of normals.
+  * @param num_normals - the number of normals in the array.
+  */
+  void transform_normals(SUVector3D* normals, size_t num_normals) const;
+  void transform_normals(std::vector<Vector3D>& normals) const;
+
   /**
   * Compare equality of tranformation objects.
   */
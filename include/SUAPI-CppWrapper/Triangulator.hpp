@@ -0,0 +1,160 @@
+//
+//  Triangulator.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef Triangulator_hpp
+#define Triangulator_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Face;
+
+/**
+* Triangulator divides planar polygons, which may have holes, into triangles without using the SketchUp API.
+*
+* The polygon is projected onto the coordinate plane most nearly parallel to it, the holes are joined to the outer loop with bridging edges, and triangles are then cut from the resulting loop by ear clipping.  Large polygons index their vertices along a z-order curve, so that each ear is only tested against nearby vertices.  The method follows Mapbox's earcut library, with its orientation tests replaced by the exact predicates (@see Predicates), so that nearly collinear vertices do not produce inverted triangles.  Unlike earcut, the edges of the loop are indexed while the holes are joined to it, so that faces with thousands of holes, such as façades with many windows, do not take quadratic time.
+*
+* As no SketchUp API functions are called, polygons can be triangulated on any thread once their loops have been fetched into a Polygon.  A Triangulator keeps its working memory between calls, so each thread should use its own Triangulator for a series of polygons.
+*/
+class Triangulator {
+  public:
+  /**
+  * The loops of a planar polygon.
+  */
+  struct Polygon {
+    std::vector<Point3D> vertices; // the vertices of the outer loop, followed by the vertices of each inner loop
+    std::vector<size_t> loop_ends; // the index in vertices after the end of each loop, starting with the outer loop
+    Vector3D normal; // the triangles are counter-clockwise about this vector
+
+    Polygon();
+
+    /**
+    * Constructs a polygon from the points of its loops.  The normal is that of the outer loop, taking its points as counter-clockwise.
+    */
+    Polygon(const std::vector<Point3D>& outer_loop, const std::vector<std::vector<Point3D>>& inner_loops = {});
+
+    /**
+    * Fetches the loops of a face.  The normal is the normal of the face, as with MeshHelper.
+    * @throws std::logic_error if the face is null.
+    */
+    Polygon(const Face& face);
+  };
+
+  private:
+  constexpr static size_t NONE = std::numeric_limits<size_t>::max();
+
+  /**
+  * A vertex of the loop being clipped.  Vertices are linked in a ring in the order of the loop, and, for large polygons, in a list in z-order.
+  */
+  struct Node {
+    SUPoint2D point;
+    size_t index; // the index of the vertex in the polygon
+    size_t prev;
+    size_t next;
+    uint32_t z;
+    size_t prev_z;
+    size_t next_z;
+    bool steiner; // a single point hole, which must not be removed as a degenerate vertex
+    bool removed;
+  };
+
+  std::vector<SUPoint2D> m_points; // the projected vertices of the polygon
+  std::vector<Node> m_nodes;
+  std::vector<size_t> m_holes;
+  std::vector<size_t>* m_triangles;
+  double m_min_x;
+  double m_min_y;
+  double m_inv_size; // zero when the z-order curve is not used
+  /**
+  * While holes are being joined to the outer loop, the edges of the outer loop are indexed in horizontal bands, so that a search for the edges beside a hole need not go around the whole loop.  Each band lists the nodes starting the edges that overlap it.  Entries are not removed when an edge changes: the node's current edge is tested instead.
+  */
+  std::vector<std::vector<size_t>> m_bands;
+  double m_band_min_y;
+  double m_band_scale; // zero when the edges are not indexed
+
+  size_t insert_node(size_t index, const SUPoint2D& point, size_t last);
+  void remove_node(size_t node);
+  size_t linked_list(const std::vector<SUPoint2D>& points, size_t begin, size_t end, bool counter_clockwise);
+  size_t filter_points(size_t start, size_t end = NONE);
+  size_t filter_around(size_t node);
+  size_t split_polygon(size_t a, size_t b);
+  size_t eliminate_holes(const std::vector<SUPoint2D>& points, const std::vector<size_t>& loop_ends, size_t outer_node);
+  size_t find_hole_bridge(size_t hole) const;
+  size_t band(double y) const;
+  void index_edge(size_t node);
+  void clip_ears(size_t ear, int pass);
+  bool is_ear(size_t ear) const;
+  bool is_ear_hashed(size_t ear) const;
+  size_t cure_local_intersections(size_t start);
+  void split_and_clip(size_t start);
+  void index_curve(size_t start);
+  void sort_linked(size_t list);
+  uint32_t z_order(double x, double y) const;
+  void add_triangle(size_t a, size_t b, size_t c);
+
+  double orient(size_t p, size_t q, size_t r) const;
+  bool equals(size_t a, size_t b) const;
+  bool intersects(size_t p1, size_t q1, size_t p2, size_t q2) const;
+  bool intersects_polygon(size_t a, size_t b) const;
+  bool locally_inside(size_t a, size_t b) const;
+  bool middle_inside(size_t a, size_t b) const;
+  bool is_valid_diagonal(size_t a, size_t b) const;
+  bool sector_contains_sector(size_t m, size_t p) const;
+
+  public:
+  Triangulator();
+
+  /**
+  * Returns the triangles of a polygon, as indices into its vertices.  Every three consecutive indices form one triangle, counter-clockwise about the normal of the polygon, as with MeshHelper::vertex_indices().
+  * A polygon of n vertices with h holes gives n + 2h - 2 triangles, or fewer where vertices are coincident or collinear.
+  * @throws std::invalid_argument if the polygon has no loops, its loop ends do not match its vertices, or its normal is zero.
+  */
+  std::vector<size_t> triangulate(const Polygon& polygon);
+
+  /**
+  * Appends the triangles of a polygon to the indices.  This reuses the memory of the indices when triangulating many polygons.
+  */
+  void triangulate(const Polygon& polygon, std::vector<size_t>& indices);
+
+  /**
+  * Returns the triangles of each polygon, triangulating the polygons in parallel.
+  * @param num_threads - the number of threads to use, or zero for one per hardware thread.
+  */
+  static std::vector<std::vector<size_t>> triangulate(const std::vector<Polygon>& polygons, size_t num_threads = 0);
+};
+
+} /* namespace CW */
+#endif /* Triangulator_hpp */
@@ -0,0 +1,118 @@
+//
+//  VertexWelder.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef VertexWelder_hpp
+#define VertexWelder_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+/**
+* VertexWelder finds points that coincide within SketchUp's tolerance, so that each location is given a single vertex index.
+*
+* Points are kept in a spatial hash of cubic cells, centred on multiples of CELL_SIZE so that points at round coordinates are far from the sides of their cells.  Points equal to a point (@see Point3D::equals()) lie within SketchUp's tolerance of it on each axis, so a search only looks in the neighbouring cells on the axes where the point is within the tolerance of its cell's side.  Most searches look in a single cell, however many points there are.
+*/
+class VertexWelder {
+  public:
+  constexpr static size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+  constexpr static double CELL_SIZE = 16.0 * SketchUpTolerance::EPSILON;
+
+  private:
+  /**
+  * A slot of the hash table, which is empty if last is NOT_FOUND.
+  */
+  struct Slot {
+    int64_t x;
+    int64_t y;
+    int64_t z;
+    size_t last; // the last point inserted into the cell
+  };
+
+  // The table is open addressed, with linear probing, so that finding a cell usually reads a single cache line.  Its size is always a power of two.
+  std::vector<Slot> m_slots;
+  size_t m_num_cells;
+  std::vector<Point3D> m_points;
+  std::vector<size_t> m_indices;
+  std::vector<size_t> m_previous; // the point inserted into the same cell before each point, or NOT_FOUND
+
+  static int64_t cell_coordinate(double value);
+
+  /**
+  * Returns the slot of the cell, or the empty slot where it would be inserted.
+  */
+  size_t slot(int64_t x, int64_t y, int64_t z) const;
+
+  /**
+  * Resizes the table to the given number of slots, which must be a power of two.
+  */
+  void rehash(size_t num_slots);
+
+  public:
+  VertexWelder();
+
+  /**
+  * Returns the index given to the first inserted point that equals the point, or NOT_FOUND if there is none.
+  */
+  size_t find(const Point3D& point) const;
+
+  /**
+  * Adds a point, without checking whether it equals another.
+  * @param index - the index to be returned by find() for points equal to this one.
+  * @throws std::invalid_argument if the point is null.
+  */
+  void insert(const Point3D& point, size_t index);
+
+  /**
+  * Returns the index of an equal point if there is one, otherwise inserts the point with the given index and returns it.
+  * @throws std::invalid_argument if the point is null.
+  */
+  size_t weld(const Point3D& point, size_t index);
+
+  /**
+  * Returns the number of points inserted.
+  */
+  size_t size() const;
+
+  /**
+  * Reserves space for the given number of points.
+  */
+  void reserve(size_t num_points);
+
+  /**
+  * Removes every point.
+  */
+  void clear();
+};
+
+} /* namespace CW */
+#endif /* VertexWelder_hpp */
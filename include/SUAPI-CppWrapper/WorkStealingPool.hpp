@@ -0,0 +1,287 @@
+//
+//  WorkStealingPool.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef WorkStealingPool_hpp
+#define WorkStealingPool_hpp
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace CW {
+
+/**
+* Returns the number of threads to run on, where zero means one per hardware thread.
+*/
+inline size_t thread_count(size_t num_threads) {
+  if (num_threads == 0) {
+    return std::max(1u, std::thread::hardware_concurrency());
+  }
+  return num_threads;
+}
+
+/**
+* A pool of threads that runs tasks, where each thread has its own queue of tasks and takes tasks from the other queues when its own is empty.
+*
+* A thread takes the most recently pushed task from its own queue, so that a task which pushes further tasks (such as the children of a node in a tree) continues depth-first and keeps its working set small.  Idle threads steal the oldest task from the front of another thread's queue, which is usually the largest piece of remaining work.  Tasks submitted from outside the pool are spread over the queues and taken oldest first, so submitting the heaviest tasks first schedules them first.
+*
+* The calling thread is one of the workers.  If a task throws, no further tasks are run, and the first exception is rethrown from run() on the calling thread.
+* Task must be default constructible and movable.
+*/
+template <class Task>
+class WorkStealingPool {
+  public:
+  /**
+  * The thread a task is running on, through which the task can push further tasks.
+  */
+  class Worker {
+    friend class WorkStealingPool;
+    private:
+    WorkStealingPool* m_pool;
+    size_t m_index;
+
+    Worker(WorkStealingPool* pool, size_t index) : m_pool(pool), m_index(index) {}
+
+    public:
+    /**
+    * Pushes a task onto this thread's queue.  It will be the next task this thread runs, unless it is stolen first.
+    */
+    void push(Task task) {
+      m_pool->push(m_index, std::move(task), false);
+    }
+
+    /**
+    * Returns the index of the thread, from zero (the calling thread) to num_threads() - 1, for keeping per-thread results without locking.
+    */
+    size_t index() const {
+      return m_index;
+    }
+  };
+
+  private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue>> m_queues;
+  std::atomic<size_t> m_pending; // the tasks queued or running
+  std::atomic<size_t> m_next_queue;
+  std::atomic<bool> m_producing;
+  std::atomic<bool> m_failed;
+  std::exception_ptr m_error;
+
+  void push(size_t queue_index, Task&& task, bool oldest_first) {
+    // Counted before it is queued, so that the pool cannot be seen as finished while the task is being pushed.
+    ++m_pending;
+    Queue& queue = *m_queues[queue_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (oldest_first) {
+      queue.tasks.push_front(std::move(task));
+    }
+    else {
+      queue.tasks.push_back(std::move(task));
+    }
+  }
+
+  bool pop(size_t queue_index, Task& task) {
+    Queue& queue = *m_queues[queue_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+  }
+
+  bool steal(size_t thief_index, Task& task) {
+    for (size_t i=1; i < m_queues.size(); ++i) {
+      Queue& queue = *m_queues[(thief_index + i) % m_queues.size()];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void fail() {
+    // Only the first error is kept, and rethrown on the calling thread.
+    if (!m_failed.exchange(true)) {
+      m_error = std::current_exception();
+    }
+  }
+
+  template <class Func>
+  void work(size_t index, Func& func) {
+    Worker worker(this, index);
+    Task task;
+    while (true) {
+      if (pop(index, task) || steal(index, task)) {
+        // After a failure the remaining tasks are drained without being run.
+        if (!m_failed) {
+          try {
+            func(task, worker);
+          }
+          catch (...) {
+            fail();
+          }
+        }
+        --m_pending;
+      }
+      else if (!m_producing && m_pending == 0) {
+        return;
+      }
+      else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  template <class Produce, class Func>
+  void run_threads(Produce& produce, Func& func) {
+    m_producing = true;
+    std::vector<std::thread> workers;
+    for (size_t i=1; i < m_queues.size(); ++i) {
+      workers.emplace_back([this, i, &func]() { work(i, func); });
+    }
+    try {
+      produce();
+    }
+    catch (...) {
+      fail();
+    }
+    m_producing = false;
+    work(0, func);
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+    m_failed = false;
+    if (m_error) {
+      std::exception_ptr error = m_error;
+      m_error = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  public:
+  /**
+  * @param num_threads - the number of threads to run tasks on, including the calling thread, or zero for one per hardware thread.
+  */
+  explicit WorkStealingPool(size_t num_threads = 0) :
+    m_pending(0),
+    m_next_queue(0),
+    m_producing(false),
+    m_failed(false)
+  {
+    num_threads = thread_count(num_threads);
+    for (size_t i=0; i < num_threads; ++i) {
+      m_queues.push_back(std::unique_ptr<Queue>(new Queue()));
+    }
+  }
+
+  size_t num_threads() const {
+    return m_queues.size();
+  }
+
+  /**
+  * Adds a task to be run by run().  Tasks are spread over the threads' queues in turn.  This may be called before run(), or while run() is producing tasks.
+  */
+  void submit(Task task) {
+    push(m_next_queue++ % m_queues.size(), std::move(task), true);
+  }
+
+  /**
+  * Runs the submitted tasks, and any tasks pushed by them, until all are done.
+  * @param func - called as func(Task&, Worker&) for each task, on any of the threads.
+  */
+  template <class Func>
+  void run(Func func) {
+    auto produce = []() {};
+    run_threads(produce, func);
+  }
+
+  /**
+  * Runs tasks while they are being produced on the calling thread, for tasks whose input can only be read on the calling thread.  The calling thread joins the other threads in running tasks once produce() returns.
+  * @param produce - called once on the calling thread, which should submit() the tasks.
+  * @param func - called as func(Task&, Worker&) for each task, on any of the threads.
+  */
+  template <class Produce, class Func>
+  void run(Produce produce, Func func) {
+    run_threads(produce, func);
+  }
+};
+
+
+/**
+* Calls func(local, begin, end) for each chunk of chunk_size indices in [0, count), on the threads of a WorkStealingPool.  Each thread makes its local value with make_local() before its first chunk, for state that is reused across chunks, such as a Triangulator or a traversal stack.  If func throws, no further chunks are started, and the first exception is rethrown on the calling thread.
+* @param num_threads - the number of threads to run on, including the calling thread, or zero for one per hardware thread.  No more threads are started than there are chunks.
+*/
+template <class MakeLocal, class Func>
+void parallel_for_chunks(size_t count, size_t chunk_size, size_t num_threads, MakeLocal make_local, Func func) {
+  using Local = decltype(make_local());
+  const size_t num_chunks = (count + chunk_size - 1) / chunk_size;
+  if (num_chunks == 0) {
+    return;
+  }
+  WorkStealingPool<size_t> pool(std::min(thread_count(num_threads), num_chunks));
+  for (size_t chunk=0; chunk < num_chunks; ++chunk) {
+    pool.submit(chunk);
+  }
+  std::vector<std::unique_ptr<Local>> locals(pool.num_threads());
+  pool.run([&](size_t& chunk, typename WorkStealingPool<size_t>::Worker& worker) {
+    std::unique_ptr<Local>& local = locals[worker.index()];
+    if (!local) {
+      local.reset(new Local(make_local()));
+    }
+    func(*local, chunk * chunk_size, std::min((chunk + 1) * chunk_size, count));
+  });
+}
+
+/**
+* Calls func(begin, end) for each chunk of chunk_size indices in [0, count), on the threads of a WorkStealingPool.  @see parallel_for_chunks() above.
+*/
+template <class Func>
+void parallel_for_chunks(size_t count, size_t chunk_size, size_t num_threads, Func func) {
+  parallel_for_chunks(count, chunk_size, num_threads, []() { return 0; }, [&func](int&, size_t begin, size_t end) {
+    func(begin, end);
+  });
+}
+
+} /* namespace CW */
+#endif /* WorkStealingPool_hpp */
@@ -0,0 +1,162 @@
+//
+//  BillOfMaterials.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef BillOfMaterials_hpp
+#define BillOfMaterials_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/model/component_definition.h>
+#include <SketchUpAPI/model/material.h>
+
+#include "SUAPI-CppWrapper/model/Material.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class DefinitionGraph;
+class Model;
+
+/**
+* A bill of materials of a model: how many times each definition occurs in the model, through any depth of nesting, and what it contributes.
+*
+* ComponentDefinition::num_instances() counts the placements of a definition, so a chair in a table set that is placed in 40 rooms counts once.  Here the multiplicity of each definition is the number of its occurrences in the model, found in one pass over the definitions in topological order (@see DefinitionGraph): the top level entities occur once, and each definition occurs as many times as the sum, over the definitions that place it, of their occurrences times its placements in them.  Definitions that are not placed in the model occur no times.
+*
+* The faces, edges, triangles and material areas of each definition's own entities are read once, and multiplied by the occurrences to give effective totals.  The number of triangles of a face is the number a triangulation of its loops has (its vertices, plus two for each inner loop, less two).  Areas are in the definition's coordinates, not scaled by the transformations of its instances, and are those of the faces' front sides, under their front materials.  Faces with the default material are listed with no material, as the material they inherit depends on the instance.
+*
+* The model is read on the calling thread when the bill is constructed, so it must be constructed again after the model has changed.  The materials are held for writing their names, so the bill must only be written while the model exists.
+*/
+class BillOfMaterials {
+  public:
+  /**
+  * The index of the material of unpainted faces.
+  */
+  static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+  /**
+  * The area of a definition's faces with a material.
+  */
+  struct MaterialArea {
+    uint32_t material; // the index in materials(), or NO_INDEX
+    double area;
+  };
+
+  /**
+  * A definition, or the top level entities of the model as the first row.
+  */
+  struct Row {
+    SUComponentDefinitionRef definition; // invalid for the top level entities
+    std::string name;
+    size_t num_occurrences; // the effective number of instances in the model
+    size_t num_placements; // the groups and component instances of the definition in the entities of other definitions, each counted once
+    size_t num_faces; // in the definition's own entities
+    size_t num_edges;
+    size_t num_triangles;
+    double area;
+
+    size_t effective_faces() const { return num_faces * num_occurrences; }
+    size_t effective_edges() const { return num_edges * num_occurrences; }
+    size_t effective_triangles() const { return num_triangles * num_occurrences; }
+    double effective_area() const { return area * static_cast<double>(num_occurrences); }
+  };
+
+  private:
+  std::vector<Row> m_rows;
+  // The material areas of row r are m_material_area_starts[r] to m_material_area_starts[r+1] - 1
+  std::vector<uint32_t> m_material_area_starts;
+  std::vector<MaterialArea> m_material_areas;
+  std::vector<Material> m_materials;
+  std::unordered_map<const void*, uint32_t> m_material_lookup;
+
+  uint32_t material_index(SUMaterialRef material);
+  void read(const Model& model, const DefinitionGraph& graph);
+
+  public:
+  /**
+  * Builds the bill of the model, from its definition graph.
+  * @throws std::logic_error if the model is null, or its definition graph has a cycle.
+  */
+  explicit BillOfMaterials(const Model& model);
+
+  /**
+  * Builds the bill of the model from a definition graph of it that has already been built.
+  * @throws std::logic_error if the model is null, or the graph has a cycle.
+  */
+  BillOfMaterials(const Model& model, const DefinitionGraph& graph);
+
+  /**
+  * Returns the number of rows, which are in the order of the nodes of the definition graph.
+  */
+  size_t size() const;
+
+  /**
+  * @throws std::out_of_range if the index is not that of a row.
+  */
+  const Row& operator[](size_t index) const;
+
+  const std::vector<Row>& rows() const;
+
+  /**
+  * Returns the materials of the material areas.
+  */
+  const std::vector<Material>& materials() const;
+
+  /**
+  * Returns the area of a row's faces under each material, in the order the materials were first found.
+  * @throws std::out_of_range if the index is not that of a row.
+  */
+  std::vector<MaterialArea> material_areas(size_t index) const;
+
+  /**
+  * Returns the totals of the whole model, as a row that occurs once and whose values are the sums of the effective values of the rows.
+  */
+  Row totals() const;
+
+  /**
+  * Writes a CSV table with a line for each row, and a header line.  Rows that occur no times are included.
+  */
+  void write_csv(std::ostream& stream) const;
+
+  /**
+  * Writes a CSV table with a line for each material of each row, giving its area and effective area, and a header line.
+  */
+  void write_material_csv(std::ostream& stream) const;
+
+  /**
+  * Writes the rows, with their material areas, as a JSON array of objects.
+  */
+  void write_json(std::ostream& stream) const;
+};
+
+} /* namespace CW */
+#endif /* BillOfMaterials_hpp */
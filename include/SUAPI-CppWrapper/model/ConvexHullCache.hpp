@@ -0,0 +1,155 @@
+//
+//  ConvexHullCache.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ConvexHullCache_hpp
+#define ConvexHullCache_hpp
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "SUAPI-CppWrapper/ConvexHull.hpp"
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class ComponentDefinition;
+class ComponentInstance;
+class Entities;
+
+/**
+* ConvexHullCache holds the convex hull, oriented bounding box and convex decomposition of component definitions, for building collision and bounding proxies.
+*
+* Each is computed the first time it is asked for, and kept for the definition, in the definition's own coordinates.  The geometry of a definition includes that of the groups and component instances inside it, which are computed from the cached results of their own definitions.  The results for an instance are those of its definition, transformed by the instance, so every instance of a definition shares the work.
+*
+* The cache is not updated when the model changes, so clear() should be called after editing the definitions.  A ConvexHullCache should only be used from one thread, as it calls the SketchUp API.
+*/
+class ConvexHullCache {
+  private:
+  struct Entry {
+    bool has_hull = false;
+    ConvexHull hull;
+    bool has_box = false;
+    OrientedBoundingBox box;
+    bool has_mesh = false;
+    std::vector<Point3D> mesh_vertices;
+    std::vector<size_t> mesh_indices;
+    bool has_decomposition = false;
+    std::vector<ConvexHull> decomposition;
+  };
+
+  ConvexHull::DecompositionOptions m_options;
+  std::unordered_map<const void*, Entry> m_entries;
+
+  /**
+  * Returns the entry for the definition, creating an empty one the first time.
+  * @throws std::logic_error if the definition is null.
+  */
+  Entry& entry(const ComponentDefinition& definition);
+
+  /**
+  * Returns the cached triangle mesh of the faces of the definition, including those of nested groups and component instances.
+  */
+  const Entry& mesh(const ComponentDefinition& definition);
+
+  /**
+  * Adds the points whose hull is the hull of the entities: the vertices of their edges, and the hull vertices of their groups and component instances.
+  */
+  void add_hull_points(const Entities& entities, std::vector<Point3D>& points);
+
+  /**
+  * Adds the triangles of the faces in the entities, and in their groups and component instances, to a mesh.
+  */
+  void add_mesh(const Entities& entities, std::vector<Point3D>& vertices, std::vector<size_t>& indices);
+
+  public:
+  /**
+  * Constructs an empty cache.
+  * @param options - the options for convex decompositions.
+  */
+  ConvexHullCache(const ConvexHull::DecompositionOptions& options = ConvexHull::DecompositionOptions());
+
+  /**
+  * Returns the convex hull of the definition's geometry.
+  * @throws std::logic_error if the definition is null.
+  */
+  const ConvexHull& hull(const ComponentDefinition& definition);
+
+  /**
+  * Returns the oriented bounding box of the definition's geometry (@see ConvexHull::oriented_bounding_box()).
+  * @throws std::logic_error if the definition is null.
+  */
+  const OrientedBoundingBox& oriented_bounding_box(const ComponentDefinition& definition);
+
+  /**
+  * Returns the convex decomposition of the faces of the definition (@see ConvexHull::decompose()).
+  * @throws std::logic_error if the definition is null.
+  */
+  const std::vector<ConvexHull>& decomposition(const ComponentDefinition& definition);
+
+  /**
+  * Returns the convex hull of an instance or group, in the coordinates of the entities that hold it.
+  * @throws std::logic_error if the instance is null.
+  */
+  ConvexHull hull(const ComponentInstance& instance);
+
+  /**
+  * Returns the oriented bounding box of an instance or group, in the coordinates of the entities that hold it.  The box is found from the transformed hull, as the box of the definition is not a box once scaled or sheared.
+  * @throws std::logic_error if the instance is null.
+  */
+  OrientedBoundingBox oriented_bounding_box(const ComponentInstance& instance);
+
+  /**
+  * Returns the convex decomposition of an instance or group, in the coordinates of the entities that hold it.
+  * @throws std::logic_error if the instance is null.
+  */
+  std::vector<ConvexHull> decomposition(const ComponentInstance& instance);
+
+  /**
+  * Returns the convex hull of a set of entities, such as those of a model.  The result is not cached, but the hulls of the definitions within the entities are.
+  */
+  ConvexHull hull(const Entities& entities);
+
+  /**
+  * Returns the convex decomposition of a set of entities.  The result is not cached, but the meshes of the definitions within the entities are.
+  */
+  std::vector<ConvexHull> decomposition(const Entities& entities);
+
+  /**
+  * Returns the number of definitions in the cache.
+  */
+  size_t size() const;
+
+  /**
+  * Removes every definition from the cache.
+  */
+  void clear();
+};
+
+} /* namespace CW */
+#endif /* ConvexHullCache_hpp */
@@ -0,0 +1,113 @@
+//
+//  DefinitionDecimator.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef DefinitionDecimator_hpp
+#define DefinitionDecimator_hpp
+
+#include <cstddef>
+#include <vector>
+
+#include "SUAPI-CppWrapper/MeshDecimator.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class ComponentDefinition;
+class GeometryInput;
+class Model;
+class String;
+
+/**
+* DefinitionDecimator builds reduced levels of detail of the faces of a ComponentDefinition, for exporting to lightweight viewers.
+*
+* The faces are read once, when the DefinitionDecimator is constructed, and triangulated into a single mesh with shared vertices (@see Triangulator).  Each combination of front material, back material and layer is a separate attribute of the mesh, so material boundaries are kept.  The hidden, soft and smooth flags of the edges of the faces are kept on the mesh edges.  Decimating calls no SketchUp API functions, so the levels of several definitions can be built in parallel.
+*
+* Each level can be written into a new definition with create_definition(), or added to any GeometryInput with add_to().  Each triangle is added as a face, and edges that were interior to a face of the source are soft and smooth, so that the triangles appear as one surface.  Textures are not repositioned on the new faces.
+*/
+class DefinitionDecimator {
+  public:
+  /**
+  * The materials and layer of a face.
+  */
+  struct FaceStyle {
+    Material front_material;
+    Material back_material;
+    Layer layer;
+  };
+
+  private:
+  MeshDecimator::Mesh m_mesh;
+  std::vector<FaceStyle> m_styles; // indexed by the attributes of the mesh
+
+  public:
+  /**
+  * Reads and triangulates the faces of the definition.  Faces within nested groups and component instances are not included, as their definitions can be decimated separately.
+  * @throws std::logic_error if the definition is null.
+  */
+  DefinitionDecimator(const ComponentDefinition& definition);
+
+  /**
+  * Returns the triangle mesh of the definition's faces.
+  */
+  const MeshDecimator::Mesh& mesh() const;
+
+  /**
+  * Returns the materials and layer of the faces of each attribute of the mesh.
+  */
+  const std::vector<FaceStyle>& styles() const;
+
+  /**
+  * Returns a mesh for each level of detail, from finest to coarsest (@see MeshDecimator::decimate()).
+  */
+  std::vector<MeshDecimator::Mesh> decimate(const std::vector<MeshDecimator::Target>& targets) const;
+
+  /**
+  * Returns the levels of detail of each definition, decimating the definitions in parallel.
+  * @param num_threads - the number of threads to use, or zero for one per hardware thread.
+  */
+  static std::vector<std::vector<MeshDecimator::Mesh>> decimate(const std::vector<DefinitionDecimator>& decimators, const std::vector<MeshDecimator::Target>& targets, size_t num_threads = 0);
+
+  /**
+  * Adds a level of detail to a GeometryInput object, with the materials, layers and edge flags of the source faces.  The materials and layers must belong to the model that the geometry is added to.
+  * @param mesh - a mesh returned by decimate().
+  * @throws std::invalid_argument if the mesh has an attribute with no style.
+  */
+  void add_to(const MeshDecimator::Mesh& mesh, GeometryInput& geom_input) const;
+
+  /**
+  * Creates a definition in the model holding a level of detail.
+  * @param mesh - a mesh returned by decimate().
+  * @param model - the model of the source definition.
+  * @param name - the name of the new definition, which is made unique if another definition has the name.
+  */
+  ComponentDefinition create_definition(const MeshDecimator::Mesh& mesh, Model& model, const String& name) const;
+};
+
+} /* namespace CW */
+#endif /* DefinitionDecimator_hpp */
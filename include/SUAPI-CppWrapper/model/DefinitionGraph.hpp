@@ -0,0 +1,181 @@
+//
+//  DefinitionGraph.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef DefinitionGraph_hpp
+#define DefinitionGraph_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/model/component_definition.h>
+
+#include "SUAPI-CppWrapper/IdRange.hpp"
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class ComponentDefinition;
+class Entities;
+class Model;
+
+/**
+* The graph of a model's component definitions (including group definitions), with an edge from each definition to the definitions of the groups and component instances in its entities.
+*
+* Node 0 is the top level entities of the model, followed by the definitions in the order of Model::definitions() and then Model::group_definitions().  A definition that holds several instances of another has one edge to it, with the number of instances.  The graph is read on the calling thread when it is constructed, and must be built again after the model has changed.
+*
+* SketchUp does not allow a definition to contain itself, so the graph should be a directed acyclic graph, but it is checked rather than assumed: topological_order() and bottom_up() throw if it has a cycle, which find_cycle() returns.
+*/
+class DefinitionGraph {
+  public:
+  /**
+  * The node returned for a definition which is not in the graph.
+  */
+  static constexpr uint32_t NO_NODE = UINT32_MAX;
+
+  private:
+  std::vector<SUComponentDefinitionRef> m_definitions; // invalid for the top level entities
+  std::vector<size_t> m_num_faces;
+  // The children of node n, and the number of instances of each, are at m_child_starts[n] to m_child_starts[n+1] - 1
+  std::vector<uint32_t> m_child_starts;
+  std::vector<uint32_t> m_children;
+  std::vector<uint32_t> m_instance_counts;
+  std::vector<uint32_t> m_parent_starts;
+  std::vector<uint32_t> m_parents;
+  std::vector<uint32_t> m_order; // parents before children, without the nodes on or below a cycle
+  std::vector<uint32_t> m_heaviest_leaves; // the nodes without children, by descending number of faces
+  std::unordered_map<const void*, uint32_t> m_node_ids;
+
+  uint32_t add_node(SUComponentDefinitionRef definition);
+  void read(const Model& model);
+  void sort();
+
+  public:
+  /**
+  * Constructs an empty graph.
+  */
+  DefinitionGraph();
+
+  /**
+  * Reads the graph of the model's definitions.  @see Model::definition_graph()
+  * @throws std::logic_error if the model is null.
+  */
+  explicit DefinitionGraph(const Model& model);
+
+  size_t num_nodes() const;
+
+  /**
+  * Returns the node of a definition, or NO_NODE if it is not in the graph.
+  */
+  uint32_t node(const ComponentDefinition& definition) const;
+
+  /**
+  * Returns the definition of a node, which is null for the top level entities.
+  * @throws std::out_of_range if the node is not in the graph.
+  */
+  ComponentDefinition definition(uint32_t node) const;
+
+  /**
+  * Returns the number of faces in the node's own entities.
+  * @throws std::out_of_range if the node is not in the graph.
+  */
+  size_t num_faces(uint32_t node) const;
+
+  /**
+  * Returns the nodes of the definitions instanced in the node's entities, each once.  As with the other ranges, the node is not checked.
+  */
+  IdRange children(uint32_t node) const;
+
+  /**
+  * Returns the number of groups or component instances of each of the node's children, in the order of children().
+  */
+  IdRange instance_counts(uint32_t node) const;
+
+  /**
+  * Returns the nodes whose entities instance the node, each once.
+  */
+  IdRange parents(uint32_t node) const;
+
+  bool is_acyclic() const;
+
+  /**
+  * Returns the nodes of a cycle, in order, with each node instancing the next and the last instancing the first.  This is empty if the graph is acyclic.
+  */
+  std::vector<uint32_t> find_cycle() const;
+
+  /**
+  * Returns the nodes in topological order: each node comes before the nodes it instances, starting with the top level entities.  The reverse order is bottom-up, with each node after the nodes it instances.
+  * @throws std::logic_error if the graph has a cycle.
+  */
+  const std::vector<uint32_t>& topological_order() const;
+
+  /**
+  * Computes a result for each node once, after the results of its children, with nodes whose children are done computed in parallel on a WorkStealingPool.  The leaves are started in descending order of their number of faces.
+  * @param compute - called as compute(node, results) from any of the threads, and returns the result of the node.  The results of the node's children are complete in results, and must not be modified.  As compute() is called from several threads at once, it must not call the SketchUp API: any input it needs should be read beforehand.
+  * @param num_threads - the number of threads, including the calling thread, or zero for one per hardware thread.
+  * @return the results by node.
+  * @throws std::logic_error if the graph has a cycle.
+  */
+  template <class Result, class Compute>
+  std::vector<Result> bottom_up(Compute compute, size_t num_threads = 0) const {
+    static_assert(!std::is_same<Result, bool>::value, "CW::DefinitionGraph::bottom_up(): results are written from several threads, which std::vector<bool> does not allow");
+    if (!is_acyclic()) {
+      throw std::logic_error("CW::DefinitionGraph::bottom_up(): the graph has a cycle");
+    }
+    const size_t size = num_nodes();
+    std::vector<Result> results(size);
+    // The number of each node's children not yet computed.  The thread that computes the last child schedules the parent.
+    std::unique_ptr<std::atomic<uint32_t>[]> pending(new std::atomic<uint32_t>[size]);
+    for (size_t i=0; i < size; ++i) {
+      pending[i] = m_child_starts[i + 1] - m_child_starts[i];
+    }
+    WorkStealingPool<uint32_t> pool(num_threads);
+    for (uint32_t leaf : m_heaviest_leaves) {
+      pool.submit(leaf);
+    }
+    const std::vector<Result>& computed = results;
+    pool.run([&](uint32_t& node, WorkStealingPool<uint32_t>::Worker& worker) {
+      results[node] = compute(node, computed);
+      for (uint32_t parent : parents(node)) {
+        if (--pending[parent] == 0) {
+          worker.push(parent);
+        }
+      }
+    });
+    return results;
+  }
+};
+
+} /* namespace CW */
+#endif /* DefinitionGraph_hpp */
@@ -0,0 +1,185 @@
+//
+//  DrawingElementTable.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef DrawingElementTable_hpp
+#define DrawingElementTable_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+#include <SketchUpAPI/model/component_instance.h>
+#include <SketchUpAPI/model/drawing_element.h>
+#include <SketchUpAPI/model/edge.h>
+#include <SketchUpAPI/model/face.h>
+#include <SketchUpAPI/model/group.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Model;
+
+/**
+* A table of the properties of many drawing elements, stored by column.
+*
+* Reading material(), layer(), hidden(), casts_shadows(), receives_shadows() and bounds() from each DrawingElement makes a C API call and a wrapper for each property of each element.  The table instead reads only the requested columns of a range of elements in one sweep, into one array per column:
+* - material and layer indices, encoded against the model's materials() and layers() (see material_dictionary() and layer_dictionary()),
+* - the hidden, casts shadows and receives shadows flags as bits,
+* - the bounding boxes.
+*
+* Rows are added in the order of the elements, so the row of an element is its index in the range.  The table holds no references to the elements, but the dictionaries hold the materials and layers of the model, so the table must only be used while the model exists.
+*/
+class DrawingElementTable {
+  public:
+  /**
+  * The columns that can be read, as bits.
+  */
+  enum Column : unsigned int {
+    ColumnMaterial = 1,
+    ColumnLayer = 2,
+    ColumnFlags = 4,
+    ColumnBounds = 8,
+    AllColumns = ColumnMaterial | ColumnLayer | ColumnFlags | ColumnBounds
+  };
+
+  /**
+  * The bits of the flags column.
+  */
+  enum Flag : uint8_t {
+    FlagHidden = 1,
+    FlagCastsShadows = 2,
+    FlagReceivesShadows = 4
+  };
+
+  /**
+  * The index in the material and layer columns of an element with no material or layer.
+  */
+  static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+  private:
+  unsigned int m_columns;
+  size_t m_size;
+  std::vector<uint32_t> m_material_indices;
+  std::vector<uint32_t> m_layer_indices;
+  std::vector<uint8_t> m_flags;
+  std::vector<SUBoundingBox3D> m_bounds;
+  std::vector<Material> m_materials;
+  std::vector<Layer> m_layers;
+  std::unordered_map<const void*, uint32_t> m_material_lookup;
+  std::unordered_map<const void*, uint32_t> m_layer_lookup;
+
+  static SUDrawingElementRef element_ref(SUDrawingElementRef element) { return element; }
+  static SUDrawingElementRef element_ref(SUFaceRef face) { return SUFaceToDrawingElement(face); }
+  static SUDrawingElementRef element_ref(SUEdgeRef edge) { return SUEdgeToDrawingElement(edge); }
+  static SUDrawingElementRef element_ref(SUComponentInstanceRef instance) { return SUComponentInstanceToDrawingElement(instance); }
+  static SUDrawingElementRef element_ref(SUGroupRef group) { return SUComponentInstanceToDrawingElement(SUGroupToComponentInstance(group)); }
+
+  /**
+  * Returns the index of the material or layer in the dictionary, adding it if it is not in the model (such as an element of another model).
+  */
+  uint32_t material_index(SUMaterialRef material);
+  uint32_t layer_index(SULayerRef layer);
+
+  void check_column(Column column, const char* method) const;
+
+  public:
+  /**
+  * Creates an empty table.
+  * @param model - the model of the elements, whose materials and layers are the dictionaries of the material and layer columns.
+  * @param columns - the columns to read, as a combination of Column bits.
+  */
+  DrawingElementTable(const Model& model, unsigned int columns = AllColumns);
+
+  /**
+  * Adds a row for an element, reading the requested columns.
+  */
+  void add(SUDrawingElementRef element);
+
+  /**
+  * Adds a row for each element of a range, in order.  The elements can be wrappers (such as Face or Group), handles (such as FaceRef) or refs of drawing elements, or anything else whose ref() is one of these types, such as the ranges of Entities.
+  */
+  template <class Range>
+  void add_all(const Range& elements) {
+    for (const auto& element : elements) {
+      add(element_ref(element.ref()));
+    }
+  }
+
+  void reserve(size_t num_rows);
+
+  /**
+  * Returns the number of rows.
+  */
+  size_t size() const;
+  bool empty() const;
+  unsigned int columns() const;
+
+  /**
+  * The columns, with one value per row.
+  * @throws std::logic_error if the column was not requested (as do the row accessors below).
+  */
+  const std::vector<uint32_t>& material_indices() const;
+  const std::vector<uint32_t>& layer_indices() const;
+  const std::vector<uint8_t>& flags() const;
+  const std::vector<SUBoundingBox3D>& bounds() const;
+
+  /**
+  * The dictionaries of the material and layer columns.  These start with the materials() and layers() of the model, in the same order.
+  */
+  const std::vector<Material>& material_dictionary() const;
+  const std::vector<Layer>& layer_dictionary() const;
+
+  /**
+  * Returns the material of the row, or a null Material if the element has none.
+  */
+  Material material(size_t row) const;
+
+  /**
+  * Returns the layer of the row, or a null Layer if the element has none.
+  */
+  Layer layer(size_t row) const;
+
+  bool hidden(size_t row) const;
+  bool casts_shadows(size_t row) const;
+  bool receives_shadows(size_t row) const;
+  BoundingBox3D bounds(size_t row) const;
+
+  /**
+  * Returns the number of rows using each entry of the material or layer dictionary.
+  */
+  std::vector<size_t> material_counts() const;
+  std::vector<size_t> layer_counts() const;
+};
+
+} /* namespace CW */
+#endif /* DrawingElementTable_hpp */
@@ -32,11 +32,13 @@
 #error "SketchUpAPI_VERSION_MAJOR must be defined to include SUAPI-CppWrapper headers"
 #endif
 
+#include <utility>
 #include <vector>
 
 #include <SketchUpAPI/model/entities.h>
 
 #include "SUAPI-CppWrapper/String.hpp"
+#include "SUAPI-CppWrapper/model/EntityRange.hpp"
 #include "SUAPI-CppWrapper/model/Model.hpp"
 
 namespace CW {
@@ -128,6 +130,42 @@ class Entities {
   */
   std::vector<Group> groups() const;
 
+  /**
+  * Ranges over the Faces, Edges, ComponentInstances and Groups in the Entities object.  Unlike faces(), edges(), instances() and groups(), the wrapper objects are made one at a time as the range is iterated, and the refs are held in a buffer reused between calls on the same thread, so no allocation is needed once the buffer has grown (@see EntityRange).
+  * The header of the wrapper class must be included to iterate over a range.
+  * @param stray_only - if true, only stray edges (not bounding faces) are included.
+  * @throws std::logic_error if the Entities is null.
+  */
+  EntityRange<Face, SUFaceRef> face_range() const;
+  EntityRange<Edge, SUEdgeRef> edge_range(bool stray_only = true) const;
+  EntityRange<ComponentInstance, SUComponentInstanceRef> instance_range() const;
+  EntityRange<Group, SUGroupRef> group_range() const;
+
+  /**
+  * Calls the visitor with each Face, Edge, ComponentInstance or Group in the Entities object (@see face_range()).
+  * @param visitor - a function taking the wrapper object, such as [](const Face& face) {}.
+  * @throws std::logic_error if the Entities is null.
+  */
+  template <class Visitor>
+  void for_each_face(Visitor&& visitor) const {
+    face_range().for_each(std::forward<Visitor>(visitor));
+  }
+
+  template <class Visitor>
+  void for_each_edge(Visitor&& visitor, bool stray_only = true) const {
+    edge_range(stray_only).for_each(std::forward<Visitor>(visitor));
+  }
+
+  template <class Visitor>
+  void for_each_instance(Visitor&& visitor) const {
+    instance_range().for_each(std::forward<Visitor>(visitor));
+  }
+
+  template <class Visitor>
+  void for_each_group(Visitor&& visitor) const {
+    group_range().for_each(std::forward<Visitor>(visitor));
+  }
+
   /**
   * Return the BoundingBox of the Entities object.
   */
@@ -314,6 +352,11 @@ class Entities {
   */
   Model model() const;
 
+  /**
+  * Returns SUEntitiesRef object for the Entities.
+  */
+  SUEntitiesRef ref() const;
+
   /*
   * The class object can be converted to a SUEntitiesRef without loss of data.
   */
@@ -0,0 +1,215 @@
+//
+//  EntityRange.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef EntityRange_hpp
+#define EntityRange_hpp
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace CW {
+
+/**
+* A pool of buffers of refs for each thread, so that refs can be fetched from the C API without allocating each time.
+*
+* A buffer is taken from the pool while it is in use, so that ranges held at the same time (such as over the faces of nested entities) each have their own.  Buffers keep their capacity when returned, and only a few are kept.  Buffers grown larger than MAX_CAPACITY (such as by the faces of a very large Entities object) are freed rather than kept, so that a thread does not hold on to them for its lifetime.
+*/
+template <class Ref>
+class RefBuffers {
+  private:
+  static constexpr size_t MAX_BUFFERS = 8;
+  static constexpr size_t MAX_CAPACITY = 65536;
+
+  static std::vector<std::vector<Ref>>& pool() {
+    thread_local std::vector<std::vector<Ref>> buffers;
+    return buffers;
+  }
+
+  public:
+  /**
+  * Returns an empty buffer, from the pool if there is one.
+  */
+  static std::vector<Ref> take() {
+    std::vector<std::vector<Ref>>& buffers = pool();
+    if (buffers.empty()) {
+      return std::vector<Ref>();
+    }
+    std::vector<Ref> buffer = std::move(buffers.back());
+    buffers.pop_back();
+    return buffer;
+  }
+
+  /**
+  * Returns a buffer to the pool, or frees it if the pool is full or the buffer is too large to keep.
+  */
+  static void give(std::vector<Ref>&& buffer) {
+    std::vector<std::vector<Ref>>& buffers = pool();
+    if (buffers.size() < MAX_BUFFERS && buffer.capacity() > 0 && buffer.capacity() <= MAX_CAPACITY) {
+      buffer.clear();
+      buffers.push_back(std::move(buffer));
+    }
+  }
+};
+
+/**
+* EntityRange is a range over the refs of a type of entity, such as the faces of an Entities object, that makes a wrapper object for each ref as it is reached.
+*
+* Unlike a std::vector of wrapper objects, no wrapper objects are made beforehand, and the refs are held in a buffer reused between ranges on the same thread (@see RefBuffers).  A range is only valid until the entities are changed.
+*/
+template <class T, class Ref>
+class EntityRange {
+  private:
+  std::vector<Ref> m_refs;
+
+  public:
+  class iterator {
+    private:
+    const Ref* m_ref;
+
+    public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = T;
+
+    explicit iterator(const Ref* ref = nullptr):
+      m_ref(ref)
+    {}
+
+    T operator*() const {
+      return T(*m_ref);
+    }
+
+    iterator& operator++() {
+      ++m_ref;
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator previous = *this;
+      ++m_ref;
+      return previous;
+    }
+
+    bool operator==(const iterator& other) const {
+      return m_ref == other.m_ref;
+    }
+
+    bool operator!=(const iterator& other) const {
+      return m_ref != other.m_ref;
+    }
+  };
+
+  /**
+  * Constructs a range over the refs, which should come from RefBuffers<Ref>::take().
+  */
+  explicit EntityRange(std::vector<Ref>&& refs):
+    m_refs(std::move(refs))
+  {}
+
+  EntityRange(EntityRange&& other) noexcept:
+    m_refs(std::move(other.m_refs))
+  {}
+
+  EntityRange& operator=(EntityRange&& other) noexcept {
+    std::swap(m_refs, other.m_refs);
+    return *this;
+  }
+
+  EntityRange(const EntityRange&) = delete;
+  EntityRange& operator=(const EntityRange&) = delete;
+
+  /**
+  * Returns the buffer of refs to this thread's pool.
+  */
+  ~EntityRange() {
+    RefBuffers<Ref>::give(std::move(m_refs));
+  }
+
+  iterator begin() const {
+    return iterator(m_refs.data());
+  }
+
+  iterator end() const {
+    return iterator(m_refs.data() + m_refs.size());
+  }
+
+  size_t size() const {
+    return m_refs.size();
+  }
+
+  bool empty() const {
+    return m_refs.empty();
+  }
+
+  T operator[](size_t index) const {
+    return T(m_refs[index]);
+  }
+
+  /**
+  * Returns the refs of the range.
+  */
+  const std::vector<Ref>& refs() const {
+    return m_refs;
+  }
+
+  /**
+  * Returns a range over the same refs that makes objects of another type, such as the handles in EntityRefs.hpp.  The refs are moved, leaving this range empty.
+  */
+  template <class U>
+  EntityRange<U, Ref> as() && {
+    return EntityRange<U, Ref>(std::move(m_refs));
+  }
+
+  /**
+  * Calls the visitor with the wrapper object of each ref in turn.
+  */
+  template <class Visitor>
+  void for_each(Visitor&& visitor) const {
+    for (const Ref& ref : m_refs) {
+      visitor(T(ref));
+    }
+  }
+
+  /**
+  * Returns the wrapper objects of every ref.
+  */
+  std::vector<T> to_vector() const {
+    std::vector<T> result;
+    result.reserve(m_refs.size());
+    for (const Ref& ref : m_refs) {
+      result.push_back(T(ref));
+    }
+    return result;
+  }
+};
+
+} /* namespace CW */
+#endif /* EntityRange_hpp */
@@ -0,0 +1,221 @@
+//
+//  EntityRefs.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef EntityRefs_hpp
+#define EntityRefs_hpp
+
+#include <cstddef>
+#include <vector>
+
+#include <SketchUpAPI/model/component_instance.h>
+#include <SketchUpAPI/model/edge.h>
+#include <SketchUpAPI/model/face.h>
+#include <SketchUpAPI/model/group.h>
+#include <SketchUpAPI/model/vertex.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class BoundingBox3D;
+class ComponentDefinition;
+class ComponentInstance;
+class Edge;
+class EdgeRef;
+class Face;
+class FaceRef;
+class Layer;
+class Material;
+class String;
+class Transformation;
+class Vertex;
+
+/**
+* Lightweight handles to entities in a model, for reading the geometry of a model in hot loops.
+*
+* Each handle holds only the ref of the entity, so it is trivially copyable and the size of a pointer, and making, copying or destroying one never calls the SketchUp API.  A handle does not own its entity: it must only be used while the entity exists in the model, and it cannot be used to create or release entities.  Handles give the read accessors of the owning wrapper classes, and can be converted to the wrapper class (such as Face) where anything more is needed.
+*
+* Handles can be iterated over without allocating with the ranges of Entities, such as entities.face_range().as<FaceRef>().
+*/
+class VertexRef {
+  private:
+  SUVertexRef m_vertex;
+
+  public:
+  VertexRef();
+  VertexRef(SUVertexRef vertex);
+
+  SUVertexRef ref() const;
+  explicit operator bool() const;
+  bool operator!() const;
+  bool operator==(const VertexRef& other) const;
+  bool operator!=(const VertexRef& other) const;
+
+  /**
+  * Returns the owning wrapper of the vertex.
+  */
+  explicit operator Vertex() const;
+
+  /**
+  * @throws std::logic_error if the handle is null (as do all the accessors below).
+  */
+  Point3D position() const;
+
+  /**
+  * Returns the edges that meet at the vertex.
+  */
+  std::vector<EdgeRef> edges() const;
+
+  /**
+  * Returns the faces that use the vertex.
+  */
+  std::vector<FaceRef> faces() const;
+};
+
+
+class EdgeRef {
+  private:
+  SUEdgeRef m_edge;
+
+  public:
+  EdgeRef();
+  EdgeRef(SUEdgeRef edge);
+
+  SUEdgeRef ref() const;
+  explicit operator bool() const;
+  bool operator!() const;
+  bool operator==(const EdgeRef& other) const;
+  bool operator!=(const EdgeRef& other) const;
+
+  /**
+  * Returns the owning wrapper of the edge.
+  */
+  explicit operator Edge() const;
+
+  VertexRef start() const;
+  VertexRef end() const;
+
+  /**
+  * Returns the vector from the start to the end of the edge.
+  */
+  Vector3D vector() const;
+
+  double length() const;
+
+  /**
+  * Returns the faces bounded by the edge.
+  */
+  std::vector<FaceRef> faces() const;
+  bool soft() const;
+  bool smooth() const;
+  bool hidden() const;
+  Material material() const;
+  Layer layer() const;
+  BoundingBox3D bounds() const;
+};
+
+
+class FaceRef {
+  private:
+  SUFaceRef m_face;
+
+  public:
+  FaceRef();
+  FaceRef(SUFaceRef face);
+
+  SUFaceRef ref() const;
+  explicit operator bool() const;
+  bool operator!() const;
+  bool operator==(const FaceRef& other) const;
+  bool operator!=(const FaceRef& other) const;
+
+  /**
+  * Returns the owning wrapper of the face.
+  */
+  explicit operator Face() const;
+
+  double area() const;
+  Plane3D plane() const;
+  Vector3D normal() const;
+  size_t num_inner_loops() const;
+
+  /**
+  * Returns the vertices of the face, in no particular order (@see Face::vertices()).
+  */
+  std::vector<VertexRef> vertices() const;
+
+  /**
+  * Returns the edges of all the loops of the face, each once.
+  */
+  std::vector<EdgeRef> edges() const;
+
+  /**
+  * Returns the material of the front of the face.
+  */
+  Material material() const;
+  Material back_material() const;
+  Layer layer() const;
+  bool hidden() const;
+  BoundingBox3D bounds() const;
+};
+
+
+/**
+* A handle to a component instance or a group.  A group is a kind of component instance in the C API, so a handle to either gives the same accessors.
+*/
+class InstanceRef {
+  private:
+  SUComponentInstanceRef m_instance;
+
+  public:
+  InstanceRef();
+  InstanceRef(SUComponentInstanceRef instance);
+  InstanceRef(SUGroupRef group);
+
+  SUComponentInstanceRef ref() const;
+  explicit operator bool() const;
+  bool operator!() const;
+  bool operator==(const InstanceRef& other) const;
+  bool operator!=(const InstanceRef& other) const;
+
+  /**
+  * Returns the owning wrapper of the instance.  For a group, this is the ComponentInstance of the group.
+  */
+  explicit operator ComponentInstance() const;
+
+  Transformation transformation() const;
+  ComponentDefinition definition() const;
+  String name() const;
+  Material material() const;
+  Layer layer() const;
+  bool hidden() const;
+  BoundingBox3D bounds() const;
+};
+
+} /* namespace CW */
+#endif /* EntityRefs_hpp */
@@ -0,0 +1,73 @@
+//
+//  FaceClassifier.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef FaceClassifier_hpp
+#define FaceClassifier_hpp
+
+#include <vector>
+
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/LoopClassifier.hpp"
+
+namespace CW {
+
+/**
+* FaceClassifier answers repeated point-in-face queries for a single face.
+*
+* The outer and inner loops of the face are fetched once, and a LoopClassifier is built for each, so that each query is independent of the number of vertices of the face.  The results are identical to Face::classify_point(), which uses this class.  @see LoopClassifier.
+*/
+class FaceClassifier {
+  private:
+  LoopClassifier m_outer_loop;
+  std::vector<LoopClassifier> m_inner_loops;
+
+  public:
+  /**
+  * Constructs a classifier for the face.
+  * @throws std::logic_error if the face is null.
+  */
+  FaceClassifier(const Face& face);
+
+  /**
+  * Constructs a classifier for the face given by the points of its outer and inner loops.
+  * @param outer_loop - the points of the outer loop of the face.
+  * @param inner_loops - the points of each of the inner loops (holes) of the face.
+  * @throws std::invalid_argument if any of the loops is not valid.
+  */
+  FaceClassifier(const std::vector<Point3D>& outer_loop, const std::vector<std::vector<Point3D>>& inner_loops = {});
+
+  /**
+  * Determine where on the face a point lies.  @see FacePointClass.
+  * @param point - the Point3D object to check.
+  * @throws std::invalid_argument if the point is null.
+  */
+  FacePointClass classify(const Point3D& point) const;
+};
+
+} /* namespace CW */
+#endif /* FaceClassifier_hpp */
@@ -0,0 +1,218 @@
+//
+//  FaceData.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef FaceData_hpp
+#define FaceData_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+#include <SketchUpAPI/model/face.h>
+#include <SketchUpAPI/model/layer.h>
+#include <SketchUpAPI/model/material.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Face;
+class Layer;
+class LoopInput;
+class Material;
+class Transformation;
+
+/**
+* A snapshot of the geometry and properties of one or more faces, read from the C API in a single pass.
+*
+* Reading a face through the wrappers fetches its loops again for every accessor, and reads each vertex and edge flag with a separate call through a temporary wrapper.  FaceData instead reads the points of every loop, the flags, materials and layers of every edge, and the plane, materials and layer of each face once, into flat arrays shared by all the faces in the snapshot.  The snapshot is then read without calling the SketchUp API, and can be used to create copies of the faces, transformed or otherwise.
+*
+* The materials and layers are held as refs, so the snapshot must only be used while the entities it was made from exist.
+*/
+class FaceData {
+  public:
+  /**
+  * Flags of an edge, as bits.
+  */
+  enum EdgeFlags : uint8_t {
+    EdgeHidden = 1,
+    EdgeSoft = 2,
+    EdgeSmooth = 4
+  };
+
+  /**
+  * The properties of the edge leading from a point of a loop to the next.
+  */
+  struct EdgeData {
+    uint8_t flags;
+    SUMaterialRef material;
+    SULayerRef layer;
+
+    bool hidden() const { return (flags & EdgeHidden) != 0; }
+    bool soft() const { return (flags & EdgeSoft) != 0; }
+    bool smooth() const { return (flags & EdgeSmooth) != 0; }
+  };
+
+  /**
+  * A loop of a face in the snapshot.  The edge at an index leads from the point at that index to the next.
+  */
+  class LoopView {
+    private:
+    const Point3D* m_points;
+    const EdgeData* m_edges;
+    size_t m_size;
+
+    public:
+    LoopView(const Point3D* points, const EdgeData* edges, size_t size);
+
+    size_t size() const { return m_size; }
+    const Point3D* begin() const { return m_points; }
+    const Point3D* end() const { return m_points + m_size; }
+    const Point3D& point(size_t index) const { return m_points[index]; }
+    const EdgeData& edge(size_t index) const { return m_edges[index]; }
+
+    /**
+    * Returns a copy of the points of the loop, optionally transformed.
+    */
+    std::vector<Point3D> points() const;
+    std::vector<Point3D> points(const Transformation& transformation) const;
+
+    /**
+    * Returns a LoopInput with the edge properties of the loop (the equivalent of Loop::loop_input()).
+    * @param vertex_index - the index of the first vertex of the loop.  Only when using a GeometryInput object would this be higher than 0.
+    */
+    LoopInput loop_input(size_t vertex_index = 0) const;
+  };
+
+  /**
+  * A face in the snapshot.
+  */
+  class FaceView {
+    private:
+    const FaceData* m_data;
+    size_t m_index;
+
+    public:
+    FaceView(const FaceData* data, size_t index);
+
+    /**
+    * Returns the face the snapshot was made from.
+    */
+    SUFaceRef face_ref() const;
+
+    LoopView outer_loop() const;
+    size_t num_inner_loops() const;
+    LoopView inner_loop(size_t index) const;
+
+    /**
+    * Returns the total number of points in all the loops of the face.
+    */
+    size_t num_points() const;
+
+    Plane3D plane() const;
+
+    /**
+    * Returns the front material of the face, or a null Material if it has none (as do back_material() and layer()).
+    */
+    Material material() const;
+    Material back_material() const;
+    Layer layer() const;
+
+    /**
+    * Creates a new detached face with the loops and edge properties of the snapshot.  The materials, layer and attributes of the face are not copied.
+    * @param inner_loops - when false, only the outer loop is created.
+    * @return the new face, or SU_INVALID if the points cannot be made into a face.  The caller is responsible for the returned face.
+    */
+    SUFaceRef create_face_ref(bool inner_loops = true) const;
+
+    /**
+    * As create_face_ref(), with the points transformed.
+    */
+    SUFaceRef create_face_ref(const Transformation& transformation, bool inner_loops = true) const;
+  };
+
+  private:
+  std::vector<Point3D> m_points;
+  std::vector<EdgeData> m_edges;
+  // The index of the first point of each loop, with the total number of points appended, so that loop i spans [m_loop_starts[i], m_loop_starts[i+1]).
+  std::vector<size_t> m_loop_starts;
+  // The index of the outer loop of each face, with the total number of loops appended.  The inner loops of a face follow its outer loop.
+  std::vector<size_t> m_face_loops;
+  std::vector<SUFaceRef> m_faces;
+  std::vector<SUPlane3D> m_planes;
+  std::vector<SUMaterialRef> m_front_materials;
+  std::vector<SUMaterialRef> m_back_materials;
+  std::vector<SULayerRef> m_layers;
+
+  /**
+  * Reads a face onto the end of the snapshot.
+  */
+  void read_face(SUFaceRef face, std::vector<SULoopRef>& loop_buffer, std::vector<SUVertexRef>& vertex_buffer, std::vector<SUEdgeRef>& edge_buffer);
+
+  LoopView loop(size_t loop_index) const;
+
+  SUFaceRef create_face_ref(size_t face_index, const Transformation* transformation, bool inner_loops) const;
+
+  public:
+  /**
+  * Creates an empty snapshot.
+  */
+  FaceData();
+
+  /**
+  * Reads a single face.
+  * @throws std::invalid_argument if the face is null.
+  */
+  explicit FaceData(const Face& face);
+
+  /**
+  * Reads a list of faces into one snapshot, reusing the same buffers for every face.  The face at index i is read into operator[](i).
+  * @throws std::invalid_argument if any of the faces is null.
+  */
+  explicit FaceData(const std::vector<Face>& faces);
+
+  /**
+  * Returns the number of faces in the snapshot.
+  */
+  size_t size() const;
+  bool empty() const;
+
+  /**
+  * Returns the total number of points in all the faces of the snapshot.
+  */
+  size_t num_points() const;
+
+  /**
+  * @throws std::out_of_range if the index is not less than size().
+  */
+  FaceView operator[](size_t index) const;
+};
+
+} /* namespace CW */
+#endif /* FaceData_hpp */
@@ -31,12 +31,14 @@
 #include <algorithm>
 #include <vector>
 #include <array>
+#include <memory>
 #include <unordered_map>
 
 #include <SketchUpAPI/geometry.h>
 #include <SketchUpAPI/model/entities.h>
 
 #include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/VertexWelder.hpp"
 
 namespace CW {
 
@@ -56,10 +58,36 @@ class LoopInput;
 class GeometryInput {
   friend class Entities;
 
+public:
+  /**
+  * Counts of the points given to add_vertex() while welding vertices.
+  */
+  struct WeldStatistics {
+    size_t points = 0; // the number of points given
+    size_t vertices = 0; // the number of vertices added for them
+
+    /**
+    * Returns the fraction of the points that were welded to an existing vertex, rather than adding a vertex.
+    */
+    double ratio() const;
+  };
+
 private:
   SUGeometryInputRef m_geometry_input;
 
-  size_t m_vertex_count = 0;
+  struct WeldState {
+    VertexWelder welder;
+    WeldStatistics statistics;
+  };
+
+  struct SharedState {
+    size_t vertex_count = 0;
+    // Null unless welding is enabled.
+    std::unique_ptr<WeldState> weld;
+  };
+
+  // Copies of a GeometryInput share the same SUGeometryInputRef, so they also share the count of its vertices and the welded vertices.
+  std::shared_ptr<SharedState> m_state;
 
   // Tracks the number of GeometryInput objects have been allocated, to allow the destructor to release an object only at the right time.
   static std::unordered_map<SUGeometryInputRef, size_t> num_objects_;
@@ -109,12 +137,29 @@ public:
   /**
   * Adds a vertex to the GeometryInput object.
   * @param point - the Point3D location of the vertex to add.
-  * @return the index number of the added vertex
+  * @return the index number of the added vertex, or when welding vertices, the index of an existing vertex at the same location.
   */
   size_t add_vertex(const Point3D& point);
 
   /**
-  * Sets all vertices of a geometry input object. Any existing vertices will be overridden.
+  * Enables or disables vertex welding.  While welding is enabled, add_vertex() returns the index of an existing vertex that equals the point within SketchUp's tolerance, instead of adding another vertex.  This saves adding the corners of each face many times over when copying faces that share vertices.
+  * Only vertices added with add_vertex() or set_vertices() while welding is enabled are welded to.  Disabling welding discards the welded vertices and statistics.  Copies of the GeometryInput share the setting, as they add to the same vertices.
+  * @param weld - true to enable welding.
+  */
+  void weld_vertices(bool weld);
+
+  /**
+  * Returns true if vertex welding is enabled.
+  */
+  bool weld_vertices() const;
+
+  /**
+  * Returns the counts of points and vertices added since welding was enabled.
+  */
+  WeldStatistics weld_statistics() const;
+
+  /**
+  * Sets all vertices of a geometry input object. Any existing vertices will be overridden.  When welding vertices, the points are not welded to each other, but points added later are welded to them.
   * @param points - vector of points to set as the vertices
   */
   void set_vertices(const std::vector<SUPoint3D>& points);
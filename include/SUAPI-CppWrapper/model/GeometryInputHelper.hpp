@@ -34,6 +34,7 @@
 #include "SUAPI-CppWrapper/model/Material.hpp"
 #include "SUAPI-CppWrapper/model/Layer.hpp"
 #include "SUAPI-CppWrapper/model/GeometryInput.hpp"
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
 
 namespace CW {
 
@@ -112,6 +113,11 @@ private:
   // GeometryInputPlus objects require that the target model (for inputting information) be known, to ensure that materials and layers assigned to geometry exists in the target model.
   Model* m_target_model;
 
+  /**
+  * Adds the points of a loop as vertices, and adds their indices and the edge properties of the loop to the LoopInput object.  The loop is closed by adding the first vertex index again.
+  */
+  void add_loop_vertices(const FaceData::LoopView& loop, LoopInput& loop_input);
+
 public:
   /**
   * Creates a valid, but empty GeometryInputPlus object.
@@ -167,6 +173,14 @@ public:
   */
   size_t add_face(const Face &face, bool copy_material_layer = true);
 
+  /**
+  * Adds a face from a FaceData snapshot to the Geometry Input object.  This is as add_face(const Face&, bool), without reading the face again.
+  * @param face_data - the face in the snapshot to be copied into the GeometryInput object.
+  * @param copy_material_layer - (optional) when true, materials and layers will be copied to the GeometryInput object.
+  * @return index to the added face.
+  */
+  size_t add_face(const FaceData::FaceView& face_data, bool copy_material_layer = true);
+
   /**
   * Adds a face to the Geometry Input object using the safer LoopInput method, which can deal with inner loops.
   * @param loops - vector of loops.  The first loop in the vector is the outer loop, and all subsequent loops are the inner loops.
@@ -0,0 +1,186 @@
+//
+//  HalfEdgeMesh.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef HalfEdgeMesh_hpp
+#define HalfEdgeMesh_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+#include <SketchUpAPI/model/edge.h>
+#include <SketchUpAPI/model/face.h>
+#include <SketchUpAPI/model/vertex.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/IdRange.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Edge;
+class Entities;
+class Face;
+class Vertex;
+
+/**
+* An immutable half-edge snapshot of the topology of the faces and edges of an Entities object, for graph algorithms that would otherwise query the SketchUp API for each step.
+*
+* The vertices, edges, faces and loops are given dense ids, in the order they were read.  Each loop of a face is a cycle of half-edges, one for each use of an edge by the loop (the equivalent of an EdgeUse), and the half-edges of a loop have consecutive ids.  The half-edges using the same edge are linked in a cycle of partners, so an edge used by two faces is the twin of its partner.  Every query is answered in constant time from flat arrays, without calling the SketchUp API, and does not check its id.  The ids can be mapped back to the wrapper objects with vertex(), edge() and face(), which do check them.
+*
+* The SketchUp API is read on the calling thread, as it is not thread safe.  The adjacency arrays are then built from what was read in parallel.
+*
+* The snapshot must be built again after the entities have changed.  Only the entities themselves are read: groups and component instances have their own topology.
+*/
+class HalfEdgeMesh {
+  public:
+  /**
+  * The id returned where there is no such element, such as the partner of a half-edge whose edge is used by only one loop.
+  */
+  static constexpr uint32_t NO_ID = UINT32_MAX;
+
+  private:
+  // Vertices
+  std::vector<SUVertexRef> m_vertex_refs;
+  std::vector<Point3D> m_positions;
+  std::vector<uint32_t> m_vertex_edge_starts;
+  std::vector<uint32_t> m_vertex_edges;
+  // Edges, with the start and end vertex of edge e at 2e and 2e + 1
+  std::vector<SUEdgeRef> m_edge_refs;
+  std::vector<uint32_t> m_edge_vertices;
+  std::vector<uint32_t> m_edge_half_edge_starts;
+  std::vector<uint32_t> m_edge_half_edges;
+  // Faces and loops.  The loops of face f are m_face_loop_starts[f] to m_face_loop_starts[f+1] - 1, the first being the outer loop.
+  std::vector<SUFaceRef> m_face_refs;
+  std::vector<uint32_t> m_face_loop_starts;
+  std::vector<uint32_t> m_loop_faces;
+  std::vector<uint32_t> m_loop_half_edge_starts;
+  // Half-edges
+  std::vector<uint32_t> m_half_edge_origins;
+  std::vector<uint32_t> m_half_edge_edges;
+  std::vector<uint32_t> m_half_edge_loops;
+  std::vector<uint32_t> m_half_edge_partners;
+  // Ids of the refs
+  std::unordered_map<const void*, uint32_t> m_vertex_ids;
+  std::unordered_map<const void*, uint32_t> m_edge_ids;
+  std::unordered_map<const void*, uint32_t> m_face_ids;
+
+  uint32_t add_vertex(SUVertexRef vertex);
+  uint32_t add_edge(SUEdgeRef edge);
+  void read(const Entities& entities);
+  void link(size_t num_threads);
+
+  public:
+  /**
+  * Constructs an empty mesh.
+  */
+  HalfEdgeMesh();
+
+  /**
+  * Builds the mesh of the faces and edges (including stray edges) of the entities.
+  * @param num_threads - the number of threads to build the adjacency arrays with, or zero for one per hardware thread.
+  * @throws std::logic_error if the entities are null.
+  */
+  explicit HalfEdgeMesh(const Entities& entities, size_t num_threads = 0);
+
+  size_t num_vertices() const;
+  size_t num_edges() const;
+  size_t num_faces() const;
+  size_t num_loops() const;
+  size_t num_half_edges() const;
+
+  /**
+  * Returns the number of bytes held by the mesh, including its adjacency arrays and the hash maps of the refs.  The hash maps are estimated, as their nodes are allocated by the standard library.
+  */
+  size_t memory_usage() const;
+
+  /**
+  * Mapping between ids and the wrapper objects.  The id of an object that is not in the mesh is NO_ID.
+  * @throws std::out_of_range if the id is out of range.
+  */
+  Vertex vertex(uint32_t vertex_id) const;
+  Edge edge(uint32_t edge_id) const;
+  Face face(uint32_t face_id) const;
+  uint32_t vertex_id(const Vertex& vertex) const;
+  uint32_t edge_id(const Edge& edge) const;
+  uint32_t face_id(const Face& face) const;
+
+  /**
+  * Vertex queries.
+  */
+  const Point3D& position(uint32_t vertex_id) const;
+  IdRange vertex_edges(uint32_t vertex_id) const;
+
+  /**
+  * Edge queries.  The half-edges of an edge are the uses of the edge by the loops of faces, so an edge bounding two faces has two half-edges.
+  */
+  uint32_t edge_start(uint32_t edge_id) const;
+  uint32_t edge_end(uint32_t edge_id) const;
+  IdRange edge_half_edges(uint32_t edge_id) const;
+
+  /**
+  * Returns true if the edge is used by exactly two loops, in opposite directions, as in a closed and consistently oriented surface.
+  */
+  bool is_manifold_edge(uint32_t edge_id) const;
+
+  /**
+  * Face and loop queries.  The half-edges of a loop are the ids loop_half_edge(loop_id) to loop_half_edge(loop_id) + loop_size(loop_id) - 1.
+  */
+  uint32_t outer_loop(uint32_t face_id) const;
+  size_t num_face_loops(uint32_t face_id) const;
+  uint32_t loop_face(uint32_t loop_id) const;
+  uint32_t loop_half_edge(uint32_t loop_id) const;
+  size_t loop_size(uint32_t loop_id) const;
+
+  /**
+  * Half-edge queries.  A half-edge runs from its origin to the origin of the next half-edge of its loop.
+  */
+  uint32_t origin(uint32_t half_edge_id) const;
+  uint32_t destination(uint32_t half_edge_id) const;
+  uint32_t half_edge_edge(uint32_t half_edge_id) const;
+  uint32_t half_edge_loop(uint32_t half_edge_id) const;
+  uint32_t half_edge_face(uint32_t half_edge_id) const;
+  uint32_t next(uint32_t half_edge_id) const;
+  uint32_t previous(uint32_t half_edge_id) const;
+
+  /**
+  * Returns the next half-edge using the same edge, or NO_ID if the edge is used by this half-edge alone (the equivalent of EdgeUse::partners()).
+  */
+  uint32_t partner(uint32_t half_edge_id) const;
+
+  /**
+  * Labels the faces by the groups of faces connected through shared edges.
+  * @param num_components - set to the number of groups.
+  * @return the group of each face, numbered from zero in order of their first face.
+  */
+  std::vector<uint32_t> connected_components(size_t& num_components) const;
+};
+
+} /* namespace CW */
+#endif /* HalfEdgeMesh_hpp */
@@ -0,0 +1,126 @@
+//
+//  LoopClassifier.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef LoopClassifier_hpp
+#define LoopClassifier_hpp
+
+#include <cstddef>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+
+namespace CW {
+
+/**
+* LoopClassifier answers repeated point-in-loop queries for a single loop.
+*
+* Loop::classify_point() fetches the loop's vertices and examines every edge for each point.  LoopClassifier does this work once: the vertices are projected onto the coordinate plane closest to the loop's plane, and the edges are sorted into a grid of horizontal bands in the projected space.  A query then only examines the edges in the band that the point falls in, which for typical loops is a handful of edges, regardless of the size of the loop.  Where most edges span most of the loop's height, as in a zigzag, the bands are made taller so that the index stays within three entries per edge, and a query examines more edges.
+*
+* The results are identical to Loop::classify_point(), including the tolerances used for vertices and edges.  The classifier keeps its own copy of the loop's points, so it remains valid if the Loop is changed or released, but will not reflect those changes.  It is not modified by queries, so may be shared between threads.
+*/
+class LoopClassifier {
+  private:
+  /**
+  * An edge from m_points[i] to the following point, with the values needed to find the distance to it.
+  */
+  struct EdgeData {
+    Point3D start;
+    Vector3D vector;
+    double length_squared;
+  };
+
+  std::vector<Point3D> m_points;
+  std::vector<SUPoint2D> m_points_2d;
+  std::vector<EdgeData> m_edges;
+  Plane3D m_plane;
+  size_t m_axis;
+
+  /**
+  * Bounds of the projected loop, expanded by SketchUp's tolerance.  Points outside these bounds cannot be on or inside the loop.
+  */
+  double m_min_x;
+  double m_max_x;
+  double m_min_y;
+  double m_max_y;
+
+  /**
+  * The bands are of equal height, with at most one band per edge, and band i holds the edges m_band_edges[m_band_offsets[i]] to m_band_edges[m_band_offsets[i+1]-1].  An edge is held in every band that its projected y range (expanded by SketchUp's tolerance) overlaps.
+  */
+  double m_inverse_band_height;
+  std::vector<size_t> m_band_offsets;
+  std::vector<size_t> m_band_edges;
+
+  /**
+  * Returns the band that the projected y value falls into, clamped to the grid.
+  */
+  size_t band(double y) const;
+
+  void build_index();
+
+  public:
+  /**
+  * Constructs a classifier for the loop given by the vector of points.
+  * @param loop_points - a vector of points representing the vertices of a loop.
+  * @throws std::invalid_argument if fewer than 3 points are given, or the points do not form a valid loop.
+  */
+  LoopClassifier(const std::vector<Point3D>& loop_points);
+
+  /**
+  * Constructs a classifier for the loop, fetching its points once.
+  * @throws std::logic_error if the loop is null.
+  */
+  LoopClassifier(const Loop& loop);
+
+  /**
+  * Determine where on the loop a point lies.  @see PointLoopClassify.
+  * @param point - the Point3D object to check.
+  * @throws std::invalid_argument if the point is null.
+  */
+  PointLoopClassify classify(const Point3D& point) const;
+
+  /**
+  * Returns the plane of the loop, as given by Plane3D::plane_from_loop().
+  */
+  const Plane3D& plane() const;
+
+  /**
+  * Returns the number of edges/vertices in the loop.
+  */
+  size_t size() const;
+
+  /**
+  * Returns the number of edges held in all the bands, which is at most three times size().
+  */
+  size_t index_size() const;
+};
+
+} /* namespace CW */
+#endif /* LoopClassifier_hpp */
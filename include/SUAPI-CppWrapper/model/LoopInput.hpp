@@ -32,6 +32,7 @@
 
 #include <SketchUpAPI/model/geometry_input.h>
 
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
 #include "SUAPI-CppWrapper/model/Material.hpp"
 #include "SUAPI-CppWrapper/model/Layer.hpp"
 
@@ -69,6 +70,7 @@ struct InputEdgeProperties {
 class LoopInput {
   friend class Face;
   friend class GeometryInput;
+  friend class FaceData;
 
   private:
   SULoopInputRef m_loop_input;
@@ -109,6 +111,13 @@ class LoopInput {
   */
   LoopInput(const std::vector<InputEdgeProperties>& loop_edge_properties, size_t vertex_index = 0);
 
+  /**
+  * Create LoopInput object from a loop of a FaceData snapshot, copying the properties of its edges.
+  * @param loop - the loop from which edge properties will be copied to the new loop input.
+  * @param vertex_index - 0 by default.  This is the first index of the vertex to be added to the loop.  Only when using SUGeometryInputRef object would you use an index higher than 0.
+  */
+  LoopInput(const FaceData::LoopView& loop, size_t vertex_index = 0);
+
   /** Copy constructor */
   LoopInput(const LoopInput& other);
 
@@ -41,6 +41,7 @@ namespace CW {
   class Camera;
   class Classifications;
   class ComponentDefinition;
+  class DefinitionGraph;
   class Layer;
   class Axes;
   class AttributeDictionary;
@@ -220,6 +221,11 @@ class Model {
   */
   std::vector<ComponentDefinition> group_definitions() const;
 
+  /**
+  * Returns the graph of the model's definitions and group definitions, with an edge from each definition to those instanced in its entities.  @see DefinitionGraph
+  */
+  DefinitionGraph definition_graph() const;
+
   /**
   * Returns the InstancePath of the given persistent ID in this model.
   * @return InstancePath object of the given persistent ID.
@@ -0,0 +1,136 @@
+//
+//  ModelRayCaster.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef ModelRayCaster_hpp
+#define ModelRayCaster_hpp
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/model/face.h>
+#include <SketchUpAPI/model/component_instance.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/RayCaster.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/InstancePath.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Model;
+class Entities;
+
+/**
+* ModelRayCaster finds the faces of a model hit by rays, in the manner of Ruby's Model#raytest, using a RayCaster.
+*
+* The faces of each component definition (and group) are tessellated once, however many instances it has, and each group or component instance becomes an instance of its definition's mesh.  Hidden entities and layers are not taken into account.
+*
+* The model is read when the ModelRayCaster is constructed, so it must be constructed again after the model has changed.
+*/
+class ModelRayCaster {
+  public:
+  /**
+  * The first face hit by a ray.
+  */
+  struct Hit {
+    Face face;
+    InstancePath path; // the groups and component instances containing the face, with the face as the leaf
+    double distance;
+    Point3D point; // the point hit, in world space
+    Vector3D normal; // the unit normal of the face at the point hit, in world space
+
+    /**
+    * Returns true if the ray hit nothing.
+    */
+    bool operator!() const;
+  };
+
+  private:
+  RayCaster m_caster;
+  std::vector<std::vector<SUFaceRef>> m_mesh_faces; // the face of each triangle of each mesh
+  std::unordered_map<const void*, size_t> m_definition_meshes;
+  std::vector<size_t> m_instance_meshes;
+  std::vector<std::vector<SUComponentInstanceRef>> m_instance_paths; // the groups and component instances leading to each instance of a mesh
+
+  /**
+  * Tessellates the faces of the entities into a new mesh, returning its index.
+  */
+  size_t add_mesh(const Entities& entities);
+
+  /**
+  * Adds an instance of the mesh of the entities, and instances of the meshes of the groups and component instances in them.
+  */
+  void add_entities(const Entities& entities, size_t mesh, const Transformation& world, std::vector<SUComponentInstanceRef>& path);
+
+  public:
+  /**
+  * Constructs a ModelRayCaster that hits nothing.
+  */
+  ModelRayCaster();
+
+  /**
+  * Reads the faces of the model, including those inside groups and component instances.
+  * @throws std::logic_error if the model is null.
+  */
+  explicit ModelRayCaster(const Model& model);
+
+  /**
+  * Reads the faces of the entities, including those inside groups and component instances.  The coordinates of the entities are taken as world space.
+  * @throws std::logic_error if the entities are null.
+  */
+  explicit ModelRayCaster(const Entities& entities);
+
+  /**
+  * Returns the first face hit by the ray.
+  * @param origin - the start of the ray.
+  * @param direction - the direction of the ray, which need not be a unit vector.
+  */
+  Hit raytest(const Point3D& origin, const Vector3D& direction) const;
+
+  /**
+  * Casts a batch of rays, in packets and in parallel (@see RayCaster::cast()).  The hits can be converted with resolve(), which calls the C API, so it is best done only for the hits needed.
+  * @param num_threads - the number of threads to use, or zero for one per hardware thread.
+  */
+  std::vector<RayCaster::Hit> cast(const std::vector<RayCaster::Ray>& rays, size_t num_threads = 0) const;
+
+  /**
+  * Returns the face and instance path of a hit returned by cast().
+  * @param ray - the ray that gave the hit.
+  */
+  Hit resolve(const RayCaster::Ray& ray, const RayCaster::Hit& hit) const;
+
+  /**
+  * Returns the underlying RayCaster.  Its instances are added depth first as the model is read: the top level entities, then each group and then each component instance, each followed by the instances inside it.  Entities with no faces, and instances scaled to nothing, have no instance of their own, so the top level entities are the first instance only if they have faces.  Use resolve() to find the path of a hit.
+  */
+  const RayCaster& caster() const;
+};
+
+} /* namespace CW */
+#endif /* ModelRayCaster_hpp */
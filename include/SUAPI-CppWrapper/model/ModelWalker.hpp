@@ -0,0 +1,225 @@
+//
+//  ModelWalker.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef ModelWalker_hpp
+#define ModelWalker_hpp
+
+#include <cstddef>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <SketchUpAPI/model/component_definition.h>
+#include <SketchUpAPI/model/component_instance.h>
+
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/InstancePath.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class ComponentDefinition;
+class Model;
+
+/**
+* ModelWalker visits every occurrence of the entities of a model, through its groups and component instances, from a graph of its definitions that is read once.
+*
+* Each distinct set of entities is a node of the graph: the top level entities are node 0, and each component definition (or group definition) reached from them is another node.  The groups and component instances in a node's entities are the edges to their definitions' nodes, with the instance's transformation.  An occurrence is a path from the root to a node, with the product of the transformations along it.
+*
+* The SketchUp API is not thread safe, so the graph is read on the calling thread when the ModelWalker is constructed, and only walk() and the read step of map_definitions() call back on the calling thread, where the API may be used.  walk_parallel() and the compute step of map_definitions() call back on the threads of a WorkStealingPool, where only the data passed in should be used.  Work is weighted by the number of faces, so that the largest definitions are started first.
+*
+* The graph must be built again after the model has changed.
+*/
+class ModelWalker {
+  public:
+  /**
+  * A group or component instance in the entities of a node.
+  */
+  struct Child {
+    size_t node; // the node of the instance's definition
+    SUComponentInstanceRef instance;
+    Transformation transformation;
+  };
+
+  /**
+  * A set of entities: the top level entities, or the entities of a definition.
+  */
+  struct Node {
+    SUComponentDefinitionRef definition; // invalid for the top level entities
+    size_t num_faces; // the faces in the entities themselves
+    size_t total_faces; // the faces in one occurrence of the node, including those of its instances
+    std::vector<Child> children;
+  };
+
+  /**
+  * An occurrence of a node, reached from the top level entities through the instances in path.
+  */
+  struct Occurrence {
+    size_t node;
+    Transformation transformation; // from the node's entities to the top level
+    std::vector<SUComponentInstanceRef> path;
+  };
+
+  private:
+  Entities m_entities;
+  std::vector<Node> m_nodes;
+  std::vector<std::vector<size_t>> m_heaviest_children; // the indices of each node's children, by descending total_faces
+  std::vector<size_t> m_heaviest_nodes; // the nodes by descending num_faces
+  std::vector<size_t> m_finish_order; // the nodes in the order their entities were finished reading, so each after the nodes below it
+  size_t m_num_threads;
+
+  size_t add_node(SUComponentDefinitionRef definition, const Entities& entities, std::unordered_map<const void*, size_t>& node_indices, std::vector<bool>& reading);
+  void build();
+  static void push_instance(InstancePath& path, SUComponentInstanceRef instance);
+
+  template <class Visitor>
+  void walk_node(Occurrence& occurrence, InstancePath& path, Visitor& visitor) const {
+    visitor(static_cast<const Occurrence&>(occurrence), static_cast<const InstancePath&>(path));
+    const Transformation world = occurrence.transformation;
+    for (const Child& child : m_nodes[occurrence.node].children) {
+      occurrence.node = child.node;
+      occurrence.transformation = world * child.transformation;
+      occurrence.path.push_back(child.instance);
+      push_instance(path, child.instance);
+      walk_node(occurrence, path, visitor);
+      path.pop();
+      occurrence.path.pop_back();
+    }
+  }
+
+  public:
+  /**
+  * Reads the graph of the model's entities.
+  * @param num_threads - the number of threads for walk_parallel() and map_definitions(), including the calling thread, or zero for one per hardware thread.
+  * @throws std::logic_error if the model is null, or a definition contains itself.
+  */
+  explicit ModelWalker(const Model& model, size_t num_threads = 0);
+
+  /**
+  * Reads the graph of the entities, which are the top level of the walk.
+  * @param num_threads - the number of threads for walk_parallel() and map_definitions(), including the calling thread, or zero for one per hardware thread.
+  * @throws std::logic_error if the entities are null, or a definition contains itself.
+  */
+  explicit ModelWalker(const Entities& entities, size_t num_threads = 0);
+
+  size_t num_nodes() const;
+
+  /**
+  * @throws std::out_of_range if the index is not that of a node.
+  */
+  const Node& node(size_t index) const;
+
+  /**
+  * Returns the definition of a node, which is null for the top level entities.
+  * @throws std::out_of_range if the index is not that of a node.
+  */
+  ComponentDefinition definition(size_t index) const;
+
+  /**
+  * @throws std::out_of_range if the index is not that of a node.
+  */
+  Entities entities(size_t index) const;
+
+  /**
+  * Returns the number of occurrences of each node in the walk, without walking it.
+  */
+  std::vector<size_t> occurrence_counts() const;
+
+  /**
+  * Returns the instance path of an occurrence, for callers of walk_parallel().  This calls the SketchUp API, so must be called on the calling thread.
+  */
+  InstancePath instance_path(const Occurrence& occurrence) const;
+
+  /**
+  * Visits each occurrence depth-first on the calling thread, starting with the top level entities, and each node's groups before its component instances.
+  * @param visitor - called as visitor(const Occurrence&, const InstancePath&).  The instance path holds the instances of the occurrence's path, so can be used to make InstancePaths to its entities with set_leaf().
+  */
+  template <class Visitor>
+  void walk(Visitor visitor) const {
+    Occurrence occurrence{0, Transformation(), {}};
+    InstancePath path;
+    walk_node(occurrence, path, visitor);
+  }
+
+  /**
+  * Visits each occurrence on the threads of a WorkStealingPool, in no particular order.  The children of an occurrence are visited after it, and the occurrences with most faces below them are the first to be stolen by idle threads.
+  * @param visitor - called as visitor(const Occurrence&, size_t thread_index) from any of the threads at once, so must not call the SketchUp API.  thread_index is below num_threads(), for keeping per-thread results.
+  */
+  template <class Visitor>
+  void walk_parallel(Visitor visitor) const {
+    WorkStealingPool<Occurrence> pool(m_num_threads);
+    pool.submit(Occurrence{0, Transformation(), {}});
+    pool.run([&](Occurrence& occurrence, typename WorkStealingPool<Occurrence>::Worker& worker) {
+      visitor(static_cast<const Occurrence&>(occurrence), worker.index());
+      const std::vector<Child>& children = m_nodes[occurrence.node].children;
+      // This thread continues with the last child pushed, leaving the heaviest to be stolen.
+      for (size_t child_index : m_heaviest_children[occurrence.node]) {
+        const Child& child = children[child_index];
+        Occurrence child_occurrence{child.node, occurrence.transformation * child.transformation, occurrence.path};
+        child_occurrence.path.push_back(child.instance);
+        worker.push(std::move(child_occurrence));
+      }
+    });
+  }
+
+  /**
+  * Computes a result for each node once, however many occurrences it has.  The nodes are read in descending order of their number of faces on the calling thread, while the threads of a WorkStealingPool compute the results of those already read.
+  * @param read - called as read(node_index) on the calling thread, where the SketchUp API may be used, to return the input for the node.  The input must be default constructible and movable.
+  * @param compute - called as compute(Input&) on any of the threads, so must not call the SketchUp API.
+  * @return the result of compute() for each node, by node index.
+  */
+  template <class Read, class Compute>
+  auto map_definitions(Read read, Compute compute) const -> std::vector<decltype(compute(std::declval<decltype(read(size_t(0)))&>()))> {
+    using Input = decltype(read(size_t(0)));
+    using Result = decltype(compute(std::declval<Input&>()));
+    static_assert(!std::is_same<Result, bool>::value, "CW::ModelWalker::map_definitions(): results are written from several threads, which std::vector<bool> does not allow");
+    std::vector<Result> results(m_nodes.size());
+    WorkStealingPool<std::pair<size_t, Input>> pool(m_num_threads);
+    pool.run(
+      [&]() {
+        for (size_t index : m_heaviest_nodes) {
+          pool.submit(std::pair<size_t, Input>(index, read(index)));
+        }
+      },
+      [&](std::pair<size_t, Input>& task, typename WorkStealingPool<std::pair<size_t, Input>>::Worker&) {
+        results[task.first] = compute(task.second);
+      });
+    return results;
+  }
+
+  /**
+  * Returns the number of threads used by walk_parallel() and map_definitions().
+  */
+  size_t num_threads() const;
+};
+
+} /* namespace CW */
+#endif /* ModelWalker_hpp */
@@ -0,0 +1,145 @@
+//
+//  PolygonMesh.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef PolygonMesh_hpp
+#define PolygonMesh_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+#include <SketchUpAPI/model/edge.h>
+#include <SketchUpAPI/model/face.h>
+#include <SketchUpAPI/model/loop.h>
+#include <SketchUpAPI/model/vertex.h>
+
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Entities;
+class Transformation;
+
+/**
+* The faces and edges of an Entities object as one indexed polygon mesh, with each vertex stored once.
+*
+* Each vertex is given a dense index the first time it is met, by the identity of its ref, so the points of vertices shared between faces and edges are read and stored only once.  The mesh is stored in flat arrays, which can be handed to exporters or other code as they are:
+* - points() holds the position of each vertex.
+* - The loops of each face are lists of vertex indices in indices().  The indices of loop i are indices()[loop_starts()[i]] to indices()[loop_starts()[i+1] - 1].
+* - The loops of face f are loop face_loops()[f] to face_loops()[f+1] - 1.  The first is the outer loop, and the rest are the inner loops.
+* - face_materials(), face_back_materials() and face_layers() hold an index into materials() or layers() for each face, or NO_INDEX.
+* - edges() holds the start and end vertex index of each edge, and edge_flags() its FaceData::EdgeFlags bits.
+*
+* The nested component instances and groups can be included, with their points transformed.  As vertices cannot be shared between different Entities objects, each occurrence of a definition has its own vertices.
+*/
+class PolygonMesh {
+  public:
+  /**
+  * The material or layer index of a face with no material or layer.
+  */
+  static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+  private:
+  std::vector<SUPoint3D> m_points;
+  std::vector<uint32_t> m_indices;
+  std::vector<uint32_t> m_loop_starts;
+  std::vector<uint32_t> m_face_loops;
+  std::vector<uint32_t> m_face_materials;
+  std::vector<uint32_t> m_face_back_materials;
+  std::vector<uint32_t> m_face_layers;
+  std::vector<uint32_t> m_edges;
+  std::vector<uint8_t> m_edge_flags;
+  std::vector<Material> m_materials;
+  std::vector<Layer> m_layers;
+  std::unordered_map<const void*, uint32_t> m_material_lookup;
+  std::unordered_map<const void*, uint32_t> m_layer_lookup;
+
+  /**
+  * Buffers reused while reading one Entities object.
+  */
+  struct Scratch {
+    std::unordered_map<const void*, uint32_t> vertex_indices;
+    std::vector<SULoopRef> loops;
+    std::vector<SUVertexRef> vertices;
+  };
+
+  uint32_t vertex_index(SUVertexRef vertex, Scratch& scratch);
+  uint32_t material_index(SUMaterialRef material);
+  uint32_t layer_index(SULayerRef layer);
+  void add_face(SUFaceRef face, Scratch& scratch);
+  void add_edge(SUEdgeRef edge, Scratch& scratch);
+  void add_entities(const Entities& entities, const Transformation& transformation, bool recursive, Scratch& scratch);
+
+  public:
+  /**
+  * Creates an empty mesh.
+  */
+  PolygonMesh();
+
+  /**
+  * Creates the mesh of the faces and edges of an Entities object.
+  * @param entities - the entities to read.
+  * @param recursive - if true, the faces and edges of nested component instances and groups are included, transformed into the coordinates of the entities.
+  * @throws std::logic_error if the Entities is null.
+  */
+  explicit PolygonMesh(const Entities& entities, bool recursive = false);
+
+  /**
+  * Adds the faces and edges of an Entities object to the mesh, with their points transformed.  The indices of the faces and edges already in the mesh are not changed.
+  * @throws std::logic_error if the Entities is null.
+  */
+  void add(const Entities& entities, const Transformation& transformation, bool recursive = false);
+
+  size_t num_points() const;
+  size_t num_faces() const;
+  size_t num_loops() const;
+  size_t num_edges() const;
+
+  const std::vector<SUPoint3D>& points() const;
+  const std::vector<uint32_t>& indices() const;
+  const std::vector<uint32_t>& loop_starts() const;
+  const std::vector<uint32_t>& face_loops() const;
+  const std::vector<uint32_t>& face_materials() const;
+  const std::vector<uint32_t>& face_back_materials() const;
+  const std::vector<uint32_t>& face_layers() const;
+  const std::vector<uint32_t>& edges() const;
+  const std::vector<uint8_t>& edge_flags() const;
+
+  /**
+  * The dictionaries of the face material and layer indices, in the order the materials and layers were first met.
+  */
+  const std::vector<Material>& materials() const;
+  const std::vector<Layer>& layers() const;
+};
+
+} /* namespace CW */
+#endif /* PolygonMesh_hpp */
@@ -0,0 +1,188 @@
+//
+//  SpatialIndex.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef SpatialIndex_hpp
+#define SpatialIndex_hpp
+
+#include <cstddef>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/geometry.h>
+#include <SketchUpAPI/model/drawing_element.h>
+#include <SketchUpAPI/model/component_instance.h>
+
+#include "SUAPI-CppWrapper/BoundingVolumeHierarchy.hpp"
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Entities;
+class ComponentInstance;
+class Camera;
+class InstancePath;
+
+/**
+* SpatialIndex finds the faces, edges, groups and component instances whose world space bounds meet a box, sphere or view frustum, without visiting every entity through the C API.
+*
+* The index is built from an Entities object (usually the model's entities), descending into groups and component instances.  The bounds of each entity are fetched once, and stored in a BoundingVolumeHierarchy in world space.  Entities inside a component definition with several instances are indexed once for each instance.
+*
+* When the transformations of groups or component instances change, update() refits the index to their new positions.  Only the transformations are fetched again, and only the affected parts of the hierarchy are updated.  Adding or erasing entities requires the index to be built again.
+*/
+class SpatialIndex {
+  public:
+  constexpr static size_t NO_PARENT = std::numeric_limits<size_t>::max();
+
+  /**
+  * An indexed entity.  Entities are listed depth first, so the entities inside a group or component instance follow it.
+  */
+  struct Item {
+    SUDrawingElementRef element;
+    SURefType type; // SURefType_Face, SURefType_Edge, SURefType_Group or SURefType_ComponentInstance
+    size_t parent; // the index of the group or component instance containing the entity, or NO_PARENT at the top level
+  };
+
+  private:
+  /**
+  * A coordinate system: the top level, or the inside of a group or component instance.
+  */
+  struct Frame {
+    SUComponentInstanceRef instance;
+    size_t parent;
+    Transformation local; // the instance's transformation
+    Transformation world; // the transformation from the frame to world space
+  };
+
+  std::vector<Item> m_items;
+  std::vector<size_t> m_item_frames; // the frame of each item's local bounds, which for groups and instances is their own frame
+  std::vector<size_t> m_subtree_ends; // one past the index of the last entity inside each item
+  std::vector<SUBoundingBox3D> m_local_bounds;
+  std::vector<SUBoundingBox3D> m_world_bounds;
+  std::vector<Frame> m_frames;
+  std::unordered_multimap<const void*, size_t> m_instance_items;
+  BoundingVolumeHierarchy m_hierarchy;
+
+  void add_entities(const Entities& entities, size_t parent, size_t frame, size_t depth, size_t max_depth);
+  void add_instance(const ComponentInstance& instance, SURefType type, size_t parent, size_t frame, size_t depth, size_t max_depth);
+  size_t add_item(SUDrawingElementRef element, SURefType type, size_t parent, size_t frame, const SUBoundingBox3D& local_bounds);
+
+  /**
+  * Recomputes the world transformations and bounds of a group or component instance and everything inside it, adding the indices of the items whose bounds were recomputed to changed.
+  */
+  void update_world(size_t index, std::vector<size_t>& changed);
+
+  /**
+  * Returns the indices of the entities whose world bounds pass the test, which is also applied to the nodes of the hierarchy.
+  */
+  template <typename BoxTest>
+  std::vector<size_t> collect(BoxTest&& test) const;
+
+  public:
+  /**
+  * Constructs an empty index.
+  */
+  SpatialIndex();
+
+  /**
+  * Builds an index of the entities.
+  * @param entities - the entities to index.  Their coordinates are taken as world space.
+  * @param max_depth - the number of levels of groups and component instances to descend into.  With zero, only the entities themselves are indexed, with groups and component instances represented by their bounds.
+  * @throws std::logic_error if the entities are null.
+  */
+  SpatialIndex(const Entities& entities, size_t max_depth = std::numeric_limits<size_t>::max());
+
+  /**
+  * Returns the number of indexed entities.
+  */
+  size_t size() const;
+
+  /**
+  * Returns an indexed entity.
+  * @throws std::out_of_range if the index is out of range.
+  */
+  const Item& item(size_t index) const;
+
+  /**
+  * Returns the world space bounds of an indexed entity.
+  */
+  BoundingBox3D bounds(size_t index) const;
+
+  /**
+  * Returns the transformation from the coordinates of the entity to world space.  This is the product of the transformations of the groups and component instances containing it, as given by InstancePath::total_transformation().
+  */
+  const Transformation& transformation(size_t index) const;
+
+  /**
+  * Returns the instance path to the entity, through the groups and component instances containing it.
+  */
+  InstancePath path(size_t index) const;
+
+  /**
+  * Returns the indices of the entities whose bounds overlap the box.  The order of the results is not defined.
+  */
+  std::vector<size_t> query(const BoundingBox3D& box) const;
+
+  /**
+  * Returns the indices of the entities whose bounds meet the sphere.
+  */
+  std::vector<size_t> query(const Point3D& centre, double radius) const;
+
+  /**
+  * Returns the indices of the entities whose bounds may be inside the convex volume bounded by the planes.  Each plane's normal must point out of the volume.  Boxes near the edges of the volume may be returned even though they are outside it.
+  */
+  std::vector<size_t> query(const std::vector<Plane3D>& planes) const;
+
+  /**
+  * Returns the indices of the entities whose bounds may be visible from the camera, within its clipping distances.
+  * @param camera - a perspective or orthographic camera.
+  * @param screen_aspect_ratio - the ratio of the width to the height of the view, used if the camera does not have its own aspect ratio.
+  */
+  std::vector<size_t> query(const Camera& camera, double screen_aspect_ratio) const;
+
+  /**
+  * Returns the planes of the camera's view frustum, with normals pointing out of the frustum, in the form used by query(const std::vector<Plane3D>&).
+  */
+  static std::vector<Plane3D> frustum_planes(const Camera& camera, double screen_aspect_ratio);
+
+  /**
+  * Refits the index after the transformation of a group or component instance has changed.  Every occurrence of the instance in the index is updated.
+  * @return the number of occurrences updated.
+  */
+  size_t update(const ComponentInstance& instance);
+
+  /**
+  * Refits the index after the transformations of any groups or component instances have changed.  Every transformation is fetched again, but no bounds are.
+  */
+  void update();
+};
+
+} /* namespace CW */
+#endif /* SpatialIndex_hpp */
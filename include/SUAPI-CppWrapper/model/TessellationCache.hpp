@@ -0,0 +1,145 @@
+//
+//  TessellationCache.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef TessellationCache_hpp
+#define TessellationCache_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SketchUpAPI/model/material.h>
+
+#include "SUAPI-CppWrapper/TessellatedMesh.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class ComponentDefinition;
+class Entities;
+class TessellationFileCache;
+
+/**
+* TessellationCache holds the tessellation of the faces of component definitions, so that an exporter tessellates each definition once, however many instances it has.
+*
+* The mesh of a definition is made the first time it is asked for, from a MeshHelper for each of the definition's own faces, in the definition's coordinates.  The groups and component instances inside the definition are not included: as with ModelWalker, each instance can be emitted as its transformation and the cached mesh of its definition.  The materials of the mesh's ranges are indices into materials(), which is shared by all the meshes.
+*
+* The SketchUp API gives no way to tell that a definition has changed, so each mesh is kept with a revision given by the caller.  Asking for a definition with a different revision makes its mesh again, so an exporter that edits a definition can bump its revision, or call erase() or clear().  A TessellationCache should only be used from one thread, as it calls the SketchUp API.
+*
+* Between runs, meshes can be kept on disk with a TessellationFileCache, keyed by content_hash() (@see load_or_tessellate()).
+*/
+class TessellationCache {
+  public:
+  /**
+  * The statistics of a cache.
+  */
+  struct Stats {
+    size_t hits; // requests for a mesh that had already been made
+    size_t misses; // requests that made a mesh, including those for a new revision
+    size_t num_meshes;
+    size_t num_vertices;
+    size_t num_triangles;
+    size_t memory_usage; // the bytes held by the meshes' buffers
+
+    /**
+    * Returns the proportion of requests that were hits, or zero if there were none.
+    */
+    double hit_rate() const;
+  };
+
+  private:
+  struct Entry {
+    uint64_t revision;
+    TessellatedMesh mesh;
+  };
+
+  std::unordered_map<const void*, Entry> m_entries;
+  std::vector<Material> m_materials;
+  std::unordered_map<const void*, uint32_t> m_material_lookup;
+  size_t m_hits;
+  size_t m_misses;
+
+  uint32_t material_index(SUMaterialRef material);
+
+  public:
+  TessellationCache();
+
+  /**
+  * Returns the mesh of the definition's own faces, making it if it has not been made for this revision.  The reference is valid until the definition's mesh is made again, erased or cleared.
+  * @param revision - the revision of the definition's geometry, which the caller should change when it changes the definition.
+  * @throws std::logic_error if the definition is null.
+  */
+  const TessellatedMesh& mesh(const ComponentDefinition& definition, uint64_t revision = 0);
+
+  /**
+  * Tessellates the faces of any entities, such as the top level entities of a model, without caching the mesh.  The materials are added to materials().
+  * @throws std::logic_error if the entities are null.
+  */
+  TessellatedMesh tessellate(const Entities& entities);
+
+  /**
+  * Returns a hash of everything the mesh of the entities' own faces is made from: the points of each face's loops, the name, type, colour, opacity and texture of its materials, and the UV coordinates of its points on textured sides.  Reading these is much cheaper than tessellating, so the hash can be used to find a mesh made by an earlier run.
+  * The hash does not depend on the addresses of any objects, so it is the same for the same geometry in any model or run (but may change with the version of this library).
+  */
+  static uint64_t content_hash(const Entities& entities);
+
+  /**
+  * Returns the mesh of the entities' own faces from the file cache if it holds the entities' content_hash(), or otherwise tessellates them and stores the mesh in the file cache.  This does not use or change the in-memory meshes.
+  * @param material_names - set to the names of the materials, which the ranges of the returned mesh index.  As names are unique in a model, they can be found with Model::materials().
+  * @throws std::logic_error if the entities are null.
+  */
+  static TessellatedMesh load_or_tessellate(const Entities& entities, TessellationFileCache& file_cache, std::vector<std::string>& material_names);
+
+  /**
+  * Returns the materials of the meshes' ranges.
+  */
+  const std::vector<Material>& materials() const;
+
+  /**
+  * Returns true if the mesh of the definition has been made, for any revision.
+  */
+  bool contains(const ComponentDefinition& definition) const;
+
+  /**
+  * Removes the mesh of the definition.
+  */
+  void erase(const ComponentDefinition& definition);
+
+  /**
+  * Removes every mesh, and resets the statistics.  The materials are kept.
+  */
+  void clear();
+
+  Stats stats() const;
+};
+
+} /* namespace CW */
+#endif /* TessellationCache_hpp */
@@ -0,0 +1,121 @@
+//
+//  VertexTree.hpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef VertexTree_hpp
+#define VertexTree_hpp
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <SketchUpAPI/model/vertex.h>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/KdTree.hpp"
+#include "SUAPI-CppWrapper/model/Vertex.hpp"
+
+namespace CW {
+
+// Forward Declarations
+class Entities;
+
+/**
+* VertexTree finds the vertices of a set of entities nearest to a point, for snapping points onto existing geometry.
+*
+* The positions of the vertices are fetched once, when the tree is built, and held in a KdTree in world space.  Vertices inside groups and component instances are included once for each instance, at their position in that instance.
+*
+* The tree must be built again after the entities have changed.
+*/
+class VertexTree {
+  private:
+  std::vector<SUVertexRef> m_vertices;
+  std::vector<Point3D> m_positions;
+  KdTree m_tree;
+
+  public:
+  /**
+  * Constructs an empty tree.
+  */
+  VertexTree();
+
+  /**
+  * Builds a tree of the vertices of the edges (and so of the faces) in the entities.
+  * @param entities - the entities whose vertices are to be found.  Their coordinates are taken as world space.
+  * @param max_depth - the number of levels of groups and component instances to descend into.  With zero, only the vertices of the entities themselves are included.
+  * @param num_threads - the number of threads to build the tree with, or zero for one per hardware thread.
+  * @throws std::logic_error if the entities are null.
+  */
+  VertexTree(const Entities& entities, size_t max_depth = std::numeric_limits<size_t>::max(), size_t num_threads = 0);
+
+  /**
+  * Returns the number of vertices in the tree, counting vertices in several instances once for each.
+  */
+  size_t size() const;
+
+  bool empty() const;
+
+  /**
+  * Returns the underlying tree.  Its indices are the indices used by vertex() and position().
+  */
+  const KdTree& tree() const;
+
+  /**
+  * Returns a vertex in the tree.
+  * @throws std::out_of_range if the index is out of range.
+  */
+  Vertex vertex(size_t index) const;
+
+  /**
+  * Returns the world space position of a vertex in the tree.
+  * @throws std::out_of_range if the index is out of range.
+  */
+  Point3D position(size_t index) const;
+
+  /**
+  * Returns the vertex nearest to the point, or a null Vertex if there is none within the maximum distance.
+  */
+  Vertex nearest(const Point3D& point, double max_distance = std::numeric_limits<double>::infinity()) const;
+
+  /**
+  * Returns the k vertices nearest to the point, within the maximum distance, nearest first.
+  */
+  std::vector<Vertex> k_nearest(const Point3D& point, size_t k, double max_distance = std::numeric_limits<double>::infinity()) const;
+
+  /**
+  * Returns the vertices within the radius of the point.  The order of the results is not defined.
+  */
+  std::vector<Vertex> within(const Point3D& point, double radius = Point3D::EPSILON) const;
+
+  /**
+  * Returns the nearest vertex within the radius of each of the points, or a null Vertex for points with none.
+  * @param num_threads - the number of threads to search with, or zero for one per hardware thread.
+  */
+  std::vector<Vertex> nearest(const std::vector<Point3D>& points, double radius = Point3D::EPSILON, size_t num_threads = 0) const;
+};
+
+} /* namespace CW */
+#endif /* VertexTree_hpp */
@@ -0,0 +1,299 @@
+//
+//  BoundingVolumeHierarchy.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SUAPI-CppWrapper/BoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace CW {
+
+namespace {
+
+constexpr size_t NUM_BINS = 16;
+constexpr size_t NO_PARENT = std::numeric_limits<size_t>::max();
+
+/**
+* Nodes with more items than this are split even if the surface area heuristic suggests otherwise (as it can for many large, overlapping boxes), so that leaves stay small wherever the items can be separated.
+*/
+constexpr size_t MAX_LEAF_SIZE = 64;
+
+double coordinate(const SUPoint3D& point, size_t axis) {
+  return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+double centre(const SUBoundingBox3D& box, size_t axis) {
+  return 0.5 * (coordinate(box.min_point, axis) + coordinate(box.max_point, axis));
+}
+
+/**
+* Returns half the surface area of the box, which is all the heuristic needs.  Empty boxes have no area.
+*/
+double half_area(const SUBoundingBox3D& box) {
+  const double x = box.max_point.x - box.min_point.x;
+  const double y = box.max_point.y - box.min_point.y;
+  const double z = box.max_point.z - box.min_point.z;
+  if (!(x >= 0.0 && y >= 0.0 && z >= 0.0)) {
+    return 0.0;
+  }
+  return (x * y) + (y * z) + (z * x);
+}
+
+} // namespace
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+{}
+
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const std::vector<SUBoundingBox3D>& boxes, size_t leaf_size) {
+  if (leaf_size == 0) {
+    throw std::invalid_argument("CW::BoundingVolumeHierarchy::BoundingVolumeHierarchy(): leaf_size must be at least 1");
+  }
+  const size_t num_items = boxes.size();
+  if (num_items == 0) {
+    return;
+  }
+  m_items.resize(num_items);
+  for (size_t i=0; i < num_items; ++i) {
+    m_items[i] = i;
+  }
+  m_nodes.reserve(2 * ((num_items + leaf_size - 1) / leaf_size));
+  m_parents.reserve(m_nodes.capacity());
+  m_nodes.push_back(Node{empty_box(), 0, num_items});
+  m_parents.push_back(NO_PARENT);
+  update_bounds(0, boxes);
+
+  // Nodes are split in the order they are created, so the children of a node always follow it.
+  std::vector<size_t> pending = {0};
+  while (!pending.empty()) {
+    const size_t node = pending.back();
+    pending.pop_back();
+    const size_t first = m_nodes[node].first;
+    const size_t count = m_nodes[node].count;
+    if (count <= leaf_size) {
+      continue;
+    }
+    // Items are divided by the centres of their boxes, along the axis in which the centres are most spread.
+    SUBoundingBox3D centres = empty_box();
+    for (size_t i=first; i < first + count; ++i) {
+      const SUBoundingBox3D& box = boxes[m_items[i]];
+      const SUPoint3D point{centre(box, 0), centre(box, 1), centre(box, 2)};
+      expand(centres, SUBoundingBox3D{point, point});
+    }
+    size_t axis = 0;
+    double extent = centres.max_point.x - centres.min_point.x;
+    for (size_t candidate=1; candidate < 3; ++candidate) {
+      const double candidate_extent = coordinate(centres.max_point, candidate) - coordinate(centres.min_point, candidate);
+      if (candidate_extent > extent) {
+        axis = candidate;
+        extent = candidate_extent;
+      }
+    }
+    if (!(extent > 0.0)) {
+      // All the centres coincide (or are not numbers), so no division would separate them.
+      continue;
+    }
+    const double axis_min = coordinate(centres.min_point, axis);
+    const double bin_scale = static_cast<double>(NUM_BINS) * (1.0 - 1.0e-9) / extent;
+    auto bin_of = [&](size_t item) {
+      const double position = (centre(boxes[item], axis) - axis_min) * bin_scale;
+      return std::min(static_cast<size_t>(std::max(position, 0.0)), NUM_BINS - 1);
+    };
+    std::array<size_t, NUM_BINS> bin_counts{};
+    std::array<SUBoundingBox3D, NUM_BINS> bin_bounds;
+    bin_bounds.fill(empty_box());
+    for (size_t i=first; i < first + count; ++i) {
+      const size_t bin = bin_of(m_items[i]);
+      ++bin_counts[bin];
+      expand(bin_bounds[bin], boxes[m_items[i]]);
+    }
+    // Sweep from the right to find the cost of each right hand side, then from the left to find the cheapest split.
+    std::array<double, NUM_BINS> right_costs{};
+    SUBoundingBox3D right_bounds = empty_box();
+    size_t right_count = 0;
+    for (size_t bin=NUM_BINS - 1; bin > 0; --bin) {
+      expand(right_bounds, bin_bounds[bin]);
+      right_count += bin_counts[bin];
+      right_costs[bin] = half_area(right_bounds) * static_cast<double>(right_count);
+    }
+    SUBoundingBox3D left_bounds = empty_box();
+    size_t left_count = 0;
+    size_t best_split = 0;
+    double best_cost = std::numeric_limits<double>::max();
+    for (size_t split=1; split < NUM_BINS; ++split) {
+      expand(left_bounds, bin_bounds[split - 1]);
+      left_count += bin_counts[split - 1];
+      if (left_count == 0 || left_count == count) {
+        continue;
+      }
+      const double cost = (half_area(left_bounds) * static_cast<double>(left_count)) + right_costs[split];
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_split = split;
+      }
+    }
+    // Visiting a node is taken to cost the same as testing an item.
+    const double leaf_cost = half_area(m_nodes[node].bounds) * static_cast<double>(count);
+    const double split_cost = half_area(m_nodes[node].bounds) + best_cost;
+    if (best_split == 0 || (split_cost >= leaf_cost && count <= MAX_LEAF_SIZE)) {
+      continue;
+    }
+    const auto middle = std::partition(m_items.begin() + first, m_items.begin() + first + count, [&](size_t item) {
+      return bin_of(item) < best_split;
+    });
+    const size_t num_left = static_cast<size_t>(middle - (m_items.begin() + first));
+    const size_t left = m_nodes.size();
+    m_nodes.push_back(Node{empty_box(), first, num_left});
+    m_nodes.push_back(Node{empty_box(), first + num_left, count - num_left});
+    m_parents.push_back(node);
+    m_parents.push_back(node);
+    update_bounds(left, boxes);
+    update_bounds(left + 1, boxes);
+    m_nodes[node].first = left;
+    m_nodes[node].count = 0;
+    pending.push_back(left);
+    pending.push_back(left + 1);
+  }
+
+  m_item_leaves.resize(num_items);
+  for (size_t node=0; node < m_nodes.size(); ++node) {
+    for (size_t i=m_nodes[node].first; i < m_nodes[node].first + m_nodes[node].count; ++i) {
+      m_item_leaves[m_items[i]] = node;
+    }
+  }
+}
+
+
+bool BoundingVolumeHierarchy::update_bounds(size_t node, const std::vector<SUBoundingBox3D>& boxes) {
+  Node& updated = m_nodes[node];
+  SUBoundingBox3D bounds = empty_box();
+  if (updated.count == 0) {
+    expand(bounds, m_nodes[updated.first].bounds);
+    expand(bounds, m_nodes[updated.first + 1].bounds);
+  }
+  else {
+    for (size_t i=updated.first; i < updated.first + updated.count; ++i) {
+      expand(bounds, boxes[m_items[i]]);
+    }
+  }
+  const bool changed = bounds.min_point.x != updated.bounds.min_point.x || bounds.min_point.y != updated.bounds.min_point.y ||
+                       bounds.min_point.z != updated.bounds.min_point.z || bounds.max_point.x != updated.bounds.max_point.x ||
+                       bounds.max_point.y != updated.bounds.max_point.y || bounds.max_point.z != updated.bounds.max_point.z;
+  updated.bounds = bounds;
+  return changed;
+}
+
+
+void BoundingVolumeHierarchy::refit(const std::vector<SUBoundingBox3D>& boxes) {
+  if (boxes.size() != m_items.size()) {
+    throw std::invalid_argument("CW::BoundingVolumeHierarchy::refit(): number of boxes differs from the number the hierarchy was built with");
+  }
+  // Children always follow their parents, so working backwards updates every child before its parent.
+  for (size_t node=m_nodes.size(); node > 0; --node) {
+    update_bounds(node - 1, boxes);
+  }
+}
+
+
+void BoundingVolumeHierarchy::refit(const std::vector<SUBoundingBox3D>& boxes, const std::vector<size_t>& changed_items) {
+  if (boxes.size() != m_items.size()) {
+    throw std::invalid_argument("CW::BoundingVolumeHierarchy::refit(): number of boxes differs from the number the hierarchy was built with");
+  }
+  std::vector<size_t> leaves;
+  leaves.reserve(changed_items.size());
+  for (size_t item : changed_items) {
+    if (item >= m_items.size()) {
+      throw std::out_of_range("CW::BoundingVolumeHierarchy::refit(): item index out of range");
+    }
+    leaves.push_back(m_item_leaves[item]);
+  }
+  // Nodes are updated a level at a time, moving to a node's parent only if the node's bounds changed.  A parent may be updated more than once if its changed descendants are at different depths, but it is always updated after the last of them.
+  std::sort(leaves.begin(), leaves.end());
+  leaves.erase(std::unique(leaves.begin(), leaves.end()), leaves.end());
+  std::vector<size_t> pending = std::move(leaves);
+  std::vector<size_t> parents;
+  while (!pending.empty()) {
+    parents.clear();
+    for (size_t node : pending) {
+      if (update_bounds(node, boxes) && m_parents[node] != NO_PARENT) {
+        parents.push_back(m_parents[node]);
+      }
+    }
+    std::sort(parents.begin(), parents.end());
+    parents.erase(std::unique(parents.begin(), parents.end()), parents.end());
+    pending.swap(parents);
+  }
+}
+
+
+size_t BoundingVolumeHierarchy::size() const {
+  return m_items.size();
+}
+
+
+bool BoundingVolumeHierarchy::empty() const {
+  return m_items.empty();
+}
+
+
+const std::vector<BoundingVolumeHierarchy::Node>& BoundingVolumeHierarchy::nodes() const {
+  return m_nodes;
+}
+
+
+const std::vector<size_t>& BoundingVolumeHierarchy::items() const {
+  return m_items;
+}
+
+
+bool BoundingVolumeHierarchy::overlaps(const SUBoundingBox3D& a, const SUBoundingBox3D& b) {
+  return a.min_point.x <= b.max_point.x && b.min_point.x <= a.max_point.x &&
+         a.min_point.y <= b.max_point.y && b.min_point.y <= a.max_point.y &&
+         a.min_point.z <= b.max_point.z && b.min_point.z <= a.max_point.z;
+}
+
+
+void BoundingVolumeHierarchy::expand(SUBoundingBox3D& box, const SUBoundingBox3D& other) {
+  box.min_point.x = std::min(box.min_point.x, other.min_point.x);
+  box.min_point.y = std::min(box.min_point.y, other.min_point.y);
+  box.min_point.z = std::min(box.min_point.z, other.min_point.z);
+  box.max_point.x = std::max(box.max_point.x, other.max_point.x);
+  box.max_point.y = std::max(box.max_point.y, other.max_point.y);
+  box.max_point.z = std::max(box.max_point.z, other.max_point.z);
+}
+
+
+SUBoundingBox3D BoundingVolumeHierarchy::empty_box() {
+  const double max = std::numeric_limits<double>::max();
+  return SUBoundingBox3D{SUPoint3D{max, max, max}, SUPoint3D{-max, -max, -max}};
+}
+
+} /* namespace CW */
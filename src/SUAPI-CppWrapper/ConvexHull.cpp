@@ -0,0 +1,976 @@
+//
+//  ConvexHull.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/ConvexHull.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/GeometryInput.hpp"
+#include "SUAPI-CppWrapper/model/LoopInput.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* The number of equal steps along each axis of a part at which splitting planes are tried.
+*/
+constexpr int NUM_SPLIT_STEPS = 8;
+
+/**
+* The relative amount by which voxels are enlarged when testing them against triangles.  Faces lying on the boundary between two voxels would otherwise miss both through rounding, leaving gaps in the surface through which the outside floods in.
+*/
+constexpr double VOXEL_OVERLAP = 1e-9;
+
+/**
+* Returns the coordinate of the point along the axis (0 for x, 1 for y, 2 for z).
+*/
+inline double coordinate(const Point3D& point, size_t axis) {
+  return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+inline double& coordinate(Point3D& point, size_t axis) {
+  return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+/**
+* Returns a unit vector perpendicular to the given unit vector.
+*/
+Vector3D perpendicular(const Vector3D& vector) {
+  const double x = std::abs(vector.x);
+  const double y = std::abs(vector.y);
+  const double z = std::abs(vector.z);
+  const Vector3D axis = (x <= y && x <= z) ? Vector3D(1.0, 0.0, 0.0) : (y <= z ? Vector3D(0.0, 1.0, 0.0) : Vector3D(0.0, 0.0, 1.0));
+  return vector.cross(axis).normalized();
+}
+
+/**
+* Returns the indices of the points on their convex hull, counter-clockwise, without collinear points (Andrew's monotone chain).
+*/
+std::vector<size_t> convex_hull_2d(const std::vector<std::array<double, 2>>& points) {
+  std::vector<size_t> order(points.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&points](size_t a, size_t b) {
+    return points[a] < points[b];
+  });
+  if (order.size() < 3) {
+    return order;
+  }
+  auto turn = [&points](size_t o, size_t a, size_t b) {
+    return ((points[a][0] - points[o][0]) * (points[b][1] - points[o][1])) - ((points[a][1] - points[o][1]) * (points[b][0] - points[o][0]));
+  };
+  std::vector<size_t> hull(order.size() * 2);
+  size_t k = 0;
+  for (size_t i : order) {
+    while (k >= 2 && turn(hull[k - 2], hull[k - 1], i) <= 0.0) {
+      --k;
+    }
+    hull[k++] = i;
+  }
+  for (size_t j=order.size() - 1, lower=k + 1; j-- > 0;) {
+    const size_t i = order[j];
+    while (k >= lower && turn(hull[k - 2], hull[k - 1], i) <= 0.0) {
+      --k;
+    }
+    hull[k++] = i;
+  }
+  hull.resize(k - 1);
+  return hull;
+}
+
+/**
+* Builds the convex hull of a set of points with the quickhull algorithm (Barber, Dobkin and Huhdanpaa).
+*
+* Each face keeps the points outside it.  The point farthest outside a face is added to the hull by removing the faces it can see, and joining it to the horizon of those faces.  The points outside the removed faces are then shared among the new faces.
+*/
+class HullBuilder {
+  public:
+  std::vector<Point3D> vertices;
+  std::vector<size_t> indices;
+
+  HullBuilder(const std::vector<Point3D>& points);
+
+  private:
+  struct Face {
+    std::array<size_t, 3> corners;
+    Vector3D normal;
+    double offset;
+    std::vector<size_t> outside;
+    bool removed;
+    bool visible;
+    size_t visited;
+  };
+
+  const std::vector<Point3D>& m_points;
+  double m_tolerance;
+  std::vector<Face> m_faces;
+  std::unordered_map<uint64_t, size_t> m_edges; // the face on the left of each directed edge
+  size_t m_visit;
+
+  static uint64_t edge_key(size_t a, size_t b) {
+    return (static_cast<uint64_t>(a) << 32) | static_cast<uint64_t>(b);
+  }
+
+  double distance(const Face& face, const Point3D& point) const {
+    return face.normal.dot(point) - face.offset;
+  }
+
+  size_t add_face(size_t a, size_t b, size_t c);
+  void assign(const std::vector<size_t>& points, size_t first_face);
+  void add_point(size_t face);
+  void build_flat(const Vector3D& normal);
+};
+
+
+HullBuilder::HullBuilder(const std::vector<Point3D>& points):
+  m_points(points),
+  m_tolerance(0.0),
+  m_visit(0)
+{
+  if (points.empty()) {
+    return;
+  }
+  // The tolerance allows for rounding in the distances of points from faces.
+  std::array<size_t, 3> min_points = {0, 0, 0};
+  std::array<size_t, 3> max_points = {0, 0, 0};
+  double scale = 0.0;
+  for (size_t axis=0; axis < 3; ++axis) {
+    double largest = 0.0;
+    for (size_t i=0; i < points.size(); ++i) {
+      const double value = coordinate(points[i], axis);
+      largest = std::max(largest, std::abs(value));
+      if (value < coordinate(points[min_points[axis]], axis)) {
+        min_points[axis] = i;
+      }
+      if (value > coordinate(points[max_points[axis]], axis)) {
+        max_points[axis] = i;
+      }
+    }
+    scale += largest;
+  }
+  m_tolerance = 32.0 * std::numeric_limits<double>::epsilon() * scale;
+  // The initial tetrahedron: the two points farthest apart along an axis, the point farthest from the line through them, and the point farthest from the plane through all three.
+  size_t axis = 0;
+  for (size_t i=1; i < 3; ++i) {
+    if (coordinate(points[max_points[i]], i) - coordinate(points[min_points[i]], i) > coordinate(points[max_points[axis]], axis) - coordinate(points[min_points[axis]], axis)) {
+      axis = i;
+    }
+  }
+  const size_t i0 = min_points[axis];
+  const size_t i1 = max_points[axis];
+  if (!(coordinate(points[i1], axis) - coordinate(points[i0], axis) > m_tolerance)) {
+    vertices.push_back(points[i0]);
+    return;
+  }
+  const Vector3D direction = Vector3D(points[i1] - points[i0]).normalized();
+  size_t i2 = i0;
+  double farthest = 0.0;
+  for (size_t i=0; i < points.size(); ++i) {
+    const Vector3D offset = points[i] - points[i0];
+    const double distance = Vector3D(offset - (direction * offset.dot(direction))).length();
+    if (distance > farthest) {
+      farthest = distance;
+      i2 = i;
+    }
+  }
+  if (!(farthest > m_tolerance)) {
+    vertices = {points[i0], points[i1]};
+    return;
+  }
+  const Vector3D normal = Vector3D(points[i1] - points[i0]).cross(points[i2] - points[i0]).normalized();
+  size_t i3 = i0;
+  farthest = 0.0;
+  for (size_t i=0; i < points.size(); ++i) {
+    const double distance = std::abs(normal.dot(points[i] - points[i0]));
+    if (distance > farthest) {
+      farthest = distance;
+      i3 = i;
+    }
+  }
+  if (!(farthest > m_tolerance)) {
+    build_flat(normal);
+    return;
+  }
+  // Orient each face of the tetrahedron away from the fourth corner.
+  const std::array<std::array<size_t, 4>, 4> tetrahedron = {{{i0, i1, i2, i3}, {i0, i1, i3, i2}, {i0, i2, i3, i1}, {i1, i2, i3, i0}}};
+  for (const std::array<size_t, 4>& face : tetrahedron) {
+    const Vector3D face_normal = Vector3D(points[face[1]] - points[face[0]]).cross(points[face[2]] - points[face[0]]);
+    if (face_normal.dot(points[face[3]] - points[face[0]]) > 0.0) {
+      add_face(face[0], face[2], face[1]);
+    }
+    else {
+      add_face(face[0], face[1], face[2]);
+    }
+  }
+  std::vector<size_t> remaining;
+  remaining.reserve(points.size());
+  for (size_t i=0; i < points.size(); ++i) {
+    if (i != i0 && i != i1 && i != i2 && i != i3) {
+      remaining.push_back(i);
+    }
+  }
+  assign(remaining, 0);
+  // New faces are added to the end, so are reached by this loop in turn.
+  for (size_t face=0; face < m_faces.size(); ++face) {
+    if (!m_faces[face].removed && !m_faces[face].outside.empty()) {
+      add_point(face);
+    }
+  }
+  std::vector<size_t> remap(points.size(), std::numeric_limits<size_t>::max());
+  for (const Face& face : m_faces) {
+    if (face.removed) {
+      continue;
+    }
+    for (size_t corner : face.corners) {
+      if (remap[corner] == std::numeric_limits<size_t>::max()) {
+        remap[corner] = vertices.size();
+        vertices.push_back(points[corner]);
+      }
+      indices.push_back(remap[corner]);
+    }
+  }
+}
+
+
+size_t HullBuilder::add_face(size_t a, size_t b, size_t c) {
+  const Vector3D normal = Vector3D(m_points[b] - m_points[a]).cross(m_points[c] - m_points[a]).normalized();
+  const size_t index = m_faces.size();
+  m_faces.push_back(Face{{a, b, c}, normal, normal.dot(m_points[a]), {}, false, false, 0});
+  m_edges[edge_key(a, b)] = index;
+  m_edges[edge_key(b, c)] = index;
+  m_edges[edge_key(c, a)] = index;
+  return index;
+}
+
+
+void HullBuilder::assign(const std::vector<size_t>& points, size_t first_face) {
+  // Each point is kept by the face it is farthest outside, and points inside every face are dropped.
+  for (size_t point : points) {
+    size_t best = m_faces.size();
+    double best_distance = m_tolerance;
+    for (size_t face=first_face; face < m_faces.size(); ++face) {
+      if (m_faces[face].removed) {
+        continue;
+      }
+      const double distance = this->distance(m_faces[face], m_points[point]);
+      if (distance > best_distance) {
+        best = face;
+        best_distance = distance;
+      }
+    }
+    if (best < m_faces.size()) {
+      m_faces[best].outside.push_back(point);
+    }
+  }
+}
+
+
+void HullBuilder::add_point(size_t first) {
+  const Point3D* eye_point = nullptr;
+  size_t eye = 0;
+  double farthest = -1.0;
+  for (size_t point : m_faces[first].outside) {
+    const double distance = this->distance(m_faces[first], m_points[point]);
+    if (distance > farthest) {
+      farthest = distance;
+      eye = point;
+    }
+  }
+  eye_point = &m_points[eye];
+  // Find the faces that the point can see, and the edges of the horizon between them and the faces it cannot.
+  ++m_visit;
+  std::vector<size_t> visible = {first};
+  std::vector<std::pair<size_t, size_t>> horizon;
+  m_faces[first].visited = m_visit;
+  m_faces[first].visible = true;
+  for (size_t i=0; i < visible.size(); ++i) {
+    const std::array<size_t, 3> corners = m_faces[visible[i]].corners;
+    for (size_t k=0; k < 3; ++k) {
+      const size_t a = corners[k];
+      const size_t b = corners[(k + 1) % 3];
+      Face& neighbour = m_faces[m_edges[edge_key(b, a)]];
+      if (neighbour.visited != m_visit) {
+        neighbour.visited = m_visit;
+        neighbour.visible = distance(neighbour, *eye_point) > m_tolerance;
+        if (neighbour.visible) {
+          visible.push_back(m_edges[edge_key(b, a)]);
+          continue;
+        }
+      }
+      if (!neighbour.visible) {
+        horizon.emplace_back(a, b);
+      }
+    }
+  }
+  std::vector<size_t> orphans;
+  for (size_t face : visible) {
+    Face& removed = m_faces[face];
+    for (size_t point : removed.outside) {
+      if (point != eye) {
+        orphans.push_back(point);
+      }
+    }
+    removed.outside.clear();
+    removed.outside.shrink_to_fit();
+    removed.removed = true;
+    for (size_t k=0; k < 3; ++k) {
+      m_edges.erase(edge_key(removed.corners[k], removed.corners[(k + 1) % 3]));
+    }
+  }
+  const size_t first_new = m_faces.size();
+  for (const std::pair<size_t, size_t>& edge : horizon) {
+    add_face(edge.first, edge.second, eye);
+  }
+  assign(orphans, first_new);
+}
+
+
+void HullBuilder::build_flat(const Vector3D& normal) {
+  // The hull of coplanar points is their 2D hull in the plane, with triangles on both sides.
+  const Vector3D u = perpendicular(normal);
+  const Vector3D v = normal.cross(u);
+  std::vector<std::array<double, 2>> projected;
+  projected.reserve(m_points.size());
+  for (const Point3D& point : m_points) {
+    projected.push_back({u.dot(point), v.dot(point)});
+  }
+  const std::vector<size_t> hull = convex_hull_2d(projected);
+  for (size_t index : hull) {
+    vertices.push_back(m_points[index]);
+  }
+  for (size_t i=1; i + 1 < hull.size(); ++i) {
+    indices.insert(indices.end(), {0, i, i + 1, 0, i + 1, i});
+  }
+}
+
+/**
+* Returns true if the triangle overlaps the axis-aligned box, by looking for a separating axis among the axes of the box, the normal of the triangle and the cross products of their edges (Akenine-Möller).
+*/
+bool triangle_overlaps_box(const Point3D& centre, double half_size, const std::array<Point3D, 3>& triangle) {
+  std::array<Vector3D, 3> corners;
+  for (size_t i=0; i < 3; ++i) {
+    corners[i] = triangle[i] - centre;
+  }
+  const std::array<Vector3D, 3> edges = {corners[1] - corners[0], corners[2] - corners[1], corners[0] - corners[2]};
+  std::array<Vector3D, 13> axes = {Vector3D(1.0, 0.0, 0.0), Vector3D(0.0, 1.0, 0.0), Vector3D(0.0, 0.0, 1.0), edges[0].cross(edges[1])};
+  for (size_t i=0; i < 3; ++i) {
+    for (size_t j=0; j < 3; ++j) {
+      axes[4 + (i * 3) + j] = edges[i].cross(axes[j]);
+    }
+  }
+  for (const Vector3D& axis : axes) {
+    const double radius = half_size * (std::abs(axis.x) + std::abs(axis.y) + std::abs(axis.z));
+    const double p0 = axis.dot(corners[0]);
+    const double p1 = axis.dot(corners[1]);
+    const double p2 = axis.dot(corners[2]);
+    if (std::min(p0, std::min(p1, p2)) > radius || std::max(p0, std::max(p1, p2)) < -radius) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+* Clips a convex polygon to the side of an axis-aligned plane (Sutherland-Hodgman).
+*/
+void clip_polygon(std::vector<Point3D>& polygon, size_t axis, double value, bool keep_above, std::vector<Point3D>& clipped) {
+  clipped.clear();
+  for (size_t i=0; i < polygon.size(); ++i) {
+    const Point3D& current = polygon[i];
+    const Point3D& next = polygon[(i + 1) % polygon.size()];
+    const double d0 = keep_above ? coordinate(current, axis) - value : value - coordinate(current, axis);
+    const double d1 = keep_above ? coordinate(next, axis) - value : value - coordinate(next, axis);
+    if (d0 >= 0.0) {
+      clipped.push_back(current);
+    }
+    if ((d0 >= 0.0) != (d1 >= 0.0)) {
+      clipped.push_back(current + (Vector3D(next - current) * (d0 / (d0 - d1))));
+    }
+  }
+  polygon.swap(clipped);
+}
+
+/**
+* A voxelized mesh, for measuring how well a hull fits a part of it.  The grid has an empty layer of voxels around the mesh.
+*/
+class VoxelGrid {
+  public:
+  enum State : uint8_t {
+    Empty,
+    Surface,
+    Outside,
+    Inside
+  };
+
+  struct Range {
+    std::array<int, 3> low; // inclusive
+    std::array<int, 3> high; // exclusive
+    double concavity = 0.0;
+  };
+
+  Point3D origin;
+  double size;
+  std::array<int, 3> dimensions;
+  std::vector<uint8_t> states;
+  size_t num_solid;
+
+  VoxelGrid(const std::vector<Point3D>& vertices, const std::vector<size_t>& indices, size_t resolution);
+
+  size_t index(int i, int j, int k) const {
+    return static_cast<size_t>(i) + (static_cast<size_t>(dimensions[0]) * (static_cast<size_t>(j) + (static_cast<size_t>(dimensions[1]) * static_cast<size_t>(k))));
+  }
+
+  bool solid(int i, int j, int k) const {
+    if (i < 0 || j < 0 || k < 0 || i >= dimensions[0] || j >= dimensions[1] || k >= dimensions[2]) {
+      return false;
+    }
+    const uint8_t state = states[index(i, j, k)];
+    return state == Surface || state == Inside;
+  }
+
+  /**
+  * Shrinks the range to the solid voxels within it, returning false if there are none.
+  */
+  bool tighten(Range& range) const;
+
+  /**
+  * Sets the concavity of the range: the volume of the hull of its voxels that they do not fill, as a fraction of the volume of the mesh.
+  */
+  void measure(Range& range) const;
+};
+
+
+VoxelGrid::VoxelGrid(const std::vector<Point3D>& vertices, const std::vector<size_t>& indices, size_t resolution):
+  size(0.0),
+  dimensions({0, 0, 0}),
+  num_solid(0)
+{
+  Point3D low = vertices[indices[0]];
+  Point3D high = low;
+  for (size_t index : indices) {
+    for (size_t axis=0; axis < 3; ++axis) {
+      coordinate(low, axis) = std::min(coordinate(low, axis), coordinate(vertices[index], axis));
+      coordinate(high, axis) = std::max(coordinate(high, axis), coordinate(vertices[index], axis));
+    }
+  }
+  const Point3D extent = high - low;
+  size = std::max(extent.x, std::max(extent.y, extent.z)) / static_cast<double>(std::max<size_t>(resolution, 1));
+  if (!(size > 0.0)) {
+    return;
+  }
+  origin = low - Vector3D(size, size, size);
+  for (size_t axis=0; axis < 3; ++axis) {
+    dimensions[axis] = static_cast<int>(std::ceil(coordinate(extent, axis) / size)) + 3;
+  }
+  states.assign(static_cast<size_t>(dimensions[0]) * dimensions[1] * dimensions[2], Empty);
+  // Mark the voxels that the triangles pass through.
+  const double half_size = size * 0.5 * (1.0 + VOXEL_OVERLAP);
+  for (size_t t=0; t + 2 < indices.size(); t += 3) {
+    const std::array<Point3D, 3> triangle = {vertices[indices[t]], vertices[indices[t + 1]], vertices[indices[t + 2]]};
+    std::array<int, 3> first;
+    std::array<int, 3> last;
+    for (size_t axis=0; axis < 3; ++axis) {
+      const double min_value = std::min(coordinate(triangle[0], axis), std::min(coordinate(triangle[1], axis), coordinate(triangle[2], axis)));
+      const double max_value = std::max(coordinate(triangle[0], axis), std::max(coordinate(triangle[1], axis), coordinate(triangle[2], axis)));
+      first[axis] = std::max(0, static_cast<int>(std::floor((min_value - coordinate(origin, axis)) / size)));
+      last[axis] = std::min(dimensions[axis] - 1, static_cast<int>(std::floor((max_value - coordinate(origin, axis)) / size)));
+    }
+    for (int k=first[2]; k <= last[2]; ++k) {
+      for (int j=first[1]; j <= last[1]; ++j) {
+        for (int i=first[0]; i <= last[0]; ++i) {
+          uint8_t& state = states[index(i, j, k)];
+          if (state == Empty && triangle_overlaps_box(origin + (Vector3D(i + 0.5, j + 0.5, k + 0.5) * size), half_size, triangle)) {
+            state = Surface;
+          }
+        }
+      }
+    }
+  }
+  // Flood the outside from a corner of the empty layer around the grid.  Empty voxels not reached are inside the mesh.
+  std::vector<size_t> stack = {0};
+  states[0] = Outside;
+  while (!stack.empty()) {
+    const size_t voxel = stack.back();
+    stack.pop_back();
+    const int i = static_cast<int>(voxel % dimensions[0]);
+    const int j = static_cast<int>((voxel / dimensions[0]) % dimensions[1]);
+    const int k = static_cast<int>(voxel / (static_cast<size_t>(dimensions[0]) * dimensions[1]));
+    const std::array<std::array<int, 3>, 6> neighbours = {{{i - 1, j, k}, {i + 1, j, k}, {i, j - 1, k}, {i, j + 1, k}, {i, j, k - 1}, {i, j, k + 1}}};
+    for (const std::array<int, 3>& neighbour : neighbours) {
+      if (neighbour[0] < 0 || neighbour[1] < 0 || neighbour[2] < 0 || neighbour[0] >= dimensions[0] || neighbour[1] >= dimensions[1] || neighbour[2] >= dimensions[2]) {
+        continue;
+      }
+      const size_t next = index(neighbour[0], neighbour[1], neighbour[2]);
+      if (states[next] == Empty) {
+        states[next] = Outside;
+        stack.push_back(next);
+      }
+    }
+  }
+  for (uint8_t& state : states) {
+    if (state == Empty) {
+      state = Inside;
+    }
+    if (state != Outside) {
+      ++num_solid;
+    }
+  }
+}
+
+
+bool VoxelGrid::tighten(Range& range) const {
+  std::array<int, 3> low = range.high;
+  std::array<int, 3> high = range.low;
+  for (int k=range.low[2]; k < range.high[2]; ++k) {
+    for (int j=range.low[1]; j < range.high[1]; ++j) {
+      for (int i=range.low[0]; i < range.high[0]; ++i) {
+        if (solid(i, j, k)) {
+          low = {std::min(low[0], i), std::min(low[1], j), std::min(low[2], k)};
+          high = {std::max(high[0], i + 1), std::max(high[1], j + 1), std::max(high[2], k + 1)};
+        }
+      }
+    }
+  }
+  if (high[0] <= low[0]) {
+    return false;
+  }
+  range.low = low;
+  range.high = high;
+  return true;
+}
+
+
+void VoxelGrid::measure(Range& range) const {
+  // The hull of the corners of the voxels on the outside of the range.  Grid coordinates are used, so a voxel has unit volume.
+  std::unordered_set<uint64_t> seen;
+  std::vector<Point3D> corners;
+  size_t count = 0;
+  auto inside_range = [&range, this](int i, int j, int k) {
+    return i >= range.low[0] && j >= range.low[1] && k >= range.low[2] && i < range.high[0] && j < range.high[1] && k < range.high[2] && solid(i, j, k);
+  };
+  for (int k=range.low[2]; k < range.high[2]; ++k) {
+    for (int j=range.low[1]; j < range.high[1]; ++j) {
+      for (int i=range.low[0]; i < range.high[0]; ++i) {
+        if (!solid(i, j, k)) {
+          continue;
+        }
+        ++count;
+        if (inside_range(i - 1, j, k) && inside_range(i + 1, j, k) && inside_range(i, j - 1, k) && inside_range(i, j + 1, k) && inside_range(i, j, k - 1) && inside_range(i, j, k + 1)) {
+          continue;
+        }
+        for (int corner=0; corner < 8; ++corner) {
+          const int x = i + (corner & 1);
+          const int y = j + ((corner >> 1) & 1);
+          const int z = k + ((corner >> 2) & 1);
+          if (seen.insert((static_cast<uint64_t>(x) << 42) | (static_cast<uint64_t>(y) << 21) | static_cast<uint64_t>(z)).second) {
+            corners.push_back(Point3D(x, y, z));
+          }
+        }
+      }
+    }
+  }
+  const double hull_volume = ConvexHull(corners).volume();
+  range.concavity = std::max(0.0, hull_volume - static_cast<double>(count)) / static_cast<double>(std::max<size_t>(num_solid, 1));
+}
+
+} // namespace
+
+/******************
+** OrientedBoundingBox **
+*******************/
+OrientedBoundingBox::OrientedBoundingBox():
+  centre(0.0, 0.0, 0.0),
+  axes({Vector3D(1.0, 0.0, 0.0), Vector3D(0.0, 1.0, 0.0), Vector3D(0.0, 0.0, 1.0)}),
+  half_sizes({0.0, 0.0, 0.0})
+{}
+
+
+double OrientedBoundingBox::volume() const {
+  return 8.0 * half_sizes[0] * half_sizes[1] * half_sizes[2];
+}
+
+
+std::array<Point3D, 8> OrientedBoundingBox::corners() const {
+  std::array<Point3D, 8> result;
+  for (size_t i=0; i < 8; ++i) {
+    Point3D corner = centre;
+    for (size_t axis=0; axis < 3; ++axis) {
+      corner = corner + (axes[axis] * ((i >> axis) & 1 ? half_sizes[axis] : -half_sizes[axis]));
+    }
+    result[i] = corner;
+  }
+  return result;
+}
+
+
+size_t OrientedBoundingBox::add_to(GeometryInput& geom_input) const {
+  std::array<bool, 3> thick;
+  size_t num_thick = 0;
+  for (size_t axis=0; axis < 3; ++axis) {
+    thick[axis] = 2.0 * half_sizes[axis] > SketchUpTolerance::EPSILON;
+    num_thick += thick[axis] ? 1 : 0;
+  }
+  if (num_thick < 2) {
+    return 0;
+  }
+  const std::array<Point3D, 8> points = corners();
+  std::array<size_t, 8> vertex_indices;
+  for (size_t i=0; i < 8; ++i) {
+    vertex_indices[i] = geom_input.add_vertex(points[i]);
+  }
+  // The face on each side of an axis has its corners counter-clockwise about that axis, as the axes are right-handed.
+  auto add_face = [&](size_t axis, bool positive) {
+    const size_t next = (axis + 1) % 3;
+    const size_t after = (axis + 2) % 3;
+    const size_t side = positive ? (size_t(1) << axis) : 0;
+    std::array<size_t, 4> loop = {side, side | (size_t(1) << next), side | (size_t(1) << next) | (size_t(1) << after), side | (size_t(1) << after)};
+    if (!positive) {
+      std::reverse(loop.begin(), loop.end());
+    }
+    LoopInput loop_input;
+    for (size_t corner : loop) {
+      loop_input.add_vertex_index(vertex_indices[corner]);
+    }
+    geom_input.add_face(loop_input);
+  };
+  if (num_thick == 2) {
+    const size_t thin = !thick[0] ? 0 : (!thick[1] ? 1 : 2);
+    add_face(thin, true);
+    return 1;
+  }
+  for (size_t axis=0; axis < 3; ++axis) {
+    add_face(axis, false);
+    add_face(axis, true);
+  }
+  return 6;
+}
+
+/******************
+** ConvexHull **
+*******************/
+ConvexHull::DecompositionOptions::DecompositionOptions()
+{}
+
+
+ConvexHull::ConvexHull()
+{}
+
+
+ConvexHull::ConvexHull(const std::vector<Point3D>& points) {
+  HullBuilder builder(points);
+  m_vertices = std::move(builder.vertices);
+  m_indices = std::move(builder.indices);
+}
+
+
+const std::vector<Point3D>& ConvexHull::vertices() const {
+  return m_vertices;
+}
+
+
+const std::vector<size_t>& ConvexHull::indices() const {
+  return m_indices;
+}
+
+
+bool ConvexHull::empty() const {
+  return m_vertices.empty();
+}
+
+
+double ConvexHull::volume() const {
+  double total = 0.0;
+  for (size_t i=0; i < m_indices.size(); i += 3) {
+    const Point3D& origin = m_vertices[0];
+    const Vector3D a = m_vertices[m_indices[i]] - origin;
+    const Vector3D b = m_vertices[m_indices[i + 1]] - origin;
+    const Vector3D c = m_vertices[m_indices[i + 2]] - origin;
+    total += a.dot(b.cross(c));
+  }
+  return total / 6.0;
+}
+
+
+bool ConvexHull::contains(const Point3D& point) const {
+  if (m_indices.empty()) {
+    return false;
+  }
+  for (size_t i=0; i < m_indices.size(); i += 3) {
+    const Point3D& a = m_vertices[m_indices[i]];
+    const Vector3D normal = Vector3D(m_vertices[m_indices[i + 1]] - a).cross(m_vertices[m_indices[i + 2]] - a);
+    const double length = normal.length();
+    if (length > 0.0 && normal.dot(point - a) > SketchUpTolerance::EPSILON * length) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+ConvexHull ConvexHull::transformed(const Transformation& transformation) const {
+  std::vector<Point3D> points = m_vertices;
+  transformation.transform_points(points);
+  return ConvexHull(points);
+}
+
+
+OrientedBoundingBox ConvexHull::oriented_bounding_box() const {
+  OrientedBoundingBox best;
+  if (m_vertices.size() == 1) {
+    best.centre = m_vertices[0];
+    return best;
+  }
+  if (m_indices.empty() && m_vertices.size() == 2) {
+    const Vector3D direction = m_vertices[1] - m_vertices[0];
+    best.centre = m_vertices[0] + (direction * 0.5);
+    best.axes[0] = direction.normalized();
+    best.axes[1] = perpendicular(best.axes[0]);
+    best.axes[2] = best.axes[0].cross(best.axes[1]);
+    best.half_sizes = {direction.length() / 2.0, 0.0, 0.0};
+    return best;
+  }
+  // For each direction of a face, the box with a side flush with the face is the least area rectangle around the projection of the hull onto the face (found with rotating calipers), extruded through the depth of the hull.
+  double best_volume = std::numeric_limits<double>::infinity();
+  double best_area = std::numeric_limits<double>::infinity();
+  std::vector<Vector3D> tried;
+  std::vector<std::array<double, 2>> projected(m_vertices.size());
+  for (size_t i=0; i < m_indices.size(); i += 3) {
+    const Point3D& a = m_vertices[m_indices[i]];
+    const Vector3D normal = Vector3D(m_vertices[m_indices[i + 1]] - a).cross(m_vertices[m_indices[i + 2]] - a).normalized();
+    if (!(normal.squared_length() > 0.0)) {
+      continue;
+    }
+    if (std::any_of(tried.begin(), tried.end(), [&normal](const Vector3D& other) { return std::abs(other.dot(normal)) > 1.0 - 1e-9; })) {
+      continue;
+    }
+    tried.push_back(normal);
+    const Vector3D u = perpendicular(normal);
+    const Vector3D v = normal.cross(u);
+    double min_height = std::numeric_limits<double>::infinity();
+    double max_height = -std::numeric_limits<double>::infinity();
+    for (size_t j=0; j < m_vertices.size(); ++j) {
+      projected[j] = {u.dot(m_vertices[j]), v.dot(m_vertices[j])};
+      const double height = normal.dot(m_vertices[j]);
+      min_height = std::min(min_height, height);
+      max_height = std::max(max_height, height);
+    }
+    const std::vector<size_t> outline = convex_hull_2d(projected);
+    for (size_t j=0; j < outline.size(); ++j) {
+      const std::array<double, 2>& p = projected[outline[j]];
+      const std::array<double, 2>& q = projected[outline[(j + 1) % outline.size()]];
+      const double length = std::hypot(q[0] - p[0], q[1] - p[1]);
+      if (!(length > 0.0)) {
+        continue;
+      }
+      const std::array<double, 2> e = {(q[0] - p[0]) / length, (q[1] - p[1]) / length};
+      const std::array<double, 2> f = {-e[1], e[0]};
+      double min_e = std::numeric_limits<double>::infinity();
+      double max_e = -min_e;
+      double min_f = min_e;
+      double max_f = -min_e;
+      for (size_t index : outline) {
+        const double along = (projected[index][0] * e[0]) + (projected[index][1] * e[1]);
+        const double across = (projected[index][0] * f[0]) + (projected[index][1] * f[1]);
+        min_e = std::min(min_e, along);
+        max_e = std::max(max_e, along);
+        min_f = std::min(min_f, across);
+        max_f = std::max(max_f, across);
+      }
+      const double area = (max_e - min_e) * (max_f - min_f);
+      const double volume = area * (max_height - min_height);
+      // Flat hulls have boxes of no volume, so the least area breaks ties.
+      if (volume < best_volume * (1.0 - 1e-9) || (volume <= best_volume * (1.0 + 1e-9) && area < best_area)) {
+        best_volume = volume;
+        best_area = area;
+        best.axes[0] = (u * e[0]) + (v * e[1]);
+        best.axes[1] = (u * f[0]) + (v * f[1]);
+        best.axes[2] = normal;
+        best.half_sizes = {(max_e - min_e) / 2.0, (max_f - min_f) / 2.0, (max_height - min_height) / 2.0};
+        best.centre = Point3D(0.0, 0.0, 0.0) + (best.axes[0] * ((min_e + max_e) / 2.0)) + (best.axes[1] * ((min_f + max_f) / 2.0)) + (normal * ((min_height + max_height) / 2.0));
+      }
+    }
+  }
+  return best;
+}
+
+
+size_t ConvexHull::add_to(GeometryInput& geom_input) const {
+  std::vector<size_t> vertex_indices;
+  vertex_indices.reserve(m_vertices.size());
+  for (const Point3D& vertex : m_vertices) {
+    vertex_indices.push_back(geom_input.add_vertex(vertex));
+  }
+  // The triangles of each side of a convex hull are exactly those facing the same way, and the corners of the side are in convex position, so they can be ordered by angle about their centre.
+  const size_t num_triangles = m_indices.size() / 3;
+  std::vector<bool> added(num_triangles, false);
+  std::vector<Vector3D> normals(num_triangles);
+  for (size_t t=0; t < num_triangles; ++t) {
+    const Point3D& a = m_vertices[m_indices[t * 3]];
+    normals[t] = Vector3D(m_vertices[m_indices[(t * 3) + 1]] - a).cross(m_vertices[m_indices[(t * 3) + 2]] - a).normalized();
+  }
+  size_t num_faces = 0;
+  std::vector<size_t> corners;
+  for (size_t t=0; t < num_triangles; ++t) {
+    if (added[t] || normals[t].squared_length() == 0.0) {
+      continue;
+    }
+    corners.clear();
+    for (size_t other=t; other < num_triangles; ++other) {
+      if (!added[other] && normals[other].dot(normals[t]) > 1.0 - 1e-9) {
+        added[other] = true;
+        corners.insert(corners.end(), m_indices.begin() + (other * 3), m_indices.begin() + (other * 3) + 3);
+      }
+    }
+    std::sort(corners.begin(), corners.end());
+    corners.erase(std::unique(corners.begin(), corners.end()), corners.end());
+    Point3D centre(0.0, 0.0, 0.0);
+    for (size_t corner : corners) {
+      centre = centre + (Vector3D(m_vertices[corner]) / static_cast<double>(corners.size()));
+    }
+    const Vector3D u = perpendicular(normals[t]);
+    const Vector3D v = normals[t].cross(u);
+    std::vector<std::pair<double, size_t>> angles;
+    for (size_t corner : corners) {
+      const Vector3D offset = m_vertices[corner] - centre;
+      angles.emplace_back(std::atan2(offset.dot(v), offset.dot(u)), corner);
+    }
+    std::sort(angles.begin(), angles.end());
+    LoopInput loop_input;
+    for (const std::pair<double, size_t>& angle : angles) {
+      loop_input.add_vertex_index(vertex_indices[angle.second]);
+    }
+    geom_input.add_face(loop_input);
+    ++num_faces;
+  }
+  return num_faces;
+}
+
+
+std::vector<ConvexHull> ConvexHull::decompose(const std::vector<Point3D>& vertices, const std::vector<size_t>& indices, const DecompositionOptions& options) {
+  std::vector<ConvexHull> hulls;
+  if (indices.size() < 3) {
+    return hulls;
+  }
+  const VoxelGrid grid(vertices, indices, options.resolution);
+  if (grid.num_solid == 0) {
+    hulls.push_back(ConvexHull(vertices));
+    return hulls;
+  }
+  // Split the part whose hull fits worst, at the plane that most reduces the concavity of its two halves, until each fits well enough.
+  std::vector<VoxelGrid::Range> parts(1);
+  parts[0].low = {0, 0, 0};
+  parts[0].high = grid.dimensions;
+  grid.tighten(parts[0]);
+  grid.measure(parts[0]);
+  while (parts.size() < options.max_hulls) {
+    auto worst = std::max_element(parts.begin(), parts.end(), [](const VoxelGrid::Range& a, const VoxelGrid::Range& b) {
+      return a.concavity < b.concavity;
+    });
+    if (worst->concavity <= options.max_concavity) {
+      break;
+    }
+    const VoxelGrid::Range part = *worst;
+    std::vector<VoxelGrid::Range> best_halves;
+    double best_concavity = std::numeric_limits<double>::infinity();
+    for (size_t axis=0; axis < 3; ++axis) {
+      const int length = part.high[axis] - part.low[axis];
+      for (int step=1; step < NUM_SPLIT_STEPS; ++step) {
+        const int plane = part.low[axis] + ((length * step) / NUM_SPLIT_STEPS);
+        if (plane <= part.low[axis] || plane >= part.high[axis] || (step > 1 && plane == part.low[axis] + ((length * (step - 1)) / NUM_SPLIT_STEPS))) {
+          continue;
+        }
+        std::vector<VoxelGrid::Range> halves(2, part);
+        halves[0].high[axis] = plane;
+        halves[1].low[axis] = plane;
+        double concavity = 0.0;
+        for (size_t h=halves.size(); h-- > 0;) {
+          if (!grid.tighten(halves[h])) {
+            halves.erase(halves.begin() + h);
+            continue;
+          }
+          grid.measure(halves[h]);
+          concavity += halves[h].concavity;
+        }
+        if (halves.size() == 2 && concavity < best_concavity) {
+          best_concavity = concavity;
+          best_halves = halves;
+        }
+      }
+    }
+    if (best_halves.empty()) {
+      // The part cannot be split, so it is left as it is.
+      worst->concavity = 0.0;
+      continue;
+    }
+    *worst = best_halves[0];
+    parts.push_back(best_halves[1]);
+  }
+  // The hull of each part is that of the mesh clipped to the part's box, and of the corners of the box that are inside the mesh.
+  std::vector<Point3D> polygon;
+  std::vector<Point3D> clipped;
+  for (const VoxelGrid::Range& part : parts) {
+    const Point3D low = grid.origin + (Vector3D(part.low[0], part.low[1], part.low[2]) * grid.size);
+    const Point3D high = grid.origin + (Vector3D(part.high[0], part.high[1], part.high[2]) * grid.size);
+    std::vector<Point3D> points;
+    for (size_t t=0; t + 2 < indices.size(); t += 3) {
+      polygon = {vertices[indices[t]], vertices[indices[t + 1]], vertices[indices[t + 2]]};
+      for (size_t axis=0; axis < 3 && !polygon.empty(); ++axis) {
+        clip_polygon(polygon, axis, coordinate(low, axis), true, clipped);
+        if (!polygon.empty()) {
+          clip_polygon(polygon, axis, coordinate(high, axis), false, clipped);
+        }
+      }
+      points.insert(points.end(), polygon.begin(), polygon.end());
+    }
+    for (int corner=0; corner < 8; ++corner) {
+      const int i = (corner & 1) ? part.high[0] : part.low[0];
+      const int j = (corner & 2) ? part.high[1] : part.low[1];
+      const int k = (corner & 4) ? part.high[2] : part.low[2];
+      bool inside = true;
+      for (int neighbour=0; neighbour < 8 && inside; ++neighbour) {
+        inside = grid.solid(i - 1 + (neighbour & 1), j - 1 + ((neighbour >> 1) & 1), k - 1 + ((neighbour >> 2) & 1));
+      }
+      if (inside) {
+        points.push_back(Point3D(i == part.high[0] ? high.x : low.x, j == part.high[1] ? high.y : low.y, k == part.high[2] ? high.z : low.z));
+      }
+    }
+    ConvexHull hull(points);
+    if (!hull.empty()) {
+      hulls.push_back(std::move(hull));
+    }
+  }
+  return hulls;
+}
+
+} /* namespace CW */
@@ -26,6 +26,7 @@
 //
 
 #include <cmath>
+#include <limits>
 #include <stdexcept>
 #include <cassert>
 
@@ -35,6 +36,7 @@
 #include <SketchUpAPI/model/face.h>
 
 #include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Predicates.hpp"
 
 #include "SUAPI-CppWrapper/model/Face.hpp"
 #include "SUAPI-CppWrapper/model/Edge.hpp"
@@ -100,10 +102,6 @@ Radians Radians::operator/(const double divider) const {
   return m_val * divider;
 }
 
-Vector3D operator*(const double &lhs, const Vector3D &rhs) {
-  return rhs * lhs;
-}
-
 bool Radians::operator==(const Radians& rhs) const {
   return (fabs(static_cast<double>(*this) - static_cast<double>(rhs))) < EPSILON;
 }
@@ -129,165 +127,12 @@ bool Radians::closest(const Radians& value) {
 * Vector3D
 *********/
 
-constexpr double Vector3D::EPSILON;
-
-Vector3D::Vector3D():
-  Vector3D(false)
-{}
-
-Vector3D::Vector3D(SUVector3D su_vector):
-  m_vector(su_vector),
-  x(m_vector.x),
-  y(m_vector.y),
-  z(m_vector.z)
-{}
-
-Vector3D::Vector3D( double x, double y, double z):
-  m_vector(SUVector3D{x,y,z}),
-  x(m_vector.x),
-  y(m_vector.y),
-  z(m_vector.z)
-{}
-
-Vector3D::Vector3D(bool valid):
-  m_vector(SUVector3D{0.0,0.0,0.0}),
-  is_null(!valid),
-  x(m_vector.x),
-  y(m_vector.y),
-  z(m_vector.z)
-{}
-
-
 Vector3D::Vector3D(const Edge &edge):
   Vector3D(edge.vector())
 {}
 
-Vector3D::Vector3D(const Vector3D &vector):
-  m_vector(vector.m_vector),
-  is_null(vector.is_null),
-  x(m_vector.x),
-  y(m_vector.y),
-  z(m_vector.z)
-{}
-
-
-Vector3D::Vector3D(const Point3D& point):
-  Vector3D(SUVector3D{point.x, point.y, point.z})
-{
-  is_null = !point;
-}
-
-
-Vector3D& Vector3D::operator=(const Vector3D &vector) {
-  if (this == &vector) {
-    return *this;
-  }
-  x = vector.x;
-  y = vector.y;
-  z = vector.z;
-  is_null = vector.is_null;
-  return *this;
-}
-
-Vector3D& Vector3D::operator=(const SUVector3D &vector) {
-  x = vector.x;
-  y = vector.y;
-  z = vector.z;
-  is_null = false;
-  return *this;
-}
-
-// Casting
-Vector3D::operator SUVector3D() const {
-  assert(!is_null);
-  return m_vector;
-}
-
-Vector3D::operator const SUVector3D*() const {
-  assert(!is_null);
-  return &m_vector;
-}
-
-Vector3D::operator Point3D() const {
-  Point3D point(!this->is_null);
-  point.x = x;
-  point.y = y;
-  point.z = z;
-  return point;
-}
-
-// Operator overloads
-Vector3D Vector3D::operator+(const Vector3D &vector) const {
-  assert(!!vector && !is_null);
-  return Vector3D(m_vector.x + vector.x, m_vector.y + vector.y, m_vector.z + vector.z);
-}
-
-Point3D operator+(const Vector3D &lhs, const Point3D& rhs) {
-  return rhs + lhs;
-}
-
-Vector3D Vector3D::operator-() const {
-  return Vector3D(-x, -y, -z);
-}
-
-Vector3D Vector3D::operator-(const Vector3D &vector) const {
-  assert(!!vector && !is_null);
-  return Vector3D(x - vector.x, y - vector.y, z - vector.z);
-}
-Vector3D Vector3D::operator*(const double &scalar) const {
-  assert(!is_null);
-  return Vector3D( x * scalar, y * scalar, z * scalar);
-}
-Vector3D Vector3D::operator/(const double &scalar) const {
-  assert(!is_null);
-  if (std::abs(scalar) < EPSILON) {
-    throw std::invalid_argument("CW::Vector3D::operator/() - cannot divide by zero");
-  }
-  return Vector3D( x / scalar, y / scalar, z / scalar);
-}
-
-bool operator==(const Vector3D &lhs, const Vector3D &rhs) {
-  if (!lhs && !rhs) {
-    return true;
-  }
-  if (!!lhs && !!rhs &&
-      std::abs(lhs.x - rhs.x) < Vector3D::EPSILON &&
-      std::abs(lhs.y - rhs.y) < Vector3D::EPSILON &&
-      std::abs(lhs.z - rhs.z) < Vector3D::EPSILON) {
-    return true;
-  }
-  return false;
-}
-
-
-bool operator!=(const Vector3D &lhs, const Vector3D &rhs) {
-  if (lhs == rhs) {
-    return false;
-  }
-  return true;
-}
-
-
-bool Vector3D::operator!() const {
-  if (this->is_null) {
-    return true;
-  }
-  return false;
-}
-
-
-double Vector3D::length() const {
-  assert(!is_null);
-  return sqrt(pow(x,2) + pow(y,2) + pow(z,2));
-}
-
-Vector3D Vector3D::unit() const {
-  assert(!is_null);
-  return *this / length();
-}
-
 double Vector3D::angle(const Vector3D& vector_b) const {
-  assert(!is_null);
+  assert(!!(*this));
   // Check that acos doesn't suffer domain error as a result of being slightly outside the range of -1 to +1
   double dot_product = unit().dot(vector_b.unit());
   if (dot_product < -1.0) {
@@ -299,24 +144,6 @@ double Vector3D::angle(const Vector3D& vector_b) const {
   return acos(dot_product);
 }
 
-double Vector3D::dot(const Vector3D& vector2) const {
-  assert(!!vector2 && !is_null);
-  return (x * vector2.x) + (y * vector2.y) + (z * vector2.z);
-}
-
-double Vector3D::dot(const Point3D& point) const {
-  assert(!!point && !is_null);
-  return (x * point.x) + (y * point.y) + (z * point.z);
-}
-
-
-Vector3D Vector3D::cross(const Vector3D& vector2) const {
-  assert(!!vector2 && !is_null);
-  return Vector3D{y * vector2.z - z * vector2.y,
-                z * vector2.x - x * vector2.z,
-                x * vector2.y - y * vector2.x};
-}
-
 Vector3D::Colinearity Vector3D::colinear(const Vector3D& vector_b) const {
   if (this->length() < EPSILON || vector_b.length() < EPSILON) {
     return Vector3D::Colinearity::UNDEFINED;
@@ -347,178 +174,89 @@ Vector3D Vector3D::rotate_about(double angle, const Vector3D& axis) const {
   return a_component_b_orth_rot + a_component_b_dir;
 }
 
-Vector3D Vector3D::zero_vector() {
-  return Vector3D(0.0, 0.0, 0.0);
-}
-
 
 /********
 * Point3D
 *********/
-Point3D::Point3D():
-  Point3D(false)
-{}
 
-Point3D::Point3D(bool valid):
-  m_point(SUPoint3D{0.0,0.0,0.0}),
-  is_null(!valid),
-  x(m_point.x),
-  y(m_point.y),
-  z(m_point.z)
-{}
-
-Point3D::Point3D( SUPoint3D su_point):
-  m_point(su_point),
-  x(m_point.x),
-  y(m_point.y),
-  z(m_point.z)
-{}
-
-Point3D::Point3D( SUVector3D su_vector):
-  Point3D(SUPoint3D{su_vector.x, su_vector.y, su_vector.z})
-{}
-
-Point3D::Point3D(double x, double y, double z):
-  Point3D(SUPoint3D{x, y, z})
-{}
-
-Point3D::Point3D(const Point3D& other):
-  Point3D(other.x, other.y, other.z)
-{
-  is_null = other.is_null;
-}
-
-
-Point3D::Point3D( const Vector3D& vector):
-  Point3D(SUPoint3D{vector.x, vector.y, vector.z})
-{}
-
-Point3D& Point3D::operator=(const Point3D &point) {
-  if (this == &point) {
-    return *this;
-  }
-  x = point.x;
-  y = point.y;
-  z = point.z;
-  is_null = point.is_null;
-  return *this;
-}
-
-
-Point3D::operator SUPoint3D() const { return SUPoint3D {m_point.x, m_point.y, m_point.z}; }
-
-
-Point3D::operator const SUPoint3D*() const{
-  //m_point = SUPoint3D{m_point.x, m_point.y, m_point.z};
-  return &m_point;
-}
-
-Point3D::operator Vector3D() const { return Vector3D(m_point.x, m_point.y, m_point.z); }
-
-// Operator overloads
-Point3D Point3D::operator+(const Point3D &point) const {
-  assert(!!point && !is_null);
-  return Point3D(m_point.x + point.x, m_point.y + point.y, m_point.z + point.z);
-}
-
-Point3D Point3D::operator+(const Vector3D &vector) const {
-  assert(!!vector && !is_null);
-  return Point3D(m_point.x + vector.x, m_point.y + vector.y, m_point.z + vector.z);
-}
-
-Point3D Point3D::operator+(const SUPoint3D &point) const {
-  assert(!is_null);
-  return (*this) + Point3D(point);
-}
-
-Vector3D Point3D::operator-(const Point3D &point) const {
-  assert(!!point && !is_null);
-  return Vector3D(m_point.x - point.x, m_point.y - point.y, m_point.z - point.z);
-}
-
-Point3D Point3D::operator-(const Vector3D &vector) const {
-  assert(!!vector && !is_null);
-  return (*this) - static_cast<Point3D>(vector);
-}
-
-Point3D Point3D::operator-(const SUPoint3D &point) const  {
-  assert(!is_null);
-  return (*this) - Point3D(point);
-}
-
-Point3D Point3D::operator*(const double &scalar) const {
-  assert(!is_null);
-  return Point3D(m_point.x * scalar, m_point.y * scalar, m_point.z * scalar);
-}
-
-Point3D Point3D::operator/(const double &scalar) const {
-  assert(!is_null);
-  if (std::abs(scalar) < EPSILON) {
-    throw std::invalid_argument("Point3D::operator/: cannot divide by zero");
-  }
-  return Point3D(m_point.x / scalar, m_point.y / scalar, m_point.z / scalar);
-}
+namespace {
 
 /**
-* Comparative operators
+* Describes where two lines cross, each given by a start point and a vector.
 */
-bool Point3D::operator!() const {
-  if (is_null) {
-    return true;
-  }
-  return false;
-}
+struct LineCrossing {
+  Point3D intersection; // Null if the lines are skew
+  double factor_a; // Position of the intersection along vector_a (0.0 at point_a, 1.0 at the end of vector_a)
+  double factor_b; // Position of the intersection along vector_b
+  bool a_crosses_b; // The ends of vector_a lie on opposite sides of the line through vector_b (or on it)
+  bool b_crosses_a; // The ends of vector_b lie on opposite sides of the line through vector_a (or on it)
+};
 
-bool operator==(const Point3D &lhs, const Point3D &rhs) {
-  if (!lhs && !rhs) {
-    return true;
-  }
-  if (!!lhs && !!rhs &&
-      std::abs(lhs.x - rhs.x) < Point3D::EPSILON &&
-      std::abs(lhs.y - rhs.y) < Point3D::EPSILON &&
-      std::abs(lhs.z - rhs.z) < Point3D::EPSILON) {
-    return true;
-  }
-  return false;
+/**
+* Returns true if the two signed values are not both positive or both negative.
+*/
+inline bool opposite_sides(double first, double second) {
+  return !(first > 0.0 && second > 0.0) && !(first < 0.0 && second < 0.0);
 }
 
-
-bool operator!=(const Point3D &lhs, const Point3D &rhs) {
-  if (lhs == rhs) {
-    return false;
-  }
-  return true;
-}
+/**
+* Finds where two non-parallel lines cross.  The lines are projected onto the coordinate plane closest to the plane containing them, where the side of each line that the end points of the other lie is decided with exact orientation tests.  No vectors are normalised, so the result is as accurate far from the origin as it is near it.
+*/
+LineCrossing line_crossing(const Point3D& point_a, const Vector3D& vector_a, const Point3D& point_b, const Vector3D& vector_b, const Vector3D& normal) {
+  const size_t axis = Predicates::dominant_axis(normal);
+  const SUPoint2D a_start = Predicates::project(point_a, axis);
+  const SUPoint2D a_end = Predicates::project(point_a + vector_a, axis);
+  const SUPoint2D b_start = Predicates::project(point_b, axis);
+  const SUPoint2D b_end = Predicates::project(point_b + vector_b, axis);
+  const double a_start_side = Predicates::orient2d(b_start, b_end, a_start);
+  const double a_end_side = Predicates::orient2d(b_start, b_end, a_end);
+  const double b_start_side = Predicates::orient2d(a_start, a_end, b_start);
+  const double b_end_side = Predicates::orient2d(a_start, a_end, b_end);
+  LineCrossing crossing{Point3D(false), 0.0, 0.0, false, false};
+  if (a_start_side == a_end_side || b_start_side == b_end_side) {
+    // The projected lines are parallel to within rounding error
+    return crossing;
+  }
+  crossing.factor_a = a_start_side / (a_start_side - a_end_side);
+  crossing.factor_b = b_start_side / (b_start_side - b_end_side);
+  crossing.a_crosses_b = opposite_sides(a_start_side, a_end_side);
+  crossing.b_crosses_a = opposite_sides(b_start_side, b_end_side);
+  // Check that the lines actually meet in 3D, and are not just crossing in the projection.
+  const Point3D intersection_a = point_a + (vector_a * crossing.factor_a);
+  const Point3D intersection_b = point_b + (vector_b * crossing.factor_b);
+  if ((intersection_a - intersection_b).squared_length() < Point3D::EPSILON * Point3D::EPSILON) {
+    crossing.intersection = intersection_a;
+  }
+  return crossing;
+}
+
+} // namespace
 
 
 /**
 * Static method
 */
 Point3D Point3D::intersection_between_lines(const Point3D& point_a, const Vector3D& vector_a, const Point3D& point_b, const Vector3D& vector_b, bool return_colinear) {
-  if (vector_a.length() < EPSILON || vector_b.length() < EPSILON) {
+  const double a_length_squared = vector_a.squared_length();
+  const double b_length_squared = vector_b.squared_length();
+  if (a_length_squared < EPSILON * EPSILON || b_length_squared < EPSILON * EPSILON) {
     throw std::invalid_argument("CW::Point3D::intersection_between_lines() - cannot find intersection of lines with zero length");
   }
   // Find the closest points according to this solution: http://paulbourke.net/geometry/pointlineplane/
   // And this: http://stackoverflow.com/questions/563198/how-do-you-detect-where-two-line-segments-intersect
-  Vector3D a_to_b = point_b - point_a;
-  Vector3D vec_a_cross_b = vector_a.unit().cross(vector_b.unit());
-  Vector3D a_to_b_cross_vec_a = a_to_b.unit().cross(vector_a.unit());
-  Vector3D zero_vector(0.0,0.0,0.0);
-  // Check for collinearity
-  if (vec_a_cross_b == zero_vector) {
-    if (a_to_b_cross_vec_a == zero_vector) {
+  const Vector3D a_to_b = point_b - point_a;
+  const Vector3D vec_a_cross_b = vector_a.cross(vector_b);
+  // Check for collinearity.  The sine of the angle between the lines is compared with EPSILON, without normalising the vectors.
+  if (vec_a_cross_b.squared_length() < EPSILON * EPSILON * a_length_squared * b_length_squared) {
+    if (a_to_b.cross(vector_a).squared_length() < EPSILON * EPSILON * a_length_squared) {
       // Lines are collinear, so there is no intersection
       if (!return_colinear) {
         return Point3D(false);
       }
-      bool opposite_direction;
-      if (vector_a.unit() == vector_b.unit())
-        opposite_direction = false;
-      else
-        opposite_direction = true;
-      double vec_a_factor_0 = a_to_b.dot(vector_a) / vector_a.dot(vector_a);
-      double vec_a_factor_1 = vec_a_factor_0 + (vector_b.dot(vector_a) / vector_a.dot(vector_a));
-      double vec_a_epsilon = Vector3D::EPSILON / vector_a.length(); // Note accuracy needs to be determined
+      const bool opposite_direction = vector_a.dot(vector_b) < 0.0;
+      double vec_a_factor_0 = a_to_b.dot(vector_a) / a_length_squared;
+      double vec_a_factor_1 = vec_a_factor_0 + (vector_b.dot(vector_a) / a_length_squared);
+      double vec_a_epsilon = Vector3D::EPSILON / std::sqrt(a_length_squared); // Note accuracy needs to be determined
       if ((!opposite_direction && vec_a_factor_0 < vec_a_epsilon && vec_a_factor_1 > -vec_a_epsilon) ||
           (opposite_direction && vec_a_factor_1 < vec_a_epsilon && vec_a_factor_0 > -vec_a_epsilon)) {
         // The intersection is at the start of line A
@@ -541,34 +279,21 @@ Point3D Point3D::intersection_between_lines(const Point3D& point_a, const Vector
       return Point3D(false);
     }
   }
-  // We create lines and find the closest points between them.
-  Line3D line_a(point_a, vector_a);
-  Line3D line_b(point_b, vector_b);
-  std::pair<Point3D, Point3D> closest_points = line_a.closest_points(line_b);
-  // Check closest points are actually the same.
-  if (closest_points.first != closest_points.second) {
-    // No intersection
+  LineCrossing crossing = line_crossing(point_a, vector_a, point_b, vector_b, vec_a_cross_b);
+  if (!crossing.intersection) {
+    // The lines are skew, so there is no intersection
     return Point3D(false);
   }
-  // Otherwise, we need to see if the intersection of the lines lie between the line segments
-  Point3D intersection = closest_points.first;
-  Vector3D a_to_int = intersection - point_a;
-  Vector3D b_to_int = intersection - point_b;
-  // Express the point of intersection as a scalar of the vectors from point A and point B
-  double a_direction_factor = 0.0;
-  if (a_to_int != zero_vector)
-    a_direction_factor = vector_a.unit().dot(a_to_int.unit());
-  double b_direction_factor = 0.0;
-  if (b_to_int != zero_vector)
-    b_direction_factor = vector_b.unit().dot(b_to_int.unit());
-
-  double a_factor = a_direction_factor * a_to_int.length() / vector_a.length();
-  double b_factor = b_direction_factor * b_to_int.length() / vector_b.length();
-  double a_epsilon = Vector3D::EPSILON / vector_a.length();
-  double b_epsilon = Vector3D::EPSILON / vector_b.length();
-  if (a_factor > -a_epsilon && a_factor < 1.0 + a_epsilon &&
-      b_factor > -b_epsilon && b_factor < 1.0 + b_epsilon) {
-    return intersection;
+  // The segments cross if the ends of each one lie on either side of the other.
+  if (crossing.a_crosses_b && crossing.b_crosses_a) {
+    return crossing.intersection;
+  }
+  // Otherwise, allow for the ends of the segments touching within SketchUp's tolerance.
+  double a_epsilon = Vector3D::EPSILON / std::sqrt(a_length_squared);
+  double b_epsilon = Vector3D::EPSILON / std::sqrt(b_length_squared);
+  if (crossing.factor_a > -a_epsilon && crossing.factor_a < 1.0 + a_epsilon &&
+      crossing.factor_b > -b_epsilon && crossing.factor_b < 1.0 + b_epsilon) {
+    return crossing.intersection;
   }
   return Point3D(false);
 }
@@ -585,18 +310,19 @@ Point3D Point3D::ray_line_intersection(const Point3D& point_a, const Vector3D& v
   if (a_to_b == zero_vector) {
     return point_a;
   }
-  Vector3D b_to_a = -a_to_b;
-  Vector3D vec_a_cross_b_z_comp =  vector_a.unit().cross(ray_b.unit()); // Use unit vectors for easier comparisons with zero vector
-  Vector3D a_to_b_cross_vec_a_z_comp = a_to_b.unit().cross(vector_a.unit()); // Use unit vectors for easier comparisons with zero vector
-  // Check for collinearity
-  if (vec_a_cross_b_z_comp == zero_vector) {
-    if (a_to_b_cross_vec_a_z_comp == zero_vector) {
+  const double a_length_squared = vector_a.squared_length();
+  const double b_length_squared = ray_b.squared_length();
+  const Vector3D vec_a_cross_b = vector_a.cross(ray_b);
+  // Check for collinearity.  The sine of the angle between the lines is compared with EPSILON, without normalising the vectors.
+  if (vec_a_cross_b.squared_length() < EPSILON * EPSILON * a_length_squared * b_length_squared) {
+    if (a_to_b.cross(vector_a).squared_length() < EPSILON * EPSILON * a_length_squared) {
       // Lines are collinear, so there is no intersection
       if (!return_colinear) {
         return Point3D(false);
       }
-      double b_to_a_factor = b_to_a.dot(ray_b) / ray_b.dot(ray_b);
-      double b_to_a_end_factor = b_to_a_factor + (vector_a.dot(ray_b) / ray_b.dot(ray_b));
+      Vector3D b_to_a = -a_to_b;
+      double b_to_a_factor = b_to_a.dot(ray_b) / b_length_squared;
+      double b_to_a_end_factor = b_to_a_factor + (vector_a.dot(ray_b) / b_length_squared);
       if ((b_to_a_factor < 0.0 && b_to_a_end_factor > 0.0) || (b_to_a_factor > 0.0 && b_to_a_end_factor < 0.0)) {
         // The start of ray B is on line A
         return point_b;
@@ -620,53 +346,23 @@ Point3D Point3D::ray_line_intersection(const Point3D& point_a, const Vector3D& v
       return Point3D(false);
     }
   }
-    // We create lines and find the closest points between them.
-  Line3D line_a(point_a, vector_a);
-  Line3D line_b(point_b, ray_b);
-  std::pair<Point3D, Point3D> closest_points = line_a.closest_points(line_b);
-  // Check closest points are actually the same.
-  if (closest_points.first != closest_points.second) {
-    // No intersection
+  LineCrossing crossing = line_crossing(point_a, vector_a, point_b, ray_b, vec_a_cross_b);
+  if (!crossing.intersection) {
+    // The lines are skew, so there is no intersection
     return Point3D(false);
   }
-  // Otherwise, we need to see if the intersection of the lines lie between the line segments
-  Point3D intersection = closest_points.first;
-  Vector3D a_to_int = intersection - point_a;
-  Vector3D b_to_int = intersection - point_b;
-  // Express the point of intersection as a scalar of the vectors from point A and point B
-  double a_direction_factor = 0.0;
-  if (a_to_int != zero_vector)
-    a_direction_factor = vector_a.unit().dot(a_to_int.unit());
-  double b_direction_factor = 0.0;
-  if (b_to_int != zero_vector)
-    b_direction_factor = ray_b.unit().dot(b_to_int.unit());
-
-  double a_factor = a_direction_factor * a_to_int.length() / vector_a.length();
-  double b_factor = b_direction_factor * b_to_int.length() / ray_b.length();
-  double a_epsilon = Vector3D::EPSILON / vector_a.length();
-  double b_epsilon = Vector3D::EPSILON / ray_b.length();
-  if (a_factor > -a_epsilon && a_factor < 1.0 + a_epsilon &&
-      b_factor > -b_epsilon) {
-    return intersection;
+  // The ray crosses the segment if the ends of the segment lie on either side of the ray, and the segment is in front of the start of the ray.
+  if (crossing.a_crosses_b && crossing.factor_b >= 0.0) {
+    return crossing.intersection;
   }
-  return Point3D(false);
-
-  /*
-  else if (a_to_b_cross_vec_a_z_comp != zero_vector) {
-    Vector3D vec_a_cross_b = vector_a.cross(ray_b);
-    double line_a_factor = a_to_b.cross(ray_b).length() / vec_a_cross_b.length();
-    double a_epsilon = Vector3D::EPSILON / vector_a.length(); // Note accuracy needs to be determined
-    double line_b_factor = b_to_a.cross(vector_a).length() / vec_a_cross_b.length();
-    double b_epsilon = Vector3D::EPSILON / ray_b.length();
-    if (-a_epsilon <= line_a_factor && line_a_factor <= (1.0 + a_epsilon) &&
-        -b_epsilon <= line_b_factor) {
-      Point3D intersection = point_a + (vector_a * line_a_factor);
-      return intersection;
-    }
+  // Otherwise, allow for the ends of the segment or ray touching within SketchUp's tolerance.
+  double a_epsilon = Vector3D::EPSILON / std::sqrt(a_length_squared);
+  double b_epsilon = Vector3D::EPSILON / std::sqrt(b_length_squared);
+  if (crossing.factor_a > -a_epsilon && crossing.factor_a < 1.0 + a_epsilon &&
+      crossing.factor_b > -b_epsilon) {
+    return crossing.intersection;
   }
-  // The lines do not intersect
   return Point3D(false);
-  */
 }
 
 
@@ -833,21 +529,6 @@ Point3D Plane3D::intersection_between(const Point3D& point_a, const Point3D& poi
 }
 
 
-Vector3D Plane3D::normal() const {
-  return Vector3D{a,b,c};
-}
-
-double Plane3D::distance(const Point3D& point) const {
-  return normal().dot(point) + d;
-}
-
-bool Plane3D::on_plane(const Point3D& point) const {
-  double distance = this->distance(point);
-  if (fabs(distance) < EPSILON) {
-    return true;
-  }
-  return false;
-}
 
 
 Plane3D Plane3D::offset(double offset_by) const {
@@ -929,15 +610,17 @@ Plane3D Plane3D::plane_from_loop(const std::vector<Point3D>& loop_points) {
   // We will use two adjacent edges of the the loop to create a plane from.  The vertex that is furthest from the centre of the loop is where we will start
 
   // Or this solution: https://www.khronos.org/opengl/wiki/Calculating_a_Surface_Normal
+  // The points are taken relative to the first point, so that the sums do not lose precision when the loop is far from the origin.
   Vector3D normal(0.0, 0.0, 0.0);
+  const Point3D& origin = loop_points[0];
   for (size_t i=0; i < loop_points.size(); i++) {
-    Point3D next;
-    Point3D current = loop_points[i];
+    Vector3D next;
+    Vector3D current = loop_points[i] - origin;
     if (i == loop_points.size() - 1) {
-      next = loop_points[0];
+      next = Vector3D::zero_vector();
     }
     else {
-      next = loop_points[i+1];
+      next = loop_points[i+1] - origin;
     }
     normal.x += (current.y - next.y) * (current.z + next.z);
     normal.y += (current.z - next.z) * (current.x + next.x);
@@ -956,11 +639,11 @@ Plane3D Plane3D::plane_from_loop(const std::vector<Point3D>& loop_points) {
 */
 
 BoundingBox3D::BoundingBox3D():
-  BoundingBox3D(SUBoundingBox3D{Point3D(), Point3D()})
+  BoundingBox3D(SUBoundingBox3D{Point3D(true), Point3D(true)})
 {}
 
 BoundingBox3D::BoundingBox3D(bool valid):
-  m_bounding_box(SUBoundingBox3D{Point3D(), Point3D()}),
+  m_bounding_box(SUBoundingBox3D{Point3D(true), Point3D(true)}),
   is_null(!valid)
 {}
 
@@ -1145,27 +828,6 @@ std::pair<Point3D, Point3D> Line3D::closest_points(const Line3D &other_line) con
 }
 
 
-Point3D Line3D::closest_point(const Point3D& point) const {
-  if (!point) {
-    throw std::invalid_argument("CW::Line3D::closest_point(): given point is null");
-  }
-  if (!(*this)) {
-    throw std::logic_error("CW::Line3D::closest_point(): this line is null");
-  }
-  // @see http://paulbourke.net/geometry/pointlineplane/
-  // [P3 - P1 - u(P2 - P1)] dot (P2 - P1) = 0 - where U is the factor
-  Vector3D start_to_point = point - m_point;
-  double factor = start_to_point.dot(m_direction);
-  return m_point + (factor * m_direction);
-}
-
-
-double Line3D::distance(const Point3D& point) const {
-  Point3D closest_point = this->closest_point(point);
-  return Vector3D(point - closest_point).length();
-}
-
-
 bool Line3D::on_line(const Point3D& test_point) const {
   if (!test_point) {
     throw std::invalid_argument("CW::Line3D::on_line(): given point is null");
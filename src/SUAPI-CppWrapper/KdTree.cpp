@@ -0,0 +1,289 @@
+//
+//  KdTree.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/KdTree.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* Queries are answered in chunks of this many points.  Each thread takes the next chunk when it finishes one.
+*/
+constexpr size_t QUERIES_PER_CHUNK = 256;
+
+inline double coordinate(const Point3D& point, size_t axis) {
+  return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+inline double squared_distance(const Point3D& a, const Point3D& b) {
+  const double dx = a.x - b.x;
+  const double dy = a.y - b.y;
+  const double dz = a.z - b.z;
+  return (dx * dx) + (dy * dy) + (dz * dz);
+}
+
+} // namespace
+
+KdTree::KdTree()
+{}
+
+
+KdTree::KdTree(const std::vector<Point3D>& points, size_t num_threads) {
+  // The points are partitioned together with their indices, rather than partitioning the indices alone, so that the comparisons read memory in order.
+  std::vector<Entry> entries;
+  entries.reserve(points.size());
+  for (size_t i=0; i < points.size(); ++i) {
+    if (!points[i]) {
+      throw std::invalid_argument("CW::KdTree::KdTree(): points must not be null");
+    }
+    entries.push_back(Entry{{points[i].x, points[i].y, points[i].z}, i});
+  }
+  m_axes.resize(points.size(), 0);
+  // Each thread builds a range of at least this size, which halves at each level of the tree.
+  const size_t threads = thread_count(num_threads);
+  const size_t parallel_size = threads > 1 ? std::max<size_t>(points.size() / threads, 4096) : points.size();
+  build(entries, 0, entries.size(), parallel_size);
+  // The points are stored in the order of the tree, so that each range is contiguous in memory.
+  m_points.reserve(points.size());
+  m_indices.reserve(points.size());
+  for (const Entry& entry : entries) {
+    m_points.push_back(points[entry.index]);
+    m_indices.push_back(entry.index);
+  }
+}
+
+
+void KdTree::build(std::vector<Entry>& entries, size_t begin, size_t end, size_t parallel_size) {
+  if (end - begin <= LEAF_SIZE) {
+    return;
+  }
+  // Split on the axis along which the points are most spread out.
+  double min[3] = {entries[begin].coordinates[0], entries[begin].coordinates[1], entries[begin].coordinates[2]};
+  double max[3] = {min[0], min[1], min[2]};
+  for (size_t i=begin + 1; i < end; ++i) {
+    for (size_t axis=0; axis < 3; ++axis) {
+      min[axis] = std::min(min[axis], entries[i].coordinates[axis]);
+      max[axis] = std::max(max[axis], entries[i].coordinates[axis]);
+    }
+  }
+  const double extent[3] = {max[0] - min[0], max[1] - min[1], max[2] - min[2]};
+  const uint8_t axis = extent[0] >= extent[1] && extent[0] >= extent[2] ? 0 : (extent[1] >= extent[2] ? 1 : 2);
+  const size_t middle = begin + ((end - begin) / 2);
+  std::nth_element(entries.begin() + begin, entries.begin() + middle, entries.begin() + end, [axis](const Entry& a, const Entry& b) {
+    return a.coordinates[axis] < b.coordinates[axis];
+  });
+  m_axes[middle] = axis;
+  if (end - begin > parallel_size) {
+    std::thread lower([this, &entries, begin, middle, parallel_size]() {
+      build(entries, begin, middle, parallel_size);
+    });
+    build(entries, middle + 1, end, parallel_size);
+    lower.join();
+  }
+  else {
+    build(entries, begin, middle, parallel_size);
+    build(entries, middle + 1, end, parallel_size);
+  }
+}
+
+
+size_t KdTree::size() const {
+  return m_points.size();
+}
+
+
+bool KdTree::empty() const {
+  return m_points.empty();
+}
+
+
+void KdTree::nearest(const Point3D& point, size_t begin, size_t end, size_t& best, double& best_squared_distance) const {
+  if (end - begin <= LEAF_SIZE) {
+    for (size_t i=begin; i < end; ++i) {
+      const double d = squared_distance(point, m_points[i]);
+      // Ties go to the lowest original index, so that the result does not depend on the shape of the tree.
+      if (d < best_squared_distance || (d == best_squared_distance && (best == NOT_FOUND || m_indices[i] < m_indices[best]))) {
+        best_squared_distance = d;
+        best = i;
+      }
+    }
+    return;
+  }
+  const size_t middle = begin + ((end - begin) / 2);
+  const size_t axis = m_axes[middle];
+  const double offset = coordinate(point, axis) - coordinate(m_points[middle], axis);
+  // Search the side of the split containing the point first, as it is most likely to hold the nearest point.
+  if (offset < 0.0) {
+    nearest(point, begin, middle, best, best_squared_distance);
+  }
+  else {
+    nearest(point, middle + 1, end, best, best_squared_distance);
+  }
+  if (offset * offset > best_squared_distance) {
+    return;
+  }
+  nearest(point, middle, middle + 1, best, best_squared_distance);
+  if (offset < 0.0) {
+    nearest(point, middle + 1, end, best, best_squared_distance);
+  }
+  else {
+    nearest(point, begin, middle, best, best_squared_distance);
+  }
+}
+
+
+size_t KdTree::nearest(const Point3D& point, double max_distance) const {
+  if (!point) {
+    throw std::invalid_argument("CW::KdTree::nearest(): Point3D given is null");
+  }
+  size_t best = NOT_FOUND;
+  double best_squared_distance = max_distance * max_distance;
+  nearest(point, 0, m_points.size(), best, best_squared_distance);
+  return best == NOT_FOUND ? NOT_FOUND : m_indices[best];
+}
+
+
+std::vector<size_t> KdTree::nearest(const std::vector<Point3D>& points, double max_distance, size_t num_threads) const {
+  for (const Point3D& point : points) {
+    if (!point) {
+      throw std::invalid_argument("CW::KdTree::nearest(): points must not be null");
+    }
+  }
+  std::vector<size_t> results(points.size());
+  parallel_for_chunks(points.size(), QUERIES_PER_CHUNK, num_threads, [&](size_t begin, size_t end) {
+    for (size_t i=begin; i < end; ++i) {
+      results[i] = nearest(points[i], max_distance);
+    }
+  });
+  return results;
+}
+
+
+void KdTree::k_nearest(const Point3D& point, size_t k, size_t begin, size_t end, std::vector<std::pair<double, size_t>>& heap) const {
+  // The heap holds the k nearest points found so far, as (squared distance, original index) pairs, with the furthest at the top.  Its size is fixed at k, padded with points at the maximum distance.
+  auto consider = [&](size_t i) {
+    const std::pair<double, size_t> candidate(squared_distance(point, m_points[i]), m_indices[i]);
+    if (candidate < heap.front()) {
+      std::pop_heap(heap.begin(), heap.end());
+      heap.back() = candidate;
+      std::push_heap(heap.begin(), heap.end());
+    }
+  };
+  if (end - begin <= LEAF_SIZE) {
+    for (size_t i=begin; i < end; ++i) {
+      consider(i);
+    }
+    return;
+  }
+  const size_t middle = begin + ((end - begin) / 2);
+  const size_t axis = m_axes[middle];
+  const double offset = coordinate(point, axis) - coordinate(m_points[middle], axis);
+  if (offset < 0.0) {
+    k_nearest(point, k, begin, middle, heap);
+  }
+  else {
+    k_nearest(point, k, middle + 1, end, heap);
+  }
+  if (offset * offset > heap.front().first) {
+    return;
+  }
+  consider(middle);
+  if (offset < 0.0) {
+    k_nearest(point, k, middle + 1, end, heap);
+  }
+  else {
+    k_nearest(point, k, begin, middle, heap);
+  }
+}
+
+
+std::vector<size_t> KdTree::k_nearest(const Point3D& point, size_t k, double max_distance) const {
+  if (!point) {
+    throw std::invalid_argument("CW::KdTree::k_nearest(): Point3D given is null");
+  }
+  k = std::min(k, m_points.size());
+  if (k == 0) {
+    return std::vector<size_t>();
+  }
+  // Padding entries have an index past any point, so that real points at the maximum distance replace them.
+  std::vector<std::pair<double, size_t>> heap(k, std::make_pair(max_distance * max_distance, NOT_FOUND));
+  k_nearest(point, k, 0, m_points.size(), heap);
+  std::sort_heap(heap.begin(), heap.end());
+  std::vector<size_t> results;
+  results.reserve(k);
+  for (const std::pair<double, size_t>& entry : heap) {
+    if (entry.second != NOT_FOUND) {
+      results.push_back(entry.second);
+    }
+  }
+  return results;
+}
+
+
+void KdTree::within(const Point3D& point, double radius, size_t begin, size_t end, std::vector<size_t>& results) const {
+  const double squared_radius = radius * radius;
+  if (end - begin <= LEAF_SIZE) {
+    for (size_t i=begin; i < end; ++i) {
+      if (squared_distance(point, m_points[i]) <= squared_radius) {
+        results.push_back(m_indices[i]);
+      }
+    }
+    return;
+  }
+  const size_t middle = begin + ((end - begin) / 2);
+  const size_t axis = m_axes[middle];
+  const double offset = coordinate(point, axis) - coordinate(m_points[middle], axis);
+  if (squared_distance(point, m_points[middle]) <= squared_radius) {
+    results.push_back(m_indices[middle]);
+  }
+  if (offset <= radius) {
+    within(point, radius, begin, middle, results);
+  }
+  if (offset >= -radius) {
+    within(point, radius, middle + 1, end, results);
+  }
+}
+
+
+std::vector<size_t> KdTree::within(const Point3D& point, double radius) const {
+  if (!point) {
+    throw std::invalid_argument("CW::KdTree::within(): Point3D given is null");
+  }
+  std::vector<size_t> results;
+  within(point, radius, 0, m_points.size(), results);
+  return results;
+}
+
+} /* namespace CW */
@@ -0,0 +1,485 @@
+//
+//  MeshDecimator.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/MeshDecimator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_set>
+
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* The weight of the planes that hold boundary and feature edges in place, relative to the planes of the triangles.
+*/
+constexpr double FEATURE_WEIGHT = 100.0;
+
+/**
+* Collapses that would turn the normal of a triangle by more than about 78 degrees are not made, so that the mesh does not fold over.
+*/
+constexpr double MIN_NORMAL_COSINE = 0.2;
+
+Vector3D triangle_normal(const Point3D& a, const Point3D& b, const Point3D& c) {
+  return Vector3D(b - a).cross(c - a);
+}
+
+} // namespace
+
+/******************
+** Mesh and Target **
+*******************/
+size_t MeshDecimator::Mesh::num_triangles() const {
+  return indices.size() / 3;
+}
+
+
+MeshDecimator::Target::Target()
+{}
+
+
+MeshDecimator::Target::Target(size_t max_triangles, double max_error):
+  max_triangles(max_triangles),
+  max_error(max_error)
+{}
+
+/******************
+** Quadric **
+*******************/
+void MeshDecimator::Quadric::add_plane(const Vector3D& normal, double offset, double weight) {
+  m[0] += weight * normal.x * normal.x;
+  m[1] += weight * normal.x * normal.y;
+  m[2] += weight * normal.x * normal.z;
+  m[3] += weight * normal.x * offset;
+  m[4] += weight * normal.y * normal.y;
+  m[5] += weight * normal.y * normal.z;
+  m[6] += weight * normal.y * offset;
+  m[7] += weight * normal.z * normal.z;
+  m[8] += weight * normal.z * offset;
+  m[9] += weight * offset * offset;
+}
+
+
+MeshDecimator::Quadric& MeshDecimator::Quadric::operator+=(const Quadric& other) {
+  for (size_t i=0; i < m.size(); ++i) {
+    m[i] += other.m[i];
+  }
+  return *this;
+}
+
+
+double MeshDecimator::Quadric::error(const Point3D& point) const {
+  const double x = point.x;
+  const double y = point.y;
+  const double z = point.z;
+  return (m[0] * x * x) + (2.0 * m[1] * x * y) + (2.0 * m[2] * x * z) + (2.0 * m[3] * x) +
+         (m[4] * y * y) + (2.0 * m[5] * y * z) + (2.0 * m[6] * y) +
+         (m[7] * z * z) + (2.0 * m[8] * z) + m[9];
+}
+
+
+bool MeshDecimator::Quadric::minimum(Point3D& point) const {
+  // Solves the 3x3 system by Cramer's rule.
+  const double c00 = (m[4] * m[7]) - (m[5] * m[5]);
+  const double c01 = (m[2] * m[5]) - (m[1] * m[7]);
+  const double c02 = (m[1] * m[5]) - (m[2] * m[4]);
+  const double det = (m[0] * c00) + (m[1] * c01) + (m[2] * c02);
+  const double scale = std::max(std::abs(m[0]), std::max(std::abs(m[4]), std::abs(m[7])));
+  if (!(std::abs(det) > 1e-9 * scale * scale * scale)) {
+    return false;
+  }
+  const double c11 = (m[0] * m[7]) - (m[2] * m[2]);
+  const double c12 = (m[1] * m[2]) - (m[0] * m[5]);
+  const double c22 = (m[0] * m[4]) - (m[1] * m[1]);
+  point = Point3D(-((c00 * m[3]) + (c01 * m[6]) + (c02 * m[8])) / det,
+                  -((c01 * m[3]) + (c11 * m[6]) + (c12 * m[8])) / det,
+                  -((c02 * m[3]) + (c12 * m[6]) + (c22 * m[8])) / det);
+  return true;
+}
+
+
+bool MeshDecimator::Collapse::operator>(const Collapse& other) const {
+  return cost > other.cost;
+}
+
+/******************
+** MeshDecimator **
+*******************/
+MeshDecimator::MeshDecimator():
+  m_num_triangles(0)
+{}
+
+
+uint64_t MeshDecimator::edge_key(size_t a, size_t b) {
+  return (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint64_t>(std::max(a, b));
+}
+
+
+std::vector<MeshDecimator::Mesh> MeshDecimator::decimate(const Mesh& mesh, const std::vector<Target>& targets) {
+  load(mesh);
+  add_constraints();
+  std::vector<Mesh> levels;
+  levels.reserve(targets.size());
+  for (const Target& target : targets) {
+    const double max_cost = target.max_error * target.max_error;
+    while (m_num_triangles > target.max_triangles && !m_queue.empty()) {
+      // Later collapses cost no less than this one, so decimation stops here.
+      if (m_queue.front().cost > max_cost) {
+        break;
+      }
+      const Collapse next = m_queue.front();
+      std::pop_heap(m_queue.begin(), m_queue.end(), std::greater<Collapse>());
+      m_queue.pop_back();
+      // Collapses are queued again whenever their vertices change, so older entries are skipped.
+      if (next.from_version != m_versions[next.from] || next.to_version != m_versions[next.to]) {
+        continue;
+      }
+      Point3D position;
+      best_position(next.from, next.to, position);
+      if (collapse_allowed(next.from, next.to, position)) {
+        collapse(next.from, next.to, position);
+      }
+    }
+    levels.push_back(result());
+  }
+  return levels;
+}
+
+
+std::vector<std::vector<MeshDecimator::Mesh>> MeshDecimator::decimate(const std::vector<Mesh>& meshes, const std::vector<Target>& targets, size_t num_threads) {
+  std::vector<std::vector<Mesh>> results(meshes.size());
+  // Each mesh is a chunk of its own, as meshes vary widely in size.
+  parallel_for_chunks(meshes.size(), 1, num_threads, []() { return MeshDecimator(); }, [&](MeshDecimator& decimator, size_t begin, size_t end) {
+    for (size_t i=begin; i < end; ++i) {
+      results[i] = decimator.decimate(meshes[i], targets);
+    }
+  });
+  return results;
+}
+
+
+void MeshDecimator::load(const Mesh& mesh) {
+  if (mesh.vertices.size() > std::numeric_limits<uint32_t>::max()) {
+    throw std::invalid_argument("CW::MeshDecimator::decimate(): too many vertices");
+  }
+  if (mesh.indices.size() % 3 != 0) {
+    throw std::invalid_argument("CW::MeshDecimator::decimate(): number of indices is not a multiple of three");
+  }
+  if (!mesh.attributes.empty() && mesh.attributes.size() != mesh.num_triangles()) {
+    throw std::invalid_argument("CW::MeshDecimator::decimate(): number of attributes differs from the number of triangles");
+  }
+  const size_t num_vertices = mesh.vertices.size();
+  m_positions = mesh.vertices;
+  m_triangles.clear();
+  m_attributes.clear();
+  m_vertex_triangles.assign(num_vertices, {});
+  m_quadrics.assign(num_vertices, Quadric());
+  m_versions.assign(num_vertices, 0);
+  m_edges.clear();
+  m_queue.clear();
+  for (size_t i=0; i < mesh.indices.size(); i += 3) {
+    const std::array<size_t, 3> triangle = {mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]};
+    if (triangle[0] >= num_vertices || triangle[1] >= num_vertices || triangle[2] >= num_vertices) {
+      throw std::invalid_argument("CW::MeshDecimator::decimate(): vertex index out of range");
+    }
+    if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0]) {
+      continue;
+    }
+    const size_t index = m_triangles.size();
+    m_triangles.push_back(triangle);
+    m_attributes.push_back(mesh.attributes.empty() ? 0 : mesh.attributes[i / 3]);
+    const Vector3D unit_normal = triangle_normal(m_positions[triangle[0]], m_positions[triangle[1]], m_positions[triangle[2]]).normalized();
+    for (size_t vertex : triangle) {
+      m_vertex_triangles[vertex].push_back(index);
+      if (unit_normal.squared_length() > 0.0) {
+        m_quadrics[vertex].add_plane(unit_normal, -unit_normal.dot(Vector3D(m_positions[triangle[0]])), 1.0);
+      }
+    }
+  }
+  m_removed.assign(m_triangles.size(), false);
+  m_num_triangles = m_triangles.size();
+  for (const Edge& edge : mesh.edges) {
+    if (edge.start >= num_vertices || edge.end >= num_vertices) {
+      throw std::invalid_argument("CW::MeshDecimator::decimate(): edge vertex index out of range");
+    }
+    m_edges[edge_key(edge.start, edge.end)] = edge;
+  }
+}
+
+
+void MeshDecimator::add_constraints() {
+  // Counts the triangles on each edge, and whether they differ in attribute.
+  struct EdgeUse {
+    size_t count;
+    size_t attribute;
+    bool mixed;
+  };
+  std::unordered_map<uint64_t, EdgeUse> uses;
+  uses.reserve(m_triangles.size() * 2);
+  for (size_t t=0; t < m_triangles.size(); ++t) {
+    for (size_t i=0; i < 3; ++i) {
+      const uint64_t key = edge_key(m_triangles[t][i], m_triangles[t][(i + 1) % 3]);
+      auto inserted = uses.emplace(key, EdgeUse{0, m_attributes[t], false});
+      EdgeUse& use = inserted.first->second;
+      ++use.count;
+      use.mixed = use.mixed || use.attribute != m_attributes[t];
+    }
+  }
+  // Each feature edge adds a plane through it, perpendicular to each of its triangles, to its vertices.
+  for (size_t t=0; t < m_triangles.size(); ++t) {
+    const std::array<size_t, 3>& triangle = m_triangles[t];
+    const Vector3D normal = triangle_normal(m_positions[triangle[0]], m_positions[triangle[1]], m_positions[triangle[2]]);
+    if (!(normal.length() > 0.0)) {
+      continue;
+    }
+    for (size_t i=0; i < 3; ++i) {
+      const size_t a = triangle[i];
+      const size_t b = triangle[(i + 1) % 3];
+      const uint64_t key = edge_key(a, b);
+      const EdgeUse& use = uses[key];
+      auto edge = m_edges.find(key);
+      const bool feature = use.count != 2 || use.mixed || (edge != m_edges.end() && !edge->second.soft);
+      if (!feature) {
+        continue;
+      }
+      const Vector3D direction = m_positions[b] - m_positions[a];
+      const Vector3D plane_normal = direction.cross(normal).normalized();
+      if (!(plane_normal.squared_length() > 0.0)) {
+        continue;
+      }
+      const double offset = -plane_normal.dot(Vector3D(m_positions[a]));
+      m_quadrics[a].add_plane(plane_normal, offset, FEATURE_WEIGHT);
+      m_quadrics[b].add_plane(plane_normal, offset, FEATURE_WEIGHT);
+    }
+  }
+  // The queue is built as a heap once, rather than by pushing each collapse.
+  m_queue.reserve(uses.size() * 2);
+  for (const std::pair<const uint64_t, EdgeUse>& use : uses) {
+    const size_t a = static_cast<size_t>(use.first >> 32);
+    const size_t b = static_cast<size_t>(use.first & 0xffffffff);
+    Point3D position;
+    m_queue.push_back(Collapse{best_position(a, b, position), static_cast<uint32_t>(a), static_cast<uint32_t>(b), m_versions[a], m_versions[b]});
+  }
+  std::make_heap(m_queue.begin(), m_queue.end(), std::greater<Collapse>());
+}
+
+
+double MeshDecimator::best_position(size_t a, size_t b, Point3D& position) const {
+  Quadric quadric = m_quadrics[a];
+  quadric += m_quadrics[b];
+  const Point3D& point_a = m_positions[a];
+  const Point3D& point_b = m_positions[b];
+  const Point3D middle = point_a + (Vector3D(point_b - point_a) * 0.5);
+  // The point of least error is used unless it is far from the edge, as it is where the planes are nearly parallel.
+  position = middle;
+  double cost = 0.0;
+  if (quadric.minimum(position) && Vector3D(position - middle).length() <= Vector3D(point_b - point_a).length()) {
+    cost = quadric.error(position);
+  }
+  else {
+    position = middle;
+    cost = quadric.error(middle);
+    for (const Point3D& end : {point_a, point_b}) {
+      const double end_cost = quadric.error(end);
+      if (end_cost < cost) {
+        position = end;
+        cost = end_cost;
+      }
+    }
+  }
+  return std::max(cost, 0.0);
+}
+
+
+void MeshDecimator::push_collapse(size_t a, size_t b) {
+  Point3D position;
+  m_queue.push_back(Collapse{best_position(a, b, position), static_cast<uint32_t>(a), static_cast<uint32_t>(b), m_versions[a], m_versions[b]});
+  std::push_heap(m_queue.begin(), m_queue.end(), std::greater<Collapse>());
+}
+
+
+void MeshDecimator::neighbours(size_t vertex, std::vector<size_t>& result) const {
+  result.clear();
+  for (size_t t : m_vertex_triangles[vertex]) {
+    for (size_t other : m_triangles[t]) {
+      if (other != vertex) {
+        result.push_back(other);
+      }
+    }
+  }
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+
+bool MeshDecimator::collapse_allowed(size_t from, size_t to, const Point3D& position) {
+  // The link condition: the only vertices adjoining both ends of the edge are those of the triangles on it.  Otherwise the collapse would pinch the surface.
+  std::vector<size_t> from_neighbours;
+  neighbours(from, from_neighbours);
+  neighbours(to, m_neighbours);
+  size_t shared_triangles = 0;
+  for (size_t t : m_vertex_triangles[from]) {
+    const std::array<size_t, 3>& triangle = m_triangles[t];
+    if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+      ++shared_triangles;
+    }
+  }
+  if (shared_triangles == 0) {
+    return false;
+  }
+  std::vector<size_t> common;
+  std::set_intersection(from_neighbours.begin(), from_neighbours.end(), m_neighbours.begin(), m_neighbours.end(), std::back_inserter(common));
+  if (common.size() != shared_triangles) {
+    return false;
+  }
+  // An interior edge between two boundary vertices would join the boundaries.  Around a boundary vertex there is one more neighbour than triangles.
+  if (shared_triangles == 2 && from_neighbours.size() != m_vertex_triangles[from].size() && m_neighbours.size() != m_vertex_triangles[to].size()) {
+    return false;
+  }
+  // No remaining triangle may fold over or become degenerate.
+  for (size_t vertex : {from, to}) {
+    for (size_t t : m_vertex_triangles[vertex]) {
+      std::array<Point3D, 3> points;
+      bool on_edge = false;
+      for (size_t i=0; i < 3; ++i) {
+        const size_t corner = m_triangles[t][i];
+        on_edge = on_edge || (corner == (vertex == from ? to : from));
+        points[i] = corner == vertex ? position : m_positions[corner];
+      }
+      if (on_edge) {
+        continue;
+      }
+      const std::array<size_t, 3>& triangle = m_triangles[t];
+      const Vector3D old_normal = triangle_normal(m_positions[triangle[0]], m_positions[triangle[1]], m_positions[triangle[2]]);
+      const Vector3D new_normal = triangle_normal(points[0], points[1], points[2]);
+      const double new_length = new_normal.length();
+      if (!(new_length > 0.0)) {
+        return false;
+      }
+      const double old_length = old_normal.length();
+      if (old_length > 0.0 && old_normal.dot(new_normal) < MIN_NORMAL_COSINE * old_length * new_length) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+void MeshDecimator::collapse(size_t from, size_t to, const Point3D& position) {
+  neighbours(from, m_neighbours);
+  for (size_t t : m_vertex_triangles[from]) {
+    std::array<size_t, 3>& triangle = m_triangles[t];
+    if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+      m_removed[t] = true;
+      --m_num_triangles;
+      for (size_t corner : triangle) {
+        if (corner != from) {
+          std::vector<size_t>& corner_triangles = m_vertex_triangles[corner];
+          corner_triangles.erase(std::find(corner_triangles.begin(), corner_triangles.end(), t));
+        }
+      }
+    }
+    else {
+      std::replace(triangle.begin(), triangle.end(), from, to);
+      m_vertex_triangles[to].push_back(t);
+    }
+  }
+  m_vertex_triangles[from].clear();
+  // The source edges at the removed vertex move to the kept vertex.  Where two edges become one, it is as visible as the more visible of them.
+  m_edges.erase(edge_key(from, to));
+  for (size_t other : m_neighbours) {
+    auto found = m_edges.find(edge_key(from, other));
+    if (found == m_edges.end()) {
+      continue;
+    }
+    Edge edge = found->second;
+    m_edges.erase(found);
+    edge.start = edge.start == from ? to : edge.start;
+    edge.end = edge.end == from ? to : edge.end;
+    auto inserted = m_edges.emplace(edge_key(to, other), edge);
+    if (!inserted.second) {
+      Edge& existing = inserted.first->second;
+      existing.hidden = existing.hidden && edge.hidden;
+      existing.soft = existing.soft && edge.soft;
+      existing.smooth = existing.smooth && edge.smooth;
+    }
+  }
+  m_quadrics[to] += m_quadrics[from];
+  m_positions[to] = position;
+  ++m_versions[from];
+  ++m_versions[to];
+  neighbours(to, m_neighbours);
+  for (size_t other : m_neighbours) {
+    push_collapse(to, other);
+  }
+}
+
+
+MeshDecimator::Mesh MeshDecimator::result() const {
+  Mesh mesh;
+  const size_t none = std::numeric_limits<size_t>::max();
+  std::vector<size_t> remap(m_positions.size(), none);
+  for (size_t vertex=0; vertex < m_positions.size(); ++vertex) {
+    if (!m_vertex_triangles[vertex].empty()) {
+      remap[vertex] = mesh.vertices.size();
+      mesh.vertices.push_back(m_positions[vertex]);
+    }
+  }
+  mesh.indices.reserve(m_num_triangles * 3);
+  mesh.attributes.reserve(m_num_triangles);
+  std::unordered_set<uint64_t> triangle_edges;
+  for (size_t t=0; t < m_triangles.size(); ++t) {
+    if (m_removed[t]) {
+      continue;
+    }
+    for (size_t i=0; i < 3; ++i) {
+      mesh.indices.push_back(remap[m_triangles[t][i]]);
+      triangle_edges.insert(edge_key(m_triangles[t][i], m_triangles[t][(i + 1) % 3]));
+    }
+    mesh.attributes.push_back(m_attributes[t]);
+  }
+  for (const std::pair<const uint64_t, Edge>& entry : m_edges) {
+    Edge edge = entry.second;
+    if (triangle_edges.count(entry.first) == 0) {
+      continue;
+    }
+    edge.start = remap[edge.start];
+    edge.end = remap[edge.end];
+    mesh.edges.push_back(edge);
+  }
+  std::sort(mesh.edges.begin(), mesh.edges.end(), [](const Edge& a, const Edge& b) {
+    return a.start != b.start ? a.start < b.start : a.end < b.end;
+  });
+  return mesh;
+}
+
+} /* namespace CW */
@@ -0,0 +1,648 @@
+//
+//  PolygonClipper.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/PolygonClipper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "SUAPI-CppWrapper/Predicates.hpp"
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/GeometryInput.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/LoopInput.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* Pairs of polygons are clipped in chunks of this many by each thread.
+*/
+constexpr size_t PAIRS_PER_CHUNK = 16;
+
+inline double component(const Vector3D& vector, size_t axis) {
+  return axis == 0 ? vector.x : (axis == 1 ? vector.y : vector.z);
+}
+
+/**
+* Returns the normal of a loop by Newell's method, with a length of twice the area of the loop.
+*/
+Vector3D newell_normal(const std::vector<Point3D>& loop) {
+  Vector3D sum(0.0, 0.0, 0.0);
+  for (size_t i=0; i < loop.size(); ++i) {
+    const Point3D& current = loop[i];
+    const Point3D& next = loop[(i + 1) % loop.size()];
+    sum.x += (current.y - next.y) * (current.z + next.z);
+    sum.y += (current.z - next.z) * (current.x + next.x);
+    sum.z += (current.x - next.x) * (current.y + next.y);
+  }
+  return sum;
+}
+
+/**
+* Returns the parameter along the segment of the point nearest to the given point, if that point is strictly between the ends of the segment and within SketchUp's tolerance of the given point.  Otherwise returns a negative value.
+*/
+double split_parameter(const Point3D& start, const Point3D& end, const Point3D& point) {
+  const Vector3D direction = end - start;
+  const double length_squared = direction.squared_length();
+  if (length_squared == 0.0) {
+    return -1.0;
+  }
+  const double t = Vector3D(point - start).dot(direction) / length_squared;
+  if (t <= 0.0 || t >= 1.0) {
+    return -1.0;
+  }
+  const Point3D nearest = start + (direction * t);
+  if (Vector3D(point - nearest).length() > SketchUpTolerance::EPSILON) {
+    return -1.0;
+  }
+  return t;
+}
+
+/**
+* Returns true if the point is inside the loop of points, by counting crossings of a ray in the +x direction.
+*/
+bool inside_loop(const SUPoint2D& point, const std::vector<SUPoint2D>& points, const std::vector<size_t>& loop) {
+  bool inside = false;
+  for (size_t i=0, j=loop.size() - 1; i < loop.size(); j = i++) {
+    const SUPoint2D& a = points[loop[i]];
+    const SUPoint2D& b = points[loop[j]];
+    if ((a.y > point.y) != (b.y > point.y) && point.x < a.x + ((point.y - a.y) * (b.x - a.x) / (b.y - a.y))) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+} // namespace
+
+/******************
+** Polygon **
+*******************/
+PolygonClipper::Polygon::Polygon()
+{}
+
+
+PolygonClipper::Polygon::Polygon(const std::vector<Point3D>& outer_loop, const std::vector<std::vector<Point3D>>& inner_loops):
+  outer_loop(outer_loop),
+  inner_loops(inner_loops)
+{}
+
+
+PolygonClipper::Polygon::Polygon(const Face& face) {
+  if (!face) {
+    throw std::logic_error("CW::PolygonClipper::Polygon::Polygon(): Face is null");
+  }
+  outer_loop = face.outer_loop().points();
+  for (const Loop& inner_loop : face.inner_loops()) {
+    inner_loops.push_back(inner_loop.points());
+  }
+}
+
+
+double PolygonClipper::Polygon::area() const {
+  double total = newell_normal(outer_loop).length() / 2.0;
+  for (const std::vector<Point3D>& inner_loop : inner_loops) {
+    total -= newell_normal(inner_loop).length() / 2.0;
+  }
+  return total;
+}
+
+
+size_t PolygonClipper::Polygon::add_to(GeometryInput& geom_input) const {
+  LoopInput outer_input;
+  for (const Point3D& point : outer_loop) {
+    outer_input.add_vertex_index(geom_input.add_vertex(point));
+  }
+  const size_t face_index = geom_input.add_face(outer_input);
+  for (const std::vector<Point3D>& inner_loop : inner_loops) {
+    LoopInput inner_input;
+    for (const Point3D& point : inner_loop) {
+      inner_input.add_vertex_index(geom_input.add_vertex(point));
+    }
+    geom_input.face_add_inner_loop(face_index, inner_input);
+  }
+  return face_index;
+}
+
+/******************
+** PolygonClipper **
+*******************/
+PolygonClipper::PolygonClipper():
+  m_axis(2),
+  m_mirror(false)
+{}
+
+
+std::vector<PolygonClipper::Polygon> PolygonClipper::clip(const Polygon& subject, const Polygon& clip, Operation operation) {
+  const Vector3D unit_normal = newell_normal(subject.outer_loop).normalized();
+  if (!(unit_normal.squared_length() > 0.0)) {
+    throw std::invalid_argument("CW::PolygonClipper::clip(): first polygon has no area");
+  }
+  const Point3D origin = subject.outer_loop[0];
+  auto check_coplanar = [&](const std::vector<Point3D>& loop) {
+    for (const Point3D& point : loop) {
+      if (!point || std::abs(Vector3D(point - origin).dot(unit_normal)) > SketchUpTolerance::EPSILON) {
+        throw std::invalid_argument("CW::PolygonClipper::clip(): polygons are not coplanar");
+      }
+    }
+  };
+  check_coplanar(clip.outer_loop);
+  for (const std::vector<Point3D>& inner_loop : clip.inner_loops) {
+    check_coplanar(inner_loop);
+  }
+  // As in Triangulator, the projection is mirrored where the normal points away from the coordinate plane, so that counter-clockwise in the projection is counter-clockwise about the normal.
+  m_axis = Predicates::dominant_axis(unit_normal);
+  m_mirror = component(unit_normal, m_axis) < 0.0;
+  m_welder.clear();
+  m_positions.clear();
+  m_points.clear();
+  m_selected.clear();
+  for (size_t polygon=0; polygon < 2; ++polygon) {
+    m_edges[polygon].clear();
+    m_pieces[polygon].clear();
+  }
+  add_loop(subject.outer_loop, 0, true);
+  for (const std::vector<Point3D>& inner_loop : subject.inner_loops) {
+    add_loop(inner_loop, 0, false);
+  }
+  add_loop(clip.outer_loop, 1, true);
+  for (const std::vector<Point3D>& inner_loop : clip.inner_loops) {
+    add_loop(inner_loop, 1, false);
+  }
+  split_edges();
+  make_pieces(0);
+  make_pieces(1);
+  build_bands(0);
+  build_bands(1);
+  classify_pieces();
+  select(operation);
+  return assemble(trace_loops());
+}
+
+
+std::vector<std::vector<PolygonClipper::Polygon>> PolygonClipper::clip(const std::vector<Polygon>& subjects, const std::vector<Polygon>& clips, Operation operation, size_t num_threads) {
+  if (subjects.size() != clips.size()) {
+    throw std::invalid_argument("CW::PolygonClipper::clip(): numbers of subjects and clips differ");
+  }
+  std::vector<std::vector<Polygon>> results(subjects.size());
+  parallel_for_chunks(subjects.size(), PAIRS_PER_CHUNK, num_threads, []() { return PolygonClipper(); }, [&](PolygonClipper& clipper, size_t begin, size_t end) {
+    for (size_t i=begin; i < end; ++i) {
+      results[i] = clipper.clip(subjects[i], clips[i], operation);
+    }
+  });
+  return results;
+}
+
+
+size_t PolygonClipper::add_vertex(const Point3D& position) {
+  const size_t vertex = m_welder.weld(position, m_positions.size());
+  if (vertex == m_positions.size()) {
+    SUPoint2D point = Predicates::project(position, m_axis);
+    if (m_mirror) {
+      point.y = -point.y;
+    }
+    m_positions.push_back(position);
+    m_points.push_back(point);
+  }
+  return vertex;
+}
+
+
+void PolygonClipper::add_loop(const std::vector<Point3D>& loop, size_t polygon, bool outer) {
+  // Coincident points are merged, and loops with no area are left out.  Outer loops are made counter-clockwise, and inner loops clockwise, so that the inside of the polygon is always to the left of its edges.
+  std::vector<size_t> vertices;
+  vertices.reserve(loop.size());
+  for (const Point3D& point : loop) {
+    if (!point) {
+      throw std::invalid_argument("CW::PolygonClipper::clip(): points of the polygons must not be null");
+    }
+    const size_t vertex = add_vertex(point);
+    if (vertices.empty() || vertex != vertices.back()) {
+      vertices.push_back(vertex);
+    }
+  }
+  while (vertices.size() > 1 && vertices.back() == vertices.front()) {
+    vertices.pop_back();
+  }
+  if (vertices.size() < 3) {
+    return;
+  }
+  const double area = signed_area(vertices);
+  if (area == 0.0) {
+    return;
+  }
+  if ((area > 0.0) != outer) {
+    std::reverse(vertices.begin(), vertices.end());
+  }
+  for (size_t i=0; i < vertices.size(); ++i) {
+    m_edges[polygon].push_back(InputEdge{vertices[i], vertices[(i + 1) % vertices.size()], {}});
+  }
+}
+
+
+void PolygonClipper::split_edges() {
+  // The edges of the second polygon are sorted by their least x, so that only those overlapping each edge of the first polygon in x are tested against it.
+  std::vector<std::pair<double, size_t>> sorted;
+  sorted.reserve(m_edges[1].size());
+  for (size_t b=0; b < m_edges[1].size(); ++b) {
+    sorted.emplace_back(std::min(m_points[m_edges[1][b].start].x, m_points[m_edges[1][b].end].x), b);
+  }
+  std::sort(sorted.begin(), sorted.end());
+  const double tolerance = SketchUpTolerance::EPSILON;
+  for (size_t a=0; a < m_edges[0].size(); ++a) {
+    const SUPoint2D a_start = m_points[m_edges[0][a].start];
+    const SUPoint2D a_end = m_points[m_edges[0][a].end];
+    const double max_x = std::max(a_start.x, a_end.x) + tolerance;
+    const double min_x = std::min(a_start.x, a_end.x) - tolerance;
+    const double max_y = std::max(a_start.y, a_end.y) + tolerance;
+    const double min_y = std::min(a_start.y, a_end.y) - tolerance;
+    for (const std::pair<double, size_t>& entry : sorted) {
+      if (entry.first > max_x) {
+        break;
+      }
+      const SUPoint2D& b_start = m_points[m_edges[1][entry.second].start];
+      const SUPoint2D& b_end = m_points[m_edges[1][entry.second].end];
+      if (std::max(b_start.x, b_end.x) < min_x || std::max(b_start.y, b_end.y) < min_y || std::min(b_start.y, b_end.y) > max_y) {
+        continue;
+      }
+      split(a, entry.second);
+    }
+  }
+}
+
+
+void PolygonClipper::split(size_t a, size_t b) {
+  InputEdge& edge_a = m_edges[0][a];
+  InputEdge& edge_b = m_edges[1][b];
+  // Where an end of one edge lies on the other, the other edge is split there.  Edges that touch or overlap in this way cannot also cross.
+  auto touch = [this](InputEdge& edge, size_t vertex) {
+    if (vertex == edge.start || vertex == edge.end) {
+      return true;
+    }
+    const double t = split_parameter(m_positions[edge.start], m_positions[edge.end], m_positions[vertex]);
+    if (t < 0.0) {
+      return false;
+    }
+    edge.splits.emplace_back(t, vertex);
+    return true;
+  };
+  bool touched = touch(edge_a, edge_b.start);
+  touched = touch(edge_a, edge_b.end) || touched;
+  touched = touch(edge_b, edge_a.start) || touched;
+  touched = touch(edge_b, edge_a.end) || touched;
+  if (touched) {
+    return;
+  }
+  const SUPoint2D& p0 = m_points[edge_a.start];
+  const SUPoint2D& p1 = m_points[edge_a.end];
+  const SUPoint2D& q0 = m_points[edge_b.start];
+  const SUPoint2D& q1 = m_points[edge_b.end];
+  const double o1 = Predicates::orient2d(p0, p1, q0);
+  const double o2 = Predicates::orient2d(p0, p1, q1);
+  if (!((o1 > 0.0 && o2 < 0.0) || (o1 < 0.0 && o2 > 0.0))) {
+    return;
+  }
+  const double o3 = Predicates::orient2d(q0, q1, p0);
+  const double o4 = Predicates::orient2d(q0, q1, p1);
+  if (!((o3 > 0.0 && o4 < 0.0) || (o3 < 0.0 && o4 > 0.0))) {
+    return;
+  }
+  // The orientations are proportional to the distances of each end from the other edge.
+  const double t = o3 / (o3 - o4);
+  const double u = o1 / (o1 - o2);
+  const Point3D start = m_positions[edge_a.start];
+  const Point3D end = m_positions[edge_a.end];
+  const size_t vertex = add_vertex(start + (Vector3D(end - start) * t));
+  if (vertex != edge_a.start && vertex != edge_a.end) {
+    edge_a.splits.emplace_back(t, vertex);
+  }
+  if (vertex != edge_b.start && vertex != edge_b.end) {
+    edge_b.splits.emplace_back(u, vertex);
+  }
+}
+
+
+void PolygonClipper::make_pieces(size_t polygon) {
+  for (InputEdge& edge : m_edges[polygon]) {
+    std::sort(edge.splits.begin(), edge.splits.end());
+    size_t previous = edge.start;
+    for (const std::pair<double, size_t>& split : edge.splits) {
+      if (split.second != previous) {
+        m_pieces[polygon].push_back(Piece{previous, split.second, Side::Outside});
+        previous = split.second;
+      }
+    }
+    if (edge.end != previous) {
+      m_pieces[polygon].push_back(Piece{previous, edge.end, Side::Outside});
+    }
+  }
+}
+
+
+void PolygonClipper::classify_pieces() {
+  // Pieces with the same ends in both polygons are shared.  Others lie wholly inside or outside the other polygon, so testing their midpoints is enough.
+  m_shared.clear();
+  auto key = [](size_t a, size_t b) {
+    return (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint64_t>(std::max(a, b));
+  };
+  for (size_t i=0; i < m_pieces[0].size(); ++i) {
+    m_shared.emplace(key(m_pieces[0][i].start, m_pieces[0][i].end), i);
+  }
+  std::vector<bool> shared(m_pieces[0].size(), false);
+  for (Piece& piece : m_pieces[1]) {
+    auto found = m_shared.find(key(piece.start, piece.end));
+    if (found != m_shared.end() && !shared[found->second]) {
+      shared[found->second] = true;
+      Piece& other = m_pieces[0][found->second];
+      piece.side = other.start == piece.start ? Side::SharedSame : Side::SharedOpposite;
+      other.side = piece.side;
+    }
+  }
+  for (size_t polygon=0; polygon < 2; ++polygon) {
+    for (Piece& piece : m_pieces[polygon]) {
+      if (piece.side == Side::SharedSame || piece.side == Side::SharedOpposite) {
+        continue;
+      }
+      const SUPoint2D& start = m_points[piece.start];
+      const SUPoint2D& end = m_points[piece.end];
+      const SUPoint2D middle{(start.x + end.x) / 2.0, (start.y + end.y) / 2.0};
+      piece.side = inside(middle, 1 - polygon) ? Side::Inside : Side::Outside;
+    }
+  }
+}
+
+
+void PolygonClipper::build_bands(size_t polygon) {
+  // About sqrt(n) bands of equal height, each listing the edges whose y range overlaps it.
+  Bands& bands = m_bands[polygon];
+  const std::vector<InputEdge>& edges = m_edges[polygon];
+  bands.offsets.clear();
+  bands.edges.clear();
+  if (edges.empty()) {
+    bands.offsets.assign(2, 0);
+    bands.min_y = 0.0;
+    bands.scale = 0.0;
+    return;
+  }
+  double min_y = m_points[edges[0].start].y;
+  double max_y = min_y;
+  for (const InputEdge& edge : edges) {
+    min_y = std::min(min_y, m_points[edge.start].y);
+    max_y = std::max(max_y, m_points[edge.start].y);
+  }
+  const size_t num_bands = static_cast<size_t>(std::sqrt(static_cast<double>(edges.size()))) + 1;
+  bands.min_y = min_y;
+  bands.scale = max_y > min_y ? static_cast<double>(num_bands) / (max_y - min_y) : 0.0;
+  auto band = [&](double y) {
+    return std::min(static_cast<size_t>(std::max(0.0, (y - min_y) * bands.scale)), num_bands - 1);
+  };
+  bands.offsets.assign(num_bands + 1, 0);
+  for (const InputEdge& edge : edges) {
+    const double y0 = m_points[edge.start].y;
+    const double y1 = m_points[edge.end].y;
+    for (size_t i=band(std::min(y0, y1)), last=band(std::max(y0, y1)); i <= last; ++i) {
+      ++bands.offsets[i + 1];
+    }
+  }
+  for (size_t i=0; i < num_bands; ++i) {
+    bands.offsets[i + 1] += bands.offsets[i];
+  }
+  bands.edges.resize(bands.offsets.back());
+  std::vector<size_t> filled(bands.offsets.begin(), bands.offsets.end() - 1);
+  for (size_t e=0; e < edges.size(); ++e) {
+    const double y0 = m_points[edges[e].start].y;
+    const double y1 = m_points[edges[e].end].y;
+    for (size_t i=band(std::min(y0, y1)), last=band(std::max(y0, y1)); i <= last; ++i) {
+      bands.edges[filled[i]++] = e;
+    }
+  }
+}
+
+
+bool PolygonClipper::inside(const SUPoint2D& point, size_t polygon) const {
+  const Bands& bands = m_bands[polygon];
+  const size_t num_bands = bands.offsets.size() - 1;
+  if (bands.edges.empty() || point.y < bands.min_y) {
+    return false;
+  }
+  const size_t band = std::min(static_cast<size_t>((point.y - bands.min_y) * bands.scale), num_bands - 1);
+  bool inside = false;
+  for (size_t i=bands.offsets[band]; i < bands.offsets[band + 1]; ++i) {
+    const InputEdge& edge = m_edges[polygon][bands.edges[i]];
+    const SUPoint2D& a = m_points[edge.start];
+    const SUPoint2D& b = m_points[edge.end];
+    if ((a.y > point.y) != (b.y > point.y) && point.x < a.x + ((point.y - a.y) * (b.x - a.x) / (b.y - a.y))) {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+
+void PolygonClipper::select(Operation operation) {
+  // The pieces that bound the result, directed so that the result is on their left.
+  for (size_t polygon=0; polygon < 2; ++polygon) {
+    for (const Piece& piece : m_pieces[polygon]) {
+      bool keep = false;
+      bool reverse = false;
+      switch (operation) {
+        case Operation::Union:
+          keep = piece.side == Side::Outside || (polygon == 0 && piece.side == Side::SharedSame);
+          break;
+        case Operation::Intersection:
+          keep = piece.side == Side::Inside || (polygon == 0 && piece.side == Side::SharedSame);
+          break;
+        case Operation::Difference:
+          if (polygon == 0) {
+            keep = piece.side == Side::Outside || piece.side == Side::SharedOpposite;
+          }
+          else {
+            keep = piece.side == Side::Inside;
+            reverse = true;
+          }
+          break;
+        case Operation::Xor:
+          keep = piece.side == Side::Outside || piece.side == Side::Inside;
+          reverse = piece.side == Side::Inside;
+          break;
+      }
+      if (keep) {
+        m_selected.emplace_back(reverse ? piece.end : piece.start, reverse ? piece.start : piece.end);
+      }
+    }
+  }
+}
+
+
+std::vector<std::vector<size_t>> PolygonClipper::trace_loops() {
+  for (std::vector<size_t>& outgoing : m_outgoing) {
+    outgoing.clear();
+  }
+  m_outgoing.resize(m_positions.size());
+  for (size_t i=0; i < m_selected.size(); ++i) {
+    m_outgoing[m_selected[i].first].push_back(i);
+  }
+  std::vector<bool> used(m_selected.size(), false);
+  std::vector<std::vector<size_t>> loops;
+  const double two_pi = 2.0 * std::acos(-1.0);
+  for (size_t first=0; first < m_selected.size(); ++first) {
+    if (used[first]) {
+      continue;
+    }
+    std::vector<size_t> loop;
+    size_t edge = first;
+    bool closed = false;
+    while (true) {
+      used[edge] = true;
+      loop.push_back(m_selected[edge].first);
+      const size_t vertex = m_selected[edge].second;
+      if (vertex == m_selected[first].first) {
+        closed = true;
+        break;
+      }
+      // Where several pieces leave a vertex, take the sharpest turn to the left, so that loops meeting at a vertex are kept apart.
+      const SUPoint2D& from = m_points[m_selected[edge].first];
+      const SUPoint2D& at = m_points[vertex];
+      const double back = std::atan2(from.y - at.y, from.x - at.x);
+      size_t next = NONE_SELECTED;
+      double best_turn = 0.0;
+      for (size_t candidate : m_outgoing[vertex]) {
+        if (used[candidate]) {
+          continue;
+        }
+        const SUPoint2D& to = m_points[m_selected[candidate].second];
+        double turn = back - std::atan2(to.y - at.y, to.x - at.x);
+        while (turn <= 0.0) {
+          turn += two_pi;
+        }
+        while (turn > two_pi) {
+          turn -= two_pi;
+        }
+        if (next == NONE_SELECTED || turn < best_turn) {
+          next = candidate;
+          best_turn = turn;
+        }
+      }
+      if (next == NONE_SELECTED) {
+        break;
+      }
+      edge = next;
+    }
+    if (!closed) {
+      continue;
+    }
+    // Vertices between collinear edges, such as where an edge of the other polygon met this one, are removed.
+    bool removed = true;
+    while (removed && loop.size() >= 3) {
+      removed = false;
+      for (size_t i=0; i < loop.size(); ++i) {
+        const Point3D& previous = m_positions[loop[(i + loop.size() - 1) % loop.size()]];
+        const Point3D& next = m_positions[loop[(i + 1) % loop.size()]];
+        if (split_parameter(previous, next, m_positions[loop[i]]) >= 0.0) {
+          loop.erase(loop.begin() + i);
+          removed = true;
+          break;
+        }
+      }
+    }
+    if (loop.size() >= 3) {
+      loops.push_back(std::move(loop));
+    }
+  }
+  return loops;
+}
+
+
+std::vector<PolygonClipper::Polygon> PolygonClipper::assemble(const std::vector<std::vector<size_t>>& loops) const {
+  // Counter-clockwise loops are outer loops, and clockwise loops are holes.  Each hole belongs to the smallest outer loop around it.
+  std::vector<size_t> outer_loops;
+  std::vector<size_t> holes;
+  std::vector<double> areas(loops.size());
+  for (size_t i=0; i < loops.size(); ++i) {
+    areas[i] = signed_area(loops[i]);
+    if (areas[i] > 0.0) {
+      outer_loops.push_back(i);
+    }
+    else if (areas[i] < 0.0) {
+      holes.push_back(i);
+    }
+  }
+  std::vector<Polygon> polygons(outer_loops.size());
+  for (size_t i=0; i < outer_loops.size(); ++i) {
+    for (size_t vertex : loops[outer_loops[i]]) {
+      polygons[i].outer_loop.push_back(m_positions[vertex]);
+    }
+  }
+  for (size_t hole : holes) {
+    size_t owner = outer_loops.size();
+    for (size_t i=0; i < outer_loops.size(); ++i) {
+      const std::vector<size_t>& outer_loop = loops[outer_loops[i]];
+      if (owner < outer_loops.size() && areas[outer_loops[i]] >= areas[outer_loops[owner]]) {
+        continue;
+      }
+      // Test a vertex of the hole that is not on the outer loop.
+      auto test = std::find_if(loops[hole].begin(), loops[hole].end(), [&outer_loop](size_t vertex) {
+        return std::find(outer_loop.begin(), outer_loop.end(), vertex) == outer_loop.end();
+      });
+      SUPoint2D point;
+      if (test != loops[hole].end()) {
+        point = m_points[*test];
+      }
+      else {
+        const SUPoint2D& a = m_points[loops[hole][0]];
+        const SUPoint2D& b = m_points[loops[hole][1]];
+        point = SUPoint2D{(a.x + b.x) / 2.0, (a.y + b.y) / 2.0};
+      }
+      if (inside_loop(point, m_points, outer_loop)) {
+        owner = i;
+      }
+    }
+    if (owner < outer_loops.size()) {
+      std::vector<Point3D> inner_loop;
+      for (size_t vertex : loops[hole]) {
+        inner_loop.push_back(m_positions[vertex]);
+      }
+      polygons[owner].inner_loops.push_back(std::move(inner_loop));
+    }
+  }
+  return polygons;
+}
+
+
+double PolygonClipper::signed_area(const std::vector<size_t>& loop) const {
+  double area = 0.0;
+  for (size_t i=0, j=loop.size() - 1; i < loop.size(); j = i++) {
+    area += (m_points[loop[j]].x * m_points[loop[i]].y) - (m_points[loop[i]].x * m_points[loop[j]].y);
+  }
+  return area / 2.0;
+}
+
+} /* namespace CW */
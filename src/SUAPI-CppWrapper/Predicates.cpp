@@ -0,0 +1,224 @@
+//
+//  Predicates.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cmath>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Predicates.hpp"
+
+namespace CW {
+namespace Predicates {
+
+namespace {
+
+/**
+* Exact arithmetic on floating point expansions.
+*
+* An expansion represents a number exactly as the sum of its components, which are stored in order of increasing magnitude and do not overlap (zero components are removed).  The sign of the expansion is the sign of its largest (last) component.
+* These are only used when the floating point evaluation of a predicate is inconclusive, so simplicity is favoured over speed.
+*/
+using Expansion = std::vector<double>;
+
+/**
+* Computes a + b = sum + error exactly.
+*/
+inline void two_sum(double a, double b, double& sum, double& error) {
+  sum = a + b;
+  const double b_virtual = sum - a;
+  const double a_virtual = sum - b_virtual;
+  error = (a - a_virtual) + (b - b_virtual);
+}
+
+/**
+* Computes a * b = product + error exactly.  The fused multiply-add is computed with a single rounding, so gives the error of the product directly.
+*/
+inline void two_product(double a, double b, double& product, double& error) {
+  product = a * b;
+  error = std::fma(a, b, -product);
+}
+
+/**
+* Returns the exact difference a - b as an expansion.
+*/
+Expansion difference(double a, double b) {
+  double sum;
+  double error;
+  two_sum(a, -b, sum, error);
+  Expansion result;
+  if (error != 0.0) {
+    result.push_back(error);
+  }
+  if (sum != 0.0 || result.empty()) {
+    result.push_back(sum);
+  }
+  return result;
+}
+
+/**
+* Returns the exact sum of two expansions (Shewchuk's fast expansion sum with zero elimination).
+*/
+Expansion sum(const Expansion& e, const Expansion& f) {
+  Expansion merged;
+  merged.reserve(e.size() + f.size());
+  size_t e_index = 0;
+  size_t f_index = 0;
+  while (e_index < e.size() && f_index < f.size()) {
+    if (std::abs(e[e_index]) < std::abs(f[f_index])) {
+      merged.push_back(e[e_index++]);
+    }
+    else {
+      merged.push_back(f[f_index++]);
+    }
+  }
+  merged.insert(merged.end(), e.begin() + e_index, e.end());
+  merged.insert(merged.end(), f.begin() + f_index, f.end());
+  Expansion result;
+  result.reserve(merged.size());
+  double q = merged[0];
+  for (size_t i=1; i < merged.size(); ++i) {
+    double q_new;
+    double error;
+    two_sum(q, merged[i], q_new, error);
+    if (error != 0.0) {
+      result.push_back(error);
+    }
+    q = q_new;
+  }
+  if (q != 0.0 || result.empty()) {
+    result.push_back(q);
+  }
+  return result;
+}
+
+/**
+* Returns the exact product of an expansion and a double (Shewchuk's scale expansion with zero elimination).
+*/
+Expansion scale(const Expansion& e, double b) {
+  Expansion result;
+  result.reserve(e.size() * 2);
+  double q;
+  double error;
+  two_product(e[0], b, q, error);
+  if (error != 0.0) {
+    result.push_back(error);
+  }
+  for (size_t i=1; i < e.size(); ++i) {
+    double product;
+    double product_error;
+    two_product(e[i], b, product, product_error);
+    double partial;
+    two_sum(q, product_error, partial, error);
+    if (error != 0.0) {
+      result.push_back(error);
+    }
+    two_sum(product, partial, q, error);
+    if (error != 0.0) {
+      result.push_back(error);
+    }
+  }
+  if (q != 0.0 || result.empty()) {
+    result.push_back(q);
+  }
+  return result;
+}
+
+/**
+* Returns the exact product of two expansions.
+*/
+Expansion multiply(const Expansion& e, const Expansion& f) {
+  Expansion result = scale(e, f[0]);
+  for (size_t i=1; i < f.size(); ++i) {
+    result = sum(result, scale(e, f[i]));
+  }
+  return result;
+}
+
+Expansion negate(Expansion e) {
+  for (double& component : e) {
+    component = -component;
+  }
+  return e;
+}
+
+/**
+* Returns the determinant of [a b; c d] exactly.
+*/
+Expansion determinant2x2(const Expansion& a, const Expansion& b, const Expansion& c, const Expansion& d) {
+  return sum(multiply(a, d), negate(multiply(b, c)));
+}
+
+/**
+* Returns an approximation of the expansion, which has the correct sign.
+*/
+double estimate(const Expansion& e) {
+  double total = 0.0;
+  for (double component : e) {
+    total += component;
+  }
+  return total;
+}
+
+} // namespace
+
+
+double orient2d_exact(const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c) {
+  return estimate(determinant2x2(difference(a.x, c.x), difference(a.y, c.y), difference(b.x, c.x), difference(b.y, c.y)));
+}
+
+
+double orient3d_exact(const Point3D& a, const Point3D& b, const Point3D& c, const Point3D& d) {
+  const Expansion adx = difference(a.x, d.x);
+  const Expansion bdx = difference(b.x, d.x);
+  const Expansion cdx = difference(c.x, d.x);
+  const Expansion ady = difference(a.y, d.y);
+  const Expansion bdy = difference(b.y, d.y);
+  const Expansion cdy = difference(c.y, d.y);
+  const Expansion a_term = multiply(difference(a.z, d.z), determinant2x2(bdx, bdy, cdx, cdy));
+  const Expansion b_term = multiply(difference(b.z, d.z), determinant2x2(cdx, cdy, adx, ady));
+  const Expansion c_term = multiply(difference(c.z, d.z), determinant2x2(adx, ady, bdx, bdy));
+  return estimate(sum(sum(a_term, b_term), c_term));
+}
+
+
+double incircle_exact(const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c, const SUPoint2D& d) {
+  const Expansion adx = difference(a.x, d.x);
+  const Expansion bdx = difference(b.x, d.x);
+  const Expansion cdx = difference(c.x, d.x);
+  const Expansion ady = difference(a.y, d.y);
+  const Expansion bdy = difference(b.y, d.y);
+  const Expansion cdy = difference(c.y, d.y);
+  const Expansion a_lift = sum(multiply(adx, adx), multiply(ady, ady));
+  const Expansion b_lift = sum(multiply(bdx, bdx), multiply(bdy, bdy));
+  const Expansion c_lift = sum(multiply(cdx, cdx), multiply(cdy, cdy));
+  const Expansion a_term = multiply(a_lift, determinant2x2(bdx, bdy, cdx, cdy));
+  const Expansion b_term = multiply(b_lift, determinant2x2(cdx, cdy, adx, ady));
+  const Expansion c_term = multiply(c_lift, determinant2x2(adx, ady, bdx, bdy));
+  return estimate(sum(sum(a_term, b_term), c_term));
+}
+
+} /* namespace Predicates */
+} /* namespace CW */
@@ -0,0 +1,432 @@
+//
+//  RayCaster.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/RayCaster.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+
+namespace CW {
+
+namespace {
+
+constexpr double INFINITE_DISTANCE = std::numeric_limits<double>::infinity();
+
+/**
+* Rays are cast in chunks of this many packets.  Each thread takes the next chunk when it finishes one, so that threads given rays that hit little do not sit idle while others finish.
+*/
+constexpr size_t PACKETS_PER_CHUNK = 16;
+
+double coordinate(const SUPoint3D& point, size_t axis) {
+  return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+} // namespace
+
+
+/**
+* The rays of a packet in structure of arrays form, so that the operations on each lane compile to SIMD instructions.  Lanes without a ray have a negative maximum distance, so they never meet a box or a triangle.
+*/
+struct alignas(32) RayCaster::Packet {
+  constexpr static size_t SIZE = RayCaster::PACKET_SIZE;
+  // The rays in world space, with unit directions.
+  double world_origin[3][SIZE];
+  double world_direction[3][SIZE];
+  // The rays in the coordinates of the mesh being traversed.  The directions are transformed without normalising them, so that distances along the rays are the same as in world space.
+  double origin[3][SIZE];
+  double direction[3][SIZE];
+  double inverse_direction[3][SIZE];
+  double max_distance[SIZE];
+  size_t instance[SIZE];
+  size_t triangle[SIZE]; // the position of the triangle in its mesh's triangles, until the hits are resolved
+
+  /**
+  * Sets the inverse directions, used by the box test.
+  */
+  void invert_directions() {
+    for (size_t axis=0; axis < 3; ++axis) {
+      for (size_t lane=0; lane < SIZE; ++lane) {
+        inverse_direction[axis][lane] = 1.0 / direction[axis][lane];
+      }
+    }
+  }
+
+  /**
+  * Returns the largest distance at which any lane can still hit something.
+  */
+  double furthest() const {
+    double furthest = max_distance[0];
+    for (size_t lane=1; lane < SIZE; ++lane) {
+      furthest = std::max(furthest, max_distance[lane]);
+    }
+    return furthest;
+  }
+
+  /**
+  * Returns the distance at which the nearest ray enters the box, or infinity if no ray meets the box before its maximum distance.
+  * Where a ray lies in the plane of a face of the box, the slab distances are NaN, and the comparisons below leave that axis out, so the box is conservatively treated as met.
+  */
+  double entry(const SUBoundingBox3D& box) const {
+    double near[SIZE];
+    double far[SIZE];
+    for (size_t lane=0; lane < SIZE; ++lane) {
+      near[lane] = 0.0;
+      far[lane] = max_distance[lane];
+    }
+    for (size_t axis=0; axis < 3; ++axis) {
+      const double lower = coordinate(box.min_point, axis);
+      const double upper = coordinate(box.max_point, axis);
+      for (size_t lane=0; lane < SIZE; ++lane) {
+        const double t_lower = (lower - origin[axis][lane]) * inverse_direction[axis][lane];
+        const double t_upper = (upper - origin[axis][lane]) * inverse_direction[axis][lane];
+        near[lane] = std::max(near[lane], std::min(t_lower, t_upper));
+        far[lane] = std::min(far[lane], std::max(t_lower, t_upper));
+      }
+    }
+    double entry = INFINITE_DISTANCE;
+    for (size_t lane=0; lane < SIZE; ++lane) {
+      entry = near[lane] <= far[lane] ? std::min(entry, near[lane]) : entry;
+    }
+    return entry;
+  }
+
+  /**
+  * Intersects each ray with a triangle (Möller-Trumbore), recording a hit where it is nearer than the ray's previous hits.
+  */
+  void intersect(const Triangle& tri, size_t instance_index, size_t triangle_index) {
+    for (size_t lane=0; lane < SIZE; ++lane) {
+      const double dx = direction[0][lane];
+      const double dy = direction[1][lane];
+      const double dz = direction[2][lane];
+      // p = d x e2
+      const double px = (dy * tri.edge2.z) - (dz * tri.edge2.y);
+      const double py = (dz * tri.edge2.x) - (dx * tri.edge2.z);
+      const double pz = (dx * tri.edge2.y) - (dy * tri.edge2.x);
+      const double det = (tri.edge1.x * px) + (tri.edge1.y * py) + (tri.edge1.z * pz);
+      const double inverse_det = 1.0 / det;
+      // s = o - v0
+      const double sx = origin[0][lane] - tri.v0.x;
+      const double sy = origin[1][lane] - tri.v0.y;
+      const double sz = origin[2][lane] - tri.v0.z;
+      const double u = ((sx * px) + (sy * py) + (sz * pz)) * inverse_det;
+      // q = s x e1
+      const double qx = (sy * tri.edge1.z) - (sz * tri.edge1.y);
+      const double qy = (sz * tri.edge1.x) - (sx * tri.edge1.z);
+      const double qz = (sx * tri.edge1.y) - (sy * tri.edge1.x);
+      const double v = ((dx * qx) + (dy * qy) + (dz * qz)) * inverse_det;
+      const double t = ((tri.edge2.x * qx) + (tri.edge2.y * qy) + (tri.edge2.z * qz)) * inverse_det;
+      // A triangle in the plane of the ray has a zero determinant, which makes u, v and t infinite or NaN, so the comparisons fail.
+      const bool hit = det != 0.0 && u >= 0.0 && v >= 0.0 && (u + v) <= 1.0 && t > 0.0 && t < max_distance[lane];
+      max_distance[lane] = hit ? t : max_distance[lane];
+      instance[lane] = hit ? instance_index : instance[lane];
+      triangle[lane] = hit ? triangle_index : triangle[lane];
+    }
+  }
+};
+
+
+bool RayCaster::Hit::operator!() const {
+  return instance == NO_HIT;
+}
+
+
+RayCaster::RayCaster():
+  m_built(true)
+{}
+
+
+size_t RayCaster::add_mesh(const std::vector<Point3D>& vertices, const std::vector<size_t>& triangle_indices) {
+  if (triangle_indices.size() % 3 != 0) {
+    throw std::invalid_argument("CW::RayCaster::add_mesh(): the number of triangle indices must be a multiple of three");
+  }
+  const size_t num_triangles = triangle_indices.size() / 3;
+  std::vector<SUBoundingBox3D> boxes;
+  boxes.reserve(num_triangles);
+  Mesh mesh;
+  mesh.bounds = BoundingVolumeHierarchy::empty_box();
+  for (size_t i=0; i < num_triangles; ++i) {
+    SUBoundingBox3D box = BoundingVolumeHierarchy::empty_box();
+    for (size_t j=0; j < 3; ++j) {
+      const size_t index = triangle_indices[(i * 3) + j];
+      if (index >= vertices.size()) {
+        throw std::out_of_range("CW::RayCaster::add_mesh(): triangle index is out of range");
+      }
+      const SUPoint3D point = vertices[index];
+      BoundingVolumeHierarchy::expand(box, SUBoundingBox3D{point, point});
+    }
+    BoundingVolumeHierarchy::expand(mesh.bounds, box);
+    boxes.push_back(box);
+  }
+  mesh.hierarchy = BoundingVolumeHierarchy(boxes);
+  mesh.triangles.reserve(num_triangles);
+  for (size_t item : mesh.hierarchy.items()) {
+    const Point3D& v0 = vertices[triangle_indices[item * 3]];
+    const Point3D& v1 = vertices[triangle_indices[(item * 3) + 1]];
+    const Point3D& v2 = vertices[triangle_indices[(item * 3) + 2]];
+    mesh.triangles.push_back(Triangle{v0, Vector3D(v1 - v0), Vector3D(v2 - v0)});
+  }
+  m_meshes.push_back(std::move(mesh));
+  return m_meshes.size() - 1;
+}
+
+
+size_t RayCaster::add_instance(size_t mesh, const Transformation& transformation) {
+  if (mesh >= m_meshes.size()) {
+    throw std::out_of_range("CW::RayCaster::add_instance(): mesh does not exist");
+  }
+  if (!transformation.is_affine()) {
+    throw std::invalid_argument("CW::RayCaster::add_instance(): transformation must be affine");
+  }
+  SUTransformation inverse;
+  try {
+    inverse = transformation.inverse().ref();
+  }
+  catch (const std::logic_error&) {
+    throw std::invalid_argument("CW::RayCaster::add_instance(): transformation cannot be inverted");
+  }
+  Instance instance;
+  instance.mesh = mesh;
+  const double w = inverse.values[15];
+  for (size_t row=0; row < 3; ++row) {
+    for (size_t col=0; col < 4; ++col) {
+      instance.to_local[(row * 4) + col] = inverse.values[(col * 4) + row] / w;
+    }
+  }
+  // The world bounds are the bounds of the transformed corners of the mesh's bounds.
+  const SUBoundingBox3D& local = m_meshes[mesh].bounds;
+  SUBoundingBox3D world = BoundingVolumeHierarchy::empty_box();
+  if (local.min_point.x <= local.max_point.x) {
+    SUPoint3D corners[8];
+    for (size_t i=0; i < 8; ++i) {
+      corners[i] = SUPoint3D{(i & 1) ? local.max_point.x : local.min_point.x,
+                             (i & 2) ? local.max_point.y : local.min_point.y,
+                             (i & 4) ? local.max_point.z : local.min_point.z};
+    }
+    transformation.transform_points(corners, 8);
+    for (const SUPoint3D& corner : corners) {
+      BoundingVolumeHierarchy::expand(world, SUBoundingBox3D{corner, corner});
+    }
+  }
+  m_instances.push_back(instance);
+  m_instance_bounds.push_back(world);
+  m_built = false;
+  return m_instances.size() - 1;
+}
+
+
+void RayCaster::build() {
+  m_hierarchy = BoundingVolumeHierarchy(m_instance_bounds);
+  m_built = true;
+}
+
+
+size_t RayCaster::num_meshes() const {
+  return m_meshes.size();
+}
+
+
+size_t RayCaster::num_instances() const {
+  return m_instances.size();
+}
+
+
+void RayCaster::intersect_mesh(const Mesh& mesh, size_t instance, Packet& packet, std::vector<StackEntry>& stack) const {
+  const std::vector<BoundingVolumeHierarchy::Node>& nodes = mesh.hierarchy.nodes();
+  if (nodes.empty()) {
+    return;
+  }
+  const double root_entry = packet.entry(nodes[0].bounds);
+  if (root_entry == INFINITE_DISTANCE) {
+    return;
+  }
+  // The stack may already hold the top level nodes still to be visited, which are left as they are.
+  const size_t base = stack.size();
+  stack.push_back(StackEntry{0, root_entry});
+  while (stack.size() > base) {
+    const StackEntry entry = stack.back();
+    stack.pop_back();
+    if (entry.entry > packet.furthest()) {
+      continue;
+    }
+    const BoundingVolumeHierarchy::Node& node = nodes[entry.node];
+    if (node.count == 0) {
+      // Visit the nearer child first, so that its hits can rule out the other.
+      const double first_entry = packet.entry(nodes[node.first].bounds);
+      const double second_entry = packet.entry(nodes[node.first + 1].bounds);
+      const bool first_nearer = first_entry <= second_entry;
+      const StackEntry near{first_nearer ? node.first : node.first + 1, std::min(first_entry, second_entry)};
+      const StackEntry far{first_nearer ? node.first + 1 : node.first, std::max(first_entry, second_entry)};
+      if (far.entry != INFINITE_DISTANCE) {
+        stack.push_back(far);
+      }
+      if (near.entry != INFINITE_DISTANCE) {
+        stack.push_back(near);
+      }
+      continue;
+    }
+    for (size_t i=node.first; i < node.first + node.count; ++i) {
+      packet.intersect(mesh.triangles[i], instance, i);
+    }
+  }
+}
+
+
+void RayCaster::cast_packet(const Ray* rays, Hit* hits, size_t count, std::vector<StackEntry>& stack) const {
+  Packet packet;
+  for (size_t lane=0; lane < PACKET_SIZE; ++lane) {
+    // Empty lanes repeat the first ray, so that they do not contribute NaNs or infinities to the box tests.
+    const Ray& ray = rays[lane < count ? lane : 0];
+    const double length = std::sqrt((ray.direction.x * ray.direction.x) + (ray.direction.y * ray.direction.y) + (ray.direction.z * ray.direction.z));
+    const bool active = lane < count && length > 0.0 && std::isfinite(length);
+    const double scale = length > 0.0 ? 1.0 / length : 0.0;
+    packet.world_origin[0][lane] = ray.origin.x;
+    packet.world_origin[1][lane] = ray.origin.y;
+    packet.world_origin[2][lane] = ray.origin.z;
+    packet.world_direction[0][lane] = ray.direction.x * scale;
+    packet.world_direction[1][lane] = ray.direction.y * scale;
+    packet.world_direction[2][lane] = ray.direction.z * scale;
+    packet.max_distance[lane] = active ? INFINITE_DISTANCE : -1.0;
+    packet.instance[lane] = NO_HIT;
+    packet.triangle[lane] = NO_HIT;
+  }
+  std::copy(&packet.world_origin[0][0], &packet.world_origin[0][0] + (3 * PACKET_SIZE), &packet.origin[0][0]);
+  std::copy(&packet.world_direction[0][0], &packet.world_direction[0][0] + (3 * PACKET_SIZE), &packet.direction[0][0]);
+  packet.invert_directions();
+
+  // Traverse the top level hierarchy in world space, descending into the mesh of each instance reached.
+  const std::vector<BoundingVolumeHierarchy::Node>& nodes = m_hierarchy.nodes();
+  const std::vector<size_t>& items = m_hierarchy.items();
+  const double root_entry = nodes.empty() ? INFINITE_DISTANCE : packet.entry(nodes[0].bounds);
+  stack.clear();
+  if (root_entry != INFINITE_DISTANCE) {
+    stack.push_back(StackEntry{0, root_entry});
+  }
+  while (!stack.empty()) {
+    const StackEntry entry = stack.back();
+    stack.pop_back();
+    if (entry.entry > packet.furthest()) {
+      continue;
+    }
+    const BoundingVolumeHierarchy::Node& node = nodes[entry.node];
+    if (node.count == 0) {
+      const double first_entry = packet.entry(nodes[node.first].bounds);
+      const double second_entry = packet.entry(nodes[node.first + 1].bounds);
+      const bool first_nearer = first_entry <= second_entry;
+      const StackEntry near{first_nearer ? node.first : node.first + 1, std::min(first_entry, second_entry)};
+      const StackEntry far{first_nearer ? node.first + 1 : node.first, std::max(first_entry, second_entry)};
+      if (far.entry != INFINITE_DISTANCE) {
+        stack.push_back(far);
+      }
+      if (near.entry != INFINITE_DISTANCE) {
+        stack.push_back(near);
+      }
+      continue;
+    }
+    for (size_t i=node.first; i < node.first + node.count; ++i) {
+      const size_t instance_index = items[i];
+      const Instance& instance = m_instances[instance_index];
+      const double* m = instance.to_local;
+      for (size_t lane=0; lane < PACKET_SIZE; ++lane) {
+        const double ox = packet.world_origin[0][lane];
+        const double oy = packet.world_origin[1][lane];
+        const double oz = packet.world_origin[2][lane];
+        const double dx = packet.world_direction[0][lane];
+        const double dy = packet.world_direction[1][lane];
+        const double dz = packet.world_direction[2][lane];
+        packet.origin[0][lane] = (m[0] * ox) + (m[1] * oy) + (m[2] * oz) + m[3];
+        packet.origin[1][lane] = (m[4] * ox) + (m[5] * oy) + (m[6] * oz) + m[7];
+        packet.origin[2][lane] = (m[8] * ox) + (m[9] * oy) + (m[10] * oz) + m[11];
+        packet.direction[0][lane] = (m[0] * dx) + (m[1] * dy) + (m[2] * dz);
+        packet.direction[1][lane] = (m[4] * dx) + (m[5] * dy) + (m[6] * dz);
+        packet.direction[2][lane] = (m[8] * dx) + (m[9] * dy) + (m[10] * dz);
+      }
+      packet.invert_directions();
+      intersect_mesh(m_meshes[instance.mesh], instance_index, packet, stack);
+    }
+    // Restore the world space rays for the top level boxes.
+    std::copy(&packet.world_origin[0][0], &packet.world_origin[0][0] + (3 * PACKET_SIZE), &packet.origin[0][0]);
+    std::copy(&packet.world_direction[0][0], &packet.world_direction[0][0] + (3 * PACKET_SIZE), &packet.direction[0][0]);
+    packet.invert_directions();
+  }
+
+  for (size_t lane=0; lane < count; ++lane) {
+    Hit& hit = hits[lane];
+    hit = Hit();
+    if (packet.instance[lane] == NO_HIT) {
+      continue;
+    }
+    const Instance& instance = m_instances[packet.instance[lane]];
+    const Mesh& mesh = m_meshes[instance.mesh];
+    const Triangle& tri = mesh.triangles[packet.triangle[lane]];
+    // Normals are transformed to world space by the transpose of the inverse of the instance's transformation, which is the transpose of to_local.
+    const Vector3D local_normal = tri.edge1.cross(tri.edge2);
+    const double* m = instance.to_local;
+    const Vector3D normal((m[0] * local_normal.x) + (m[4] * local_normal.y) + (m[8] * local_normal.z),
+                          (m[1] * local_normal.x) + (m[5] * local_normal.y) + (m[9] * local_normal.z),
+                          (m[2] * local_normal.x) + (m[6] * local_normal.y) + (m[10] * local_normal.z));
+    hit.distance = packet.max_distance[lane];
+    hit.normal = normal * (1.0 / normal.length());
+    hit.instance = packet.instance[lane];
+    hit.triangle = mesh.hierarchy.items()[packet.triangle[lane]];
+  }
+}
+
+
+RayCaster::Hit RayCaster::cast(const Ray& ray) const {
+  if (!m_built) {
+    throw std::logic_error("CW::RayCaster::cast(): build() must be called after adding instances");
+  }
+  Hit hit;
+  std::vector<StackEntry> stack;
+  stack.reserve(64);
+  cast_packet(&ray, &hit, 1, stack);
+  return hit;
+}
+
+
+std::vector<RayCaster::Hit> RayCaster::cast(const std::vector<Ray>& rays, size_t num_threads) const {
+  if (!m_built) {
+    throw std::logic_error("CW::RayCaster::cast(): build() must be called after adding instances");
+  }
+  std::vector<Hit> hits(rays.size());
+  auto make_stack = []() {
+    std::vector<StackEntry> stack;
+    stack.reserve(64);
+    return stack;
+  };
+  parallel_for_chunks(rays.size(), PACKETS_PER_CHUNK * PACKET_SIZE, num_threads, make_stack, [&](std::vector<StackEntry>& stack, size_t begin, size_t end) {
+    for (size_t first=begin; first < end; first += PACKET_SIZE) {
+      cast_packet(&rays[first], &hits[first], std::min(PACKET_SIZE, end - first), stack);
+    }
+  });
+  return hits;
+}
+
+} /* namespace CW */
@@ -0,0 +1,191 @@
+//
+//  TessellatedMesh.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SUAPI-CppWrapper/TessellatedMesh.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace CW {
+
+namespace {
+
+constexpr size_t WORD_SIZE = sizeof(uint64_t);
+
+inline size_t round_up_to_words(size_t bytes) {
+  return (bytes + WORD_SIZE - 1) / WORD_SIZE * WORD_SIZE;
+}
+
+} // namespace
+
+
+TessellatedMesh::TessellatedMesh():
+  m_view(nullptr),
+  m_view_size(0)
+{}
+
+
+TessellatedMesh::TessellatedMesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const std::vector<MaterialRange>& ranges):
+  m_view(nullptr),
+  m_view_size(0)
+{
+  for (uint32_t index : indices) {
+    if (index >= vertices.size()) {
+      throw std::invalid_argument("CW::TessellatedMesh::TessellatedMesh(): index is not that of a vertex");
+    }
+  }
+  for (const MaterialRange& range : ranges) {
+    if (static_cast<size_t>(range.first_index) + range.num_indices > indices.size()) {
+      throw std::invalid_argument("CW::TessellatedMesh::TessellatedMesh(): range is not within the indices");
+    }
+  }
+  const size_t size = ranges_offset(vertices.size(), indices.size()) + (ranges.size() * sizeof(MaterialRange));
+  m_buffer.assign(round_up_to_words(size) / WORD_SIZE, 0);
+  unsigned char* bytes = reinterpret_cast<unsigned char*>(m_buffer.data());
+  const Header header{static_cast<uint32_t>(vertices.size()), static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(ranges.size()), 0};
+  std::memcpy(bytes, &header, sizeof(Header));
+  if (!vertices.empty()) {
+    std::memcpy(bytes + sizeof(Header), vertices.data(), vertices.size() * sizeof(Vertex));
+  }
+  if (!indices.empty()) {
+    std::memcpy(bytes + indices_offset(vertices.size()), indices.data(), indices.size() * sizeof(uint32_t));
+  }
+  if (!ranges.empty()) {
+    std::memcpy(bytes + ranges_offset(vertices.size(), indices.size()), ranges.data(), ranges.size() * sizeof(MaterialRange));
+  }
+}
+
+
+TessellatedMesh TessellatedMesh::view(const void* data, size_t size, std::shared_ptr<const void> owner) {
+  if (reinterpret_cast<uintptr_t>(data) % WORD_SIZE != 0) {
+    throw std::invalid_argument("CW::TessellatedMesh::view(): buffer is not aligned to 8 bytes");
+  }
+  if (size < sizeof(Header)) {
+    throw std::invalid_argument("CW::TessellatedMesh::view(): buffer is smaller than its header");
+  }
+  Header header;
+  std::memcpy(&header, data, sizeof(Header));
+  const size_t ranges_end = ranges_offset(header.num_vertices, header.num_indices) + (static_cast<size_t>(header.num_ranges) * sizeof(MaterialRange));
+  if (round_up_to_words(ranges_end) != size) {
+    throw std::invalid_argument("CW::TessellatedMesh::view(): buffer size does not match its header");
+  }
+  TessellatedMesh mesh;
+  mesh.m_view = static_cast<const unsigned char*>(data);
+  mesh.m_view_size = size;
+  mesh.m_view_owner = std::move(owner);
+  for (size_t i=0; i < mesh.num_ranges(); ++i) {
+    const MaterialRange& range = mesh.ranges()[i];
+    if (static_cast<size_t>(range.first_index) + range.num_indices > header.num_indices) {
+      throw std::invalid_argument("CW::TessellatedMesh::view(): range is not within the indices");
+    }
+  }
+  return mesh;
+}
+
+
+const unsigned char* TessellatedMesh::bytes() const {
+  if (m_view != nullptr) {
+    return m_view;
+  }
+  return m_buffer.empty() ? nullptr : reinterpret_cast<const unsigned char*>(m_buffer.data());
+}
+
+
+const TessellatedMesh::Header& TessellatedMesh::header() const {
+  static const Header empty_header{0, 0, 0, 0};
+  const unsigned char* buffer = bytes();
+  if (buffer == nullptr) {
+    return empty_header;
+  }
+  return *reinterpret_cast<const Header*>(buffer);
+}
+
+
+size_t TessellatedMesh::indices_offset(size_t num_vertices) {
+  return sizeof(Header) + (num_vertices * sizeof(Vertex));
+}
+
+
+size_t TessellatedMesh::ranges_offset(size_t num_vertices, size_t num_indices) {
+  return indices_offset(num_vertices) + (num_indices * sizeof(uint32_t));
+}
+
+
+size_t TessellatedMesh::num_vertices() const {
+  return header().num_vertices;
+}
+
+
+size_t TessellatedMesh::num_indices() const {
+  return header().num_indices;
+}
+
+
+size_t TessellatedMesh::num_triangles() const {
+  return header().num_indices / 3;
+}
+
+
+size_t TessellatedMesh::num_ranges() const {
+  return header().num_ranges;
+}
+
+
+bool TessellatedMesh::empty() const {
+  return header().num_indices == 0;
+}
+
+
+const TessellatedMesh::Vertex* TessellatedMesh::vertices() const {
+  const unsigned char* buffer = bytes();
+  return buffer == nullptr ? nullptr : reinterpret_cast<const Vertex*>(buffer + sizeof(Header));
+}
+
+
+const uint32_t* TessellatedMesh::indices() const {
+  const unsigned char* buffer = bytes();
+  return buffer == nullptr ? nullptr : reinterpret_cast<const uint32_t*>(buffer + indices_offset(num_vertices()));
+}
+
+
+const TessellatedMesh::MaterialRange* TessellatedMesh::ranges() const {
+  const unsigned char* buffer = bytes();
+  return buffer == nullptr ? nullptr : reinterpret_cast<const MaterialRange*>(buffer + ranges_offset(num_vertices(), num_indices()));
+}
+
+
+const void* TessellatedMesh::data() const {
+  return bytes();
+}
+
+
+size_t TessellatedMesh::size_bytes() const {
+  return m_view != nullptr ? m_view_size : m_buffer.size() * WORD_SIZE;
+}
+
+} /* namespace CW */
@@ -0,0 +1,457 @@
+//
+//  TessellationFileCache.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SUAPI-CppWrapper/TessellationFileCache.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CW {
+
+namespace {
+
+constexpr uint32_t FILE_MAGIC = 0x53455443; // "CTES" read as little endian bytes
+constexpr uint32_t FILE_VERSION = 1;
+constexpr const char* FILE_EXTENSION = ".tess";
+constexpr const char* TEMPORARY_EXTENSION = ".tmp";
+constexpr size_t KEY_DIGITS = 16;
+
+/**
+* The start of each file.  It is followed by the mesh's buffer, and then by the material names, each as a 32 bit length followed by its bytes, padded to a multiple of 8 bytes.  The buffer and names are in the byte order of the machine that wrote them, so a cache directory should not be shared between machines of different byte orders.
+*/
+struct FileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t key;
+  uint64_t mesh_size;
+  uint64_t names_size;
+  uint32_t num_names;
+  uint32_t reserved;
+};
+static_assert(sizeof(FileHeader) % sizeof(uint64_t) == 0, "The mesh must start on an 8 byte boundary");
+
+/**
+* A file mapped read only into memory.  The mapping is released when the object is destroyed.
+*/
+class MappedFile {
+  private:
+  const unsigned char* m_data;
+  size_t m_size;
+
+  public:
+  /**
+  * Maps the whole of the file, or leaves data() null if it cannot be mapped (as is the case for an empty file).
+  */
+  explicit MappedFile(const std::filesystem::path& path):
+    m_data(nullptr),
+    m_size(0)
+  {
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      return;
+    }
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+      HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping != nullptr) {
+        // The view keeps the mapping open once the handles are closed.
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view != nullptr) {
+          m_data = static_cast<const unsigned char*>(view);
+          m_size = static_cast<size_t>(size.QuadPart);
+        }
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+#else
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+      return;
+    }
+    struct stat status;
+    if (fstat(file, &status) == 0 && status.st_size > 0) {
+      void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+      if (view != MAP_FAILED) {
+        m_data = static_cast<const unsigned char*>(view);
+        m_size = static_cast<size_t>(status.st_size);
+      }
+    }
+    // The mapping keeps the file open once the descriptor is closed.
+    close(file);
+#endif
+  }
+
+  ~MappedFile() {
+    if (m_data == nullptr) {
+      return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+#else
+    munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const unsigned char* data() const {
+    return m_data;
+  }
+
+  size_t size() const {
+    return m_size;
+  }
+};
+
+
+/**
+* Returns the key of a cache file's name, or false if the name is not that of a cache file.
+*/
+bool parse_file_name(const std::string& name, uint64_t& key) {
+  const std::string extension = FILE_EXTENSION;
+  if (name.size() != KEY_DIGITS + extension.size() || name.compare(KEY_DIGITS, extension.size(), extension) != 0) {
+    return false;
+  }
+  key = 0;
+  for (size_t i=0; i < KEY_DIGITS; ++i) {
+    const char digit = name[i];
+    uint64_t value;
+    if (digit >= '0' && digit <= '9') {
+      value = static_cast<uint64_t>(digit - '0');
+    }
+    else if (digit >= 'a' && digit <= 'f') {
+      value = static_cast<uint64_t>(digit - 'a' + 10);
+    }
+    else {
+      return false;
+    }
+    key = (key << 4) | value;
+  }
+  return true;
+}
+
+
+/**
+* Reads the material names that follow the mesh, or returns false if they overrun the file.
+*/
+bool read_names(const unsigned char* data, size_t size, size_t num_names, std::vector<std::string>& names) {
+  names.clear();
+  names.reserve(num_names);
+  size_t offset = 0;
+  for (size_t i=0; i < num_names; ++i) {
+    uint32_t length;
+    if (size - offset < sizeof(length)) {
+      return false;
+    }
+    std::memcpy(&length, data + offset, sizeof(length));
+    offset += sizeof(length);
+    if (size - offset < length) {
+      return false;
+    }
+    names.emplace_back(reinterpret_cast<const char*>(data + offset), length);
+    offset += length;
+  }
+  return true;
+}
+
+} // namespace
+
+
+double TessellationFileCache::Stats::hit_rate() const {
+  const size_t requests = hits + misses;
+  return requests == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(requests);
+}
+
+
+TessellationFileCache::TessellationFileCache(const std::string& directory, uint64_t max_size_bytes, size_t max_entries):
+  m_directory(directory),
+  m_max_size_bytes(max_size_bytes),
+  m_max_entries(max_entries),
+  m_size_bytes(0),
+  m_hits(0),
+  m_misses(0),
+  m_stores(0),
+  m_evictions(0)
+{
+  std::error_code error;
+  std::filesystem::create_directories(m_directory, error);
+  if (error) {
+    throw std::runtime_error("CW::TessellationFileCache::TessellationFileCache(): could not create the directory " + directory);
+  }
+  struct Found {
+    std::filesystem::file_time_type time;
+    uint64_t key;
+    uint64_t size_bytes;
+  };
+  std::vector<Found> found;
+  std::filesystem::directory_iterator it(m_directory, error);
+  if (error) {
+    throw std::runtime_error("CW::TessellationFileCache::TessellationFileCache(): could not read the directory " + directory);
+  }
+  for (; it != std::filesystem::directory_iterator(); it.increment(error)) {
+    const std::filesystem::path& file = it->path();
+    const std::string name = file.filename().string();
+    uint64_t key;
+    if (parse_file_name(name, key)) {
+      // A file that cannot be read is skipped, and the rest are still kept within the limits.
+      std::error_code size_error;
+      std::error_code time_error;
+      const uint64_t size_bytes = it->file_size(size_error);
+      const std::filesystem::file_time_type time = it->last_write_time(time_error);
+      if (!size_error && !time_error) {
+        found.push_back(Found{time, key, size_bytes});
+      }
+    }
+    else if (file.extension() == TEMPORARY_EXTENSION) {
+      // Left by a run that stopped while writing.
+      std::error_code remove_error;
+      std::filesystem::remove(file, remove_error);
+    }
+  }
+  // If the iteration itself fails it ends, and the files found so far are kept.
+  std::sort(found.begin(), found.end(), [](const Found& a, const Found& b) {
+    return a.time < b.time;
+  });
+  for (const Found& file : found) {
+    m_order.push_front(file.key);
+    m_entries.emplace(file.key, Entry{m_order.begin(), file.size_bytes});
+    m_size_bytes += file.size_bytes;
+  }
+  evict();
+}
+
+
+std::filesystem::path TessellationFileCache::path(uint64_t key) const {
+  char name[KEY_DIGITS + 1];
+  std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+  return m_directory / (std::string(name) + FILE_EXTENSION);
+}
+
+
+void TessellationFileCache::touch(uint64_t key) {
+  Entry& entry = m_entries.at(key);
+  m_order.splice(m_order.begin(), m_order, entry.position);
+  std::error_code error;
+  std::filesystem::last_write_time(path(key), std::filesystem::file_time_type::clock::now(), error);
+}
+
+
+void TessellationFileCache::remove(uint64_t key) {
+  auto found = m_entries.find(key);
+  if (found == m_entries.end()) {
+    return;
+  }
+  // On Windows a file cannot be removed while a mesh still maps it.  It is then forgotten here, and found again the next time the cache is opened.
+  std::error_code error;
+  std::filesystem::remove(path(key), error);
+  m_size_bytes -= found->second.size_bytes;
+  m_order.erase(found->second.position);
+  m_entries.erase(found);
+}
+
+
+void TessellationFileCache::evict() {
+  while (!m_order.empty() && (m_size_bytes > m_max_size_bytes || m_entries.size() > m_max_entries)) {
+    remove(m_order.back());
+    ++m_evictions;
+  }
+}
+
+
+bool TessellationFileCache::find(uint64_t key, TessellatedMesh& mesh, std::vector<std::string>& material_names) {
+  if (m_entries.find(key) == m_entries.end()) {
+    ++m_misses;
+    return false;
+  }
+  auto file = std::make_shared<const MappedFile>(path(key));
+  bool valid = false;
+  if (file->size() >= sizeof(FileHeader)) {
+    FileHeader header;
+    std::memcpy(&header, file->data(), sizeof(header));
+    valid = header.magic == FILE_MAGIC && header.version == FILE_VERSION && header.key == key &&
+            header.mesh_size <= file->size() - sizeof(FileHeader) &&
+            header.names_size == file->size() - sizeof(FileHeader) - header.mesh_size;
+    if (valid) {
+      const unsigned char* mesh_data = file->data() + sizeof(FileHeader);
+      valid = read_names(mesh_data + header.mesh_size, static_cast<size_t>(header.names_size), header.num_names, material_names);
+      if (valid && header.mesh_size == 0) {
+        mesh = TessellatedMesh();
+      }
+      else if (valid) {
+        try {
+          TessellatedMesh view = TessellatedMesh::view(mesh_data, static_cast<size_t>(header.mesh_size), file);
+          for (size_t i=0; i < view.num_ranges() && valid; ++i) {
+            const TessellatedMesh::MaterialRange& range = view.ranges()[i];
+            valid = (range.front_material == TessellatedMesh::NO_INDEX || range.front_material < material_names.size()) &&
+                    (range.back_material == TessellatedMesh::NO_INDEX || range.back_material < material_names.size());
+          }
+          // The view does not check the indices, and an index past the vertices would be read out of bounds by an exporter.
+          const uint32_t* indices = view.indices();
+          for (size_t i=0; i < view.num_indices() && valid; ++i) {
+            valid = indices[i] < view.num_vertices();
+          }
+          if (valid) {
+            mesh = std::move(view);
+          }
+        }
+        catch (const std::invalid_argument&) {
+          valid = false;
+        }
+      }
+    }
+  }
+  if (!valid) {
+    remove(key);
+    ++m_misses;
+    return false;
+  }
+  touch(key);
+  ++m_hits;
+  return true;
+}
+
+
+bool TessellationFileCache::store(uint64_t key, const TessellatedMesh& mesh, const std::vector<std::string>& material_names) {
+  std::vector<char> names;
+  for (const std::string& name : material_names) {
+    const uint32_t length = static_cast<uint32_t>(name.size());
+    const char* length_bytes = reinterpret_cast<const char*>(&length);
+    names.insert(names.end(), length_bytes, length_bytes + sizeof(length));
+    names.insert(names.end(), name.begin(), name.end());
+  }
+  names.resize((names.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t), 0);
+  const FileHeader header{FILE_MAGIC, FILE_VERSION, key, mesh.size_bytes(), names.size(), static_cast<uint32_t>(material_names.size()), 0};
+  const uint64_t size_bytes = sizeof(FileHeader) + header.mesh_size + header.names_size;
+  if (size_bytes > m_max_size_bytes) {
+    return false;
+  }
+  const std::filesystem::path file = path(key);
+  std::filesystem::path temporary = file;
+  temporary += TEMPORARY_EXTENSION;
+  {
+    std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (mesh.size_bytes() > 0) {
+      stream.write(static_cast<const char*>(mesh.data()), static_cast<std::streamsize>(mesh.size_bytes()));
+    }
+    stream.write(names.data(), static_cast<std::streamsize>(names.size()));
+    stream.close();
+    if (!stream) {
+      std::error_code error;
+      std::filesystem::remove(temporary, error);
+      return false;
+    }
+  }
+  // Forget any older file first, as the rename replaces it.
+  auto found = m_entries.find(key);
+  if (found != m_entries.end()) {
+    m_size_bytes -= found->second.size_bytes;
+    m_order.erase(found->second.position);
+    m_entries.erase(found);
+  }
+  std::error_code error;
+  std::filesystem::rename(temporary, file, error);
+  if (error) {
+    std::filesystem::remove(temporary, error);
+    return false;
+  }
+  m_order.push_front(key);
+  m_entries.emplace(key, Entry{m_order.begin(), size_bytes});
+  m_size_bytes += size_bytes;
+  ++m_stores;
+  evict();
+  return true;
+}
+
+
+bool TessellationFileCache::contains(uint64_t key) const {
+  return m_entries.find(key) != m_entries.end();
+}
+
+
+void TessellationFileCache::erase(uint64_t key) {
+  remove(key);
+}
+
+
+void TessellationFileCache::clear() {
+  while (!m_order.empty()) {
+    remove(m_order.back());
+  }
+  m_hits = 0;
+  m_misses = 0;
+  m_stores = 0;
+  m_evictions = 0;
+}
+
+
+TessellationFileCache::Stats TessellationFileCache::stats() const {
+  return Stats{m_hits, m_misses, m_stores, m_evictions, m_entries.size(), m_size_bytes, m_max_entries, m_max_size_bytes};
+}
+
+
+void TessellationFileCache::write_report(std::ostream& stream) const {
+  const Stats current = stats();
+  stream << "Tessellation cache: " << m_directory.string() << "\n";
+  stream << "  entries:   " << current.num_entries;
+  if (current.max_entries != SIZE_MAX) {
+    stream << " of " << current.max_entries;
+  }
+  stream << "\n";
+  stream << "  size:      " << current.size_bytes << " of " << current.max_size_bytes << " bytes\n";
+  stream << "  hits:      " << current.hits << "\n";
+  stream << "  misses:    " << current.misses << "\n";
+  stream << "  hit rate:  " << (current.hit_rate() * 100.0) << "%\n";
+  stream << "  stores:    " << current.stores << "\n";
+  stream << "  evictions: " << current.evictions << "\n";
+}
+
+} /* namespace CW */
@@ -31,6 +31,17 @@
 #include <cassert>
 #include <cmath>
 
+#if defined(__x86_64__) || defined(_M_X64)
+  #define CW_TRANSFORM_X86
+  #include <immintrin.h>
+  #ifdef _MSC_VER
+    #include <intrin.h>
+    #define CW_TARGET_AVX2
+  #else
+    #define CW_TARGET_AVX2 __attribute__((target("avx2,fma")))
+  #endif
+#endif
+
 #include "SUAPI-CppWrapper/Transformation.hpp"
 
 #include <SketchUpAPI/geometry/vector3d.h>
@@ -39,6 +50,7 @@
 
 #include "SUAPI-CppWrapper/model/Axes.hpp"
 #include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
 #include "SUAPI-CppWrapper/model/Loop.hpp"
 #include "SUAPI-CppWrapper/model/LoopInput.hpp"
 #include "SUAPI-CppWrapper/model/Vertex.hpp"
@@ -46,13 +58,187 @@
 
 namespace CW {
 
+namespace {
+
+/**
+* Batch transformation kernels.
+*
+* The matrix is given as four columns of four doubles, in the same column-major order as SUTransformation.  The fourth row is ignored, so each column can be loaded straight into a SIMD register.  Coordinates are an array of contiguous x, y, z triplets (i.e. SUPoint3D or SUVector3D arrays).
+*/
+using KernelMatrix = std::array<double, 16>;
+using TransformKernel = void (*)(const KernelMatrix& matrix, double* coords, size_t count);
+
+#ifndef CW_TRANSFORM_X86
+// Only needed where there is no SIMD kernel.
+void transform_kernel_scalar(const KernelMatrix& m, double* coords, size_t count) {
+  for (size_t i=0; i < count; ++i, coords += 3) {
+    const double x = coords[0];
+    const double y = coords[1];
+    const double z = coords[2];
+    coords[0] = (m[0] * x) + (m[4] * y) + (m[8] * z) + m[12];
+    coords[1] = (m[1] * x) + (m[5] * y) + (m[9] * z) + m[13];
+    coords[2] = (m[2] * x) + (m[6] * y) + (m[10] * z) + m[14];
+  }
+}
+#endif
+
+#ifdef CW_TRANSFORM_X86
+// SSE2 is always available on x86-64.
+void transform_kernel_sse2(const KernelMatrix& m, double* coords, size_t count) {
+  const __m128d c0_xy = _mm_loadu_pd(&m[0]);
+  const __m128d c1_xy = _mm_loadu_pd(&m[4]);
+  const __m128d c2_xy = _mm_loadu_pd(&m[8]);
+  const __m128d c3_xy = _mm_loadu_pd(&m[12]);
+  const __m128d c0_z = _mm_load_sd(&m[2]);
+  const __m128d c1_z = _mm_load_sd(&m[6]);
+  const __m128d c2_z = _mm_load_sd(&m[10]);
+  const __m128d c3_z = _mm_load_sd(&m[14]);
+  for (size_t i=0; i < count; ++i, coords += 3) {
+    const __m128d x = _mm_set1_pd(coords[0]);
+    const __m128d y = _mm_set1_pd(coords[1]);
+    const __m128d z = _mm_set1_pd(coords[2]);
+    __m128d xy = _mm_add_pd(_mm_add_pd(_mm_mul_pd(c0_xy, x), _mm_mul_pd(c1_xy, y)), _mm_add_pd(_mm_mul_pd(c2_xy, z), c3_xy));
+    __m128d zz = _mm_add_sd(_mm_add_sd(_mm_mul_sd(c0_z, x), _mm_mul_sd(c1_z, y)), _mm_add_sd(_mm_mul_sd(c2_z, z), c3_z));
+    _mm_storeu_pd(coords, xy);
+    _mm_store_sd(coords + 2, zz);
+  }
+}
+
+// Each point is transformed with a single 256-bit register holding (x', y', z', w').  The w lane is dropped when storing.
+// Note: a masked 256-bit store is avoided, as it overlaps the next point and stalls store forwarding on its loads.
+CW_TARGET_AVX2 void transform_kernel_avx2(const KernelMatrix& m, double* coords, size_t count) {
+  const __m256d c0 = _mm256_loadu_pd(&m[0]);
+  const __m256d c1 = _mm256_loadu_pd(&m[4]);
+  const __m256d c2 = _mm256_loadu_pd(&m[8]);
+  const __m256d c3 = _mm256_loadu_pd(&m[12]);
+  for (size_t i=0; i < count; ++i, coords += 3) {
+    __m256d result = _mm256_fmadd_pd(c0, _mm256_broadcast_sd(coords), c3);
+    result = _mm256_fmadd_pd(c1, _mm256_broadcast_sd(coords + 1), result);
+    result = _mm256_fmadd_pd(c2, _mm256_broadcast_sd(coords + 2), result);
+    _mm_storeu_pd(coords, _mm256_castpd256_pd128(result));
+    _mm_store_sd(coords + 2, _mm256_extractf128_pd(result, 1));
+  }
+}
+
+bool cpu_supports_avx2() {
+#ifdef _MSC_VER
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  __cpuid(info, 1);
+  const bool fma = (info[2] & (1 << 12)) != 0;
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  const bool avx = (info[2] & (1 << 28)) != 0;
+  // The OS must also save the YMM registers on context switches.
+  if (!fma || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+#endif
+
+TransformKernel select_transform_kernel() {
+#ifdef CW_TRANSFORM_X86
+  if (cpu_supports_avx2()) {
+    return transform_kernel_avx2;
+  }
+  return transform_kernel_sse2;
+#else
+  return transform_kernel_scalar;
+#endif
+}
+
+/**
+* Runs the fastest kernel supported by the CPU.  The CPU is only queried the first time this is called.
+*/
+void run_transform_kernel(const KernelMatrix& matrix, double* coords, size_t count) {
+  static const TransformKernel kernel = select_transform_kernel();
+  kernel(matrix, coords, count);
+}
+
+/**
+* Returns the kernel matrix for the top three rows of the transformation, multiplied by the given scale.
+*/
+KernelMatrix kernel_matrix(const SUTransformation& transformation, double scale, bool translate) {
+  KernelMatrix matrix{};
+  for (size_t col=0; col < 4; ++col) {
+    for (size_t row=0; row < 3; ++row) {
+      matrix[(col * 4) + row] = transformation.values[(col * 4) + row] * scale;
+    }
+  }
+  if (!translate) {
+    matrix[12] = matrix[13] = matrix[14] = 0.0;
+  }
+  return matrix;
+}
+
+/**
+* Returns the determinant of the top left 3x3 part of the matrix.
+*/
+double determinant3x3(const SUTransformation& transformation) {
+  const double* m = transformation.values;
+  return (m[0] * ((m[5] * m[10]) - (m[9] * m[6]))) -
+         (m[4] * ((m[1] * m[10]) - (m[9] * m[2]))) +
+         (m[8] * ((m[1] * m[6]) - (m[5] * m[2])));
+}
+
+/**
+* Calculates the inverse of a general 4x4 matrix from its adjugate.
+* @return the determinant of the matrix. If it is zero, the inverse is not valid.
+*/
+double general_inverse(const SUTransformation& transformation, SUTransformation& inverse) {
+  // From the MESA implementation of gluInvertMatrix.  As (M^T)^-1 = (M^-1)^T, it works for both row and column major matrices.
+  const double* m = transformation.values;
+  double* inv = inverse.values;
+  inv[0] = m[5]*m[10]*m[15] - m[5]*m[11]*m[14] - m[9]*m[6]*m[15] + m[9]*m[7]*m[14] + m[13]*m[6]*m[11] - m[13]*m[7]*m[10];
+  inv[4] = -m[4]*m[10]*m[15] + m[4]*m[11]*m[14] + m[8]*m[6]*m[15] - m[8]*m[7]*m[14] - m[12]*m[6]*m[11] + m[12]*m[7]*m[10];
+  inv[8] = m[4]*m[9]*m[15] - m[4]*m[11]*m[13] - m[8]*m[5]*m[15] + m[8]*m[7]*m[13] + m[12]*m[5]*m[11] - m[12]*m[7]*m[9];
+  inv[12] = -m[4]*m[9]*m[14] + m[4]*m[10]*m[13] + m[8]*m[5]*m[14] - m[8]*m[6]*m[13] - m[12]*m[5]*m[10] + m[12]*m[6]*m[9];
+  inv[1] = -m[1]*m[10]*m[15] + m[1]*m[11]*m[14] + m[9]*m[2]*m[15] - m[9]*m[3]*m[14] - m[13]*m[2]*m[11] + m[13]*m[3]*m[10];
+  inv[5] = m[0]*m[10]*m[15] - m[0]*m[11]*m[14] - m[8]*m[2]*m[15] + m[8]*m[3]*m[14] + m[12]*m[2]*m[11] - m[12]*m[3]*m[10];
+  inv[9] = -m[0]*m[9]*m[15] + m[0]*m[11]*m[13] + m[8]*m[1]*m[15] - m[8]*m[3]*m[13] - m[12]*m[1]*m[11] + m[12]*m[3]*m[9];
+  inv[13] = m[0]*m[9]*m[14] - m[0]*m[10]*m[13] - m[8]*m[1]*m[14] + m[8]*m[2]*m[13] + m[12]*m[1]*m[10] - m[12]*m[2]*m[9];
+  inv[2] = m[1]*m[6]*m[15] - m[1]*m[7]*m[14] - m[5]*m[2]*m[15] + m[5]*m[3]*m[14] + m[13]*m[2]*m[7] - m[13]*m[3]*m[6];
+  inv[6] = -m[0]*m[6]*m[15] + m[0]*m[7]*m[14] + m[4]*m[2]*m[15] - m[4]*m[3]*m[14] - m[12]*m[2]*m[7] + m[12]*m[3]*m[6];
+  inv[10] = m[0]*m[5]*m[15] - m[0]*m[7]*m[13] - m[4]*m[1]*m[15] + m[4]*m[3]*m[13] + m[12]*m[1]*m[7] - m[12]*m[3]*m[5];
+  inv[14] = -m[0]*m[5]*m[14] + m[0]*m[6]*m[13] + m[4]*m[1]*m[14] - m[4]*m[2]*m[13] - m[12]*m[1]*m[6] + m[12]*m[2]*m[5];
+  inv[3] = -m[1]*m[6]*m[11] + m[1]*m[7]*m[10] + m[5]*m[2]*m[11] - m[5]*m[3]*m[10] - m[9]*m[2]*m[7] + m[9]*m[3]*m[6];
+  inv[7] = m[0]*m[6]*m[11] - m[0]*m[7]*m[10] - m[4]*m[2]*m[11] + m[4]*m[3]*m[10] + m[8]*m[2]*m[7] - m[8]*m[3]*m[6];
+  inv[11] = -m[0]*m[5]*m[11] + m[0]*m[7]*m[9] + m[4]*m[1]*m[11] - m[4]*m[3]*m[9] - m[8]*m[1]*m[7] + m[8]*m[3]*m[5];
+  inv[15] = m[0]*m[5]*m[10] - m[0]*m[6]*m[9] - m[4]*m[1]*m[10] + m[4]*m[2]*m[9] + m[8]*m[1]*m[6] - m[8]*m[2]*m[5];
+  const double det = m[0]*inv[0] + m[1]*inv[4] + m[2]*inv[8] + m[3]*inv[12];
+  if (det == 0.0) {
+    return det;
+  }
+  for (size_t i=0; i < 16; ++i) {
+    inv[i] /= det;
+  }
+  return det;
+}
+
+} // namespace
+
+
 Transformation::Transformation():
   Transformation(1.0)
 {}
 
 
 Transformation::Transformation(SUTransformation transformation):
-  m_transformation(transformation)
+  m_transformation(transformation),
+  m_flags(classify(transformation))
+{}
+
+
+Transformation::Transformation(const SUTransformation& transformation, unsigned int flags):
+  m_transformation(transformation),
+  m_flags(flags | CLASSIFIED)
 {}
 
 Transformation::Transformation(const Axes& axes, const Vector3D& translation, double scalar):
@@ -64,6 +250,7 @@ Transformation::  Transformation(const Point3D& origin, const Vector3D& x_axis,
 {
   SUResult res = SUTransformationSetFromPointAndAxes(&m_transformation, origin, x_axis, y_axis, z_axis);
   assert(res == SU_ERROR_NONE); _unused(res);
+  m_flags = classify(m_transformation);
   if (scalar != 1.0) {
     // TODO:
     assert(false);
@@ -75,6 +262,7 @@ Transformation::Transformation(double scalar):
 {
   SUResult res = SUTransformationScale(&m_transformation, scalar);
   assert(res == SU_ERROR_NONE); _unused(res);
+  m_flags = classify(m_transformation);
 }
 
 
@@ -83,6 +271,7 @@ Transformation::Transformation(double x_scale, double y_scale, double z_scale):
 {
   SUResult res = SUTransformationNonUniformScale(&m_transformation, x_scale, y_scale, z_scale);
   assert(res == SU_ERROR_NONE); _unused(res);
+  m_flags = classify(m_transformation);
 }
 
 
@@ -91,6 +280,7 @@ Transformation::Transformation(const Vector3D& translation):
 {
   SUResult res = SUTransformationTranslation(&m_transformation, translation);
   assert(res == SU_ERROR_NONE); _unused(res);
+  m_flags = classify(m_transformation);
 }
 
 
@@ -99,6 +289,7 @@ Transformation::Transformation(const Point3D& translation, double scalar):
 {
   SUResult res = SUTransformationScaleAboutPoint(&m_transformation, translation, scalar);
   assert(res == SU_ERROR_NONE); _unused(res);
+  m_flags = classify(m_transformation);
 }
 
 
@@ -107,6 +298,7 @@ Transformation::Transformation(const Point3D& translation, const Vector3D& norma
 {
   SUResult res = SUTransformationSetFromPointAndNormal(&m_transformation, translation, normal);
   assert(res == SU_ERROR_NONE); _unused(res);
+  m_flags = classify(m_transformation);
 }
 
 
@@ -115,6 +307,7 @@ Transformation::Transformation(const Point3D& point, const Vector3D& vector, dou
 {
   SUResult res = SUTransformationRotation(&m_transformation, point, vector, angle);
   assert(res == SU_ERROR_NONE); _unused(res);
+  m_flags = classify(m_transformation);
 }
 
 
@@ -123,20 +316,16 @@ Transformation::Transformation(const Transformation& transform1, const Transform
 {
   SUResult res = SUTransformationInterpolate(&m_transformation, transform1, transform2, weight);
   assert(res == SU_ERROR_NONE); _unused(res);
+  m_flags = classify(m_transformation);
 }
 
 
 double Transformation::determinant() const {
-  // From: http://www.euclideanspace.com/maths/algebra/matrix/functions/determinant/fourD/index.htm
-  // Note this is for general 4x4 matrix, and it is excessive for a 3x3 matrix.
-  double value =
-    m_transformation.values[12] * m_transformation.values[9] * m_transformation.values[6] * m_transformation.values[3]-m_transformation.values[8] * m_transformation.values[13] * m_transformation.values[6] * m_transformation.values[3]-m_transformation.values[12] * m_transformation.values[5] * m_transformation.values[10] * m_transformation.values[3]+m_transformation.values[4] * m_transformation.values[13] * m_transformation.values[10] * m_transformation.values[3]+
-    m_transformation.values[8] * m_transformation.values[5] * m_transformation.values[14] * m_transformation.values[3]-m_transformation.values[4] * m_transformation.values[9] * m_transformation.values[14] * m_transformation.values[3]-m_transformation.values[12] * m_transformation.values[9] * m_transformation.values[2] * m_transformation.values[7]+m_transformation.values[8] * m_transformation.values[13] * m_transformation.values[2] * m_transformation.values[7]+
-    m_transformation.values[12] * m_transformation.values[1] * m_transformation.values[10] * m_transformation.values[7]-m_transformation.values[0] * m_transformation.values[13] * m_transformation.values[10] * m_transformation.values[7]-m_transformation.values[8] * m_transformation.values[1] * m_transformation.values[14] * m_transformation.values[7]+m_transformation.values[0] * m_transformation.values[9] * m_transformation.values[14] * m_transformation.values[7]+
-    m_transformation.values[12] * m_transformation.values[5] * m_transformation.values[2] * m_transformation.values[11]-m_transformation.values[4] * m_transformation.values[13] * m_transformation.values[2] * m_transformation.values[11]-m_transformation.values[12] * m_transformation.values[1] * m_transformation.values[6] * m_transformation.values[11]+m_transformation.values[0] * m_transformation.values[13] * m_transformation.values[6] * m_transformation.values[11]+
-    m_transformation.values[4] * m_transformation.values[1] * m_transformation.values[14] * m_transformation.values[11]-m_transformation.values[0] * m_transformation.values[5] * m_transformation.values[14] * m_transformation.values[11]-m_transformation.values[8] * m_transformation.values[5] * m_transformation.values[2] * m_transformation.values[15]+m_transformation.values[4] * m_transformation.values[9] * m_transformation.values[2] * m_transformation.values[15]+
-    m_transformation.values[8] * m_transformation.values[1] * m_transformation.values[6] * m_transformation.values[15]-m_transformation.values[0] * m_transformation.values[9] * m_transformation.values[6] * m_transformation.values[15]-m_transformation.values[4] * m_transformation.values[1] * m_transformation.values[10] * m_transformation.values[15]+m_transformation.values[0] * m_transformation.values[5] * m_transformation.values[10] * m_transformation.values[15];
- return value;
+  if (flags() & AFFINE) {
+    return m_transformation.values[15] * determinant3x3(m_transformation);
+  }
+  SUTransformation inverse;
+  return general_inverse(m_transformation, inverse);
 }
 
 
@@ -171,6 +360,8 @@ double& Transformation::operator[](size_t i) {
   if (i > 15) {
     throw std::out_of_range("CW::Transformation::operator[](): index range is between 0 and 15");
   }
+  // The matrix may be modified through the reference, so the classification can no longer be relied upon.
+  m_flags = 0;
   return m_transformation.values[i];
 }
 
@@ -188,18 +379,142 @@ Transformation::operator const SUTransformation*() const {
 }
 
 
+unsigned int Transformation::classify(const SUTransformation& transformation) {
+  const double* values = transformation.values;
+  unsigned int flags = CLASSIFIED;
+  if (values[3] != 0.0 || values[7] != 0.0 || values[11] != 0.0 || values[15] == 0.0) {
+    // Perspective transformation - no shortcuts can be taken.
+    return flags;
+  }
+  flags |= AFFINE;
+  // The 3x3 matrix is classified as if the homogenous coordinate w had been divided out, so the comparisons against 1.0 are made against w instead.
+  const double w = values[15];
+  const double w_squared = w * w;
+  if (determinant3x3(transformation) * w < 0.0) {
+    flags |= MIRRORED;
+  }
+  auto dot = [values](size_t col1, size_t col2) {
+    return (values[col1 * 4] * values[col2 * 4]) + (values[(col1 * 4) + 1] * values[(col2 * 4) + 1]) + (values[(col1 * 4) + 2] * values[(col2 * 4) + 2]);
+  };
+  const double length0 = dot(0, 0);
+  const double tolerance = CLASSIFICATION_EPSILON * length0;
+  if (std::abs(dot(0, 1)) >= tolerance ||
+      std::abs(dot(0, 2)) >= tolerance ||
+      std::abs(dot(1, 2)) >= tolerance ||
+      std::abs(dot(1, 1) - length0) > tolerance ||
+      std::abs(dot(2, 2) - length0) > tolerance) {
+    return flags;
+  }
+  flags |= UNIFORM_SCALE;
+  if (std::abs(length0 - w_squared) > CLASSIFICATION_EPSILON * w_squared) {
+    return flags;
+  }
+  flags |= RIGID;
+  const double w_tolerance = CLASSIFICATION_EPSILON * std::abs(w);
+  if (std::abs(values[0] - w) > w_tolerance ||
+      std::abs(values[5] - w) > w_tolerance ||
+      std::abs(values[10] - w) > w_tolerance) {
+    return flags;
+  }
+  flags |= TRANSLATION;
+  if (std::abs(values[12]) < w_tolerance &&
+      std::abs(values[13]) < w_tolerance &&
+      std::abs(values[14]) < w_tolerance) {
+    flags |= IDENTITY;
+  }
+  return flags;
+}
+
+
+unsigned int Transformation::flags() const {
+  if (m_flags & CLASSIFIED) {
+    return m_flags;
+  }
+  return classify(m_transformation);
+}
+
+
 bool Transformation::is_identity() const {
-  bool is_identity;
-  SUResult res = SUTransformationIsIdentity(&m_transformation, &is_identity);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  return is_identity;
+  return (flags() & IDENTITY) != 0;
+}
+
+
+bool Transformation::is_affine() const {
+  return (flags() & AFFINE) != 0;
+}
+
+
+bool Transformation::is_translation() const {
+  return (flags() & TRANSLATION) != 0;
+}
+
+
+bool Transformation::is_rigid() const {
+  return (flags() & RIGID) != 0;
+}
+
+
+bool Transformation::is_uniform_scale() const {
+  return (flags() & UNIFORM_SCALE) != 0;
+}
+
+
+bool Transformation::is_mirrored() const {
+  unsigned int classification = flags();
+  if (classification & AFFINE) {
+    return (classification & MIRRORED) != 0;
+  }
+  return determinant() < 0.0;
 }
 
 
 Transformation Transformation::inverse() const {
-  SUTransformation inverse = SU_INVALID;
-  SUResult res = SUTransformationGetInverse(&m_transformation, &inverse);
-  assert(res == SU_ERROR_NONE); _unused(res);
+  const unsigned int classification = flags();
+  if (classification & IDENTITY) {
+    return *this;
+  }
+  const double* values = m_transformation.values;
+  SUTransformation inverse;
+  if (classification & AFFINE) {
+    // For M = [A t; 0 w], the inverse is [A^-1, -A^-1*t/w; 0, 1/w]
+    const double w = values[15];
+    double* inv = inverse.values;
+    if (classification & UNIFORM_SCALE) {
+      // A is a rotation multiplied by a scalar, so its inverse is the transpose divided by the square of the scale.
+      const double scale_squared = (values[0] * values[0]) + (values[1] * values[1]) + (values[2] * values[2]);
+      for (size_t col=0; col < 3; ++col) {
+        for (size_t row=0; row < 3; ++row) {
+          inv[(col * 4) + row] = values[(row * 4) + col] / scale_squared;
+        }
+      }
+    }
+    else {
+      const double det = determinant3x3(m_transformation);
+      if (det == 0.0) {
+        throw std::logic_error("CW::Transformation::inverse(): transformation cannot be inverted");
+      }
+      // Inverse of a 3x3 matrix is its adjugate divided by the determinant.  The rows of the inverse are the cross products of the columns.
+      const Vector3D col0(values[0], values[1], values[2]);
+      const Vector3D col1(values[4], values[5], values[6]);
+      const Vector3D col2(values[8], values[9], values[10]);
+      const Vector3D row0 = col1.cross(col2) * (1.0 / det);
+      const Vector3D row1 = col2.cross(col0) * (1.0 / det);
+      const Vector3D row2 = col0.cross(col1) * (1.0 / det);
+      inv[0] = row0.x; inv[4] = row0.y; inv[8] = row0.z;
+      inv[1] = row1.x; inv[5] = row1.y; inv[9] = row1.z;
+      inv[2] = row2.x; inv[6] = row2.y; inv[10] = row2.z;
+    }
+    for (size_t row=0; row < 3; ++row) {
+      inv[12 + row] = -((inv[row] * values[12]) + (inv[4 + row] * values[13]) + (inv[8 + row] * values[14])) / w;
+    }
+    inv[3] = inv[7] = inv[11] = 0.0;
+    inv[15] = 1.0 / w;
+    // The inverse is the same kind of transformation (mirrored if this is).
+    return Transformation(inverse, classification);
+  }
+  if (general_inverse(m_transformation, inverse) == 0.0) {
+    throw std::logic_error("CW::Transformation::inverse(): transformation cannot be inverted");
+  }
   return Transformation(inverse);
 }
   
@@ -246,15 +561,13 @@ Transformation& Transformation::normalize() {
     m_transformation.values[i] = m_transformation.values[i] / m_transformation.values[15];
   }
   m_transformation.values[15] = 1.0;
+  m_flags = classify(m_transformation);
   return (*this);
 }
 
 
 Point3D Transformation::origin() const {
-  SUPoint3D origin;
-  SUResult res = SUTransformationGetOrigin(&m_transformation, &origin);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  return Point3D(origin);
+  return Point3D(translation());
 }
   
 
@@ -266,11 +579,150 @@ Vector3D Transformation::translation() const {
 }
 
   
-Transformation Transformation::operator*(Transformation transform) {
-  SUTransformation out_transform = SU_INVALID;
-  SUResult res = SUTransformationMultiply(&m_transformation, &transform.m_transformation, &out_transform);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  return Transformation(out_transform);
+Transformation Transformation::operator*(const Transformation& transform) const {
+  const unsigned int lhs_flags = flags();
+  const unsigned int rhs_flags = transform.flags();
+  if (lhs_flags & IDENTITY) {
+    return transform;
+  }
+  if (rhs_flags & IDENTITY) {
+    return *this;
+  }
+  const double* a = m_transformation.values;
+  const double* b = transform.m_transformation.values;
+  SUTransformation product;
+  double* out = product.values;
+  if (!(lhs_flags & AFFINE) || !(rhs_flags & AFFINE)) {
+    for (size_t col=0; col < 4; ++col) {
+      for (size_t row=0; row < 4; ++row) {
+        out[(col * 4) + row] = (a[row] * b[col * 4]) + (a[4 + row] * b[(col * 4) + 1]) + (a[8 + row] * b[(col * 4) + 2]) + (a[12 + row] * b[(col * 4) + 3]);
+      }
+    }
+    return Transformation(product);
+  }
+  // [A ta; 0 wa] * [B tb; 0 wb] = [A*B, A*tb + ta*wb; 0, wa*wb]
+  if ((lhs_flags & TRANSLATION) && a[15] == 1.0) {
+    // A is the identity, so only the translation changes.
+    product = transform.m_transformation;
+    out[12] += a[12] * b[15];
+    out[13] += a[13] * b[15];
+    out[14] += a[14] * b[15];
+  }
+  else {
+    for (size_t col=0; col < 3; ++col) {
+      for (size_t row=0; row < 3; ++row) {
+        out[(col * 4) + row] = (a[row] * b[col * 4]) + (a[4 + row] * b[(col * 4) + 1]) + (a[8 + row] * b[(col * 4) + 2]);
+      }
+    }
+    for (size_t row=0; row < 3; ++row) {
+      out[12 + row] = (a[row] * b[12]) + (a[4 + row] * b[13]) + (a[8 + row] * b[14]) + (a[12 + row] * b[15]);
+    }
+    out[3] = out[7] = out[11] = 0.0;
+    out[15] = a[15] * b[15];
+  }
+  if (!(lhs_flags & rhs_flags & UNIFORM_SCALE)) {
+    // Non-uniform scales may combine into any kind of transformation.
+    return Transformation(product);
+  }
+  // The product of uniform scale transformations is also a uniform scale, so only check whether the scales, rotations and translations have cancelled out (e.g. a transformation multiplied by its inverse).
+  unsigned int product_flags = AFFINE | UNIFORM_SCALE | (lhs_flags & rhs_flags & (TRANSLATION | RIGID));
+  if ((lhs_flags ^ rhs_flags) & MIRRORED) {
+    product_flags |= MIRRORED;
+  }
+  if (!(product_flags & RIGID) &&
+      std::abs((out[0] * out[0]) + (out[1] * out[1]) + (out[2] * out[2]) - (out[15] * out[15])) < CLASSIFICATION_EPSILON * out[15] * out[15]) {
+    product_flags |= RIGID;
+  }
+  if ((product_flags & RIGID) &&
+      std::abs(out[0] - out[15]) < CLASSIFICATION_EPSILON * std::abs(out[15]) &&
+      std::abs(out[5] - out[15]) < CLASSIFICATION_EPSILON * std::abs(out[15]) &&
+      std::abs(out[10] - out[15]) < CLASSIFICATION_EPSILON * std::abs(out[15])) {
+    product_flags |= TRANSLATION;
+    if (std::abs(out[12]) < CLASSIFICATION_EPSILON * std::abs(out[15]) &&
+        std::abs(out[13]) < CLASSIFICATION_EPSILON * std::abs(out[15]) &&
+        std::abs(out[14]) < CLASSIFICATION_EPSILON * std::abs(out[15])) {
+      product_flags |= IDENTITY;
+    }
+  }
+  return Transformation(product, product_flags);
+}
+
+
+void Transformation::transform_points(SUPoint3D* points, size_t num_points) const {
+  if (num_points == 0) {
+    return;
+  }
+  const double* values = m_transformation.values;
+  if (values[3] == 0.0 && values[7] == 0.0 && values[11] == 0.0) {
+    // The homogenous coordinate is the same for every point, so it can be folded into the matrix.
+    run_transform_kernel(kernel_matrix(m_transformation, 1.0 / values[15], true), &points[0].x, num_points);
+    return;
+  }
+  // Projective transformations need a division per point.
+  for (size_t i=0; i < num_points; ++i) {
+    const double x = points[i].x;
+    const double y = points[i].y;
+    const double z = points[i].z;
+    const double w = (values[3] * x) + (values[7] * y) + (values[11] * z) + values[15];
+    points[i].x = ((values[0] * x) + (values[4] * y) + (values[8] * z) + values[12]) / w;
+    points[i].y = ((values[1] * x) + (values[5] * y) + (values[9] * z) + values[13]) / w;
+    points[i].z = ((values[2] * x) + (values[6] * y) + (values[10] * z) + values[14]) / w;
+  }
+}
+
+
+void Transformation::transform_points(std::vector<Point3D>& points) const {
+  // Point3D is layout compatible with SUPoint3D
+  transform_points(reinterpret_cast<SUPoint3D*>(points.data()), points.size());
+}
+
+
+void Transformation::transform_vectors(SUVector3D* vectors, size_t num_vectors) const {
+  if (num_vectors == 0) {
+    return;
+  }
+  run_transform_kernel(kernel_matrix(m_transformation, 1.0 / m_transformation.values[15], false), &vectors[0].x, num_vectors);
+}
+
+
+void Transformation::transform_vectors(std::vector<Vector3D>& vectors) const {
+  // Vector3D is layout compatible with SUVector3D
+  transform_vectors(reinterpret_cast<SUVector3D*>(vectors.data()), vectors.size());
+}
+
+
+void Transformation::transform_normals(SUVector3D* normals, size_t num_normals) const {
+  if (num_normals == 0) {
+    return;
+  }
+  // The inverse transpose of the 3x3 rotation/scale matrix is the cofactor matrix divided by the determinant.  As the normals are unitised afterwards, only the sign of the determinant is needed.
+  const double* values = m_transformation.values;
+  const Vector3D col0(values[0], values[1], values[2]);
+  const Vector3D col1(values[4], values[5], values[6]);
+  const Vector3D col2(values[8], values[9], values[10]);
+  const Vector3D cof0 = col1.cross(col2);
+  const Vector3D cof1 = col2.cross(col0);
+  const Vector3D cof2 = col0.cross(col1);
+  const double sign = col0.dot(cof0) < 0.0 ? -1.0 : 1.0;
+  KernelMatrix matrix{
+    cof0.x * sign, cof0.y * sign, cof0.z * sign, 0.0,
+    cof1.x * sign, cof1.y * sign, cof1.z * sign, 0.0,
+    cof2.x * sign, cof2.y * sign, cof2.z * sign, 0.0,
+    0.0, 0.0, 0.0, 0.0};
+  run_transform_kernel(matrix, &normals[0].x, num_normals);
+  for (size_t i=0; i < num_normals; ++i) {
+    const double length = std::sqrt((normals[i].x * normals[i].x) + (normals[i].y * normals[i].y) + (normals[i].z * normals[i].z));
+    if (length > 0.0) {
+      normals[i].x /= length;
+      normals[i].y /= length;
+      normals[i].z /= length;
+    }
+  }
+}
+
+
+void Transformation::transform_normals(std::vector<Vector3D>& normals) const {
+  transform_normals(reinterpret_cast<SUVector3D*>(normals.data()), normals.size());
 }
 
 
@@ -337,35 +789,83 @@ Face operator*(const Face &lhs, const Transformation &rhs) {
   if (!lhs) {
     throw std::invalid_argument("CW::Transformation::operator*(const Face &lhs, const Transformation &rhs): Face given is null");
   }
-  // We transform all the vertices then create loops
-  std::vector<Vertex> outer_vertices = lhs.outer_loop().vertices();
-  std::vector<Point3D> trans_outer_points;
-  trans_outer_points.reserve(outer_vertices.size());
-  for (size_t i=0; i < outer_vertices.size(); ++i) {
-    trans_outer_points.push_back(outer_vertices[i].position() * rhs);
-  }
-  LoopInput outer_loop_input = lhs.outer_loop().loop_input();
-  Face trans_face(trans_outer_points, outer_loop_input);
-  // Now add inner loops
-  std::vector<Loop> inner_loops = lhs.inner_loops();
-  for (size_t j=0; j < inner_loops.size(); ++j) {
-    std::vector<Vertex> inner_vertices = inner_loops[j].vertices();
-    std::vector<Point3D> trans_inner_points;
-    trans_inner_points.reserve(inner_vertices.size());
-    for (size_t i=0; i < inner_vertices.size(); ++i) {
-      trans_inner_points.push_back(inner_vertices[i].position() * rhs);
-    }
-    LoopInput inner_loop_input = inner_loops[j].loop_input();
-    trans_face.add_inner_loop(trans_inner_points, inner_loop_input);
-  }
-  if (!!lhs.material()) {
-    trans_face.material(lhs.material());
+  // Read the face once, then create the transformed face with its loops
+  FaceData face_data(lhs);
+  Face trans_face(face_data[0].create_face_ref(rhs), false);
+  Material material = face_data[0].material();
+  if (!!material) {
+    trans_face.material(material);
   }
   trans_face.copy_attributes_from(lhs);
   return trans_face;
 }
   
 
+bool Transformation::decompose(Vector3D& translation, Transformation& rotation, Vector3D& scale) const {
+  const unsigned int classification = flags();
+  const double* values = m_transformation.values;
+  const double w = values[15];
+  translation = this->translation();
+  // Gram-Schmidt orthogonalisation of the columns, which gives the rotation, scales and shears.
+  const Vector3D col0 = Vector3D(values[0], values[1], values[2]) * (1.0 / w);
+  const Vector3D col1 = Vector3D(values[4], values[5], values[6]) * (1.0 / w);
+  const Vector3D col2 = Vector3D(values[8], values[9], values[10]) * (1.0 / w);
+  // A scale below this is treated as zero.  Such an axis has no direction, so an axis perpendicular to the others is used in its place, and the decomposition is not exact.
+  const double zero_scale = CLASSIFICATION_EPSILON * std::max(col0.length(), std::max(col1.length(), col2.length()));
+  bool zero_scaled = false;
+  scale.x = col0.length();
+  Vector3D x_axis(1.0, 0.0, 0.0);
+  if (scale.x > zero_scale) {
+    x_axis = col0 * (1.0 / scale.x);
+  }
+  else {
+    scale.x = 0.0;
+    zero_scaled = true;
+  }
+  const double shear_xy = x_axis.dot(col1);
+  Vector3D y_axis = col1 - (x_axis * shear_xy);
+  scale.y = y_axis.length();
+  if (scale.y > zero_scale) {
+    y_axis = y_axis * (1.0 / scale.y);
+  }
+  else {
+    scale.y = 0.0;
+    zero_scaled = true;
+    // Whichever of the Y and Z axes is further from the X axis gives a perpendicular.
+    const Vector3D candidate = std::abs(x_axis.y) < std::abs(x_axis.z) ? Vector3D(0.0, 1.0, 0.0) : Vector3D(0.0, 0.0, 1.0);
+    y_axis = candidate - (x_axis * x_axis.dot(candidate));
+    y_axis = y_axis * (1.0 / y_axis.length());
+  }
+  const double shear_xz = x_axis.dot(col2);
+  const double shear_yz = y_axis.dot(col2);
+  Vector3D z_axis = col2 - (x_axis * shear_xz) - (y_axis * shear_yz);
+  scale.z = z_axis.length();
+  if (scale.z > zero_scale) {
+    z_axis = z_axis * (1.0 / scale.z);
+  }
+  else {
+    scale.z = 0.0;
+    zero_scaled = true;
+    z_axis = x_axis.cross(y_axis);
+  }
+  if (x_axis.cross(y_axis).dot(z_axis) < 0.0) {
+    // Represent mirroring as a negative X scale so that the rotation is a proper rotation.
+    scale.x = -scale.x;
+    x_axis = -x_axis;
+  }
+  SUTransformation rotation_matrix = {{x_axis.x, x_axis.y, x_axis.z, 0.0,
+                                       y_axis.x, y_axis.y, y_axis.z, 0.0,
+                                       z_axis.x, z_axis.y, z_axis.z, 0.0,
+                                       0.0, 0.0, 0.0, 1.0}};
+  rotation = Transformation(rotation_matrix);
+  if (!(classification & AFFINE) || zero_scaled) {
+    return false;
+  }
+  const double shear_epsilon = CLASSIFICATION_EPSILON * std::max(std::abs(scale.x), std::max(scale.y, scale.z));
+  return std::abs(shear_xy) < shear_epsilon && std::abs(shear_xz) < shear_epsilon && std::abs(shear_yz) < shear_epsilon;
+}
+
+
 bool Transformation::equal(const Transformation transform, const double epsilon) const {
   for (size_t i=0; i < 16; ++i) {
     // Skip bottom row, except last
@@ -0,0 +1,810 @@
+//
+//  Triangulator.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/Triangulator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "SUAPI-CppWrapper/Predicates.hpp"
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* Polygons are triangulated in chunks of this many by each thread.
+*/
+constexpr size_t POLYGONS_PER_CHUNK = 16;
+
+/**
+* Polygons with more vertices than this index their vertices along a z-order curve to find those near each ear.
+*/
+constexpr size_t HASH_THRESHOLD = 80;
+
+inline double component(const Vector3D& vector, size_t axis) {
+  return axis == 0 ? vector.x : (axis == 1 ? vector.y : vector.z);
+}
+
+inline int sign(double value) {
+  return value > 0.0 ? 1 : (value < 0.0 ? -1 : 0);
+}
+
+/**
+* Returns true if p is inside or on the counter-clockwise triangle abc, and is not at a.
+*/
+inline bool point_in_triangle_except_first(const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c, const SUPoint2D& p) {
+  if (a.x == p.x && a.y == p.y) {
+    return false;
+  }
+  return Predicates::orient2d(c, a, p) >= 0.0 && Predicates::orient2d(a, b, p) >= 0.0 && Predicates::orient2d(b, c, p) >= 0.0;
+}
+
+inline bool point_in_triangle(const SUPoint2D& a, const SUPoint2D& b, const SUPoint2D& c, const SUPoint2D& p) {
+  return Predicates::orient2d(c, a, p) >= 0.0 && Predicates::orient2d(a, b, p) >= 0.0 && Predicates::orient2d(b, c, p) >= 0.0;
+}
+
+/**
+* Returns true if q lies on the bounding box of the segment pr, given that the three points are collinear.
+*/
+inline bool on_segment(const SUPoint2D& p, const SUPoint2D& q, const SUPoint2D& r) {
+  return q.x <= std::max(p.x, r.x) && q.x >= std::min(p.x, r.x) && q.y <= std::max(p.y, r.y) && q.y >= std::min(p.y, r.y);
+}
+
+} // namespace
+
+/******************
+** Polygon **
+*******************/
+Triangulator::Polygon::Polygon()
+{}
+
+
+Triangulator::Polygon::Polygon(const std::vector<Point3D>& outer_loop, const std::vector<std::vector<Point3D>>& inner_loops):
+  vertices(outer_loop)
+{
+  loop_ends.push_back(vertices.size());
+  for (const std::vector<Point3D>& inner_loop : inner_loops) {
+    vertices.insert(vertices.end(), inner_loop.begin(), inner_loop.end());
+    loop_ends.push_back(vertices.size());
+  }
+  // Newell's method gives the normal of a non-convex loop, and of a loop with collinear vertices.
+  Vector3D sum(0.0, 0.0, 0.0);
+  for (size_t i=0; i < outer_loop.size(); ++i) {
+    const Point3D& current = outer_loop[i];
+    const Point3D& next = outer_loop[(i + 1) % outer_loop.size()];
+    sum.x += (current.y - next.y) * (current.z + next.z);
+    sum.y += (current.z - next.z) * (current.x + next.x);
+    sum.z += (current.x - next.x) * (current.y + next.y);
+  }
+  normal = sum.normalized();
+}
+
+
+Triangulator::Polygon::Polygon(const Face& face) {
+  if (!face) {
+    throw std::logic_error("CW::Triangulator::Polygon::Polygon(): Face is null");
+  }
+  vertices = face.outer_loop().points();
+  loop_ends.push_back(vertices.size());
+  for (const Loop& inner_loop : face.inner_loops()) {
+    const std::vector<Point3D> points = inner_loop.points();
+    vertices.insert(vertices.end(), points.begin(), points.end());
+    loop_ends.push_back(vertices.size());
+  }
+  normal = face.normal();
+}
+
+/******************
+** Triangulator **
+*******************/
+Triangulator::Triangulator():
+  m_triangles(nullptr),
+  m_min_x(0.0),
+  m_min_y(0.0),
+  m_inv_size(0.0),
+  m_band_min_y(0.0),
+  m_band_scale(0.0)
+{}
+
+
+std::vector<size_t> Triangulator::triangulate(const Polygon& polygon) {
+  std::vector<size_t> indices;
+  triangulate(polygon, indices);
+  return indices;
+}
+
+
+void Triangulator::triangulate(const Polygon& polygon, std::vector<size_t>& indices) {
+  if (polygon.loop_ends.empty() || polygon.loop_ends.back() != polygon.vertices.size() || !std::is_sorted(polygon.loop_ends.begin(), polygon.loop_ends.end())) {
+    throw std::invalid_argument("CW::Triangulator::triangulate(): loop ends of the polygon do not match its vertices");
+  }
+  if (!(polygon.normal.squared_length() > 0.0)) {
+    throw std::invalid_argument("CW::Triangulator::triangulate(): normal of the polygon is zero");
+  }
+  // The projection is exact, so the predicates are exact for the projected points.  Mirroring the projection when the normal points away from the coordinate plane keeps the triangles counter-clockwise about the normal.
+  const size_t axis = Predicates::dominant_axis(polygon.normal);
+  const bool mirror = component(polygon.normal, axis) < 0.0;
+  m_points.clear();
+  m_nodes.clear();
+  m_band_scale = 0.0;
+  for (const Point3D& vertex : polygon.vertices) {
+    if (!vertex) {
+      throw std::invalid_argument("CW::Triangulator::triangulate(): vertices of the polygon must not be null");
+    }
+    SUPoint2D point = Predicates::project(vertex, axis);
+    if (mirror) {
+      point.y = -point.y;
+    }
+    m_points.push_back(point);
+  }
+  m_triangles = &indices;
+  size_t outer_node = linked_list(m_points, 0, polygon.loop_ends[0], true);
+  if (outer_node == NONE || m_nodes[outer_node].next == m_nodes[outer_node].prev) {
+    m_triangles = nullptr;
+    return;
+  }
+  if (polygon.loop_ends.size() > 1) {
+    outer_node = eliminate_holes(m_points, polygon.loop_ends, outer_node);
+  }
+  m_inv_size = 0.0;
+  if (m_points.size() > HASH_THRESHOLD) {
+    m_min_x = m_points[0].x;
+    m_min_y = m_points[0].y;
+    double max_x = m_min_x;
+    double max_y = m_min_y;
+    for (const SUPoint2D& point : m_points) {
+      m_min_x = std::min(m_min_x, point.x);
+      m_min_y = std::min(m_min_y, point.y);
+      max_x = std::max(max_x, point.x);
+      max_y = std::max(max_y, point.y);
+    }
+    const double size = std::max(max_x - m_min_x, max_y - m_min_y);
+    m_inv_size = size > 0.0 ? 32767.0 / size : 0.0;
+  }
+  clip_ears(outer_node, 0);
+  m_triangles = nullptr;
+}
+
+
+std::vector<std::vector<size_t>> Triangulator::triangulate(const std::vector<Polygon>& polygons, size_t num_threads) {
+  std::vector<std::vector<size_t>> results(polygons.size());
+  parallel_for_chunks(polygons.size(), POLYGONS_PER_CHUNK, num_threads, []() { return Triangulator(); }, [&](Triangulator& triangulator, size_t begin, size_t end) {
+    for (size_t i=begin; i < end; ++i) {
+      triangulator.triangulate(polygons[i], results[i]);
+    }
+  });
+  return results;
+}
+
+/******************
+** Linked lists **
+*******************/
+size_t Triangulator::insert_node(size_t index, const SUPoint2D& point, size_t last) {
+  const size_t node = m_nodes.size();
+  m_nodes.push_back(Node{point, index, node, node, 0, NONE, NONE, false, false});
+  if (last != NONE) {
+    m_nodes[node].next = m_nodes[last].next;
+    m_nodes[node].prev = last;
+    m_nodes[m_nodes[last].next].prev = node;
+    m_nodes[last].next = node;
+  }
+  return node;
+}
+
+
+void Triangulator::remove_node(size_t node) {
+  Node& removed = m_nodes[node];
+  removed.removed = true;
+  m_nodes[removed.next].prev = removed.prev;
+  m_nodes[removed.prev].next = removed.next;
+  if (m_band_scale != 0.0) {
+    index_edge(removed.prev);
+  }
+  if (removed.prev_z != NONE) {
+    m_nodes[removed.prev_z].next_z = removed.next_z;
+  }
+  if (removed.next_z != NONE) {
+    m_nodes[removed.next_z].prev_z = removed.prev_z;
+  }
+}
+
+
+size_t Triangulator::linked_list(const std::vector<SUPoint2D>& points, size_t begin, size_t end, bool counter_clockwise) {
+  if (begin == end) {
+    return NONE;
+  }
+  double area = 0.0;
+  for (size_t i=begin, j=end - 1; i < end; j = i++) {
+    area += (points[j].x * points[i].y) - (points[i].x * points[j].y);
+  }
+  size_t last = NONE;
+  if (counter_clockwise == (area > 0.0)) {
+    for (size_t i=begin; i < end; ++i) {
+      last = insert_node(i, points[i], last);
+    }
+  }
+  else {
+    for (size_t i=end; i > begin; --i) {
+      last = insert_node(i - 1, points[i - 1], last);
+    }
+  }
+  if (equals(last, m_nodes[last].next)) {
+    remove_node(last);
+    last = m_nodes[last].next;
+  }
+  return last;
+}
+
+
+size_t Triangulator::filter_points(size_t start, size_t end) {
+  // Removes coincident vertices, and vertices between collinear edges.
+  if (start == NONE) {
+    return start;
+  }
+  if (end == NONE) {
+    end = start;
+  }
+  size_t p = start;
+  bool again;
+  do {
+    again = false;
+    if (!m_nodes[p].steiner && (equals(p, m_nodes[p].next) || orient(m_nodes[p].prev, p, m_nodes[p].next) == 0.0)) {
+      remove_node(p);
+      p = end = m_nodes[p].prev;
+      if (p == m_nodes[p].next) {
+        break;
+      }
+      again = true;
+    }
+    else {
+      p = m_nodes[p].next;
+    }
+  } while (again || p != end);
+  return end;
+}
+
+
+size_t Triangulator::filter_around(size_t node) {
+  // Unlike filter_points(), only the node, and the vertices made degenerate by removing it, are removed.  filter_points() goes around the whole loop after removing a vertex, which would make joining many holes to the loop take quadratic time.
+  size_t p = node;
+  while (p != m_nodes[p].next) {
+    const size_t prev = m_nodes[p].prev;
+    const size_t next = m_nodes[p].next;
+    if (!m_nodes[p].steiner && (equals(p, next) || orient(prev, p, next) == 0.0)) {
+      remove_node(p);
+      p = prev;
+    }
+    else if (!m_nodes[next].steiner && (equals(next, m_nodes[next].next) || orient(p, next, m_nodes[next].next) == 0.0)) {
+      remove_node(next);
+    }
+    else {
+      break;
+    }
+  }
+  return p;
+}
+
+
+size_t Triangulator::split_polygon(size_t a, size_t b) {
+  // Links a to b with a diagonal, splitting the ring in two.  The vertices at a and b are duplicated so that each ring has its own.
+  const size_t a2 = m_nodes.size();
+  m_nodes.push_back(Node{m_nodes[a].point, m_nodes[a].index, NONE, NONE, 0, NONE, NONE, false, false});
+  const size_t b2 = m_nodes.size();
+  m_nodes.push_back(Node{m_nodes[b].point, m_nodes[b].index, NONE, NONE, 0, NONE, NONE, false, false});
+  const size_t a_next = m_nodes[a].next;
+  const size_t b_prev = m_nodes[b].prev;
+  m_nodes[a].next = b;
+  m_nodes[b].prev = a;
+  m_nodes[a2].next = a_next;
+  m_nodes[a_next].prev = a2;
+  m_nodes[b2].next = a2;
+  m_nodes[a2].prev = b2;
+  m_nodes[b_prev].next = b2;
+  m_nodes[b2].prev = b_prev;
+  return b2;
+}
+
+/******************
+** Holes **
+*******************/
+size_t Triangulator::eliminate_holes(const std::vector<SUPoint2D>& points, const std::vector<size_t>& loop_ends, size_t outer_node) {
+  // Each hole is joined to the outer loop from its leftmost vertex, working from left to right, so that each bridge is to a loop that already includes the holes to its left.
+  m_holes.clear();
+  for (size_t loop=1; loop < loop_ends.size(); ++loop) {
+    const size_t list = linked_list(points, loop_ends[loop - 1], loop_ends[loop], false);
+    if (list == NONE) {
+      continue;
+    }
+    if (list == m_nodes[list].next) {
+      m_nodes[list].steiner = true;
+    }
+    size_t leftmost = list;
+    size_t p = list;
+    do {
+      if (m_nodes[p].point.x < m_nodes[leftmost].point.x || (m_nodes[p].point.x == m_nodes[leftmost].point.x && m_nodes[p].point.y < m_nodes[leftmost].point.y)) {
+        leftmost = p;
+      }
+      p = m_nodes[p].next;
+    } while (p != list);
+    m_holes.push_back(leftmost);
+  }
+  std::sort(m_holes.begin(), m_holes.end(), [this](size_t a, size_t b) {
+    const SUPoint2D& a_point = m_nodes[a].point;
+    const SUPoint2D& b_point = m_nodes[b].point;
+    return a_point.x < b_point.x || (a_point.x == b_point.x && a_point.y < b_point.y);
+  });
+  // Index the edges of the outer loop in about sqrt(n) bands.
+  double min_y = points[0].y;
+  double max_y = min_y;
+  for (const SUPoint2D& point : points) {
+    min_y = std::min(min_y, point.y);
+    max_y = std::max(max_y, point.y);
+  }
+  const size_t num_bands = static_cast<size_t>(std::sqrt(static_cast<double>(points.size()))) + 1;
+  for (std::vector<size_t>& entries : m_bands) {
+    entries.clear();
+  }
+  m_bands.resize(num_bands);
+  m_band_min_y = min_y;
+  m_band_scale = max_y > min_y ? static_cast<double>(num_bands) / (max_y - min_y) : 1.0;
+  size_t p = outer_node;
+  do {
+    index_edge(p);
+    p = m_nodes[p].next;
+  } while (p != outer_node);
+
+  for (size_t hole : m_holes) {
+    const size_t bridge = find_hole_bridge(hole);
+    if (bridge == NONE) {
+      continue;
+    }
+    const size_t bridge_next = m_nodes[bridge].next;
+    const size_t bridge_reverse = split_polygon(bridge, hole);
+    // The edges of the hole, and the edges either side of the bridge, are now part of the outer loop.
+    for (p = bridge; p != bridge_next; p = m_nodes[p].next) {
+      index_edge(p);
+    }
+    filter_around(bridge_reverse);
+    outer_node = filter_around(bridge);
+  }
+  m_band_scale = 0.0;
+  return outer_node;
+}
+
+
+size_t Triangulator::band(double y) const {
+  const double position = (y - m_band_min_y) * m_band_scale;
+  if (!(position > 0.0)) {
+    return 0;
+  }
+  return std::min(static_cast<size_t>(position), m_bands.size() - 1);
+}
+
+
+void Triangulator::index_edge(size_t node) {
+  const double y0 = m_nodes[node].point.y;
+  const double y1 = m_nodes[m_nodes[node].next].point.y;
+  const size_t last = band(std::max(y0, y1));
+  for (size_t i=band(std::min(y0, y1)); i <= last; ++i) {
+    m_bands[i].push_back(node);
+  }
+}
+
+
+size_t Triangulator::find_hole_bridge(size_t hole) const {
+  // Find the nearest edge crossed by a ray from the hole to the left.  The end of the edge furthest left is a candidate for the bridge, unless the ray meets a vertex.
+  const double hx = m_nodes[hole].point.x;
+  const double hy = m_nodes[hole].point.y;
+  double qx = -std::numeric_limits<double>::infinity();
+  size_t m = NONE;
+  for (size_t p : m_bands[band(hy)]) {
+    const Node& node = m_nodes[p];
+    if (node.removed) {
+      continue;
+    }
+    if (equals(hole, p)) {
+      return p;
+    }
+    const Node& next = m_nodes[node.next];
+    if (hy <= node.point.y && hy >= next.point.y && next.point.y != node.point.y) {
+      const double x = node.point.x + ((hy - node.point.y) * (next.point.x - node.point.x) / (next.point.y - node.point.y));
+      if (x <= hx && x > qx) {
+        qx = x;
+        m = node.point.x < next.point.x ? p : node.next;
+        if (x == hx) {
+          return m;
+        }
+      }
+    }
+  }
+  if (m == NONE) {
+    return NONE;
+  }
+  // Vertices inside the triangle between the hole, the crossing and the candidate could block the bridge.  Of these, the one at the smallest angle to the ray is visible from the hole.
+  const double mx = m_nodes[m].point.x;
+  const double my = m_nodes[m].point.y;
+  const SUPoint2D a{hy < my ? hx : qx, hy};
+  const SUPoint2D b{mx, my};
+  const SUPoint2D c{hy < my ? qx : hx, hy};
+  double tan_min = std::numeric_limits<double>::infinity();
+  const size_t last_band = band(std::max(hy, my));
+  for (size_t i=band(std::min(hy, my)); i <= last_band; ++i) {
+    for (size_t p : m_bands[i]) {
+      const SUPoint2D& point = m_nodes[p].point;
+      if (m_nodes[p].removed || !(hx >= point.x && point.x >= mx && hx != point.x) || !point_in_triangle(a, b, c, point)) {
+        continue;
+      }
+      const double tan = std::abs(hy - point.y) / (hx - point.x);
+      if (locally_inside(p, hole) && (tan < tan_min || (tan == tan_min && (point.x > m_nodes[m].point.x || (point.x == m_nodes[m].point.x && sector_contains_sector(m, p)))))) {
+        m = p;
+        tan_min = tan;
+      }
+    }
+  }
+  return m;
+}
+
+/******************
+** Ear clipping **
+*******************/
+void Triangulator::clip_ears(size_t ear, int pass) {
+  // Each pass that fails to find an ear tries harder: first removing degenerate vertices, then cutting off self-intersections, and finally splitting the loop in two along a diagonal.
+  if (ear == NONE) {
+    return;
+  }
+  if (pass == 0 && m_inv_size != 0.0) {
+    index_curve(ear);
+  }
+  size_t stop = ear;
+  while (m_nodes[ear].prev != m_nodes[ear].next) {
+    const size_t prev = m_nodes[ear].prev;
+    const size_t next = m_nodes[ear].next;
+    if (m_inv_size != 0.0 ? is_ear_hashed(ear) : is_ear(ear)) {
+      add_triangle(prev, ear, next);
+      remove_node(ear);
+      // Skipping the next vertex gives fewer thin triangles.
+      ear = m_nodes[next].next;
+      stop = ear;
+      continue;
+    }
+    ear = next;
+    if (ear == stop) {
+      if (pass == 0) {
+        clip_ears(filter_points(ear), 1);
+      }
+      else if (pass == 1) {
+        clip_ears(cure_local_intersections(filter_points(ear)), 2);
+      }
+      else {
+        split_and_clip(ear);
+      }
+      break;
+    }
+  }
+}
+
+
+bool Triangulator::is_ear(size_t ear) const {
+  const size_t a = m_nodes[ear].prev;
+  const size_t c = m_nodes[ear].next;
+  if (orient(a, ear, c) <= 0.0) {
+    return false;
+  }
+  // No reflex vertex may lie inside the ear.
+  const SUPoint2D& a_point = m_nodes[a].point;
+  const SUPoint2D& b_point = m_nodes[ear].point;
+  const SUPoint2D& c_point = m_nodes[c].point;
+  const double x0 = std::min({a_point.x, b_point.x, c_point.x});
+  const double y0 = std::min({a_point.y, b_point.y, c_point.y});
+  const double x1 = std::max({a_point.x, b_point.x, c_point.x});
+  const double y1 = std::max({a_point.y, b_point.y, c_point.y});
+  for (size_t p = m_nodes[c].next; p != a; p = m_nodes[p].next) {
+    const SUPoint2D& point = m_nodes[p].point;
+    if (point.x >= x0 && point.x <= x1 && point.y >= y0 && point.y <= y1 &&
+        point_in_triangle_except_first(a_point, b_point, c_point, point) && orient(m_nodes[p].prev, p, m_nodes[p].next) <= 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+bool Triangulator::is_ear_hashed(size_t ear) const {
+  const size_t a = m_nodes[ear].prev;
+  const size_t c = m_nodes[ear].next;
+  if (orient(a, ear, c) <= 0.0) {
+    return false;
+  }
+  const SUPoint2D& a_point = m_nodes[a].point;
+  const SUPoint2D& b_point = m_nodes[ear].point;
+  const SUPoint2D& c_point = m_nodes[c].point;
+  const double x0 = std::min({a_point.x, b_point.x, c_point.x});
+  const double y0 = std::min({a_point.y, b_point.y, c_point.y});
+  const double x1 = std::max({a_point.x, b_point.x, c_point.x});
+  const double y1 = std::max({a_point.y, b_point.y, c_point.y});
+  // Only the vertices whose z-order values lie between those of the corners of the ear's bounding box need to be tested.
+  const uint32_t min_z = z_order(x0, y0);
+  const uint32_t max_z = z_order(x1, y1);
+  auto blocks = [&](size_t p) {
+    const SUPoint2D& point = m_nodes[p].point;
+    return point.x >= x0 && point.x <= x1 && point.y >= y0 && point.y <= y1 && p != a && p != c &&
+           point_in_triangle_except_first(a_point, b_point, c_point, point) && orient(m_nodes[p].prev, p, m_nodes[p].next) <= 0.0;
+  };
+  size_t p = m_nodes[ear].prev_z;
+  size_t n = m_nodes[ear].next_z;
+  while (p != NONE && m_nodes[p].z >= min_z && n != NONE && m_nodes[n].z <= max_z) {
+    if (blocks(p)) {
+      return false;
+    }
+    p = m_nodes[p].prev_z;
+    if (blocks(n)) {
+      return false;
+    }
+    n = m_nodes[n].next_z;
+  }
+  while (p != NONE && m_nodes[p].z >= min_z) {
+    if (blocks(p)) {
+      return false;
+    }
+    p = m_nodes[p].prev_z;
+  }
+  while (n != NONE && m_nodes[n].z <= max_z) {
+    if (blocks(n)) {
+      return false;
+    }
+    n = m_nodes[n].next_z;
+  }
+  return true;
+}
+
+
+size_t Triangulator::cure_local_intersections(size_t start) {
+  // Where the edges either side of a vertex cross, the small triangle between them is cut off.
+  if (start == NONE) {
+    return start;
+  }
+  size_t p = start;
+  do {
+    const size_t a = m_nodes[p].prev;
+    const size_t b = m_nodes[m_nodes[p].next].next;
+    if (!equals(a, b) && intersects(a, p, m_nodes[p].next, b) && locally_inside(a, b) && locally_inside(b, a)) {
+      add_triangle(a, p, b);
+      const size_t next = m_nodes[p].next;
+      remove_node(p);
+      remove_node(next);
+      p = start = b;
+    }
+    p = m_nodes[p].next;
+  } while (p != start);
+  return filter_points(p);
+}
+
+
+void Triangulator::split_and_clip(size_t start) {
+  // Look for a valid diagonal that divides the loop in two, and triangulate each half separately.
+  size_t a = start;
+  do {
+    for (size_t b = m_nodes[m_nodes[a].next].next; b != m_nodes[a].prev; b = m_nodes[b].next) {
+      if (m_nodes[a].index != m_nodes[b].index && is_valid_diagonal(a, b)) {
+        size_t c = split_polygon(a, b);
+        a = filter_points(a, m_nodes[a].next);
+        c = filter_points(c, m_nodes[c].next);
+        clip_ears(a, 0);
+        clip_ears(c, 0);
+        return;
+      }
+    }
+    a = m_nodes[a].next;
+  } while (a != start);
+}
+
+
+void Triangulator::index_curve(size_t start) {
+  size_t p = start;
+  do {
+    Node& node = m_nodes[p];
+    if (node.z == 0) {
+      node.z = z_order(node.point.x, node.point.y);
+    }
+    node.prev_z = node.prev;
+    node.next_z = node.next;
+    p = node.next;
+  } while (p != start);
+  m_nodes[m_nodes[p].prev_z].next_z = NONE;
+  m_nodes[p].prev_z = NONE;
+  sort_linked(p);
+}
+
+
+void Triangulator::sort_linked(size_t list) {
+  // A bottom-up merge sort of the z-order list (Simon Tatham's linked list merge sort).
+  size_t in_size = 1;
+  size_t num_merges;
+  do {
+    size_t p = list;
+    size_t tail = NONE;
+    list = NONE;
+    num_merges = 0;
+    while (p != NONE) {
+      ++num_merges;
+      size_t q = p;
+      size_t p_size = 0;
+      for (size_t i=0; i < in_size; ++i) {
+        ++p_size;
+        q = m_nodes[q].next_z;
+        if (q == NONE) {
+          break;
+        }
+      }
+      size_t q_size = in_size;
+      while (p_size > 0 || (q_size > 0 && q != NONE)) {
+        size_t e;
+        if (p_size != 0 && (q_size == 0 || q == NONE || m_nodes[p].z <= m_nodes[q].z)) {
+          e = p;
+          p = m_nodes[p].next_z;
+          --p_size;
+        }
+        else {
+          e = q;
+          q = m_nodes[q].next_z;
+          --q_size;
+        }
+        if (tail != NONE) {
+          m_nodes[tail].next_z = e;
+        }
+        else {
+          list = e;
+        }
+        m_nodes[e].prev_z = tail;
+        tail = e;
+      }
+      p = q;
+    }
+    m_nodes[tail].next_z = NONE;
+    in_size *= 2;
+  } while (num_merges > 1);
+}
+
+
+uint32_t Triangulator::z_order(double x, double y) const {
+  // Interleaves the bits of the coordinates, scaled to 15 bits.
+  uint32_t ix = static_cast<uint32_t>((x - m_min_x) * m_inv_size);
+  uint32_t iy = static_cast<uint32_t>((y - m_min_y) * m_inv_size);
+  ix = (ix | (ix << 8)) & 0x00FF00FF;
+  ix = (ix | (ix << 4)) & 0x0F0F0F0F;
+  ix = (ix | (ix << 2)) & 0x33333333;
+  ix = (ix | (ix << 1)) & 0x55555555;
+  iy = (iy | (iy << 8)) & 0x00FF00FF;
+  iy = (iy | (iy << 4)) & 0x0F0F0F0F;
+  iy = (iy | (iy << 2)) & 0x33333333;
+  iy = (iy | (iy << 1)) & 0x55555555;
+  return ix | (iy << 1);
+}
+
+
+void Triangulator::add_triangle(size_t a, size_t b, size_t c) {
+  m_triangles->push_back(m_nodes[a].index);
+  m_triangles->push_back(m_nodes[b].index);
+  m_triangles->push_back(m_nodes[c].index);
+}
+
+/******************
+** Predicates **
+*******************/
+double Triangulator::orient(size_t p, size_t q, size_t r) const {
+  return Predicates::orient2d(m_nodes[p].point, m_nodes[q].point, m_nodes[r].point);
+}
+
+
+bool Triangulator::equals(size_t a, size_t b) const {
+  return m_nodes[a].point.x == m_nodes[b].point.x && m_nodes[a].point.y == m_nodes[b].point.y;
+}
+
+
+bool Triangulator::intersects(size_t p1, size_t q1, size_t p2, size_t q2) const {
+  const int o1 = sign(orient(p1, q1, p2));
+  const int o2 = sign(orient(p1, q1, q2));
+  const int o3 = sign(orient(p2, q2, p1));
+  const int o4 = sign(orient(p2, q2, q1));
+  if (o1 != o2 && o3 != o4) {
+    return true;
+  }
+  return (o1 == 0 && on_segment(m_nodes[p1].point, m_nodes[p2].point, m_nodes[q1].point)) ||
+         (o2 == 0 && on_segment(m_nodes[p1].point, m_nodes[q2].point, m_nodes[q1].point)) ||
+         (o3 == 0 && on_segment(m_nodes[p2].point, m_nodes[p1].point, m_nodes[q2].point)) ||
+         (o4 == 0 && on_segment(m_nodes[p2].point, m_nodes[q1].point, m_nodes[q2].point));
+}
+
+
+bool Triangulator::intersects_polygon(size_t a, size_t b) const {
+  const size_t a_index = m_nodes[a].index;
+  const size_t b_index = m_nodes[b].index;
+  size_t p = a;
+  do {
+    const size_t next = m_nodes[p].next;
+    if (m_nodes[p].index != a_index && m_nodes[next].index != a_index && m_nodes[p].index != b_index && m_nodes[next].index != b_index &&
+        intersects(p, next, a, b)) {
+      return true;
+    }
+    p = next;
+  } while (p != a);
+  return false;
+}
+
+
+bool Triangulator::locally_inside(size_t a, size_t b) const {
+  // Whether the diagonal ab leaves a into the inside of the polygon.
+  const size_t prev = m_nodes[a].prev;
+  const size_t next = m_nodes[a].next;
+  if (orient(prev, a, next) > 0.0) {
+    return orient(a, b, next) <= 0.0 && orient(a, prev, b) <= 0.0;
+  }
+  return orient(a, b, prev) > 0.0 || orient(a, next, b) > 0.0;
+}
+
+
+bool Triangulator::middle_inside(size_t a, size_t b) const {
+  const double px = (m_nodes[a].point.x + m_nodes[b].point.x) / 2.0;
+  const double py = (m_nodes[a].point.y + m_nodes[b].point.y) / 2.0;
+  bool inside = false;
+  size_t p = a;
+  do {
+    const SUPoint2D& point = m_nodes[p].point;
+    const SUPoint2D& next = m_nodes[m_nodes[p].next].point;
+    if (((point.y > py) != (next.y > py)) && next.y != point.y && (px < ((next.x - point.x) * (py - point.y) / (next.y - point.y)) + point.x)) {
+      inside = !inside;
+    }
+    p = m_nodes[p].next;
+  } while (p != a);
+  return inside;
+}
+
+
+bool Triangulator::is_valid_diagonal(size_t a, size_t b) const {
+  // The diagonal must not cross an edge, must lie inside the polygon, and must not create sectors that face each other.  A zero length diagonal is valid between two reflex vertices.
+  const Node& a_node = m_nodes[a];
+  const Node& b_node = m_nodes[b];
+  if (m_nodes[a_node.next].index == b_node.index || m_nodes[a_node.prev].index == b_node.index || intersects_polygon(a, b)) {
+    return false;
+  }
+  if (locally_inside(a, b) && locally_inside(b, a) && middle_inside(a, b) && (orient(a_node.prev, a, b_node.prev) != 0.0 || orient(a, b_node.prev, b) != 0.0)) {
+    return true;
+  }
+  return equals(a, b) && orient(a_node.prev, a, a_node.next) < 0.0 && orient(b_node.prev, b, b_node.next) < 0.0;
+}
+
+
+bool Triangulator::sector_contains_sector(size_t m, size_t p) const {
+  return orient(m_nodes[m].prev, m, m_nodes[p].prev) > 0.0 && orient(m_nodes[p].next, m, m_nodes[m].next) > 0.0;
+}
+
+} /* namespace CW */
@@ -0,0 +1,173 @@
+//
+//  VertexWelder.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/VertexWelder.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace CW {
+
+int64_t VertexWelder::cell_coordinate(double value) {
+  // Equivalent to std::floor(), which is a library call where SSE4.1 cannot be assumed.
+  const double scaled = (value / CELL_SIZE) + 0.5;
+  const int64_t truncated = static_cast<int64_t>(scaled);
+  return static_cast<double>(truncated) > scaled ? truncated - 1 : truncated;
+}
+
+
+size_t VertexWelder::slot(int64_t x, int64_t y, int64_t z) const {
+  // The low bits of a product only depend on the low bits of the coordinates, so the combined hash is mixed (as in splitmix64) before taking its low bits.
+  uint64_t hash = (static_cast<uint64_t>(x) * 0x9E3779B97F4A7C15ull) ^
+                  (static_cast<uint64_t>(y) * 0xC2B2AE3D27D4EB4Full) ^
+                  (static_cast<uint64_t>(z) * 0x165667B19E3779F9ull);
+  hash = (hash ^ (hash >> 31)) * 0xBF58476D1CE4E5B9ull;
+  hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+  hash ^= hash >> 31;
+  const size_t mask = m_slots.size() - 1;
+  for (size_t index = static_cast<size_t>(hash) & mask; ; index = (index + 1) & mask) {
+    const Slot& candidate = m_slots[index];
+    if (candidate.last == NOT_FOUND || (candidate.x == x && candidate.y == y && candidate.z == z)) {
+      return index;
+    }
+  }
+}
+
+
+void VertexWelder::rehash(size_t num_slots) {
+  std::vector<Slot> old_slots(num_slots, Slot{0, 0, 0, NOT_FOUND});
+  m_slots.swap(old_slots);
+  for (const Slot& old_slot : old_slots) {
+    if (old_slot.last != NOT_FOUND) {
+      m_slots[slot(old_slot.x, old_slot.y, old_slot.z)] = old_slot;
+    }
+  }
+}
+
+
+VertexWelder::VertexWelder():
+  m_num_cells(0)
+{}
+
+
+size_t VertexWelder::find(const Point3D& point) const {
+  if (!point || m_points.empty()) {
+    return NOT_FOUND;
+  }
+  // On each axis, search the point's cell, and the neighbouring cell if the point is within the tolerance of the side between them.
+  constexpr double margin = SketchUpTolerance::EPSILON / CELL_SIZE;
+  int64_t cells[3][2];
+  size_t num_cells[3];
+  const double coordinates[3] = {point.x, point.y, point.z};
+  for (size_t axis=0; axis < 3; ++axis) {
+    cells[axis][0] = cell_coordinate(coordinates[axis]);
+    const double offset = ((coordinates[axis] / CELL_SIZE) + 0.5) - static_cast<double>(cells[axis][0]);
+    num_cells[axis] = 1;
+    if (offset <= margin) {
+      cells[axis][num_cells[axis]++] = cells[axis][0] - 1;
+    }
+    else if (offset >= 1.0 - margin) {
+      cells[axis][num_cells[axis]++] = cells[axis][0] + 1;
+    }
+  }
+  size_t found = NOT_FOUND;
+  for (size_t i=0; i < num_cells[0] * num_cells[1] * num_cells[2]; ++i) {
+    const size_t x = i % num_cells[0];
+    const size_t y = (i / num_cells[0]) % num_cells[1];
+    const size_t z = i / (num_cells[0] * num_cells[1]);
+    // The points in a cell are listed from the last inserted, and the first inserted match is wanted.
+    for (size_t candidate = m_slots[slot(cells[0][x], cells[1][y], cells[2][z])].last; candidate != NOT_FOUND; candidate = m_previous[candidate]) {
+      if (candidate < found && m_points[candidate] == point) {
+        found = candidate;
+      }
+    }
+  }
+  return found == NOT_FOUND ? NOT_FOUND : m_indices[found];
+}
+
+
+void VertexWelder::insert(const Point3D& point, size_t index) {
+  if (!point) {
+    throw std::invalid_argument("CW::VertexWelder::insert(): Point3D given is null");
+  }
+  // The table is kept at most half full, so that probes stay short.
+  if ((m_num_cells + 1) * 2 > m_slots.size()) {
+    rehash(std::max<size_t>(m_slots.size() * 2, 64));
+  }
+  const int64_t x = cell_coordinate(point.x);
+  const int64_t y = cell_coordinate(point.y);
+  const int64_t z = cell_coordinate(point.z);
+  Slot& cell = m_slots[slot(x, y, z)];
+  if (cell.last == NOT_FOUND) {
+    cell = Slot{x, y, z, NOT_FOUND};
+    ++m_num_cells;
+  }
+  m_previous.push_back(cell.last);
+  cell.last = m_points.size();
+  m_points.push_back(point);
+  m_indices.push_back(index);
+}
+
+
+size_t VertexWelder::weld(const Point3D& point, size_t index) {
+  const size_t found = find(point);
+  if (found != NOT_FOUND) {
+    return found;
+  }
+  insert(point, index);
+  return index;
+}
+
+
+size_t VertexWelder::size() const {
+  return m_points.size();
+}
+
+
+void VertexWelder::reserve(size_t num_points) {
+  size_t num_slots = 64;
+  while (num_slots < num_points * 2) {
+    num_slots *= 2;
+  }
+  if (num_slots > m_slots.size()) {
+    rehash(num_slots);
+  }
+  m_points.reserve(num_points);
+  m_indices.reserve(num_points);
+  m_previous.reserve(num_points);
+}
+
+
+void VertexWelder::clear() {
+  m_slots.clear();
+  m_num_cells = 0;
+  m_points.clear();
+  m_indices.clear();
+  m_previous.clear();
+}
+
+} /* namespace CW */
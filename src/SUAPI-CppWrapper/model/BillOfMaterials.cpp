@@ -0,0 +1,350 @@
+//
+//  BillOfMaterials.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/BillOfMaterials.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <stdexcept>
+
+#include <SketchUpAPI/model/entities.h>
+#include <SketchUpAPI/model/face.h>
+
+#include "SUAPI-CppWrapper/String.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/DefinitionGraph.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* Writes a number with enough digits for areas to survive a round trip through the file.
+*/
+void write_number(std::ostream& stream, double value) {
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+  stream << buffer;
+}
+
+/**
+* Writes a CSV field, quoted if it contains a separator, a quote or a line break.
+*/
+void write_csv_field(std::ostream& stream, const std::string& field) {
+  if (field.find_first_of(",\"\r\n") == std::string::npos) {
+    stream << field;
+    return;
+  }
+  stream << '"';
+  for (char c : field) {
+    if (c == '"') {
+      stream << '"';
+    }
+    stream << c;
+  }
+  stream << '"';
+}
+
+void write_json_string(std::ostream& stream, const std::string& string) {
+  stream << '"';
+  for (char c : string) {
+    switch (c) {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      case '\r':
+        stream << "\\r";
+        break;
+      case '\t':
+        stream << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[8];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(c));
+          stream << buffer;
+        }
+        else {
+          // Names are UTF-8, which is written as it is.
+          stream << c;
+        }
+    }
+  }
+  stream << '"';
+}
+
+/**
+* Returns the names of the materials.  They are read once, rather than for each row they appear in.
+*/
+std::vector<std::string> material_names(const std::vector<Material>& materials) {
+  std::vector<std::string> names;
+  names.reserve(materials.size());
+  for (const Material& material : materials) {
+    names.push_back(material.name().std_string());
+  }
+  return names;
+}
+
+} // namespace
+
+
+BillOfMaterials::BillOfMaterials(const Model& model):
+  BillOfMaterials(model, model.definition_graph())
+{}
+
+
+BillOfMaterials::BillOfMaterials(const Model& model, const DefinitionGraph& graph) {
+  if (!model) {
+    throw std::logic_error("CW::BillOfMaterials::BillOfMaterials(): Model is null");
+  }
+  read(model, graph);
+}
+
+
+uint32_t BillOfMaterials::material_index(SUMaterialRef material) {
+  if (SUIsInvalid(material)) {
+    return NO_INDEX;
+  }
+  auto found = m_material_lookup.find(material.ptr);
+  if (found != m_material_lookup.end()) {
+    return found->second;
+  }
+  const uint32_t index = static_cast<uint32_t>(m_materials.size());
+  m_materials.push_back(Material(material));
+  m_material_lookup.emplace(material.ptr, index);
+  return index;
+}
+
+
+void BillOfMaterials::read(const Model& model, const DefinitionGraph& graph) {
+  const std::vector<uint32_t>& order = graph.topological_order();
+  const size_t size = graph.num_nodes();
+  m_rows.resize(size);
+  // The occurrences of each node pass to its children, which come after it in topological order, so each is complete before it is passed on.
+  if (size > 0) {
+    m_rows[0].num_occurrences = 1;
+  }
+  for (uint32_t node : order) {
+    const IdRange children = graph.children(node);
+    const IdRange counts = graph.instance_counts(node);
+    for (size_t i=0; i < children.size(); ++i) {
+      m_rows[children[i]].num_occurrences += m_rows[node].num_occurrences * counts[i];
+      m_rows[children[i]].num_placements += counts[i];
+    }
+  }
+  // The area of the current row under each material, with the materials found in it.  The area of unpainted faces is kept separately.
+  std::vector<double> material_areas;
+  std::vector<uint32_t> row_materials;
+  m_material_area_starts.reserve(size + 1);
+  m_material_area_starts.push_back(0);
+  for (uint32_t node=0; node < size; ++node) {
+    Row& row = m_rows[node];
+    Entities entities;
+    if (node == 0) {
+      row.definition = SU_INVALID;
+      entities = model.entities();
+    }
+    else {
+      const ComponentDefinition definition = graph.definition(node);
+      row.definition = definition.ref();
+      row.name = definition.name().std_string();
+      entities = definition.entities();
+    }
+    row.num_faces = graph.num_faces(node);
+    SUResult res = SUEntitiesGetNumEdges(entities, false, &row.num_edges);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    double unpainted_area = 0.0;
+    bool has_unpainted = false;
+    for (const Face& face : entities.face_range()) {
+      size_t num_vertices = 0;
+      size_t num_inner_loops = 0;
+      double area = 0.0;
+      res = SUFaceGetNumVertices(face.ref(), &num_vertices);
+      assert(res == SU_ERROR_NONE);
+      res = SUFaceGetNumInnerLoops(face.ref(), &num_inner_loops);
+      assert(res == SU_ERROR_NONE);
+      res = SUFaceGetArea(face.ref(), &area);
+      assert(res == SU_ERROR_NONE);
+      if (num_vertices >= 3) {
+        row.num_triangles += num_vertices + (2 * num_inner_loops) - 2;
+      }
+      row.area += area;
+      SUMaterialRef material = SU_INVALID;
+      res = SUFaceGetFrontMaterial(face.ref(), &material);
+      if (res == SU_ERROR_NO_DATA) {
+        material = SU_INVALID;
+      }
+      assert(res == SU_ERROR_NONE || res == SU_ERROR_NO_DATA);
+      const uint32_t index = material_index(material);
+      if (index == NO_INDEX) {
+        unpainted_area += area;
+        has_unpainted = true;
+        continue;
+      }
+      if (material_areas.size() <= index) {
+        material_areas.resize(index + 1, -1.0);
+      }
+      if (material_areas[index] < 0.0) {
+        material_areas[index] = 0.0;
+        row_materials.push_back(index);
+      }
+      material_areas[index] += area;
+    }
+    if (has_unpainted) {
+      m_material_areas.push_back(MaterialArea{NO_INDEX, unpainted_area});
+    }
+    for (uint32_t index : row_materials) {
+      m_material_areas.push_back(MaterialArea{index, material_areas[index]});
+      material_areas[index] = -1.0;
+    }
+    row_materials.clear();
+    m_material_area_starts.push_back(static_cast<uint32_t>(m_material_areas.size()));
+  }
+}
+
+
+size_t BillOfMaterials::size() const {
+  return m_rows.size();
+}
+
+
+const BillOfMaterials::Row& BillOfMaterials::operator[](size_t index) const {
+  return m_rows.at(index);
+}
+
+
+const std::vector<BillOfMaterials::Row>& BillOfMaterials::rows() const {
+  return m_rows;
+}
+
+
+const std::vector<Material>& BillOfMaterials::materials() const {
+  return m_materials;
+}
+
+
+std::vector<BillOfMaterials::MaterialArea> BillOfMaterials::material_areas(size_t index) const {
+  if (index >= m_rows.size()) {
+    throw std::out_of_range("CW::BillOfMaterials::material_areas(): index is out of range");
+  }
+  return std::vector<MaterialArea>(m_material_areas.begin() + m_material_area_starts[index], m_material_areas.begin() + m_material_area_starts[index + 1]);
+}
+
+
+BillOfMaterials::Row BillOfMaterials::totals() const {
+  Row total{SU_INVALID, "Total", 1, 0, 0, 0, 0, 0.0};
+  for (const Row& row : m_rows) {
+    total.num_placements += row.num_placements;
+    total.num_faces += row.effective_faces();
+    total.num_edges += row.effective_edges();
+    total.num_triangles += row.effective_triangles();
+    total.area += row.effective_area();
+  }
+  return total;
+}
+
+
+void BillOfMaterials::write_csv(std::ostream& stream) const {
+  stream << "definition,occurrences,placements,faces,edges,triangles,area,effective_faces,effective_edges,effective_triangles,effective_area\n";
+  for (const Row& row : m_rows) {
+    write_csv_field(stream, row.name);
+    stream << ',' << row.num_occurrences << ',' << row.num_placements << ',' << row.num_faces << ',' << row.num_edges << ',' << row.num_triangles << ',';
+    write_number(stream, row.area);
+    stream << ',' << row.effective_faces() << ',' << row.effective_edges() << ',' << row.effective_triangles() << ',';
+    write_number(stream, row.effective_area());
+    stream << '\n';
+  }
+}
+
+
+void BillOfMaterials::write_material_csv(std::ostream& stream) const {
+  const std::vector<std::string> names = material_names(m_materials);
+  stream << "definition,material,area,effective_area\n";
+  for (size_t r=0; r < m_rows.size(); ++r) {
+    const Row& row = m_rows[r];
+    for (uint32_t i=m_material_area_starts[r]; i < m_material_area_starts[r + 1]; ++i) {
+      const MaterialArea& material_area = m_material_areas[i];
+      write_csv_field(stream, row.name);
+      stream << ',';
+      write_csv_field(stream, material_area.material == NO_INDEX ? std::string() : names[material_area.material]);
+      stream << ',';
+      write_number(stream, material_area.area);
+      stream << ',';
+      write_number(stream, material_area.area * static_cast<double>(row.num_occurrences));
+      stream << '\n';
+    }
+  }
+}
+
+
+void BillOfMaterials::write_json(std::ostream& stream) const {
+  const std::vector<std::string> names = material_names(m_materials);
+  stream << '[';
+  for (size_t r=0; r < m_rows.size(); ++r) {
+    const Row& row = m_rows[r];
+    stream << (r == 0 ? "\n" : ",\n") << "{\"definition\":";
+    write_json_string(stream, row.name);
+    stream << ",\"occurrences\":" << row.num_occurrences << ",\"placements\":" << row.num_placements;
+    stream << ",\"faces\":" << row.num_faces << ",\"edges\":" << row.num_edges << ",\"triangles\":" << row.num_triangles << ",\"area\":";
+    write_number(stream, row.area);
+    stream << ",\"effective_faces\":" << row.effective_faces() << ",\"effective_edges\":" << row.effective_edges() << ",\"effective_triangles\":" << row.effective_triangles() << ",\"effective_area\":";
+    write_number(stream, row.effective_area());
+    stream << ",\"materials\":[";
+    for (uint32_t i=m_material_area_starts[r]; i < m_material_area_starts[r + 1]; ++i) {
+      const MaterialArea& material_area = m_material_areas[i];
+      stream << (i == m_material_area_starts[r] ? "" : ",") << "{\"material\":";
+      if (material_area.material == NO_INDEX) {
+        stream << "null";
+      }
+      else {
+        write_json_string(stream, names[material_area.material]);
+      }
+      stream << ",\"area\":";
+      write_number(stream, material_area.area);
+      stream << ",\"effective_area\":";
+      write_number(stream, material_area.area * static_cast<double>(row.num_occurrences));
+      stream << '}';
+    }
+    stream << "]}";
+  }
+  stream << "\n]\n";
+}
+
+} /* namespace CW */
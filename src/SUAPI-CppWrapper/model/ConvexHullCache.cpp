@@ -0,0 +1,240 @@
+//
+//  ConvexHullCache.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/ConvexHullCache.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <unordered_set>
+
+#include <SketchUpAPI/model/edge.h>
+#include <SketchUpAPI/model/vertex.h>
+
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/Triangulator.hpp"
+#include "SUAPI-CppWrapper/VertexWelder.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+
+namespace CW {
+
+ConvexHullCache::ConvexHullCache(const ConvexHull::DecompositionOptions& options):
+  m_options(options)
+{}
+
+
+ConvexHullCache::Entry& ConvexHullCache::entry(const ComponentDefinition& definition) {
+  if (!definition) {
+    throw std::logic_error("CW::ConvexHullCache::entry(): ComponentDefinition is null");
+  }
+  return m_entries[definition.ref().ptr];
+}
+
+
+const ConvexHullCache::Entry& ConvexHullCache::mesh(const ComponentDefinition& definition) {
+  Entry& found = entry(definition);
+  if (!found.has_mesh) {
+    std::vector<Point3D> vertices;
+    std::vector<size_t> indices;
+    add_mesh(definition.entities(), vertices, indices);
+    found.mesh_vertices = std::move(vertices);
+    found.mesh_indices = std::move(indices);
+    found.has_mesh = true;
+  }
+  return found;
+}
+
+
+void ConvexHullCache::add_hull_points(const Entities& entities, std::vector<Point3D>& points) {
+  // The C API is called directly, as in VertexTree, as this is done for every vertex of the definition.
+  std::unordered_set<const void*> seen;
+  for (const Edge& edge : entities.edge_range(false)) {
+    SUVertexRef ends[2] = {SU_INVALID, SU_INVALID};
+    SUResult res = SUEdgeGetStartVertex(edge.ref(), &ends[0]);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    res = SUEdgeGetEndVertex(edge.ref(), &ends[1]);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    for (SUVertexRef vertex : ends) {
+      if (!seen.insert(vertex.ptr).second) {
+        continue;
+      }
+      SUPoint3D position;
+      res = SUVertexGetPosition(vertex, &position);
+      assert(res == SU_ERROR_NONE); _unused(res);
+      points.push_back(Point3D(position));
+    }
+  }
+  auto add_instance = [&](const auto& instance) {
+    std::vector<Point3D> hull_points = hull(instance.definition()).vertices();
+    instance.transformation().transform_points(hull_points);
+    points.insert(points.end(), hull_points.begin(), hull_points.end());
+  };
+  for (const Group& group : entities.group_range()) {
+    add_instance(group);
+  }
+  for (const ComponentInstance& instance : entities.instance_range()) {
+    add_instance(instance);
+  }
+}
+
+
+void ConvexHullCache::add_mesh(const Entities& entities, std::vector<Point3D>& vertices, std::vector<size_t>& indices) {
+  // The vertices of faces that share them are welded, so that the mesh is closed where the faces are.
+  VertexWelder welder;
+  Triangulator triangulator;
+  std::vector<size_t> triangle_indices;
+  std::vector<size_t> polygon_vertices;
+  for (const Face& face : entities.face_range()) {
+    const Triangulator::Polygon polygon(face);
+    polygon_vertices.clear();
+    for (const Point3D& point : polygon.vertices) {
+      const size_t vertex = welder.weld(point, vertices.size());
+      if (vertex == vertices.size()) {
+        vertices.push_back(point);
+      }
+      polygon_vertices.push_back(vertex);
+    }
+    triangle_indices.clear();
+    triangulator.triangulate(polygon, triangle_indices);
+    for (size_t index : triangle_indices) {
+      indices.push_back(polygon_vertices[index]);
+    }
+  }
+  auto add_instance = [&](const auto& instance) {
+    const Entry& nested = mesh(instance.definition());
+    std::vector<Point3D> nested_vertices = nested.mesh_vertices;
+    instance.transformation().transform_points(nested_vertices);
+    const size_t first = vertices.size();
+    vertices.insert(vertices.end(), nested_vertices.begin(), nested_vertices.end());
+    for (size_t index : nested.mesh_indices) {
+      indices.push_back(first + index);
+    }
+  };
+  for (const Group& group : entities.group_range()) {
+    add_instance(group);
+  }
+  for (const ComponentInstance& instance : entities.instance_range()) {
+    add_instance(instance);
+  }
+}
+
+
+const ConvexHull& ConvexHullCache::hull(const ComponentDefinition& definition) {
+  Entry& found = entry(definition);
+  if (!found.has_hull) {
+    std::vector<Point3D> points;
+    add_hull_points(definition.entities(), points);
+    found.hull = ConvexHull(points);
+    found.has_hull = true;
+  }
+  return found.hull;
+}
+
+
+const OrientedBoundingBox& ConvexHullCache::oriented_bounding_box(const ComponentDefinition& definition) {
+  Entry& found = entry(definition);
+  if (!found.has_box) {
+    found.box = hull(definition).oriented_bounding_box();
+    found.has_box = true;
+  }
+  return found.box;
+}
+
+
+const std::vector<ConvexHull>& ConvexHullCache::decomposition(const ComponentDefinition& definition) {
+  Entry& found = entry(definition);
+  if (!found.has_decomposition) {
+    // Entries are not moved when others are added, so found is still valid after the meshes of nested definitions are built.
+    mesh(definition);
+    found.decomposition = ConvexHull::decompose(found.mesh_vertices, found.mesh_indices, m_options);
+    found.has_decomposition = true;
+  }
+  return found.decomposition;
+}
+
+
+ConvexHull ConvexHullCache::hull(const ComponentInstance& instance) {
+  if (!instance) {
+    throw std::logic_error("CW::ConvexHullCache::hull(): ComponentInstance is null");
+  }
+  return hull(instance.definition()).transformed(instance.transformation());
+}
+
+
+OrientedBoundingBox ConvexHullCache::oriented_bounding_box(const ComponentInstance& instance) {
+  if (!instance) {
+    throw std::logic_error("CW::ConvexHullCache::oriented_bounding_box(): ComponentInstance is null");
+  }
+  return hull(instance).oriented_bounding_box();
+}
+
+
+std::vector<ConvexHull> ConvexHullCache::decomposition(const ComponentInstance& instance) {
+  if (!instance) {
+    throw std::logic_error("CW::ConvexHullCache::decomposition(): ComponentInstance is null");
+  }
+  const Transformation transformation = instance.transformation();
+  std::vector<ConvexHull> hulls;
+  for (const ConvexHull& part : decomposition(instance.definition())) {
+    hulls.push_back(part.transformed(transformation));
+  }
+  return hulls;
+}
+
+
+ConvexHull ConvexHullCache::hull(const Entities& entities) {
+  std::vector<Point3D> points;
+  add_hull_points(entities, points);
+  return ConvexHull(points);
+}
+
+
+std::vector<ConvexHull> ConvexHullCache::decomposition(const Entities& entities) {
+  std::vector<Point3D> vertices;
+  std::vector<size_t> indices;
+  add_mesh(entities, vertices, indices);
+  return ConvexHull::decompose(vertices, indices, m_options);
+}
+
+
+size_t ConvexHullCache::size() const {
+  return m_entries.size();
+}
+
+
+void ConvexHullCache::clear() {
+  m_entries.clear();
+}
+
+} /* namespace CW */
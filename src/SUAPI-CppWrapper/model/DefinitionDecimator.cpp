@@ -0,0 +1,211 @@
+//
+//  DefinitionDecimator.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/model/DefinitionDecimator.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "SUAPI-CppWrapper/String.hpp"
+#include "SUAPI-CppWrapper/Triangulator.hpp"
+#include "SUAPI-CppWrapper/VertexWelder.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/GeometryInput.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/LoopInput.hpp"
+#include "SUAPI-CppWrapper/model/MaterialInput.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+
+namespace CW {
+
+namespace {
+
+uint64_t edge_key(size_t a, size_t b) {
+  return (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint64_t>(std::max(a, b));
+}
+
+} // namespace
+
+
+DefinitionDecimator::DefinitionDecimator(const ComponentDefinition& definition) {
+  if (!definition) {
+    throw std::logic_error("CW::DefinitionDecimator::DefinitionDecimator(): ComponentDefinition is null");
+  }
+  VertexWelder welder;
+  Triangulator triangulator;
+  std::unordered_map<uint64_t, size_t> edge_indices;
+  std::vector<size_t> triangle_indices;
+  std::vector<size_t> vertices;
+  for (const Face& face : definition.entities().face_range()) {
+    const FaceStyle style{face.material(), face.back_material(), face.layer()};
+    auto found = std::find_if(m_styles.begin(), m_styles.end(), [&style](const FaceStyle& other) {
+      return other.front_material == style.front_material && other.back_material == style.back_material && other.layer == style.layer;
+    });
+    const size_t attribute = static_cast<size_t>(found - m_styles.begin());
+    if (found == m_styles.end()) {
+      m_styles.push_back(style);
+    }
+    // The vertices of faces that share them are welded, so that the mesh is connected across the edges between faces.
+    const Triangulator::Polygon polygon(face);
+    vertices.clear();
+    for (const Point3D& point : polygon.vertices) {
+      const size_t vertex = welder.weld(point, m_mesh.vertices.size());
+      if (vertex == m_mesh.vertices.size()) {
+        m_mesh.vertices.push_back(point);
+      }
+      vertices.push_back(vertex);
+    }
+    triangle_indices.clear();
+    triangulator.triangulate(polygon, triangle_indices);
+    for (size_t index : triangle_indices) {
+      m_mesh.indices.push_back(vertices[index]);
+    }
+    m_mesh.attributes.insert(m_mesh.attributes.end(), triangle_indices.size() / 3, attribute);
+    // The edges of each loop are in the same order as its points.
+    std::vector<Loop> loops = face.inner_loops();
+    loops.insert(loops.begin(), face.outer_loop());
+    size_t loop_start = 0;
+    for (size_t i=0; i < loops.size(); ++i) {
+      const std::vector<Edge> edges = loops[i].edges();
+      const size_t loop_end = polygon.loop_ends[i];
+      for (size_t j=0; j < edges.size(); ++j) {
+        const size_t start = vertices[loop_start + j];
+        const size_t end = vertices[loop_start + j + 1 < loop_end ? loop_start + j + 1 : loop_start];
+        if (start == end || !edge_indices.emplace(edge_key(start, end), m_mesh.edges.size()).second) {
+          continue;
+        }
+        MeshDecimator::Edge edge{start, end};
+        edge.hidden = edges[j].hidden();
+        edge.soft = edges[j].soft();
+        edge.smooth = edges[j].smooth();
+        m_mesh.edges.push_back(edge);
+      }
+      loop_start = loop_end;
+    }
+  }
+}
+
+
+const MeshDecimator::Mesh& DefinitionDecimator::mesh() const {
+  return m_mesh;
+}
+
+
+const std::vector<DefinitionDecimator::FaceStyle>& DefinitionDecimator::styles() const {
+  return m_styles;
+}
+
+
+std::vector<MeshDecimator::Mesh> DefinitionDecimator::decimate(const std::vector<MeshDecimator::Target>& targets) const {
+  MeshDecimator decimator;
+  return decimator.decimate(m_mesh, targets);
+}
+
+
+std::vector<std::vector<MeshDecimator::Mesh>> DefinitionDecimator::decimate(const std::vector<DefinitionDecimator>& decimators, const std::vector<MeshDecimator::Target>& targets, size_t num_threads) {
+  std::vector<MeshDecimator::Mesh> meshes;
+  meshes.reserve(decimators.size());
+  for (const DefinitionDecimator& decimator : decimators) {
+    meshes.push_back(decimator.m_mesh);
+  }
+  return MeshDecimator::decimate(meshes, targets, num_threads);
+}
+
+
+void DefinitionDecimator::add_to(const MeshDecimator::Mesh& mesh, GeometryInput& geom_input) const {
+  std::unordered_map<uint64_t, const MeshDecimator::Edge*> edges;
+  edges.reserve(mesh.edges.size());
+  for (const MeshDecimator::Edge& edge : mesh.edges) {
+    edges.emplace(edge_key(edge.start, edge.end), &edge);
+  }
+  std::vector<size_t> vertex_indices;
+  vertex_indices.reserve(mesh.vertices.size());
+  for (const Point3D& point : mesh.vertices) {
+    vertex_indices.push_back(geom_input.add_vertex(point));
+  }
+  for (size_t t=0; t < mesh.num_triangles(); ++t) {
+    const size_t attribute = mesh.attributes.empty() ? 0 : mesh.attributes[t];
+    if (attribute >= m_styles.size()) {
+      throw std::invalid_argument("CW::DefinitionDecimator::add_to(): mesh has an attribute with no style");
+    }
+    LoopInput loop_input;
+    for (size_t k=0; k < 3; ++k) {
+      loop_input.add_vertex_index(vertex_indices[mesh.indices[(t * 3) + k]]);
+    }
+    for (size_t k=0; k < 3; ++k) {
+      auto found = edges.find(edge_key(mesh.indices[(t * 3) + k], mesh.indices[(t * 3) + ((k + 1) % 3)]));
+      if (found == edges.end()) {
+        loop_input.set_edge_soft(k, true);
+        loop_input.set_edge_smooth(k, true);
+        continue;
+      }
+      loop_input.set_edge_hidden(k, found->second->hidden);
+      loop_input.set_edge_soft(k, found->second->soft);
+      loop_input.set_edge_smooth(k, found->second->smooth);
+    }
+    const size_t face_index = geom_input.add_face(loop_input);
+    const FaceStyle& style = m_styles[attribute];
+    if (!!style.layer) {
+      geom_input.face_layer(face_index, style.layer);
+    }
+    #if SketchUpAPI_VERSION_MAJOR < 2021
+    if (!!style.front_material) {
+      MaterialInput material_input(style.front_material);
+      geom_input.face_front_material(face_index, material_input);
+    }
+    if (!!style.back_material) {
+      MaterialInput material_input(style.back_material);
+      geom_input.face_back_material(face_index, material_input);
+    }
+    #else
+    if (!!style.front_material) {
+      geom_input.face_front_material_position(face_index, MaterialPositionInput(style.front_material));
+    }
+    if (!!style.back_material) {
+      geom_input.face_back_material_position(face_index, MaterialPositionInput(style.back_material));
+    }
+    #endif
+  }
+}
+
+
+ComponentDefinition DefinitionDecimator::create_definition(const MeshDecimator::Mesh& mesh, Model& model, const String& name) const {
+  ComponentDefinition definition;
+  model.add_definition(definition);
+  definition.name(name);
+  GeometryInput geom_input;
+  add_to(mesh, geom_input);
+  Entities entities = definition.entities();
+  entities.fill(geom_input);
+  return definition;
+}
+
+} /* namespace CW */
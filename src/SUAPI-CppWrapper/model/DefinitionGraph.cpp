@@ -0,0 +1,262 @@
+//
+//  DefinitionGraph.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/DefinitionGraph.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include <SketchUpAPI/model/entities.h>
+
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+
+namespace CW {
+
+DefinitionGraph::DefinitionGraph():
+  m_child_starts{0},
+  m_parent_starts{0}
+{}
+
+
+DefinitionGraph::DefinitionGraph(const Model& model) {
+  if (!model) {
+    throw std::logic_error("CW::DefinitionGraph::DefinitionGraph(): Model is null");
+  }
+  read(model);
+  sort();
+}
+
+
+uint32_t DefinitionGraph::add_node(SUComponentDefinitionRef definition) {
+  const uint32_t node = static_cast<uint32_t>(m_definitions.size());
+  m_definitions.push_back(definition);
+  if (SUIsValid(definition)) {
+    m_node_ids.emplace(definition.ptr, node);
+  }
+  return node;
+}
+
+
+void DefinitionGraph::read(const Model& model) {
+  add_node(SU_INVALID);
+  for (const ComponentDefinition& definition : model.definitions()) {
+    add_node(definition.ref());
+  }
+  for (const ComponentDefinition& definition : model.group_definitions()) {
+    add_node(definition.ref());
+  }
+  // The position in m_children of each child of the node being read, so that the instances of a child are counted on one edge.
+  std::vector<uint32_t> child_positions;
+  m_child_starts.push_back(0);
+  m_num_faces.reserve(m_definitions.size());
+  // Definitions missing from the model's lists are added when they are found, so m_definitions may grow.
+  for (uint32_t node=0; node < m_definitions.size(); ++node) {
+    Entities entities = node == 0 ? model.entities() : ComponentDefinition(m_definitions[node]).entities();
+    size_t num_faces = 0;
+    SUResult res = SUEntitiesGetNumFaces(entities, &num_faces);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    m_num_faces.push_back(num_faces);
+    const size_t first_child = m_children.size();
+    auto add_instance = [&](const ComponentInstance& instance) {
+      const SUComponentDefinitionRef definition = instance.definition().ref();
+      auto found = m_node_ids.find(definition.ptr);
+      const uint32_t child = found == m_node_ids.end() ? add_node(definition) : found->second;
+      if (child_positions.size() < m_definitions.size()) {
+        child_positions.resize(m_definitions.size(), NO_NODE);
+      }
+      if (child_positions[child] == NO_NODE) {
+        child_positions[child] = static_cast<uint32_t>(m_children.size());
+        m_children.push_back(child);
+        m_instance_counts.push_back(0);
+      }
+      ++m_instance_counts[child_positions[child]];
+    };
+    for (const Group& group : entities.group_range()) {
+      add_instance(group);
+    }
+    for (const ComponentInstance& instance : entities.instance_range()) {
+      add_instance(instance);
+    }
+    for (size_t i=first_child; i < m_children.size(); ++i) {
+      child_positions[m_children[i]] = NO_NODE;
+    }
+    m_child_starts.push_back(static_cast<uint32_t>(m_children.size()));
+  }
+  // The parents are the edges reversed, counted and then placed.
+  const size_t size = m_definitions.size();
+  m_parent_starts.assign(size + 1, 0);
+  for (uint32_t child : m_children) {
+    ++m_parent_starts[child + 1];
+  }
+  for (size_t i=0; i < size; ++i) {
+    m_parent_starts[i + 1] += m_parent_starts[i];
+  }
+  m_parents.resize(m_children.size());
+  std::vector<uint32_t> parent_ends(m_parent_starts.begin(), m_parent_starts.end() - 1);
+  for (uint32_t node=0; node < size; ++node) {
+    for (uint32_t child : children(node)) {
+      m_parents[parent_ends[child]++] = node;
+    }
+  }
+}
+
+
+void DefinitionGraph::sort() {
+  // Kahn's algorithm: a node is placed once all of its parents have been.  The nodes on a cycle, and below one, are never placed.
+  const size_t size = num_nodes();
+  std::vector<uint32_t> num_unplaced_parents(size);
+  m_order.clear();
+  m_order.reserve(size);
+  for (uint32_t node=0; node < size; ++node) {
+    num_unplaced_parents[node] = m_parent_starts[node + 1] - m_parent_starts[node];
+    if (num_unplaced_parents[node] == 0) {
+      m_order.push_back(node);
+    }
+  }
+  for (size_t i=0; i < m_order.size(); ++i) {
+    for (uint32_t child : children(m_order[i])) {
+      if (--num_unplaced_parents[child] == 0) {
+        m_order.push_back(child);
+      }
+    }
+  }
+  m_heaviest_leaves.clear();
+  for (uint32_t node=0; node < size; ++node) {
+    if (m_child_starts[node + 1] == m_child_starts[node]) {
+      m_heaviest_leaves.push_back(node);
+    }
+  }
+  std::stable_sort(m_heaviest_leaves.begin(), m_heaviest_leaves.end(), [&](uint32_t a, uint32_t b) {
+    return m_num_faces[a] > m_num_faces[b];
+  });
+}
+
+
+size_t DefinitionGraph::num_nodes() const {
+  return m_definitions.size();
+}
+
+
+uint32_t DefinitionGraph::node(const ComponentDefinition& definition) const {
+  auto found = m_node_ids.find(definition.ref().ptr);
+  return found == m_node_ids.end() ? NO_NODE : found->second;
+}
+
+
+ComponentDefinition DefinitionGraph::definition(uint32_t node) const {
+  const SUComponentDefinitionRef definition = m_definitions.at(node);
+  if (SUIsInvalid(definition)) {
+    return ComponentDefinition();
+  }
+  return ComponentDefinition(definition);
+}
+
+
+size_t DefinitionGraph::num_faces(uint32_t node) const {
+  return m_num_faces.at(node);
+}
+
+
+IdRange DefinitionGraph::children(uint32_t node) const {
+  return IdRange(m_children.data() + m_child_starts[node], m_children.data() + m_child_starts[node + 1]);
+}
+
+
+IdRange DefinitionGraph::instance_counts(uint32_t node) const {
+  return IdRange(m_instance_counts.data() + m_child_starts[node], m_instance_counts.data() + m_child_starts[node + 1]);
+}
+
+
+IdRange DefinitionGraph::parents(uint32_t node) const {
+  return IdRange(m_parents.data() + m_parent_starts[node], m_parents.data() + m_parent_starts[node + 1]);
+}
+
+
+bool DefinitionGraph::is_acyclic() const {
+  return m_order.size() == num_nodes();
+}
+
+
+std::vector<uint32_t> DefinitionGraph::find_cycle() const {
+  std::vector<uint32_t> cycle;
+  if (is_acyclic()) {
+    return cycle;
+  }
+  // A depth-first search, without recursion, for a child that is still on the stack.
+  enum State : uint8_t { Unvisited, OnStack, Done };
+  std::vector<uint8_t> states(num_nodes(), Unvisited);
+  std::vector<std::pair<uint32_t, uint32_t>> stack; // each node, and the position of its next child
+  for (uint32_t root=0; root < num_nodes(); ++root) {
+    if (states[root] != Unvisited) {
+      continue;
+    }
+    states[root] = OnStack;
+    stack.emplace_back(root, m_child_starts[root]);
+    while (!stack.empty()) {
+      const uint32_t node = stack.back().first;
+      if (stack.back().second == m_child_starts[node + 1]) {
+        states[node] = Done;
+        stack.pop_back();
+        continue;
+      }
+      const uint32_t child = m_children[stack.back().second++];
+      if (states[child] == OnStack) {
+        auto start = std::find_if(stack.begin(), stack.end(), [&](const std::pair<uint32_t, uint32_t>& entry) {
+          return entry.first == child;
+        });
+        for (; start != stack.end(); ++start) {
+          cycle.push_back(start->first);
+        }
+        return cycle;
+      }
+      if (states[child] == Unvisited) {
+        states[child] = OnStack;
+        stack.emplace_back(child, m_child_starts[child]);
+      }
+    }
+  }
+  return cycle;
+}
+
+
+const std::vector<uint32_t>& DefinitionGraph::topological_order() const {
+  if (!is_acyclic()) {
+    throw std::logic_error("CW::DefinitionGraph::topological_order(): the graph has a cycle");
+  }
+  return m_order;
+}
+
+} /* namespace CW */
@@ -0,0 +1,258 @@
+//
+//  DrawingElementTable.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/DrawingElementTable.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+#include "SUAPI-CppWrapper/model/Model.hpp"
+
+namespace CW {
+
+constexpr uint32_t DrawingElementTable::NO_INDEX;
+
+DrawingElementTable::DrawingElementTable(const Model& model, unsigned int columns):
+  m_columns(columns),
+  m_size(0)
+{
+  if (!model) {
+    throw std::logic_error("CW::DrawingElementTable::DrawingElementTable(): Model is null");
+  }
+  if ((m_columns & ColumnMaterial) != 0) {
+    m_materials = model.materials();
+    for (size_t i=0; i < m_materials.size(); ++i) {
+      m_material_lookup.emplace(m_materials[i].ref().ptr, static_cast<uint32_t>(i));
+    }
+  }
+  if ((m_columns & ColumnLayer) != 0) {
+    m_layers = model.layers();
+    for (size_t i=0; i < m_layers.size(); ++i) {
+      m_layer_lookup.emplace(m_layers[i].ref().ptr, static_cast<uint32_t>(i));
+    }
+  }
+}
+
+
+uint32_t DrawingElementTable::material_index(SUMaterialRef material) {
+  auto found = m_material_lookup.find(material.ptr);
+  if (found != m_material_lookup.end()) {
+    return found->second;
+  }
+  const uint32_t index = static_cast<uint32_t>(m_materials.size());
+  m_materials.push_back(Material(material));
+  m_material_lookup.emplace(material.ptr, index);
+  return index;
+}
+
+
+uint32_t DrawingElementTable::layer_index(SULayerRef layer) {
+  auto found = m_layer_lookup.find(layer.ptr);
+  if (found != m_layer_lookup.end()) {
+    return found->second;
+  }
+  const uint32_t index = static_cast<uint32_t>(m_layers.size());
+  m_layers.push_back(Layer(layer));
+  m_layer_lookup.emplace(layer.ptr, index);
+  return index;
+}
+
+
+void DrawingElementTable::check_column(Column column, const char* method) const {
+  if ((m_columns & column) == 0) {
+    throw std::logic_error(std::string("CW::DrawingElementTable::") + method + "(): column was not requested");
+  }
+}
+
+
+void DrawingElementTable::add(SUDrawingElementRef element) {
+  if (SUIsInvalid(element)) {
+    throw std::invalid_argument("CW::DrawingElementTable::add(): DrawingElement is null");
+  }
+  if ((m_columns & ColumnMaterial) != 0) {
+    SUMaterialRef material = SU_INVALID;
+    SUResult res = SUDrawingElementGetMaterial(element, &material);
+    m_material_indices.push_back(res == SU_ERROR_NONE && SUIsValid(material) ? material_index(material) : NO_INDEX);
+  }
+  if ((m_columns & ColumnLayer) != 0) {
+    SULayerRef layer = SU_INVALID;
+    SUResult res = SUDrawingElementGetLayer(element, &layer);
+    m_layer_indices.push_back(res == SU_ERROR_NONE && SUIsValid(layer) ? layer_index(layer) : NO_INDEX);
+  }
+  if ((m_columns & ColumnFlags) != 0) {
+    bool hidden = false;
+    bool casts_shadows = false;
+    bool receives_shadows = false;
+    SUResult res = SUDrawingElementGetHidden(element, &hidden);
+    assert(res == SU_ERROR_NONE);
+    res = SUDrawingElementGetCastsShadows(element, &casts_shadows);
+    assert(res == SU_ERROR_NONE);
+    res = SUDrawingElementGetReceivesShadows(element, &receives_shadows);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    m_flags.push_back(static_cast<uint8_t>((hidden ? FlagHidden : 0) | (casts_shadows ? FlagCastsShadows : 0) | (receives_shadows ? FlagReceivesShadows : 0)));
+  }
+  if ((m_columns & ColumnBounds) != 0) {
+    SUBoundingBox3D box;
+    SUResult res = SUDrawingElementGetBoundingBox(element, &box);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    m_bounds.push_back(box);
+  }
+  ++m_size;
+}
+
+
+void DrawingElementTable::reserve(size_t num_rows) {
+  if ((m_columns & ColumnMaterial) != 0) {
+    m_material_indices.reserve(num_rows);
+  }
+  if ((m_columns & ColumnLayer) != 0) {
+    m_layer_indices.reserve(num_rows);
+  }
+  if ((m_columns & ColumnFlags) != 0) {
+    m_flags.reserve(num_rows);
+  }
+  if ((m_columns & ColumnBounds) != 0) {
+    m_bounds.reserve(num_rows);
+  }
+}
+
+
+size_t DrawingElementTable::size() const {
+  return m_size;
+}
+
+
+bool DrawingElementTable::empty() const {
+  return m_size == 0;
+}
+
+
+unsigned int DrawingElementTable::columns() const {
+  return m_columns;
+}
+
+
+const std::vector<uint32_t>& DrawingElementTable::material_indices() const {
+  check_column(ColumnMaterial, "material_indices");
+  return m_material_indices;
+}
+
+
+const std::vector<uint32_t>& DrawingElementTable::layer_indices() const {
+  check_column(ColumnLayer, "layer_indices");
+  return m_layer_indices;
+}
+
+
+const std::vector<uint8_t>& DrawingElementTable::flags() const {
+  check_column(ColumnFlags, "flags");
+  return m_flags;
+}
+
+
+const std::vector<SUBoundingBox3D>& DrawingElementTable::bounds() const {
+  check_column(ColumnBounds, "bounds");
+  return m_bounds;
+}
+
+
+const std::vector<Material>& DrawingElementTable::material_dictionary() const {
+  check_column(ColumnMaterial, "material_dictionary");
+  return m_materials;
+}
+
+
+const std::vector<Layer>& DrawingElementTable::layer_dictionary() const {
+  check_column(ColumnLayer, "layer_dictionary");
+  return m_layers;
+}
+
+
+Material DrawingElementTable::material(size_t row) const {
+  const uint32_t index = material_indices().at(row);
+  if (index == NO_INDEX) {
+    return Material();
+  }
+  return m_materials[index];
+}
+
+
+Layer DrawingElementTable::layer(size_t row) const {
+  const uint32_t index = layer_indices().at(row);
+  if (index == NO_INDEX) {
+    return Layer();
+  }
+  return m_layers[index];
+}
+
+
+bool DrawingElementTable::hidden(size_t row) const {
+  return (flags().at(row) & FlagHidden) != 0;
+}
+
+
+bool DrawingElementTable::casts_shadows(size_t row) const {
+  return (flags().at(row) & FlagCastsShadows) != 0;
+}
+
+
+bool DrawingElementTable::receives_shadows(size_t row) const {
+  return (flags().at(row) & FlagReceivesShadows) != 0;
+}
+
+
+BoundingBox3D DrawingElementTable::bounds(size_t row) const {
+  return BoundingBox3D(bounds().at(row));
+}
+
+
+std::vector<size_t> DrawingElementTable::material_counts() const {
+  std::vector<size_t> counts(material_dictionary().size(), 0);
+  for (uint32_t index : m_material_indices) {
+    if (index != NO_INDEX) {
+      ++counts[index];
+    }
+  }
+  return counts;
+}
+
+
+std::vector<size_t> DrawingElementTable::layer_counts() const {
+  std::vector<size_t> counts(layer_dictionary().size(), 0);
+  for (uint32_t index : m_layer_indices) {
+    if (index != NO_INDEX) {
+      ++counts[index];
+    }
+  }
+  return counts;
+}
+
+} /* namespace CW */
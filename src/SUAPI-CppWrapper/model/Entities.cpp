@@ -54,6 +54,32 @@
 
 namespace CW {
 
+namespace {
+
+/**
+* Fetches refs from the C API into a buffer from this thread's pool (@see RefBuffers), so that the refs of large Entities objects are not allocated on each call.
+* @param get_num - called with a pointer to the count, as SUEntitiesGetNumFaces() is.
+* @param get - called with the length of the buffer, the buffer and a pointer to the count, as SUEntitiesGetFaces() is.
+*/
+template <class Ref, class GetNum, class Get>
+std::vector<Ref> fetch_refs(GetNum get_num, Get get) {
+  std::vector<Ref> refs = RefBuffers<Ref>::take();
+  size_t count = 0;
+  SUResult res = get_num(&count);
+  assert(res == SU_ERROR_NONE);
+  if (count > 0) {
+    Ref invalid = SU_INVALID;
+    refs.resize(count, invalid);
+    res = get(count, refs.data(), &count);
+    assert(res == SU_ERROR_NONE);
+    refs.resize(count);
+  }
+  _unused(res);
+  return refs;
+}
+
+} // namespace
+
 #if SketchUpAPI_VERSION_MAJOR < 2021
 Entities::Entities(SUEntitiesRef entities, const SUModelRef model):
   Entities(entities, Model(model, false))
@@ -78,25 +104,37 @@ Entities::Entities():
 {}
 #endif
 
+EntityRange<Face, SUFaceRef> Entities::face_range() const {
+  if (!SUIsValid(m_entities)) {
+    throw std::logic_error("CW::Entities::face_range(): Entities is null");
+  }
+  return EntityRange<Face, SUFaceRef>(fetch_refs<SUFaceRef>([this](size_t* count) {
+    return SUEntitiesGetNumFaces(m_entities, count);
+  },
+  [this](size_t len, SUFaceRef* refs, size_t* count) {
+    return SUEntitiesGetFaces(m_entities, len, refs, count);
+  }));
+}
+
+
 std::vector<Face> Entities::faces() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::faces(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumFaces(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<Face>(0);
+  return face_range().to_vector();
+}
+
+
+EntityRange<Edge, SUEdgeRef> Entities::edge_range(bool stray_only) const {
+  if (!SUIsValid(m_entities)) {
+    throw std::logic_error("CW::Entities::edge_range(): Entities is null");
   }
-  std::vector<SUFaceRef> face_refs(count, SU_INVALID);
-  res = SUEntitiesGetFaces(m_entities, count, face_refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<Face> faces(count);
-  std::transform(face_refs.begin(), face_refs.end(), faces.begin(),
-  [](const SUFaceRef& value) {
-    return Face(value);
-  });
-  return faces;
+  return EntityRange<Edge, SUEdgeRef>(fetch_refs<SUEdgeRef>([this, stray_only](size_t* count) {
+    return SUEntitiesGetNumEdges(m_entities, stray_only, count);
+  },
+  [this, stray_only](size_t len, SUEdgeRef* refs, size_t* count) {
+    return SUEntitiesGetEdges(m_entities, stray_only, len, refs, count);
+  }));
 }
 
 
@@ -104,21 +142,20 @@ std::vector<Edge> Entities::edges(bool stray_only) const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::edges(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumEdges(m_entities, stray_only, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<Edge>(0);
+  return edge_range(stray_only).to_vector();
+}
+
+
+EntityRange<ComponentInstance, SUComponentInstanceRef> Entities::instance_range() const {
+  if (!SUIsValid(m_entities)) {
+    throw std::logic_error("CW::Entities::instance_range(): Entities is null");
   }
-  std::vector<SUEdgeRef> edge_refs(count, SU_INVALID);
-  res = SUEntitiesGetEdges(m_entities, stray_only, count, edge_refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<Edge> edges(count);
-  std::transform(edge_refs.begin(), edge_refs.end(), edges.begin(),
-  [](const SUEdgeRef& value) {
-    return Edge(value);
-  });
-  return edges;
+  return EntityRange<ComponentInstance, SUComponentInstanceRef>(fetch_refs<SUComponentInstanceRef>([this](size_t* count) {
+    return SUEntitiesGetNumInstances(m_entities, count);
+  },
+  [this](size_t len, SUComponentInstanceRef* refs, size_t* count) {
+    return SUEntitiesGetInstances(m_entities, len, refs, count);
+  }));
 }
 
 
@@ -126,21 +163,20 @@ std::vector<ComponentInstance> Entities::instances() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::instances(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumInstances(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<ComponentInstance>{};
+  return instance_range().to_vector();
+}
+
+
+EntityRange<Group, SUGroupRef> Entities::group_range() const {
+  if (!SUIsValid(m_entities)) {
+    throw std::logic_error("CW::Entities::group_range(): Entities is null");
   }
-  std::vector<SUComponentInstanceRef> instance_refs(count, SU_INVALID);
-  res = SUEntitiesGetInstances(m_entities, count, instance_refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<ComponentInstance> instances(count);
-  std::transform(instance_refs.begin(), instance_refs.end(), instances.begin(),
-  [](const SUComponentInstanceRef& value) {
-    return ComponentInstance(value);
-  });;
-  return instances;
+  return EntityRange<Group, SUGroupRef>(fetch_refs<SUGroupRef>([this](size_t* count) {
+    return SUEntitiesGetNumGroups(m_entities, count);
+  },
+  [this](size_t len, SUGroupRef* refs, size_t* count) {
+    return SUEntitiesGetGroups(m_entities, len, refs, count);
+  }));
 }
 
 
@@ -148,21 +184,7 @@ std::vector<Group> Entities::groups() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::groups(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumGroups(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<Group>(0);
-  }
-  std::vector<SUGroupRef> group_refs(count);
-  res = SUEntitiesGetGroups(m_entities, count, &group_refs[0], &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<Group> groups;
-  groups.reserve(count);
-  for (size_t i=0; i < group_refs.size(); ++i) {
-    groups.push_back(Group(group_refs[i], true));
-  }
-  return groups;
+  return group_range().to_vector();
 }
 
 
@@ -430,21 +452,12 @@ std::vector<GuidePoint> Entities::guide_points() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::guide_points(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumGuidePoints(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<GuidePoint>(0);
-  }
-  std::vector<SUGuidePointRef> refs(count, SU_INVALID);
-  res = SUEntitiesGetGuidePoints(m_entities, count, refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<GuidePoint> points(count);
-  std::transform(refs.begin(), refs.end(), points.begin(),
-  [](const SUGuidePointRef& value) {
-    return GuidePoint(value);
-  });
-  return points;
+  return EntityRange<GuidePoint, SUGuidePointRef>(fetch_refs<SUGuidePointRef>([this](size_t* count) {
+    return SUEntitiesGetNumGuidePoints(m_entities, count);
+  },
+  [this](size_t len, SUGuidePointRef* refs, size_t* count) {
+    return SUEntitiesGetGuidePoints(m_entities, len, refs, count);
+  })).to_vector();
 }
 
 
@@ -471,21 +484,12 @@ std::vector<GuideLine> Entities::guide_lines() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::guide_lines(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumGuideLines(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<GuideLine>(0);
-  }
-  std::vector<SUGuideLineRef> refs(count, SU_INVALID);
-  res = SUEntitiesGetGuideLines(m_entities, count, refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<GuideLine> lines(count);
-  std::transform(refs.begin(), refs.end(), lines.begin(),
-  [](const SUGuideLineRef& value) {
-    return GuideLine(value);
-  });
-  return lines;
+  return EntityRange<GuideLine, SUGuideLineRef>(fetch_refs<SUGuideLineRef>([this](size_t* count) {
+    return SUEntitiesGetNumGuideLines(m_entities, count);
+  },
+  [this](size_t len, SUGuideLineRef* refs, size_t* count) {
+    return SUEntitiesGetGuideLines(m_entities, len, refs, count);
+  })).to_vector();
 }
 
 
@@ -512,21 +516,12 @@ std::vector<SectionPlane> Entities::section_planes() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::section_planes(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumSectionPlanes(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<SectionPlane>(0);
-  }
-  std::vector<SUSectionPlaneRef> refs(count, SU_INVALID);
-  res = SUEntitiesGetSectionPlanes(m_entities, count, refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<SectionPlane> planes(count);
-  std::transform(refs.begin(), refs.end(), planes.begin(),
-  [](const SUSectionPlaneRef& value) {
-    return SectionPlane(value);
-  });
-  return planes;
+  return EntityRange<SectionPlane, SUSectionPlaneRef>(fetch_refs<SUSectionPlaneRef>([this](size_t* count) {
+    return SUEntitiesGetNumSectionPlanes(m_entities, count);
+  },
+  [this](size_t len, SUSectionPlaneRef* refs, size_t* count) {
+    return SUEntitiesGetSectionPlanes(m_entities, len, refs, count);
+  })).to_vector();
 }
 
 
@@ -553,21 +548,12 @@ std::vector<Image> Entities::images() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::images(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumImages(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<Image>(0);
-  }
-  std::vector<SUImageRef> refs(count, SU_INVALID);
-  res = SUEntitiesGetImages(m_entities, count, refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<Image> images(count);
-  std::transform(refs.begin(), refs.end(), images.begin(),
-  [](const SUImageRef& value) {
-    return Image(value);
-  });
-  return images;
+  return EntityRange<Image, SUImageRef>(fetch_refs<SUImageRef>([this](size_t* count) {
+    return SUEntitiesGetNumImages(m_entities, count);
+  },
+  [this](size_t len, SUImageRef* refs, size_t* count) {
+    return SUEntitiesGetImages(m_entities, len, refs, count);
+  })).to_vector();
 }
 
 
@@ -588,21 +574,12 @@ std::vector<Text> Entities::texts() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::texts(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumTexts(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<Text>(0);
-  }
-  std::vector<SUTextRef> refs(count, SU_INVALID);
-  res = SUEntitiesGetTexts(m_entities, count, refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<Text> texts(count);
-  std::transform(refs.begin(), refs.end(), texts.begin(),
-  [](const SUTextRef& value) {
-    return Text(value);
-  });
-  return texts;
+  return EntityRange<Text, SUTextRef>(fetch_refs<SUTextRef>([this](size_t* count) {
+    return SUEntitiesGetNumTexts(m_entities, count);
+  },
+  [this](size_t len, SUTextRef* refs, size_t* count) {
+    return SUEntitiesGetTexts(m_entities, len, refs, count);
+  })).to_vector();
 }
 
 
@@ -629,21 +606,12 @@ std::vector<Dimension> Entities::dimensions() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::dimensions(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumDimensions(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<Dimension>{};
-  }
-  std::vector<SUDimensionRef> refs(count, SU_INVALID);
-  res = SUEntitiesGetDimensions(m_entities, count, refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<Dimension> dims(count);
-  std::transform(refs.begin(), refs.end(), dims.begin(),
-  [](const SUDimensionRef& value) {
-    return Dimension(value, true);
-  });
-  return dims;
+  return EntityRange<Dimension, SUDimensionRef>(fetch_refs<SUDimensionRef>([this](size_t* count) {
+    return SUEntitiesGetNumDimensions(m_entities, count);
+  },
+  [this](size_t len, SUDimensionRef* refs, size_t* count) {
+    return SUEntitiesGetDimensions(m_entities, len, refs, count);
+  })).to_vector();
 }
 
 
@@ -672,21 +640,12 @@ std::vector<ArcCurve> Entities::arc_curves() const {
   if (!SUIsValid(m_entities)) {
     throw std::logic_error("CW::Entities::arc_curves(): Entities is null");
   }
-  size_t count = 0;
-  SUResult res = SUEntitiesGetNumArcCurves(m_entities, &count);
-  assert(res == SU_ERROR_NONE);
-  if (count == 0) {
-    return std::vector<ArcCurve>{};
-  }
-  std::vector<SUArcCurveRef> refs(count, SU_INVALID);
-  res = SUEntitiesGetArcCurves(m_entities, count, refs.data(), &count);
-  assert(res == SU_ERROR_NONE); _unused(res);
-  std::vector<ArcCurve> arcs;
-  arcs.reserve(count);
-  for (size_t i = 0; i < count; ++i) {
-    arcs.emplace_back(refs[i], true);
-  }
-  return arcs;
+  return EntityRange<ArcCurve, SUArcCurveRef>(fetch_refs<SUArcCurveRef>([this](size_t* count) {
+    return SUEntitiesGetNumArcCurves(m_entities, count);
+  },
+  [this](size_t len, SUArcCurveRef* refs, size_t* count) {
+    return SUEntitiesGetArcCurves(m_entities, len, refs, count);
+  })).to_vector();
 }
 
 
@@ -770,6 +729,11 @@ Model Entities::model() const {
 #endif
 
 
+SUEntitiesRef Entities::ref() const {
+  return m_entities;
+}
+
+
 Entities::operator SUEntitiesRef() {
   return m_entities;
 }
@@ -0,0 +1,608 @@
+//
+//  EntityRefs.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/EntityRefs.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+
+#include <SketchUpAPI/model/drawing_element.h>
+
+#include "SUAPI-CppWrapper/String.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+#include "SUAPI-CppWrapper/model/Vertex.hpp"
+
+namespace CW {
+
+static_assert(std::is_trivially_copyable<VertexRef>::value && sizeof(VertexRef) == sizeof(void*), "VertexRef must be a trivially copyable pointer");
+static_assert(std::is_trivially_copyable<EdgeRef>::value && sizeof(EdgeRef) == sizeof(void*), "EdgeRef must be a trivially copyable pointer");
+static_assert(std::is_trivially_copyable<FaceRef>::value && sizeof(FaceRef) == sizeof(void*), "FaceRef must be a trivially copyable pointer");
+static_assert(std::is_trivially_copyable<InstanceRef>::value && sizeof(InstanceRef) == sizeof(void*), "InstanceRef must be a trivially copyable pointer");
+
+namespace {
+
+/**
+* Fetches a list of refs from the C API, as handles.
+* @param get_num - called with a pointer to the count.
+* @param get - called with the length of the buffer, the buffer and a pointer to the count.
+*/
+template <class Handle, class Ref, class GetNum, class Get>
+std::vector<Handle> get_handles(GetNum get_num, Get get) {
+  size_t count = 0;
+  SUResult res = get_num(&count);
+  assert(res == SU_ERROR_NONE);
+  if (count == 0) {
+    return std::vector<Handle>();
+  }
+  Ref invalid = SU_INVALID;
+  std::vector<Ref> refs(count, invalid);
+  res = get(count, refs.data(), &count);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return std::vector<Handle>(refs.begin(), refs.begin() + count);
+}
+
+Material element_material(SUDrawingElementRef element) {
+  SUMaterialRef material = SU_INVALID;
+  SUResult res = SUDrawingElementGetMaterial(element, &material);
+  if (res == SU_ERROR_NO_DATA || res == SU_ERROR_NULL_POINTER_OUTPUT) {
+    return Material();
+  }
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return Material(material, true);
+}
+
+Layer element_layer(SUDrawingElementRef element) {
+  SULayerRef layer = SU_INVALID;
+  SUResult res = SUDrawingElementGetLayer(element, &layer);
+  if (res == SU_ERROR_NO_DATA || res == SU_ERROR_NULL_POINTER_OUTPUT) {
+    return Layer();
+  }
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return Layer(layer, true);
+}
+
+bool element_hidden(SUDrawingElementRef element) {
+  bool hidden = false;
+  SUResult res = SUDrawingElementGetHidden(element, &hidden);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return hidden;
+}
+
+BoundingBox3D element_bounds(SUDrawingElementRef element) {
+  SUBoundingBox3D box;
+  SUResult res = SUDrawingElementGetBoundingBox(element, &box);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return BoundingBox3D(box);
+}
+
+} // namespace
+
+/******************
+** VertexRef **
+*******************/
+VertexRef::VertexRef():
+  m_vertex(SU_INVALID)
+{}
+
+
+VertexRef::VertexRef(SUVertexRef vertex):
+  m_vertex(vertex)
+{}
+
+
+SUVertexRef VertexRef::ref() const {
+  return m_vertex;
+}
+
+
+VertexRef::operator bool() const {
+  return SUIsValid(m_vertex);
+}
+
+
+bool VertexRef::operator!() const {
+  return SUIsInvalid(m_vertex);
+}
+
+
+bool VertexRef::operator==(const VertexRef& other) const {
+  return m_vertex.ptr == other.m_vertex.ptr;
+}
+
+
+bool VertexRef::operator!=(const VertexRef& other) const {
+  return m_vertex.ptr != other.m_vertex.ptr;
+}
+
+
+VertexRef::operator Vertex() const {
+  return Vertex(m_vertex);
+}
+
+
+Point3D VertexRef::position() const {
+  if (SUIsInvalid(m_vertex)) {
+    throw std::logic_error("CW::VertexRef::position(): VertexRef is null");
+  }
+  SUPoint3D position;
+  SUResult res = SUVertexGetPosition(m_vertex, &position);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return Point3D(position);
+}
+
+
+std::vector<EdgeRef> VertexRef::edges() const {
+  if (SUIsInvalid(m_vertex)) {
+    throw std::logic_error("CW::VertexRef::edges(): VertexRef is null");
+  }
+  return get_handles<EdgeRef, SUEdgeRef>([this](size_t* count) {
+    return SUVertexGetNumEdges(m_vertex, count);
+  },
+  [this](size_t len, SUEdgeRef* refs, size_t* count) {
+    return SUVertexGetEdges(m_vertex, len, refs, count);
+  });
+}
+
+
+std::vector<FaceRef> VertexRef::faces() const {
+  if (SUIsInvalid(m_vertex)) {
+    throw std::logic_error("CW::VertexRef::faces(): VertexRef is null");
+  }
+  return get_handles<FaceRef, SUFaceRef>([this](size_t* count) {
+    return SUVertexGetNumFaces(m_vertex, count);
+  },
+  [this](size_t len, SUFaceRef* refs, size_t* count) {
+    return SUVertexGetFaces(m_vertex, len, refs, count);
+  });
+}
+
+/******************
+** EdgeRef **
+*******************/
+EdgeRef::EdgeRef():
+  m_edge(SU_INVALID)
+{}
+
+
+EdgeRef::EdgeRef(SUEdgeRef edge):
+  m_edge(edge)
+{}
+
+
+SUEdgeRef EdgeRef::ref() const {
+  return m_edge;
+}
+
+
+EdgeRef::operator bool() const {
+  return SUIsValid(m_edge);
+}
+
+
+bool EdgeRef::operator!() const {
+  return SUIsInvalid(m_edge);
+}
+
+
+bool EdgeRef::operator==(const EdgeRef& other) const {
+  return m_edge.ptr == other.m_edge.ptr;
+}
+
+
+bool EdgeRef::operator!=(const EdgeRef& other) const {
+  return m_edge.ptr != other.m_edge.ptr;
+}
+
+
+EdgeRef::operator Edge() const {
+  return Edge(m_edge);
+}
+
+
+VertexRef EdgeRef::start() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::start(): EdgeRef is null");
+  }
+  SUVertexRef vertex = SU_INVALID;
+  SUResult res = SUEdgeGetStartVertex(m_edge, &vertex);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return VertexRef(vertex);
+}
+
+
+VertexRef EdgeRef::end() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::end(): EdgeRef is null");
+  }
+  SUVertexRef vertex = SU_INVALID;
+  SUResult res = SUEdgeGetEndVertex(m_edge, &vertex);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return VertexRef(vertex);
+}
+
+
+Vector3D EdgeRef::vector() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::vector(): EdgeRef is null");
+  }
+  return end().position() - start().position();
+}
+
+
+double EdgeRef::length() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::length(): EdgeRef is null");
+  }
+  return vector().length();
+}
+
+
+std::vector<FaceRef> EdgeRef::faces() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::faces(): EdgeRef is null");
+  }
+  return get_handles<FaceRef, SUFaceRef>([this](size_t* count) {
+    return SUEdgeGetNumFaces(m_edge, count);
+  },
+  [this](size_t len, SUFaceRef* refs, size_t* count) {
+    return SUEdgeGetFaces(m_edge, len, refs, count);
+  });
+}
+
+
+bool EdgeRef::soft() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::soft(): EdgeRef is null");
+  }
+  bool soft = false;
+  SUResult res = SUEdgeGetSoft(m_edge, &soft);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return soft;
+}
+
+
+bool EdgeRef::smooth() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::smooth(): EdgeRef is null");
+  }
+  bool smooth = false;
+  SUResult res = SUEdgeGetSmooth(m_edge, &smooth);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return smooth;
+}
+
+
+bool EdgeRef::hidden() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::hidden(): EdgeRef is null");
+  }
+  return element_hidden(SUEdgeToDrawingElement(m_edge));
+}
+
+
+Material EdgeRef::material() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::material(): EdgeRef is null");
+  }
+  return element_material(SUEdgeToDrawingElement(m_edge));
+}
+
+
+Layer EdgeRef::layer() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::layer(): EdgeRef is null");
+  }
+  return element_layer(SUEdgeToDrawingElement(m_edge));
+}
+
+
+BoundingBox3D EdgeRef::bounds() const {
+  if (SUIsInvalid(m_edge)) {
+    throw std::logic_error("CW::EdgeRef::bounds(): EdgeRef is null");
+  }
+  return element_bounds(SUEdgeToDrawingElement(m_edge));
+}
+
+/******************
+** FaceRef **
+*******************/
+FaceRef::FaceRef():
+  m_face(SU_INVALID)
+{}
+
+
+FaceRef::FaceRef(SUFaceRef face):
+  m_face(face)
+{}
+
+
+SUFaceRef FaceRef::ref() const {
+  return m_face;
+}
+
+
+FaceRef::operator bool() const {
+  return SUIsValid(m_face);
+}
+
+
+bool FaceRef::operator!() const {
+  return SUIsInvalid(m_face);
+}
+
+
+bool FaceRef::operator==(const FaceRef& other) const {
+  return m_face.ptr == other.m_face.ptr;
+}
+
+
+bool FaceRef::operator!=(const FaceRef& other) const {
+  return m_face.ptr != other.m_face.ptr;
+}
+
+
+FaceRef::operator Face() const {
+  return Face(m_face);
+}
+
+
+double FaceRef::area() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::area(): FaceRef is null");
+  }
+  double area = 0.0;
+  SUResult res = SUFaceGetArea(m_face, &area);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return area;
+}
+
+
+Plane3D FaceRef::plane() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::plane(): FaceRef is null");
+  }
+  SUPlane3D plane;
+  SUResult res = SUFaceGetPlane(m_face, &plane);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return Plane3D(plane);
+}
+
+
+Vector3D FaceRef::normal() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::normal(): FaceRef is null");
+  }
+  return plane().normal();
+}
+
+
+size_t FaceRef::num_inner_loops() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::num_inner_loops(): FaceRef is null");
+  }
+  size_t num_loops = 0;
+  SUResult res = SUFaceGetNumInnerLoops(m_face, &num_loops);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return num_loops;
+}
+
+
+std::vector<VertexRef> FaceRef::vertices() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::vertices(): FaceRef is null");
+  }
+  return get_handles<VertexRef, SUVertexRef>([this](size_t* count) {
+    return SUFaceGetNumVertices(m_face, count);
+  },
+  [this](size_t len, SUVertexRef* refs, size_t* count) {
+    return SUFaceGetVertices(m_face, len, refs, count);
+  });
+}
+
+
+std::vector<EdgeRef> FaceRef::edges() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::edges(): FaceRef is null");
+  }
+  return get_handles<EdgeRef, SUEdgeRef>([this](size_t* count) {
+    return SUFaceGetNumEdges(m_face, count);
+  },
+  [this](size_t len, SUEdgeRef* refs, size_t* count) {
+    return SUFaceGetEdges(m_face, len, refs, count);
+  });
+}
+
+
+Material FaceRef::material() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::material(): FaceRef is null");
+  }
+  return element_material(SUFaceToDrawingElement(m_face));
+}
+
+
+Material FaceRef::back_material() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::back_material(): FaceRef is null");
+  }
+  SUMaterialRef material = SU_INVALID;
+  SUResult res = SUFaceGetBackMaterial(m_face, &material);
+  if (res == SU_ERROR_NO_DATA) {
+    return Material();
+  }
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return Material(material);
+}
+
+
+Layer FaceRef::layer() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::layer(): FaceRef is null");
+  }
+  return element_layer(SUFaceToDrawingElement(m_face));
+}
+
+
+bool FaceRef::hidden() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::hidden(): FaceRef is null");
+  }
+  return element_hidden(SUFaceToDrawingElement(m_face));
+}
+
+
+BoundingBox3D FaceRef::bounds() const {
+  if (SUIsInvalid(m_face)) {
+    throw std::logic_error("CW::FaceRef::bounds(): FaceRef is null");
+  }
+  return element_bounds(SUFaceToDrawingElement(m_face));
+}
+
+/******************
+** InstanceRef **
+*******************/
+InstanceRef::InstanceRef():
+  m_instance(SU_INVALID)
+{}
+
+
+InstanceRef::InstanceRef(SUComponentInstanceRef instance):
+  m_instance(instance)
+{}
+
+
+InstanceRef::InstanceRef(SUGroupRef group):
+  m_instance(SUGroupToComponentInstance(group))
+{}
+
+
+SUComponentInstanceRef InstanceRef::ref() const {
+  return m_instance;
+}
+
+
+InstanceRef::operator bool() const {
+  return SUIsValid(m_instance);
+}
+
+
+bool InstanceRef::operator!() const {
+  return SUIsInvalid(m_instance);
+}
+
+
+bool InstanceRef::operator==(const InstanceRef& other) const {
+  return m_instance.ptr == other.m_instance.ptr;
+}
+
+
+bool InstanceRef::operator!=(const InstanceRef& other) const {
+  return m_instance.ptr != other.m_instance.ptr;
+}
+
+
+InstanceRef::operator ComponentInstance() const {
+  return ComponentInstance(m_instance);
+}
+
+
+Transformation InstanceRef::transformation() const {
+  if (SUIsInvalid(m_instance)) {
+    throw std::logic_error("CW::InstanceRef::transformation(): InstanceRef is null");
+  }
+  SUTransformation transform;
+  SUResult res = SUComponentInstanceGetTransform(m_instance, &transform);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return Transformation(transform);
+}
+
+
+ComponentDefinition InstanceRef::definition() const {
+  if (SUIsInvalid(m_instance)) {
+    throw std::logic_error("CW::InstanceRef::definition(): InstanceRef is null");
+  }
+  SUComponentDefinitionRef definition = SU_INVALID;
+  SUResult res = SUComponentInstanceGetDefinition(m_instance, &definition);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return ComponentDefinition(definition);
+}
+
+
+String InstanceRef::name() const {
+  if (SUIsInvalid(m_instance)) {
+    throw std::logic_error("CW::InstanceRef::name(): InstanceRef is null");
+  }
+  String string;
+  SUStringRef * const string_ref = string;
+  SUResult res = SUComponentInstanceGetName(m_instance, string_ref);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return string;
+}
+
+
+Material InstanceRef::material() const {
+  if (SUIsInvalid(m_instance)) {
+    throw std::logic_error("CW::InstanceRef::material(): InstanceRef is null");
+  }
+  return element_material(SUComponentInstanceToDrawingElement(m_instance));
+}
+
+
+Layer InstanceRef::layer() const {
+  if (SUIsInvalid(m_instance)) {
+    throw std::logic_error("CW::InstanceRef::layer(): InstanceRef is null");
+  }
+  return element_layer(SUComponentInstanceToDrawingElement(m_instance));
+}
+
+
+bool InstanceRef::hidden() const {
+  if (SUIsInvalid(m_instance)) {
+    throw std::logic_error("CW::InstanceRef::hidden(): InstanceRef is null");
+  }
+  return element_hidden(SUComponentInstanceToDrawingElement(m_instance));
+}
+
+
+BoundingBox3D InstanceRef::bounds() const {
+  if (SUIsInvalid(m_instance)) {
+    throw std::logic_error("CW::InstanceRef::bounds(): InstanceRef is null");
+  }
+  return element_bounds(SUComponentInstanceToDrawingElement(m_instance));
+}
+
+} /* namespace CW */
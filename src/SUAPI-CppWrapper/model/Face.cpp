@@ -40,7 +40,9 @@
 #include "SUAPI-CppWrapper/model/Texture.hpp"
 #include "SUAPI-CppWrapper/model/Vertex.hpp"
 #include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
 #include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/FaceClassifier.hpp"
 #include "SUAPI-CppWrapper/model/LoopInput.hpp"
 #include "SUAPI-CppWrapper/model/GeometryInput.hpp"
 #include "SUAPI-CppWrapper/model/MaterialInput.hpp"
@@ -62,12 +64,8 @@ SUFaceRef Face::create_face(std::vector<Point3D>& outer_points) {
 SUFaceRef Face::create_face(std::vector<Point3D>& outer_points, LoopInput& loop_input) {
   SUFaceRef face = SU_INVALID;
   SULoopInputRef loop_input_ref = loop_input.ref();
-  std::vector<SUPoint3D> su_points(outer_points.size());
-  std::transform(outer_points.begin(), outer_points.end(), su_points.begin(),
-    [](const Point3D& value){
-      return (SUPoint3D)value;
-    });
-  SUResult res = SUFaceCreate(&face, su_points.data(), &loop_input_ref);
+  // Point3D is layout compatible with SUPoint3D, so the points can be passed without copying.
+  SUResult res = SUFaceCreate(&face, reinterpret_cast<const SUPoint3D*>(outer_points.data()), &loop_input_ref);
   if (res != SU_ERROR_NONE) {
     // The points cannot be made into a face: either the points do not lie in a plane, or is somehow problematic.
     return SU_INVALID;
@@ -82,11 +80,8 @@ SUFaceRef Face::copy_reference(const Face& other) {
     return other.ref();
   }
   // The other face has not been attached to the model, so copy its properties to a new object
-  Loop other_outer_loop = other.outer_loop();
-  std::vector<Point3D> other_outer_points = other_outer_loop.points();
-  LoopInput outer_loop_input = other_outer_loop.loop_input();
-  SUFaceRef new_face = create_face(other_outer_points, outer_loop_input);
-  return new_face;
+  FaceData other_data(other);
+  return other_data[0].create_face_ref(false);
 }
 
 
@@ -181,12 +176,10 @@ Face Face::copy() const {
   if (!(*this)) {
     throw std::logic_error("CW::Face::copy(): Face is null");
   }
-  Loop other_outer_loop = this->outer_loop();
-  std::vector<Point3D> outer_points = other_outer_loop.points();
-  LoopInput outer_loop_input = other_outer_loop.loop_input();
-  Face new_face(outer_points, outer_loop_input);
+  FaceData face_data(*this);
+  Face new_face(face_data[0].create_face_ref(), false);
   if (!!new_face && !this->m_attached) {
-    new_face.back_material(this->back_material());
+    new_face.back_material(face_data[0].back_material());
   }
   new_face.copy_attributes_from(*this);
   return new_face;
@@ -260,42 +253,7 @@ FacePointClass Face::classify_point(const Point3D& point) {
   if (!point) {
     throw std::invalid_argument("CW::Face::classify_point(): Given Point3D object is null");
   }
-  Loop outer_loop = this->outer_loop();
-  PointLoopClassify outer_class = outer_loop.classify_point(point);
-  switch (outer_class) {
-    case (PointLoopClassify::PointUnknown):
-      return FacePointClass::PointUnknown;
-    case (PointLoopClassify::PointNotOnPlane):
-      return FacePointClass::PointNotOnPlane;
-    case (PointLoopClassify::PointOnEdge):
-      return FacePointClass::PointOnEdge;
-    case (PointLoopClassify::PointOnVertex):
-      return FacePointClass::PointOnVertex;
-    case (PointLoopClassify::PointOutside):
-      return FacePointClass::PointOutside;
-    case (PointLoopClassify::PointInside): {
-      std::vector<Loop> inner_loops = this->inner_loops();
-      for (size_t i=0; i < inner_loops.size(); i++) {
-        PointLoopClassify inner_class = inner_loops[i].classify_point(point);
-        switch (inner_class) {
-          case (PointLoopClassify::PointOnEdge):
-            return FacePointClass::PointOnEdge;
-          case (PointLoopClassify::PointOnVertex):
-            return FacePointClass::PointOnVertex;
-          case (PointLoopClassify::PointOutside):
-            break;
-          case (PointLoopClassify::PointInside):
-            return FacePointClass::PointOutside;
-            break;
-          case (PointLoopClassify::PointNotOnPlane):
-          case (PointLoopClassify::PointUnknown):
-            assert(false); // this should not happen
-        }
-      }
-      return FacePointClass::PointOutside;
-    } break;
-  }
-  return FacePointClass::PointUnknown;
+  return FaceClassifier(*this).classify(point);
 }
 
 
@@ -0,0 +1,108 @@
+//
+//  FaceClassifier.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SUAPI-CppWrapper/model/FaceClassifier.hpp"
+
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace CW {
+
+namespace {
+
+LoopClassifier outer_loop_classifier(const Face& face) {
+  if (!face) {
+    throw std::logic_error("CW::FaceClassifier::FaceClassifier(): Face is null");
+  }
+  return LoopClassifier(face.outer_loop());
+}
+
+} // namespace
+
+FaceClassifier::FaceClassifier(const Face& face):
+  m_outer_loop(outer_loop_classifier(face))
+{
+  std::vector<Loop> inner_loops = face.inner_loops();
+  m_inner_loops.reserve(inner_loops.size());
+  for (const Loop& inner_loop : inner_loops) {
+    m_inner_loops.emplace_back(inner_loop);
+  }
+}
+
+
+FaceClassifier::FaceClassifier(const std::vector<Point3D>& outer_loop, const std::vector<std::vector<Point3D>>& inner_loops):
+  m_outer_loop(outer_loop)
+{
+  m_inner_loops.reserve(inner_loops.size());
+  for (const std::vector<Point3D>& inner_loop : inner_loops) {
+    m_inner_loops.emplace_back(inner_loop);
+  }
+}
+
+
+FacePointClass FaceClassifier::classify(const Point3D& point) const {
+  if (!point) {
+    throw std::invalid_argument("CW::FaceClassifier::classify(): Point3D given is null");
+  }
+  switch (m_outer_loop.classify(point)) {
+    case (PointLoopClassify::PointUnknown):
+      return FacePointClass::PointUnknown;
+    case (PointLoopClassify::PointNotOnPlane):
+      return FacePointClass::PointNotOnPlane;
+    case (PointLoopClassify::PointOnEdge):
+      return FacePointClass::PointOnEdge;
+    case (PointLoopClassify::PointOnVertex):
+      return FacePointClass::PointOnVertex;
+    case (PointLoopClassify::PointOutside):
+      return FacePointClass::PointOutside;
+    case (PointLoopClassify::PointInside):
+      break;
+  }
+  for (const LoopClassifier& inner_loop : m_inner_loops) {
+    switch (inner_loop.classify(point)) {
+      case (PointLoopClassify::PointOnEdge):
+        return FacePointClass::PointOnEdge;
+      case (PointLoopClassify::PointOnVertex):
+        return FacePointClass::PointOnVertex;
+      case (PointLoopClassify::PointOutside):
+        break;
+      case (PointLoopClassify::PointInside):
+        return FacePointClass::PointOutside;
+      case (PointLoopClassify::PointNotOnPlane):
+      case (PointLoopClassify::PointUnknown):
+        assert(false); // this should not happen
+        break;
+    }
+  }
+  // Inside the outer loop, and not in any of the holes.
+  return FacePointClass::PointInside;
+}
+
+} /* namespace CW */
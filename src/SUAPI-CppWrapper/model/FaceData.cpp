@@ -0,0 +1,359 @@
+//
+//  FaceData.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+#include <SketchUpAPI/model/drawing_element.h>
+#include <SketchUpAPI/model/edge.h>
+#include <SketchUpAPI/model/loop.h>
+#include <SketchUpAPI/model/vertex.h>
+
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/LoopInput.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+
+namespace CW {
+
+namespace {
+
+SUMaterialRef element_material(SUDrawingElementRef element) {
+  SUMaterialRef material = SU_INVALID;
+  SUResult res = SUDrawingElementGetMaterial(element, &material);
+  if (res != SU_ERROR_NONE) {
+    SUSetInvalid(material);
+  }
+  return material;
+}
+
+SULayerRef element_layer(SUDrawingElementRef element) {
+  SULayerRef layer = SU_INVALID;
+  SUResult res = SUDrawingElementGetLayer(element, &layer);
+  if (res != SU_ERROR_NONE) {
+    SUSetInvalid(layer);
+  }
+  return layer;
+}
+
+} // namespace
+
+/******************
+** LoopView **
+*******************/
+FaceData::LoopView::LoopView(const Point3D* points, const EdgeData* edges, size_t size):
+  m_points(points),
+  m_edges(edges),
+  m_size(size)
+{}
+
+
+std::vector<Point3D> FaceData::LoopView::points() const {
+  return std::vector<Point3D>(m_points, m_points + m_size);
+}
+
+
+std::vector<Point3D> FaceData::LoopView::points(const Transformation& transformation) const {
+  std::vector<Point3D> points;
+  points.reserve(m_size);
+  for (size_t i=0; i < m_size; ++i) {
+    points.push_back(m_points[i] * transformation);
+  }
+  return points;
+}
+
+
+LoopInput FaceData::LoopView::loop_input(size_t vertex_index) const {
+  return LoopInput(*this, vertex_index);
+}
+
+
+/******************
+** FaceView **
+*******************/
+FaceData::FaceView::FaceView(const FaceData* data, size_t index):
+  m_data(data),
+  m_index(index)
+{}
+
+
+SUFaceRef FaceData::FaceView::face_ref() const {
+  return m_data->m_faces[m_index];
+}
+
+
+FaceData::LoopView FaceData::FaceView::outer_loop() const {
+  return m_data->loop(m_data->m_face_loops[m_index]);
+}
+
+
+size_t FaceData::FaceView::num_inner_loops() const {
+  return m_data->m_face_loops[m_index + 1] - m_data->m_face_loops[m_index] - 1;
+}
+
+
+FaceData::LoopView FaceData::FaceView::inner_loop(size_t index) const {
+  if (index >= num_inner_loops()) {
+    throw std::out_of_range("CW::FaceData::FaceView::inner_loop(): index is out of range");
+  }
+  return m_data->loop(m_data->m_face_loops[m_index] + 1 + index);
+}
+
+
+size_t FaceData::FaceView::num_points() const {
+  const std::vector<size_t>& loop_starts = m_data->m_loop_starts;
+  return loop_starts[m_data->m_face_loops[m_index + 1]] - loop_starts[m_data->m_face_loops[m_index]];
+}
+
+
+Plane3D FaceData::FaceView::plane() const {
+  return Plane3D(m_data->m_planes[m_index]);
+}
+
+
+Material FaceData::FaceView::material() const {
+  SUMaterialRef material = m_data->m_front_materials[m_index];
+  if (SUIsInvalid(material)) {
+    return Material();
+  }
+  return Material(material);
+}
+
+
+Material FaceData::FaceView::back_material() const {
+  SUMaterialRef material = m_data->m_back_materials[m_index];
+  if (SUIsInvalid(material)) {
+    return Material();
+  }
+  return Material(material);
+}
+
+
+Layer FaceData::FaceView::layer() const {
+  SULayerRef layer = m_data->m_layers[m_index];
+  if (SUIsInvalid(layer)) {
+    return Layer();
+  }
+  return Layer(layer);
+}
+
+
+SUFaceRef FaceData::FaceView::create_face_ref(bool inner_loops) const {
+  return m_data->create_face_ref(m_index, nullptr, inner_loops);
+}
+
+
+SUFaceRef FaceData::FaceView::create_face_ref(const Transformation& transformation, bool inner_loops) const {
+  return m_data->create_face_ref(m_index, &transformation, inner_loops);
+}
+
+
+/******************
+** FaceData **
+*******************/
+FaceData::FaceData():
+  m_loop_starts(1, 0),
+  m_face_loops(1, 0)
+{}
+
+
+FaceData::FaceData(const Face& face):
+  FaceData()
+{
+  if (!face) {
+    throw std::invalid_argument("CW::FaceData::FaceData(): Face is null");
+  }
+  std::vector<SULoopRef> loop_buffer;
+  std::vector<SUVertexRef> vertex_buffer;
+  std::vector<SUEdgeRef> edge_buffer;
+  read_face(face.ref(), loop_buffer, vertex_buffer, edge_buffer);
+}
+
+
+FaceData::FaceData(const std::vector<Face>& faces):
+  FaceData()
+{
+  m_faces.reserve(faces.size());
+  m_planes.reserve(faces.size());
+  m_front_materials.reserve(faces.size());
+  m_back_materials.reserve(faces.size());
+  m_layers.reserve(faces.size());
+  m_face_loops.reserve(faces.size() + 1);
+  std::vector<SULoopRef> loop_buffer;
+  std::vector<SUVertexRef> vertex_buffer;
+  std::vector<SUEdgeRef> edge_buffer;
+  for (const Face& face : faces) {
+    if (!face) {
+      throw std::invalid_argument("CW::FaceData::FaceData(): Face is null");
+    }
+    read_face(face.ref(), loop_buffer, vertex_buffer, edge_buffer);
+  }
+}
+
+
+void FaceData::read_face(SUFaceRef face, std::vector<SULoopRef>& loop_buffer, std::vector<SUVertexRef>& vertex_buffer, std::vector<SUEdgeRef>& edge_buffer) {
+  SUDrawingElementRef face_element = SUFaceToDrawingElement(face);
+  SUPlane3D plane;
+  SUResult res = SUFaceGetPlane(face, &plane);
+  assert(res == SU_ERROR_NONE);
+  SUMaterialRef back_material = SU_INVALID;
+  res = SUFaceGetBackMaterial(face, &back_material);
+  if (res != SU_ERROR_NONE) {
+    SUSetInvalid(back_material);
+  }
+  m_faces.push_back(face);
+  m_planes.push_back(plane);
+  m_front_materials.push_back(element_material(face_element));
+  m_back_materials.push_back(back_material);
+  m_layers.push_back(element_layer(face_element));
+
+  // The outer loop, followed by the inner loops
+  size_t num_inner_loops = 0;
+  res = SUFaceGetNumInnerLoops(face, &num_inner_loops);
+  assert(res == SU_ERROR_NONE);
+  SULoopRef invalid_loop = SU_INVALID;
+  loop_buffer.assign(num_inner_loops + 1, invalid_loop);
+  res = SUFaceGetOuterLoop(face, &loop_buffer[0]);
+  assert(res == SU_ERROR_NONE);
+  if (num_inner_loops > 0) {
+    res = SUFaceGetInnerLoops(face, num_inner_loops, &loop_buffer[1], &num_inner_loops);
+    assert(res == SU_ERROR_NONE);
+  }
+  for (size_t i=0; i < num_inner_loops + 1; ++i) {
+    size_t count = 0;
+    res = SULoopGetNumVertices(loop_buffer[i], &count);
+    assert(res == SU_ERROR_NONE);
+    SUVertexRef invalid_vertex = SU_INVALID;
+    SUEdgeRef invalid_edge = SU_INVALID;
+    vertex_buffer.assign(count, invalid_vertex);
+    edge_buffer.assign(count, invalid_edge);
+    if (count > 0) {
+      res = SULoopGetVertices(loop_buffer[i], count, vertex_buffer.data(), &count);
+      assert(res == SU_ERROR_NONE);
+      res = SULoopGetEdges(loop_buffer[i], count, edge_buffer.data(), &count);
+      assert(res == SU_ERROR_NONE);
+    }
+    for (size_t j=0; j < count; ++j) {
+      SUPoint3D position;
+      res = SUVertexGetPosition(vertex_buffer[j], &position);
+      assert(res == SU_ERROR_NONE);
+      m_points.push_back(Point3D(position));
+      SUEdgeRef edge = edge_buffer[j];
+      SUDrawingElementRef edge_element = SUEdgeToDrawingElement(edge);
+      bool hidden = false;
+      bool soft = false;
+      bool smooth = false;
+      res = SUDrawingElementGetHidden(edge_element, &hidden);
+      assert(res == SU_ERROR_NONE);
+      res = SUEdgeGetSoft(edge, &soft);
+      assert(res == SU_ERROR_NONE);
+      res = SUEdgeGetSmooth(edge, &smooth);
+      assert(res == SU_ERROR_NONE);
+      EdgeData edge_data;
+      edge_data.flags = static_cast<uint8_t>((hidden ? EdgeHidden : 0) | (soft ? EdgeSoft : 0) | (smooth ? EdgeSmooth : 0));
+      edge_data.material = element_material(edge_element);
+      edge_data.layer = element_layer(edge_element);
+      m_edges.push_back(edge_data);
+    }
+    m_loop_starts.push_back(m_points.size());
+  }
+  m_face_loops.push_back(m_loop_starts.size() - 1);
+  _unused(res);
+}
+
+
+FaceData::LoopView FaceData::loop(size_t loop_index) const {
+  const size_t start = m_loop_starts[loop_index];
+  return LoopView(m_points.data() + start, m_edges.data() + start, m_loop_starts[loop_index + 1] - start);
+}
+
+
+SUFaceRef FaceData::create_face_ref(size_t face_index, const Transformation* transformation, bool inner_loops) const {
+  FaceView face_view = (*this)[face_index];
+  LoopView outer = face_view.outer_loop();
+  if (outer.size() < 3) {
+    return SU_INVALID;
+  }
+  std::vector<Point3D> points = transformation == nullptr ? outer.points() : outer.points(*transformation);
+  LoopInput outer_loop_input = outer.loop_input();
+  SULoopInputRef outer_loop_input_ref = outer_loop_input.ref();
+  SUFaceRef face = SU_INVALID;
+  SUResult res = SUFaceCreate(&face, reinterpret_cast<const SUPoint3D*>(points.data()), &outer_loop_input_ref);
+  if (res != SU_ERROR_NONE) {
+    // The points cannot be made into a face: either the points do not lie in a plane, or is somehow problematic.
+    return SU_INVALID;
+  }
+  // The loop input is released by SUFaceCreate()
+  outer_loop_input.m_attached = true;
+  if (!inner_loops) {
+    return face;
+  }
+  for (size_t i=0; i < face_view.num_inner_loops(); ++i) {
+    LoopView inner = face_view.inner_loop(i);
+    points = transformation == nullptr ? inner.points() : inner.points(*transformation);
+    LoopInput inner_loop_input = inner.loop_input();
+    res = SUFaceAddInnerLoop(face, reinterpret_cast<const SUPoint3D*>(points.data()), inner_loop_input);
+    if (res == SU_ERROR_INVALID_INPUT) {
+      SUFaceRelease(&face);
+      throw std::invalid_argument("CW::FaceData::create_face_ref(): inner loop could not be added to the face");
+    }
+    assert(res == SU_ERROR_NONE);
+  }
+  _unused(res);
+  return face;
+}
+
+
+size_t FaceData::size() const {
+  return m_faces.size();
+}
+
+
+bool FaceData::empty() const {
+  return m_faces.empty();
+}
+
+
+size_t FaceData::num_points() const {
+  return m_points.size();
+}
+
+
+FaceData::FaceView FaceData::operator[](size_t index) const {
+  if (index >= m_faces.size()) {
+    throw std::out_of_range("CW::FaceData::operator[](): index is out of range");
+  }
+  return FaceView(this, index);
+}
+
+} /* namespace CW */
@@ -61,7 +61,8 @@ SUGeometryInputRef GeometryInput::create_geometry_input() {
 ** Constructors / Destructor **
 *******************************/
 GeometryInput::GeometryInput():
-  m_geometry_input(create_geometry_input())
+  m_geometry_input(create_geometry_input()),
+  m_state(std::make_shared<SharedState>())
 {
   num_objects_[m_geometry_input] = 1;
 }
@@ -93,6 +94,7 @@ GeometryInput::GeometryInput(const GeometryInput& other) {
   }
   m_geometry_input = other.m_geometry_input;
   ++num_objects_[m_geometry_input];
+  m_state = other.m_state;
 }
 
 
@@ -107,6 +109,7 @@ GeometryInput& GeometryInput::operator=(const GeometryInput& other) {
   }
   m_geometry_input = other.m_geometry_input;
   ++num_objects_[m_geometry_input];
+  m_state = other.m_state;
   return (*this);
 }
 
@@ -143,10 +146,50 @@ bool GeometryInput::empty() const {
 
 
 size_t GeometryInput::add_vertex(const Point3D& point) {
+  WeldState* weld = m_state->weld.get();
+  if (weld != nullptr && !!point) {
+    ++weld->statistics.points;
+    const size_t existing = weld->welder.find(point);
+    if (existing != VertexWelder::NOT_FOUND) {
+      return existing;
+    }
+    weld->welder.insert(point, m_state->vertex_count);
+    ++weld->statistics.vertices;
+  }
   SUResult res = SUGeometryInputAddVertex(m_geometry_input, point);
   assert(res == SU_ERROR_NONE); _unused(res);
-  m_vertex_count++;
-  return m_vertex_count-1;
+  return m_state->vertex_count++;
+}
+
+
+void GeometryInput::weld_vertices(bool weld) {
+  if (!weld) {
+    m_state->weld.reset();
+  }
+  else if (!m_state->weld) {
+    m_state->weld = std::make_unique<WeldState>();
+  }
+}
+
+
+bool GeometryInput::weld_vertices() const {
+  return !!m_state->weld;
+}
+
+
+GeometryInput::WeldStatistics GeometryInput::weld_statistics() const {
+  if (!m_state->weld) {
+    return WeldStatistics();
+  }
+  return m_state->weld->statistics;
+}
+
+
+double GeometryInput::WeldStatistics::ratio() const {
+  if (points == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(points - vertices) / static_cast<double>(points);
 }
 
 
@@ -156,17 +199,31 @@ void GeometryInput::set_vertices(const std::vector<SUPoint3D>& points) {
   SUResult res = SUGeometryInputSetVertices(m_geometry_input, points.size(), points.data());
   assert(res == SU_ERROR_NONE); _unused(res);
   // Overwrite the existing vertex count
-  m_vertex_count = points.size();
+  m_state->vertex_count = points.size();
+  if (m_state->weld) {
+    m_state->weld->welder.clear();
+    for (size_t i=0; i < points.size(); ++i) {
+      m_state->weld->welder.insert(points[i], i);
+    }
+  }
 }
 
 
 void GeometryInput::set_vertices(const std::vector<Point3D>& points) {
-  std::vector<SUPoint3D> point_refs(points.size());
-  std::transform(points.begin(), points.end(), point_refs.begin(),
-    [](const Point3D& value) {
-    return value;
-  });
-  return this->set_vertices(point_refs);
+  assert(this->counts()[1] == 0); // Undefined behaviour when overwriting vertices
+  assert(this->counts()[2] == 0); // Undefined behaviour when overwriting vertices
+  // Point3D is layout compatible with SUPoint3D, so the points can be passed without copying.
+  SUResult res = SUGeometryInputSetVertices(m_geometry_input, points.size(), reinterpret_cast<const SUPoint3D*>(points.data()));
+  assert(res == SU_ERROR_NONE); _unused(res);
+  m_state->vertex_count = points.size();
+  if (m_state->weld) {
+    m_state->weld->welder.clear();
+    for (size_t i=0; i < points.size(); ++i) {
+      if (!!points[i]) {
+        m_state->weld->welder.insert(points[i], i);
+      }
+    }
+  }
 }
 
 
@@ -45,6 +45,7 @@
 #include "SUAPI-CppWrapper/model/Loop.hpp"
 #include "SUAPI-CppWrapper/model/LoopInput.hpp"
 #include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
 #include "SUAPI-CppWrapper/model/Edge.hpp"
 #include "SUAPI-CppWrapper/model/MaterialInput.hpp"
 
@@ -246,6 +247,33 @@ void GeometryInputPlus::load_layers(LayerDictionary layer_dictionary) {
 }
 
 
+void GeometryInputPlus::add_loop_vertices(const FaceData::LoopView& loop, LoopInput& loop_input) {
+  size_t first_vertex_index = 0;
+  for (size_t i=0; i < loop.size(); ++i) {
+    size_t v_index = this->add_vertex(loop.point(i));
+    loop_input.add_vertex_index(v_index);
+    if (i==0) first_vertex_index = v_index;
+    const FaceData::EdgeData& edge = loop.edge(i);
+    if (edge.hidden()) {
+      loop_input.set_edge_hidden(i, true);
+    }
+    if (edge.smooth()) {
+      loop_input.set_edge_smooth(i, true);
+    }
+    if (edge.soft()) {
+      loop_input.set_edge_soft(i, true);
+    }
+    if (SUIsValid(edge.material)) {
+      loop_input.set_edge_material(i, m_material_dict.get_reference(Material(edge.material)));
+    }
+    if (SUIsValid(edge.layer)) {
+      loop_input.set_edge_layer(i, m_layer_dict.get_reference(Layer(edge.layer)));
+    }
+  }
+  loop_input.add_vertex_index(first_vertex_index); // Close the loop TODO: not strictly necessary, and messes with the m_edge_num count...
+}
+
+
 size_t GeometryInputPlus::add_face(const Face &face, bool copy_material_layer) {
   if(!(*this)) {
     throw std::logic_error("CW::GeometryInputPlus::add_face(): GeometryInput is null");
@@ -253,97 +281,61 @@ size_t GeometryInputPlus::add_face(const Face &face, bool copy_material_layer) {
   if(!face) {
     throw std::invalid_argument("CW::GeometryInputPlus::add_face(): Face argument is null");
   }
-  LoopInput outer_loop_input;
+  FaceData face_data(face);
+  return add_face(face_data[0], copy_material_layer);
+}
+
+
+size_t GeometryInputPlus::add_face(const FaceData::FaceView& face_data, bool copy_material_layer) {
+  if(!(*this)) {
+    throw std::logic_error("CW::GeometryInputPlus::add_face(): GeometryInput is null");
+  }
   // Add outer loop
-  std::vector<Point3D> outer_points = face.outer_loop().points();
-  if(outer_points.size() < 3) {
+  FaceData::LoopView outer_loop = face_data.outer_loop();
+  if(outer_loop.size() < 3) {
     throw std::logic_error("CW::GeometryInputPlus::add_face(): face has less than 3 points in outer loop");
   }
-  std::vector<Edge> outer_edges = face.outer_loop().edges();
-  size_t first_vertex_index;
-  for (size_t i=0; i < outer_points.size(); ++i) {
-    size_t v_index = this->add_vertex(outer_points[i]);
-    outer_loop_input.add_vertex_index(v_index);
-    if (i==0) first_vertex_index = v_index;
-    if (outer_edges[i].hidden()) {
-      outer_loop_input.set_edge_hidden(i, true);
-    }
-    if (outer_edges[i].smooth()) {
-      outer_loop_input.set_edge_smooth(i, true);
-    }
-    if (outer_edges[i].soft()) {
-      outer_loop_input.set_edge_soft(i, true);
-    }
-    if (!!outer_edges[i].material()) {
-      outer_loop_input.set_edge_material(i, m_material_dict.get_reference(outer_edges[i].material()));
-    }
-    if (!!outer_edges[i].layer()) {
-      outer_loop_input.set_edge_layer(i, m_layer_dict.get_reference(outer_edges[i].layer()));
-    }
-  }
-  outer_loop_input.add_vertex_index(first_vertex_index); // Close the loop TODO: not strictly necessary, and messes with the m_edge_num count...
-
+  LoopInput outer_loop_input;
+  add_loop_vertices(outer_loop, outer_loop_input);
   size_t added_face_index = GeometryInput::add_face(outer_loop_input);
   // Add inner loops
-  std::vector<Loop> inner_loops = face.inner_loops();
-  for (size_t i=0; i < inner_loops.size(); ++i) {
+  for (size_t i=0; i < face_data.num_inner_loops(); ++i) {
     LoopInput inner_loop_input;
-    std::vector<Point3D> inner_points = inner_loops[i].points();
-    std::vector<Edge> inner_edges = inner_loops[i].edges();
-    for (size_t j=0; j < inner_points.size(); ++j) {
-      size_t v_index = this->add_vertex(inner_points[j]);
-      inner_loop_input.add_vertex_index(v_index);
-      if (j==0) first_vertex_index = v_index;
-      if (inner_edges[j].hidden()) {
-        inner_loop_input.set_edge_hidden(j, true);
-      }
-      if (inner_edges[j].smooth()) {
-        inner_loop_input.set_edge_smooth(j, true);
-      }
-      if (inner_edges[j].soft()) {
-        inner_loop_input.set_edge_soft(j, true);
-      }
-      if (!!inner_edges[j].material()) {
-        inner_loop_input.set_edge_material(j, m_material_dict.get_reference(inner_edges[j].material()));
-      }
-      if (!!inner_edges[j].layer()) {
-        inner_loop_input.set_edge_layer(j, m_layer_dict.get_reference(inner_edges[j].layer()));
-      }
-    }
-    inner_loop_input.add_vertex_index(first_vertex_index); // Close the loop TODO: not strictly necessary, and messes with the m_edge_num count...
+    add_loop_vertices(face_data.inner_loop(i), inner_loop_input);
     this->face_add_inner_loop(added_face_index, inner_loop_input);
   }
   if (copy_material_layer) {
     // Add layer
-    Layer face_layer = face.layer();
+    Layer face_layer = face_data.layer();
     if (!!face_layer) {
       this->GeometryInput::face_layer(added_face_index, m_layer_dict.get_reference(face_layer));
       face_layer.attached(true);
     }
+    Material front_mat = face_data.material();
+    Material back_mat = face_data.back_material();
     #if SketchUpAPI_VERSION_MAJOR < 2021
     // Old way of setting the material
-    Material front_mat = face.material();
     if (!!front_mat) {
       MaterialInput front_material_input(front_mat);
       this->face_front_material(added_face_index, front_material_input);
     }
-    Material back_mat = face.back_material();
     if (!!back_mat) {
-      MaterialInput back_material_input(face.back_material());
+      MaterialInput back_material_input(back_mat);
       assert(m_target_model->material_exists(back_material_input.material()));
       this->face_back_material(added_face_index, back_material_input);
     }
     #else
     // New way of setting the material with MaterialInputPosition
-    if (!!face.material()) {
+    Face face(face_data.face_ref());
+    if (!!front_mat) {
       MaterialPositionInput material_input = face.material_position_front();
       // Replace material with one in the target model
-      material_input.material(this->material_reference(face.material()));
+      material_input.material(this->material_reference(front_mat));
       this->face_front_material_position(added_face_index, material_input);
     }
-    if (!!face.back_material()) {
+    if (!!back_mat) {
       MaterialPositionInput material_input = face.material_position_back();
-      material_input.material(this->material_reference(face.back_material()));
+      material_input.material(this->material_reference(back_mat));
       this->face_back_material_position(added_face_index, material_input);
     }
     #endif
@@ -357,9 +349,11 @@ size_t GeometryInputPlus::add_faces(const std::vector<Face>& faces, bool copy_ma
   if(!(*this)) {
     throw std::logic_error("CW::GeometryInputPlus::add_faces(): GeometryInput is null");
   }
+  // Read all the faces in one pass before adding them
+  FaceData faces_data(faces);
   size_t index = 0;
-  for (size_t i=0; i < faces.size(); ++i) {
-    index = add_face(faces[i]);
+  for (size_t i=0; i < faces_data.size(); ++i) {
+    index = add_face(faces_data[i], copy_material_layer);
   }
   return index;
 }
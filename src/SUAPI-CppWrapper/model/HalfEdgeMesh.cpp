@@ -0,0 +1,427 @@
+//
+//  HalfEdgeMesh.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/HalfEdgeMesh.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <thread>
+
+#include <SketchUpAPI/model/loop.h>
+
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/EntityRefs.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Vertex.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* Edges are linked in chunks of this many by each thread.
+*/
+constexpr size_t EDGES_PER_CHUNK = 4096;
+
+/**
+* Fills a compressed adjacency list: the values of key k are values[starts[k]] to values[starts[k+1] - 1], in the order they were given.
+* @param num_keys - the number of keys.
+* @param num_pairs - the number of (key, value) pairs.
+* @param pair - called with an index, and returns the pair at that index.
+*/
+template <class Pair>
+void fill_adjacency(size_t num_keys, size_t num_pairs, const Pair& pair, std::vector<uint32_t>& starts, std::vector<uint32_t>& values) {
+  starts.assign(num_keys + 1, 0);
+  for (size_t i=0; i < num_pairs; ++i) {
+    ++starts[pair(i).first + 1];
+  }
+  for (size_t k=0; k < num_keys; ++k) {
+    starts[k + 1] += starts[k];
+  }
+  values.resize(num_pairs);
+  std::vector<uint32_t> next(starts.begin(), starts.end() - 1);
+  for (size_t i=0; i < num_pairs; ++i) {
+    const std::pair<uint32_t, uint32_t> key_value = pair(i);
+    values[next[key_value.first]++] = key_value.second;
+  }
+}
+
+template <class T>
+size_t vector_bytes(const std::vector<T>& vector) {
+  return vector.capacity() * sizeof(T);
+}
+
+template <class Map>
+size_t map_bytes(const Map& map) {
+  // Each node holds the value and a link, and is typically padded to two more pointers.
+  return (map.bucket_count() * sizeof(void*)) + (map.size() * (sizeof(typename Map::value_type) + (2 * sizeof(void*))));
+}
+
+} // namespace
+
+constexpr uint32_t HalfEdgeMesh::NO_ID;
+
+HalfEdgeMesh::HalfEdgeMesh():
+  m_vertex_edge_starts(1, 0),
+  m_edge_half_edge_starts(1, 0),
+  m_face_loop_starts(1, 0),
+  m_loop_half_edge_starts(1, 0)
+{}
+
+
+HalfEdgeMesh::HalfEdgeMesh(const Entities& entities, size_t num_threads):
+  HalfEdgeMesh()
+{
+  read(entities);
+  link(num_threads);
+}
+
+
+uint32_t HalfEdgeMesh::add_vertex(SUVertexRef vertex) {
+  auto inserted = m_vertex_ids.emplace(vertex.ptr, static_cast<uint32_t>(m_vertex_refs.size()));
+  if (inserted.second) {
+    SUPoint3D position;
+    SUResult res = SUVertexGetPosition(vertex, &position);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    m_vertex_refs.push_back(vertex);
+    m_positions.push_back(Point3D(position));
+  }
+  return inserted.first->second;
+}
+
+
+uint32_t HalfEdgeMesh::add_edge(SUEdgeRef edge) {
+  auto inserted = m_edge_ids.emplace(edge.ptr, static_cast<uint32_t>(m_edge_refs.size()));
+  if (inserted.second) {
+    SUVertexRef start = SU_INVALID;
+    SUVertexRef end = SU_INVALID;
+    SUResult res = SUEdgeGetStartVertex(edge, &start);
+    assert(res == SU_ERROR_NONE);
+    res = SUEdgeGetEndVertex(edge, &end);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    m_edge_refs.push_back(edge);
+    m_edge_vertices.push_back(add_vertex(start));
+    m_edge_vertices.push_back(add_vertex(end));
+  }
+  return inserted.first->second;
+}
+
+
+void HalfEdgeMesh::read(const Entities& entities) {
+  std::vector<SULoopRef> loops;
+  std::vector<SUVertexRef> vertices;
+  std::vector<SUEdgeRef> edges;
+  for (FaceRef face : entities.face_range().as<FaceRef>()) {
+    const uint32_t face_id = static_cast<uint32_t>(m_face_refs.size());
+    m_face_refs.push_back(face.ref());
+    m_face_ids.emplace(face.ref().ptr, face_id);
+    // The outer loop, followed by the inner loops
+    size_t num_inner_loops = 0;
+    SUResult res = SUFaceGetNumInnerLoops(face.ref(), &num_inner_loops);
+    assert(res == SU_ERROR_NONE);
+    SULoopRef invalid_loop = SU_INVALID;
+    loops.assign(num_inner_loops + 1, invalid_loop);
+    res = SUFaceGetOuterLoop(face.ref(), &loops[0]);
+    assert(res == SU_ERROR_NONE);
+    if (num_inner_loops > 0) {
+      res = SUFaceGetInnerLoops(face.ref(), num_inner_loops, &loops[1], &num_inner_loops);
+      assert(res == SU_ERROR_NONE);
+    }
+    for (size_t i=0; i < num_inner_loops + 1; ++i) {
+      const uint32_t loop_id = static_cast<uint32_t>(m_loop_faces.size());
+      m_loop_faces.push_back(face_id);
+      size_t count = 0;
+      res = SULoopGetNumVertices(loops[i], &count);
+      assert(res == SU_ERROR_NONE);
+      SUVertexRef invalid_vertex = SU_INVALID;
+      SUEdgeRef invalid_edge = SU_INVALID;
+      vertices.assign(count, invalid_vertex);
+      edges.assign(count, invalid_edge);
+      if (count > 0) {
+        res = SULoopGetVertices(loops[i], count, vertices.data(), &count);
+        assert(res == SU_ERROR_NONE);
+        res = SULoopGetEdges(loops[i], count, edges.data(), &count);
+        assert(res == SU_ERROR_NONE);
+      }
+      for (size_t j=0; j < count; ++j) {
+        m_half_edge_origins.push_back(add_vertex(vertices[j]));
+        m_half_edge_edges.push_back(add_edge(edges[j]));
+        m_half_edge_loops.push_back(loop_id);
+      }
+      m_loop_half_edge_starts.push_back(static_cast<uint32_t>(m_half_edge_origins.size()));
+    }
+    m_face_loop_starts.push_back(static_cast<uint32_t>(m_loop_faces.size()));
+    _unused(res);
+  }
+  // Stray edges are given ids too, for the vertex queries
+  for (EdgeRef edge : entities.edge_range(true).as<EdgeRef>()) {
+    add_edge(edge.ref());
+  }
+}
+
+
+void HalfEdgeMesh::link(size_t num_threads) {
+  const size_t threads = thread_count(num_threads);
+  // The edges of each vertex are listed on a second thread while the half-edges of each edge are listed on this one.
+  auto list_vertex_edges = [this]() {
+    fill_adjacency(m_vertex_refs.size(), m_edge_vertices.size(), [this](size_t i) {
+      return std::make_pair(m_edge_vertices[i], static_cast<uint32_t>(i / 2));
+    }, m_vertex_edge_starts, m_vertex_edges);
+  };
+  std::thread vertex_worker;
+  if (threads > 1) {
+    vertex_worker = std::thread(list_vertex_edges);
+  }
+  else {
+    list_vertex_edges();
+  }
+  fill_adjacency(m_edge_refs.size(), m_half_edge_edges.size(), [this](size_t i) {
+    return std::make_pair(m_half_edge_edges[i], static_cast<uint32_t>(i));
+  }, m_edge_half_edge_starts, m_edge_half_edges);
+  // Each half-edge of an edge is partnered with the next, in a cycle.
+  m_half_edge_partners.assign(m_half_edge_edges.size(), NO_ID);
+  parallel_for_chunks(m_edge_refs.size(), EDGES_PER_CHUNK, threads, [this](size_t begin, size_t end) {
+    for (size_t e=begin; e < end; ++e) {
+      const uint32_t first = m_edge_half_edge_starts[e];
+      const uint32_t last = m_edge_half_edge_starts[e + 1];
+      if (last - first < 2) {
+        continue;
+      }
+      for (uint32_t i=first; i < last; ++i) {
+        m_half_edge_partners[m_edge_half_edges[i]] = m_edge_half_edges[i + 1 < last ? i + 1 : first];
+      }
+    }
+  });
+  if (vertex_worker.joinable()) {
+    vertex_worker.join();
+  }
+}
+
+
+size_t HalfEdgeMesh::num_vertices() const {
+  return m_vertex_refs.size();
+}
+
+
+size_t HalfEdgeMesh::num_edges() const {
+  return m_edge_refs.size();
+}
+
+
+size_t HalfEdgeMesh::num_faces() const {
+  return m_face_refs.size();
+}
+
+
+size_t HalfEdgeMesh::num_loops() const {
+  return m_loop_faces.size();
+}
+
+
+size_t HalfEdgeMesh::num_half_edges() const {
+  return m_half_edge_origins.size();
+}
+
+
+size_t HalfEdgeMesh::memory_usage() const {
+  return sizeof(HalfEdgeMesh) +
+    vector_bytes(m_vertex_refs) + vector_bytes(m_positions) + vector_bytes(m_vertex_edge_starts) + vector_bytes(m_vertex_edges) +
+    vector_bytes(m_edge_refs) + vector_bytes(m_edge_vertices) + vector_bytes(m_edge_half_edge_starts) + vector_bytes(m_edge_half_edges) +
+    vector_bytes(m_face_refs) + vector_bytes(m_face_loop_starts) + vector_bytes(m_loop_faces) + vector_bytes(m_loop_half_edge_starts) +
+    vector_bytes(m_half_edge_origins) + vector_bytes(m_half_edge_edges) + vector_bytes(m_half_edge_loops) + vector_bytes(m_half_edge_partners) +
+    map_bytes(m_vertex_ids) + map_bytes(m_edge_ids) + map_bytes(m_face_ids);
+}
+
+
+Vertex HalfEdgeMesh::vertex(uint32_t vertex_id) const {
+  return Vertex(m_vertex_refs.at(vertex_id));
+}
+
+
+Edge HalfEdgeMesh::edge(uint32_t edge_id) const {
+  return Edge(m_edge_refs.at(edge_id));
+}
+
+
+Face HalfEdgeMesh::face(uint32_t face_id) const {
+  return Face(m_face_refs.at(face_id));
+}
+
+
+uint32_t HalfEdgeMesh::vertex_id(const Vertex& vertex) const {
+  auto found = m_vertex_ids.find(vertex.ref().ptr);
+  return found == m_vertex_ids.end() ? NO_ID : found->second;
+}
+
+
+uint32_t HalfEdgeMesh::edge_id(const Edge& edge) const {
+  auto found = m_edge_ids.find(edge.ref().ptr);
+  return found == m_edge_ids.end() ? NO_ID : found->second;
+}
+
+
+uint32_t HalfEdgeMesh::face_id(const Face& face) const {
+  auto found = m_face_ids.find(face.ref().ptr);
+  return found == m_face_ids.end() ? NO_ID : found->second;
+}
+
+
+const Point3D& HalfEdgeMesh::position(uint32_t vertex_id) const {
+  return m_positions[vertex_id];
+}
+
+
+IdRange HalfEdgeMesh::vertex_edges(uint32_t vertex_id) const {
+  return IdRange(m_vertex_edges.data() + m_vertex_edge_starts[vertex_id], m_vertex_edges.data() + m_vertex_edge_starts[vertex_id + 1]);
+}
+
+
+uint32_t HalfEdgeMesh::edge_start(uint32_t edge_id) const {
+  return m_edge_vertices[edge_id * 2];
+}
+
+
+uint32_t HalfEdgeMesh::edge_end(uint32_t edge_id) const {
+  return m_edge_vertices[(edge_id * 2) + 1];
+}
+
+
+IdRange HalfEdgeMesh::edge_half_edges(uint32_t edge_id) const {
+  return IdRange(m_edge_half_edges.data() + m_edge_half_edge_starts[edge_id], m_edge_half_edges.data() + m_edge_half_edge_starts[edge_id + 1]);
+}
+
+
+bool HalfEdgeMesh::is_manifold_edge(uint32_t edge_id) const {
+  const IdRange half_edges = edge_half_edges(edge_id);
+  return half_edges.size() == 2 && origin(half_edges[0]) != origin(half_edges[1]);
+}
+
+
+uint32_t HalfEdgeMesh::outer_loop(uint32_t face_id) const {
+  return m_face_loop_starts[face_id];
+}
+
+
+size_t HalfEdgeMesh::num_face_loops(uint32_t face_id) const {
+  return m_face_loop_starts[face_id + 1] - m_face_loop_starts[face_id];
+}
+
+
+uint32_t HalfEdgeMesh::loop_face(uint32_t loop_id) const {
+  return m_loop_faces[loop_id];
+}
+
+
+uint32_t HalfEdgeMesh::loop_half_edge(uint32_t loop_id) const {
+  return m_loop_half_edge_starts[loop_id];
+}
+
+
+size_t HalfEdgeMesh::loop_size(uint32_t loop_id) const {
+  return m_loop_half_edge_starts[loop_id + 1] - m_loop_half_edge_starts[loop_id];
+}
+
+
+uint32_t HalfEdgeMesh::origin(uint32_t half_edge_id) const {
+  return m_half_edge_origins[half_edge_id];
+}
+
+
+uint32_t HalfEdgeMesh::destination(uint32_t half_edge_id) const {
+  return m_half_edge_origins[next(half_edge_id)];
+}
+
+
+uint32_t HalfEdgeMesh::half_edge_edge(uint32_t half_edge_id) const {
+  return m_half_edge_edges[half_edge_id];
+}
+
+
+uint32_t HalfEdgeMesh::half_edge_loop(uint32_t half_edge_id) const {
+  return m_half_edge_loops[half_edge_id];
+}
+
+
+uint32_t HalfEdgeMesh::half_edge_face(uint32_t half_edge_id) const {
+  return m_loop_faces[m_half_edge_loops[half_edge_id]];
+}
+
+
+uint32_t HalfEdgeMesh::next(uint32_t half_edge_id) const {
+  const uint32_t loop_id = m_half_edge_loops[half_edge_id];
+  return half_edge_id + 1 < m_loop_half_edge_starts[loop_id + 1] ? half_edge_id + 1 : m_loop_half_edge_starts[loop_id];
+}
+
+
+uint32_t HalfEdgeMesh::previous(uint32_t half_edge_id) const {
+  const uint32_t loop_id = m_half_edge_loops[half_edge_id];
+  return half_edge_id > m_loop_half_edge_starts[loop_id] ? half_edge_id - 1 : m_loop_half_edge_starts[loop_id + 1] - 1;
+}
+
+
+uint32_t HalfEdgeMesh::partner(uint32_t half_edge_id) const {
+  return m_half_edge_partners[half_edge_id];
+}
+
+
+std::vector<uint32_t> HalfEdgeMesh::connected_components(size_t& num_components) const {
+  std::vector<uint32_t> components(m_face_refs.size(), NO_ID);
+  std::vector<uint32_t> stack;
+  num_components = 0;
+  for (uint32_t f=0; f < components.size(); ++f) {
+    if (components[f] != NO_ID) {
+      continue;
+    }
+    const uint32_t component = static_cast<uint32_t>(num_components++);
+    components[f] = component;
+    stack.push_back(f);
+    while (!stack.empty()) {
+      const uint32_t face_id = stack.back();
+      stack.pop_back();
+      const uint32_t first = m_loop_half_edge_starts[m_face_loop_starts[face_id]];
+      const uint32_t last = m_loop_half_edge_starts[m_face_loop_starts[face_id + 1]];
+      for (uint32_t h=first; h < last; ++h) {
+        for (uint32_t other = m_half_edge_partners[h]; other != NO_ID && other != h; other = m_half_edge_partners[other]) {
+          const uint32_t other_face = half_edge_face(other);
+          if (components[other_face] == NO_ID) {
+            components[other_face] = component;
+            stack.push_back(other_face);
+          }
+        }
+      }
+    }
+  }
+  return components;
+}
+
+} /* namespace CW */
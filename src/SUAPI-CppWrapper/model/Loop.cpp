@@ -30,12 +30,14 @@
 
 #include "SUAPI-CppWrapper/model/Loop.hpp"
 
+#include "SUAPI-CppWrapper/Predicates.hpp"
 #include "SUAPI-CppWrapper/model/LoopInput.hpp"
 #include "SUAPI-CppWrapper/model/Vertex.hpp"
 #include "SUAPI-CppWrapper/model/Edge.hpp"
 #include "SUAPI-CppWrapper/model/Material.hpp"
 #include "SUAPI-CppWrapper/model/Layer.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 
@@ -43,6 +45,24 @@
 
 namespace CW {
 
+namespace {
+
+/**
+* Returns true if the point is within SketchUp's tolerance of the edge between the start and end points.  Squared distances are compared, so that no vectors need to be normalised.
+*/
+bool on_edge(const Point3D& start, const Point3D& end, const Point3D& point) {
+  const Vector3D edge = end - start;
+  const double length_squared = edge.squared_length();
+  if (length_squared == 0.0) {
+    return false;
+  }
+  const double factor = std::min(std::max(edge.dot(point - start) / length_squared, 0.0), 1.0);
+  const Vector3D offset = point - (start + (edge * factor));
+  return offset.squared_length() < Point3D::EPSILON * Point3D::EPSILON;
+}
+
+} // namespace
+
 Loop::Loop():
   Entity()
 {}
@@ -199,77 +219,34 @@ PointLoopClassify Loop::classify_point(const std::vector<Point3D>& loop_points,
   }
   // Now check if it is on the edges
   for (size_t i=0; i < loop_points.size(); i++) {
-    Point3D next_point;
-    if (i == loop_points.size()-1) {
-      next_point = loop_points[0];
-    }
-    else {
-      next_point = loop_points[i+1];
-    }
-    if (Line3D::on_line_segment(loop_points[i], next_point, test_point)) {
+    const Point3D& next_point = (i == loop_points.size()-1) ? loop_points[0] : loop_points[i+1];
+    if (on_edge(loop_points[i], next_point, test_point)) {
       return PointLoopClassify::PointOnEdge;
     }
   }
   // Now check if it is inside or outside, given that we know that the point is (a) on the same plane of the loop, and (b) not on the edge, and (c) not on the vertices.
-  // From: http://www.geeksforgeeks.org/how-to-check-if-a-given-point-lies-inside-a-polygon/
-  // We draw a line from the point, and if it intersects with the loop an even number of times, then it is outside, if it intersects an odd number of times, it is inside.
-  // The line to draw can be any vector that is coplanar to the loop's plane - the simple one is get a vector of two points within the loop.
-  assert(loop_points[0] != loop_points[1]);
-  Vector3D ray = Vector3D(loop_points[1] - loop_points[0]).unit();
-  // Colinear line segments create problems for the algorith below, so we ignore them by creating a new list of points to calculate that exclude colinear edges.
-  struct LoopPoint {
-    Point3D point;
-    Vector3D vector_to_next;
-  };
-  std::vector<LoopPoint> red_loop_points;
-  red_loop_points.reserve(loop_points.size());
+  // We draw a ray from the point, and if it crosses the loop an odd number of times, then it is inside.  The loop is projected onto the coordinate plane closest to its own plane, and the ray is drawn along the projected x axis.
+  // The side of each edge that the point lies on is decided with an exact orientation test, so that the result is correct however far the loop is from the origin.
+  const size_t axis = Predicates::dominant_axis(loop_plane.normal());
+  const SUPoint2D point_2d = Predicates::project(test_point, axis);
+  bool inside = false;
+  SUPoint2D start = Predicates::project(loop_points.back(), axis);
   for (size_t i=0; i < loop_points.size(); i++) {
-    Point3D next_point;
-    if (i == loop_points.size()-1) {
-      next_point = loop_points[0];
-    } else {
-      next_point = loop_points[i+1];
-    }
-    Vector3D next_vector = next_point - loop_points[i];
-    if (next_vector.unit() != ray.unit() && next_vector.unit() != -ray.unit()) {
-      red_loop_points.push_back(LoopPoint{loop_points[i], next_vector});
-    }
-  }
-  // Now we have a list of points with colinear points removed, find intersections with the line segments
-  size_t num_intersections = 0;
-  for (size_t i=0; i < red_loop_points.size(); i++) {
-    Point3D intersection = Point3D::ray_line_intersection(red_loop_points[i].point, red_loop_points[i].vector_to_next, test_point, ray, false);
-    if (!!intersection) {
-      // There is a case where the ray intersection lies on a vertex of the loop. Whether this should be counted as an intersection of both lines connected to the loop or just once through depends on the orientation of the ray relative to the lines connected to that vertex
-      if (intersection == red_loop_points[i].point) {
-        // Get the directions of the lines connected to the vertex
-        LoopPoint prev_point;
-        if (i == 0) {
-          prev_point = red_loop_points[red_loop_points.size()-1];
-        }
-        else {
-          prev_point = red_loop_points[i-1];
-        }
-        Vector3D prev_cross = ray.cross(prev_point.vector_to_next);
-        Vector3D next_cross = ray.cross(red_loop_points[i].vector_to_next);
-        assert(fabs(next_cross.length()) > Vector3D::EPSILON);
-        if (prev_cross.unit() != next_cross.unit()) {
-          // The cross product direction is in opposite directions - ie the lines connected to the vertex are on the same side of the ray, therefore, count this as an additional intersection
-          num_intersections++;
-        }
-      }
-      else {
-        num_intersections++;
+    const SUPoint2D end = Predicates::project(loop_points[i], axis);
+    // Vertices lying on the ray are treated as being above it, so a ray passing through a vertex is counted once if the loop crosses the ray there, and not at all if it only touches it.
+    if ((start.y > point_2d.y) != (end.y > point_2d.y)) {
+      // The edge crosses the ray if the point is on its left when going up, or on its right when going down.
+      const double orientation = Predicates::orient2d(start, end, point_2d);
+      if ((end.y > start.y) == (orientation > 0.0)) {
+        inside = !inside;
       }
     }
+    start = end;
   }
-  if (num_intersections % 2 == 0) {
-    // Even number of intersections
-    return PointLoopClassify::PointOutside;
-  }
-  else {
+  if (inside) {
     return PointLoopClassify::PointInside;
   }
+  return PointLoopClassify::PointOutside;
 }
 
 bool Loop::is_outer_loop() const {
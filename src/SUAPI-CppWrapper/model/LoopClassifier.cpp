@@ -0,0 +1,217 @@
+//
+//  LoopClassifier.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SUAPI-CppWrapper/model/LoopClassifier.hpp"
+
+#include "SUAPI-CppWrapper/Predicates.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace CW {
+
+namespace {
+
+/**
+* Bounds and bands are expanded by twice SketchUp's tolerance, so that rounding when they are computed cannot exclude a point that is within tolerance of a vertex or edge.
+*/
+constexpr double MARGIN = 2.0 * Point3D::EPSILON;
+
+} // namespace
+
+LoopClassifier::LoopClassifier(const std::vector<Point3D>& loop_points):
+  m_points(loop_points)
+{
+  if (m_points.size() < 3) {
+    throw std::invalid_argument("CW::LoopClassifier::LoopClassifier(): Fewer than 3 points given - not a valid loop.");
+  }
+  m_plane = Plane3D::plane_from_loop(m_points);
+  if (!m_plane) {
+    throw std::invalid_argument("CW::LoopClassifier::LoopClassifier(): Points given does not form a valid loop.");
+  }
+  build_index();
+}
+
+
+LoopClassifier::LoopClassifier(const Loop& loop)
+{
+  if (!loop) {
+    throw std::logic_error("CW::LoopClassifier::LoopClassifier(): Loop is null");
+  }
+  m_points = loop.points();
+  if (m_points.size() < 3) {
+    throw std::invalid_argument("CW::LoopClassifier::LoopClassifier(): Fewer than 3 points given - not a valid loop.");
+  }
+  m_plane = Plane3D::plane_from_loop(m_points);
+  if (!m_plane) {
+    throw std::invalid_argument("CW::LoopClassifier::LoopClassifier(): Points given does not form a valid loop.");
+  }
+  build_index();
+}
+
+
+void LoopClassifier::build_index() {
+  const size_t num_points = m_points.size();
+  m_axis = Predicates::dominant_axis(m_plane.normal());
+  m_points_2d.resize(num_points);
+  m_edges.resize(num_points);
+  for (size_t i=0; i < num_points; ++i) {
+    m_points_2d[i] = Predicates::project(m_points[i], m_axis);
+    const Point3D& next_point = (i == num_points-1) ? m_points[0] : m_points[i+1];
+    m_edges[i].start = m_points[i];
+    m_edges[i].vector = next_point - m_points[i];
+    m_edges[i].length_squared = m_edges[i].vector.squared_length();
+  }
+  m_min_x = m_max_x = m_points_2d[0].x;
+  m_min_y = m_max_y = m_points_2d[0].y;
+  for (const SUPoint2D& point : m_points_2d) {
+    m_min_x = std::min(m_min_x, point.x);
+    m_max_x = std::max(m_max_x, point.x);
+    m_min_y = std::min(m_min_y, point.y);
+    m_max_y = std::max(m_max_y, point.y);
+  }
+  m_min_x -= MARGIN;
+  m_max_x += MARGIN;
+  m_min_y -= MARGIN;
+  m_max_y += MARGIN;
+
+  // One band per edge keeps the number of edges in each band small for typical loops.  But an edge is held in every band it spans, so where most edges span most of the loop's height (as in a zigzag), the bands are made taller, to keep the index within three entries per edge.
+  const double height = m_max_y - m_min_y;
+  double total_span = 0.0;
+  for (size_t i=0; i < num_points; ++i) {
+    total_span += std::abs(m_points_2d[(i + 1) % num_points].y - m_points_2d[i].y) + (2.0 * MARGIN);
+  }
+  const double max_bands = static_cast<double>(num_points) * height / total_span;
+  const size_t num_bands = std::max<size_t>(1, std::min(num_points, static_cast<size_t>(max_bands)));
+  m_inverse_band_height = static_cast<double>(num_bands) / height;
+  // Count the edges in each band, then place them, so the bands can be stored contiguously.
+  std::vector<size_t> first_band(num_points);
+  std::vector<size_t> last_band(num_points);
+  m_band_offsets.assign(num_bands + 1, 0);
+  for (size_t i=0; i < num_points; ++i) {
+    const double start_y = m_points_2d[i].y;
+    const double end_y = m_points_2d[(i + 1) % num_points].y;
+    first_band[i] = band(std::min(start_y, end_y) - MARGIN);
+    last_band[i] = band(std::max(start_y, end_y) + MARGIN);
+    for (size_t j=first_band[i]; j <= last_band[i]; ++j) {
+      ++m_band_offsets[j + 1];
+    }
+  }
+  for (size_t j=0; j < num_bands; ++j) {
+    m_band_offsets[j + 1] += m_band_offsets[j];
+  }
+  m_band_edges.resize(m_band_offsets[num_bands]);
+  std::vector<size_t> next_slot(m_band_offsets.begin(), m_band_offsets.end() - 1);
+  for (size_t i=0; i < num_points; ++i) {
+    for (size_t j=first_band[i]; j <= last_band[i]; ++j) {
+      m_band_edges[next_slot[j]++] = i;
+    }
+  }
+}
+
+
+size_t LoopClassifier::band(double y) const {
+  // The band is a monotonic function of y, so a value within an edge's y range always falls in one of the edge's bands.
+  const double position = (y - m_min_y) * m_inverse_band_height;
+  const size_t num_bands = m_band_offsets.size() - 1;
+  if (!(position > 0.0)) {
+    return 0;
+  }
+  if (position >= static_cast<double>(num_bands)) {
+    return num_bands - 1;
+  }
+  return static_cast<size_t>(position);
+}
+
+
+PointLoopClassify LoopClassifier::classify(const Point3D& point) const {
+  if (!point) {
+    throw std::invalid_argument("CW::LoopClassifier::classify(): Point3D given is null");
+  }
+  if (!m_plane.on_plane(point)) {
+    return PointLoopClassify::PointNotOnPlane;
+  }
+  const SUPoint2D point_2d = Predicates::project(point, m_axis);
+  if (point_2d.x < m_min_x || point_2d.x > m_max_x || point_2d.y < m_min_y || point_2d.y > m_max_y) {
+    return PointLoopClassify::PointOutside;
+  }
+  // The checks are made in the same order as Loop::classify_point(), but only on the edges in the point's band.  Every vertex and edge within tolerance of the point, and every edge crossing the ray from the point, is in this band.
+  const size_t point_band = band(point_2d.y);
+  const size_t* const band_begin = m_band_edges.data() + m_band_offsets[point_band];
+  const size_t* const band_end = m_band_edges.data() + m_band_offsets[point_band + 1];
+  for (const size_t* edge = band_begin; edge != band_end; ++edge) {
+    if (m_points[*edge] == point) {
+      return PointLoopClassify::PointOnVertex;
+    }
+  }
+  for (const size_t* edge = band_begin; edge != band_end; ++edge) {
+    const EdgeData& data = m_edges[*edge];
+    if (data.length_squared == 0.0) {
+      continue;
+    }
+    const double factor = std::min(std::max(data.vector.dot(point - data.start) / data.length_squared, 0.0), 1.0);
+    const Vector3D offset = point - (data.start + (data.vector * factor));
+    if (offset.squared_length() < Point3D::EPSILON * Point3D::EPSILON) {
+      return PointLoopClassify::PointOnEdge;
+    }
+  }
+  const size_t num_points = m_points.size();
+  bool inside = false;
+  for (const size_t* edge = band_begin; edge != band_end; ++edge) {
+    const SUPoint2D& start = m_points_2d[*edge];
+    const SUPoint2D& end = m_points_2d[*edge + 1 == num_points ? 0 : *edge + 1];
+    if ((start.y > point_2d.y) != (end.y > point_2d.y)) {
+      const double orientation = Predicates::orient2d(start, end, point_2d);
+      if ((end.y > start.y) == (orientation > 0.0)) {
+        inside = !inside;
+      }
+    }
+  }
+  if (inside) {
+    return PointLoopClassify::PointInside;
+  }
+  return PointLoopClassify::PointOutside;
+}
+
+
+const Plane3D& LoopClassifier::plane() const {
+  return m_plane;
+}
+
+
+size_t LoopClassifier::size() const {
+  return m_points.size();
+}
+
+
+size_t LoopClassifier::index_size() const {
+  return m_band_edges.size();
+}
+
+} /* namespace CW */
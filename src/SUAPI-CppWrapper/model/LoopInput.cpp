@@ -108,6 +108,28 @@ LoopInput::LoopInput(const std::vector<InputEdgeProperties>& loop_edge_propertie
 }
 
 
+LoopInput::LoopInput(const FaceData::LoopView& loop, size_t vertex_index):
+  LoopInput()
+{
+  for (size_t i=0; i < loop.size(); ++i) {
+    add_vertex_index(vertex_index);
+    if (SU_API_VERSION_MAJOR >= 5) {
+      const FaceData::EdgeData& edge = loop.edge(i);
+      set_edge_hidden(i, edge.hidden());
+      set_edge_soft(i, edge.soft());
+      set_edge_smooth(i, edge.smooth());
+      if (SUIsValid(edge.material)) {
+        set_edge_material(i, Material(edge.material));
+      }
+      if (SUIsValid(edge.layer)) {
+        set_edge_layer(i, Layer(edge.layer));
+      }
+    }
+    ++vertex_index;
+  }
+}
+
+
 LoopInput::LoopInput(const LoopInput& other):
   m_loop_input(create_loop_input_ref())
 {
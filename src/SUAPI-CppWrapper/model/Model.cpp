@@ -39,6 +39,7 @@
 #include "SUAPI-CppWrapper/model/Classifications.hpp"
 #include "SUAPI-CppWrapper/model/Location.hpp"
 #include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/DefinitionGraph.hpp"
 #include "SUAPI-CppWrapper/model/InstancePath.hpp"
 #include "SUAPI-CppWrapper/model/Material.hpp"
 #include "SUAPI-CppWrapper/model/Texture.hpp"
@@ -381,6 +382,14 @@ std::vector<ComponentDefinition> Model::group_definitions() const {
 }
 
 
+DefinitionGraph Model::definition_graph() const {
+  if(!(*this)) {
+    throw std::logic_error("CW::Model::definition_graph(): Model is null");
+  }
+  return DefinitionGraph(*this);
+}
+
+
 InstancePath Model::instance_path(const String& persistent_id) const {
   SUInstancePathRef instance_path_ref = SU_INVALID;
   SUResult res = SUInstancePathCreate(&instance_path_ref);
@@ -0,0 +1,166 @@
+//
+//  ModelRayCaster.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SUAPI-CppWrapper/model/ModelRayCaster.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/MeshHelper.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+
+namespace CW {
+
+bool ModelRayCaster::Hit::operator!() const {
+  return !face;
+}
+
+
+ModelRayCaster::ModelRayCaster()
+{}
+
+
+ModelRayCaster::ModelRayCaster(const Model& model) {
+  if (!model) {
+    throw std::logic_error("CW::ModelRayCaster::ModelRayCaster(): Model is null");
+  }
+  const Entities entities = model.entities();
+  std::vector<SUComponentInstanceRef> path;
+  add_entities(entities, add_mesh(entities), Transformation(), path);
+  m_caster.build();
+}
+
+
+ModelRayCaster::ModelRayCaster(const Entities& entities) {
+  if (!SUIsValid(entities.ref())) {
+    throw std::logic_error("CW::ModelRayCaster::ModelRayCaster(): Entities is null");
+  }
+  std::vector<SUComponentInstanceRef> path;
+  add_entities(entities, add_mesh(entities), Transformation(), path);
+  m_caster.build();
+}
+
+
+size_t ModelRayCaster::add_mesh(const Entities& entities) {
+  std::vector<Point3D> vertices;
+  std::vector<size_t> indices;
+  std::vector<SUFaceRef> faces;
+  for (const Face& face : entities.face_range()) {
+    const MeshHelper mesh(face);
+    const std::vector<Point3D> mesh_vertices = mesh.vertices();
+    const std::vector<size_t> mesh_indices = mesh.vertex_indices();
+    const std::vector<Vector3D> normals = mesh.normals();
+    const size_t offset = vertices.size();
+    vertices.insert(vertices.end(), mesh_vertices.begin(), mesh_vertices.end());
+    for (size_t i=0; i + 2 < mesh_indices.size(); i += 3) {
+      size_t a = mesh_indices[i];
+      size_t b = mesh_indices[i + 1];
+      size_t c = mesh_indices[i + 2];
+      // The RayCaster gives the normal on the side of the triangle's winding, so the triangles are wound to match the face.
+      const Vector3D winding = Vector3D(mesh_vertices[b] - mesh_vertices[a]).cross(Vector3D(mesh_vertices[c] - mesh_vertices[a]));
+      if (winding.dot(normals[a]) < 0.0) {
+        std::swap(b, c);
+      }
+      indices.insert(indices.end(), {offset + a, offset + b, offset + c});
+      faces.push_back(face.ref());
+    }
+  }
+  m_mesh_faces.push_back(std::move(faces));
+  return m_caster.add_mesh(vertices, indices);
+}
+
+
+void ModelRayCaster::add_entities(const Entities& entities, size_t mesh, const Transformation& world, std::vector<SUComponentInstanceRef>& path) {
+  if (!m_mesh_faces[mesh].empty()) {
+    try {
+      m_caster.add_instance(mesh, world);
+    }
+    catch (const std::invalid_argument&) {
+      // Instances scaled to nothing cannot be hit.
+      return;
+    }
+    m_instance_meshes.push_back(mesh);
+    m_instance_paths.push_back(path);
+  }
+  auto add_instance = [&](const ComponentInstance& instance) {
+    const ComponentDefinition definition = instance.definition();
+    const Entities definition_entities = definition.entities();
+    auto found = m_definition_meshes.find(definition.ref().ptr);
+    if (found == m_definition_meshes.end()) {
+      found = m_definition_meshes.emplace(definition.ref().ptr, add_mesh(definition_entities)).first;
+    }
+    path.push_back(instance.ref());
+    add_entities(definition_entities, found->second, world * instance.transformation(), path);
+    path.pop_back();
+  };
+  for (const Group& group : entities.group_range()) {
+    add_instance(group);
+  }
+  for (const ComponentInstance& instance : entities.instance_range()) {
+    add_instance(instance);
+  }
+}
+
+
+ModelRayCaster::Hit ModelRayCaster::raytest(const Point3D& origin, const Vector3D& direction) const {
+  const RayCaster::Ray ray{origin, direction};
+  return resolve(ray, m_caster.cast(ray));
+}
+
+
+std::vector<RayCaster::Hit> ModelRayCaster::cast(const std::vector<RayCaster::Ray>& rays, size_t num_threads) const {
+  return m_caster.cast(rays, num_threads);
+}
+
+
+ModelRayCaster::Hit ModelRayCaster::resolve(const RayCaster::Ray& ray, const RayCaster::Hit& hit) const {
+  if (!hit) {
+    return Hit{Face(), InstancePath(), hit.distance, Point3D(false), Vector3D(false)};
+  }
+  if (hit.instance >= m_instance_meshes.size()) {
+    throw std::out_of_range("CW::ModelRayCaster::resolve(): hit is not from this ModelRayCaster");
+  }
+  const Face face(m_mesh_faces[m_instance_meshes[hit.instance]][hit.triangle]);
+  InstancePath path;
+  for (const SUComponentInstanceRef& instance : m_instance_paths[hit.instance]) {
+    path.push(ComponentInstance(instance));
+  }
+  path.set_leaf(face);
+  const Point3D point = ray.origin + (ray.direction.unit() * hit.distance);
+  return Hit{face, path, hit.distance, point, hit.normal};
+}
+
+
+const RayCaster& ModelRayCaster::caster() const {
+  return m_caster;
+}
+
+} /* namespace CW */
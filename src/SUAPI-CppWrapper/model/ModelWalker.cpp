@@ -0,0 +1,209 @@
+//
+//  ModelWalker.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/ModelWalker.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <stdexcept>
+
+#include <SketchUpAPI/model/entities.h>
+
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/Model.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* Returns the indices of the values in descending order.  Ties keep their order.
+*/
+template <class Value>
+std::vector<size_t> descending_order(const std::vector<Value>& values) {
+  std::vector<size_t> order(values.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return values[a] > values[b];
+  });
+  return order;
+}
+
+} // namespace
+
+
+ModelWalker::ModelWalker(const Model& model, size_t num_threads):
+  m_num_threads(thread_count(num_threads))
+{
+  if (!model) {
+    throw std::logic_error("CW::ModelWalker::ModelWalker(): Model is null");
+  }
+  m_entities = model.entities();
+  build();
+}
+
+
+ModelWalker::ModelWalker(const Entities& entities, size_t num_threads):
+  m_entities(entities),
+  m_num_threads(thread_count(num_threads))
+{
+  if (!SUIsValid(entities.ref())) {
+    throw std::logic_error("CW::ModelWalker::ModelWalker(): Entities is null");
+  }
+  build();
+}
+
+
+size_t ModelWalker::add_node(SUComponentDefinitionRef definition, const Entities& entities, std::unordered_map<const void*, size_t>& node_indices, std::vector<bool>& reading) {
+  const size_t index = m_nodes.size();
+  if (SUIsValid(definition)) {
+    node_indices.emplace(definition.ptr, index);
+  }
+  m_nodes.push_back(Node{definition, 0, 0, {}});
+  reading.push_back(true);
+  Entities entities_copy(entities);
+  size_t num_faces = 0;
+  SUResult res = SUEntitiesGetNumFaces(entities_copy, &num_faces);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  std::vector<Child> children;
+  auto add_child = [&](const ComponentInstance& instance) {
+    const ComponentDefinition child_definition = instance.definition();
+    auto found = node_indices.find(child_definition.ref().ptr);
+    const size_t child_node = found == node_indices.end() ? add_node(child_definition.ref(), child_definition.entities(), node_indices, reading) : found->second;
+    // A definition still being read contains itself, through this instance, so the walks would never end.  As in DefinitionGraph, the cycle is checked rather than assumed impossible.
+    if (reading[child_node]) {
+      throw std::logic_error("CW::ModelWalker::ModelWalker(): the definitions have a cycle");
+    }
+    children.push_back(Child{child_node, instance.ref(), instance.transformation()});
+  };
+  for (const Group& group : entities.group_range()) {
+    add_child(group);
+  }
+  for (const ComponentInstance& instance : entities.instance_range()) {
+    add_child(instance);
+  }
+  // The children are complete before their parent, so their totals are known.  m_nodes may have grown, so the node is only referred to now.
+  size_t total_faces = num_faces;
+  for (const Child& child : children) {
+    total_faces += m_nodes[child.node].total_faces;
+  }
+  Node& node = m_nodes[index];
+  node.num_faces = num_faces;
+  node.total_faces = total_faces;
+  node.children = std::move(children);
+  reading[index] = false;
+  m_finish_order.push_back(index);
+  return index;
+}
+
+
+void ModelWalker::build() {
+  std::unordered_map<const void*, size_t> node_indices;
+  std::vector<bool> reading; // the nodes whose entities are being read, which are those on the path from the root to the current node
+  add_node(SU_INVALID, m_entities, node_indices, reading);
+  m_heaviest_children.reserve(m_nodes.size());
+  std::vector<size_t> num_faces;
+  num_faces.reserve(m_nodes.size());
+  for (const Node& node : m_nodes) {
+    std::vector<size_t> child_faces;
+    child_faces.reserve(node.children.size());
+    for (const Child& child : node.children) {
+      child_faces.push_back(m_nodes[child.node].total_faces);
+    }
+    m_heaviest_children.push_back(descending_order(child_faces));
+    num_faces.push_back(node.num_faces);
+  }
+  m_heaviest_nodes = descending_order(num_faces);
+}
+
+
+void ModelWalker::push_instance(InstancePath& path, SUComponentInstanceRef instance) {
+  path.push(ComponentInstance(instance));
+}
+
+
+size_t ModelWalker::num_nodes() const {
+  return m_nodes.size();
+}
+
+
+const ModelWalker::Node& ModelWalker::node(size_t index) const {
+  return m_nodes.at(index);
+}
+
+
+ComponentDefinition ModelWalker::definition(size_t index) const {
+  const Node& found = m_nodes.at(index);
+  if (SUIsInvalid(found.definition)) {
+    return ComponentDefinition();
+  }
+  return ComponentDefinition(found.definition);
+}
+
+
+Entities ModelWalker::entities(size_t index) const {
+  if (SUIsInvalid(m_nodes.at(index).definition)) {
+    return m_entities;
+  }
+  return definition(index).entities();
+}
+
+
+std::vector<size_t> ModelWalker::occurrence_counts() const {
+  // Every instance adds the occurrences of its parent to its child.  A node finishes after all the nodes below it, so in reverse order of finishing each node's count is complete before it is passed on.
+  std::vector<size_t> counts(m_nodes.size(), 0);
+  counts[0] = 1;
+  for (auto it = m_finish_order.rbegin(); it != m_finish_order.rend(); ++it) {
+    for (const Child& child : m_nodes[*it].children) {
+      counts[child.node] += counts[*it];
+    }
+  }
+  return counts;
+}
+
+
+InstancePath ModelWalker::instance_path(const Occurrence& occurrence) const {
+  InstancePath path;
+  for (SUComponentInstanceRef instance : occurrence.path) {
+    push_instance(path, instance);
+  }
+  return path;
+}
+
+
+size_t ModelWalker::num_threads() const {
+  return m_num_threads;
+}
+
+} /* namespace CW */
@@ -0,0 +1,272 @@
+//
+//  PolygonMesh.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/PolygonMesh.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include <SketchUpAPI/model/drawing_element.h>
+
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/EntityRefs.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+
+namespace CW {
+
+constexpr uint32_t PolygonMesh::NO_INDEX;
+
+PolygonMesh::PolygonMesh():
+  m_loop_starts(1, 0),
+  m_face_loops(1, 0)
+{}
+
+
+PolygonMesh::PolygonMesh(const Entities& entities, bool recursive):
+  PolygonMesh()
+{
+  add(entities, Transformation(), recursive);
+}
+
+
+void PolygonMesh::add(const Entities& entities, const Transformation& transformation, bool recursive) {
+  Scratch scratch;
+  add_entities(entities, transformation, recursive, scratch);
+}
+
+
+uint32_t PolygonMesh::vertex_index(SUVertexRef vertex, Scratch& scratch) {
+  auto inserted = scratch.vertex_indices.emplace(vertex.ptr, static_cast<uint32_t>(m_points.size()));
+  if (inserted.second) {
+    SUPoint3D position;
+    SUResult res = SUVertexGetPosition(vertex, &position);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    m_points.push_back(position);
+  }
+  return inserted.first->second;
+}
+
+
+uint32_t PolygonMesh::material_index(SUMaterialRef material) {
+  auto inserted = m_material_lookup.emplace(material.ptr, static_cast<uint32_t>(m_materials.size()));
+  if (inserted.second) {
+    m_materials.push_back(Material(material));
+  }
+  return inserted.first->second;
+}
+
+
+uint32_t PolygonMesh::layer_index(SULayerRef layer) {
+  auto inserted = m_layer_lookup.emplace(layer.ptr, static_cast<uint32_t>(m_layers.size()));
+  if (inserted.second) {
+    m_layers.push_back(Layer(layer));
+  }
+  return inserted.first->second;
+}
+
+
+void PolygonMesh::add_face(SUFaceRef face, Scratch& scratch) {
+  // The outer loop, followed by the inner loops
+  size_t num_inner_loops = 0;
+  SUResult res = SUFaceGetNumInnerLoops(face, &num_inner_loops);
+  assert(res == SU_ERROR_NONE);
+  SULoopRef invalid_loop = SU_INVALID;
+  scratch.loops.assign(num_inner_loops + 1, invalid_loop);
+  res = SUFaceGetOuterLoop(face, &scratch.loops[0]);
+  assert(res == SU_ERROR_NONE);
+  if (num_inner_loops > 0) {
+    res = SUFaceGetInnerLoops(face, num_inner_loops, &scratch.loops[1], &num_inner_loops);
+    assert(res == SU_ERROR_NONE);
+  }
+  for (size_t i=0; i < num_inner_loops + 1; ++i) {
+    size_t count = 0;
+    res = SULoopGetNumVertices(scratch.loops[i], &count);
+    assert(res == SU_ERROR_NONE);
+    SUVertexRef invalid_vertex = SU_INVALID;
+    scratch.vertices.assign(count, invalid_vertex);
+    if (count > 0) {
+      res = SULoopGetVertices(scratch.loops[i], count, scratch.vertices.data(), &count);
+      assert(res == SU_ERROR_NONE);
+    }
+    for (size_t j=0; j < count; ++j) {
+      m_indices.push_back(vertex_index(scratch.vertices[j], scratch));
+    }
+    m_loop_starts.push_back(static_cast<uint32_t>(m_indices.size()));
+  }
+  m_face_loops.push_back(static_cast<uint32_t>(m_loop_starts.size() - 1));
+
+  SUDrawingElementRef element = SUFaceToDrawingElement(face);
+  SUMaterialRef material = SU_INVALID;
+  res = SUDrawingElementGetMaterial(element, &material);
+  m_face_materials.push_back(res == SU_ERROR_NONE && SUIsValid(material) ? material_index(material) : NO_INDEX);
+  SUMaterialRef back_material = SU_INVALID;
+  res = SUFaceGetBackMaterial(face, &back_material);
+  m_face_back_materials.push_back(res == SU_ERROR_NONE && SUIsValid(back_material) ? material_index(back_material) : NO_INDEX);
+  SULayerRef layer = SU_INVALID;
+  res = SUDrawingElementGetLayer(element, &layer);
+  m_face_layers.push_back(res == SU_ERROR_NONE && SUIsValid(layer) ? layer_index(layer) : NO_INDEX);
+}
+
+
+void PolygonMesh::add_edge(SUEdgeRef edge, Scratch& scratch) {
+  SUVertexRef start = SU_INVALID;
+  SUVertexRef end = SU_INVALID;
+  SUResult res = SUEdgeGetStartVertex(edge, &start);
+  assert(res == SU_ERROR_NONE);
+  res = SUEdgeGetEndVertex(edge, &end);
+  assert(res == SU_ERROR_NONE);
+  m_edges.push_back(vertex_index(start, scratch));
+  m_edges.push_back(vertex_index(end, scratch));
+  bool hidden = false;
+  bool soft = false;
+  bool smooth = false;
+  res = SUDrawingElementGetHidden(SUEdgeToDrawingElement(edge), &hidden);
+  assert(res == SU_ERROR_NONE);
+  res = SUEdgeGetSoft(edge, &soft);
+  assert(res == SU_ERROR_NONE);
+  res = SUEdgeGetSmooth(edge, &smooth);
+  assert(res == SU_ERROR_NONE); _unused(res);
+  m_edge_flags.push_back(static_cast<uint8_t>((hidden ? FaceData::EdgeHidden : 0) | (soft ? FaceData::EdgeSoft : 0) | (smooth ? FaceData::EdgeSmooth : 0)));
+}
+
+
+void PolygonMesh::add_entities(const Entities& entities, const Transformation& transformation, bool recursive, Scratch& scratch) {
+  // Vertices are never shared between Entities objects, and the same definition may be met again with a different transformation.
+  scratch.vertex_indices.clear();
+  const size_t first_point = m_points.size();
+  const size_t first_loop = m_loop_starts.size() - 1;
+  for (FaceRef face : entities.face_range().as<FaceRef>()) {
+    add_face(face.ref(), scratch);
+  }
+  for (EdgeRef edge : entities.edge_range(false).as<EdgeRef>()) {
+    add_edge(edge.ref(), scratch);
+  }
+  if (!transformation.is_identity()) {
+    transformation.transform_points(m_points.data() + first_point, m_points.size() - first_point);
+    if (transformation.is_mirrored()) {
+      // Keep the loops counter-clockwise about the transformed normals
+      for (size_t i = first_loop; i + 1 < m_loop_starts.size(); ++i) {
+        std::reverse(m_indices.begin() + m_loop_starts[i], m_indices.begin() + m_loop_starts[i + 1]);
+      }
+    }
+  }
+  if (!recursive) {
+    return;
+  }
+  auto add_instance = [&](const auto& instance) {
+    add_entities(instance.definition().entities(), transformation * instance.transformation(), true, scratch);
+  };
+  for (const ComponentInstance& instance : entities.instances()) {
+    add_instance(instance);
+  }
+  for (const Group& group : entities.groups()) {
+    add_instance(group);
+  }
+}
+
+
+size_t PolygonMesh::num_points() const {
+  return m_points.size();
+}
+
+
+size_t PolygonMesh::num_faces() const {
+  return m_face_loops.size() - 1;
+}
+
+
+size_t PolygonMesh::num_loops() const {
+  return m_loop_starts.size() - 1;
+}
+
+
+size_t PolygonMesh::num_edges() const {
+  return m_edge_flags.size();
+}
+
+
+const std::vector<SUPoint3D>& PolygonMesh::points() const {
+  return m_points;
+}
+
+
+const std::vector<uint32_t>& PolygonMesh::indices() const {
+  return m_indices;
+}
+
+
+const std::vector<uint32_t>& PolygonMesh::loop_starts() const {
+  return m_loop_starts;
+}
+
+
+const std::vector<uint32_t>& PolygonMesh::face_loops() const {
+  return m_face_loops;
+}
+
+
+const std::vector<uint32_t>& PolygonMesh::face_materials() const {
+  return m_face_materials;
+}
+
+
+const std::vector<uint32_t>& PolygonMesh::face_back_materials() const {
+  return m_face_back_materials;
+}
+
+
+const std::vector<uint32_t>& PolygonMesh::face_layers() const {
+  return m_face_layers;
+}
+
+
+const std::vector<uint32_t>& PolygonMesh::edges() const {
+  return m_edges;
+}
+
+
+const std::vector<uint8_t>& PolygonMesh::edge_flags() const {
+  return m_edge_flags;
+}
+
+
+const std::vector<Material>& PolygonMesh::materials() const {
+  return m_materials;
+}
+
+
+const std::vector<Layer>& PolygonMesh::layers() const {
+  return m_layers;
+}
+
+} /* namespace CW */
@@ -0,0 +1,361 @@
+//
+//  SpatialIndex.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SUAPI-CppWrapper/model/SpatialIndex.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+#include <SketchUpAPI/model/camera.h>
+
+#include "SUAPI-CppWrapper/model/Camera.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/InstancePath.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* Returns the world space box containing the transformed corners of the local box.
+*/
+SUBoundingBox3D transform_box(const Transformation& transformation, const SUBoundingBox3D& box) {
+  if (!(box.min_point.x <= box.max_point.x && box.min_point.y <= box.max_point.y && box.min_point.z <= box.max_point.z)) {
+    // Empty boxes (such as the bounds of an empty definition) stay empty.
+    return BoundingVolumeHierarchy::empty_box();
+  }
+  SUPoint3D corners[8];
+  for (size_t i=0; i < 8; ++i) {
+    corners[i] = SUPoint3D{(i & 1) ? box.max_point.x : box.min_point.x,
+                           (i & 2) ? box.max_point.y : box.min_point.y,
+                           (i & 4) ? box.max_point.z : box.min_point.z};
+  }
+  transformation.transform_points(corners, 8);
+  SUBoundingBox3D result = BoundingVolumeHierarchy::empty_box();
+  for (const SUPoint3D& corner : corners) {
+    BoundingVolumeHierarchy::expand(result, SUBoundingBox3D{corner, corner});
+  }
+  return result;
+}
+
+/**
+* Returns the squared distance from the point to the nearest point in the box, which is zero if the point is inside it.
+*/
+double squared_distance(const SUBoundingBox3D& box, const Point3D& point) {
+  const double dx = std::max({box.min_point.x - point.x, 0.0, point.x - box.max_point.x});
+  const double dy = std::max({box.min_point.y - point.y, 0.0, point.y - box.max_point.y});
+  const double dz = std::max({box.min_point.z - point.z, 0.0, point.z - box.max_point.z});
+  return (dx * dx) + (dy * dy) + (dz * dz);
+}
+
+/**
+* Returns true if some of the box is on the inner (negative) side of every plane.  The corner of the box furthest along the inside of each plane is tested, so boxes outside the volume but near its edges pass too.
+*/
+bool inside_planes(const SUBoundingBox3D& box, const std::vector<Plane3D>& planes) {
+  for (const Plane3D& plane : planes) {
+    const Vector3D normal = plane.normal();
+    const Point3D nearest(normal.x > 0.0 ? box.min_point.x : box.max_point.x,
+                          normal.y > 0.0 ? box.min_point.y : box.max_point.y,
+                          normal.z > 0.0 ? box.min_point.z : box.max_point.z);
+    if (plane.distance(nearest) > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+SpatialIndex::SpatialIndex()
+{}
+
+
+SpatialIndex::SpatialIndex(const Entities& entities, size_t max_depth) {
+  m_frames.push_back(Frame{SU_INVALID, NO_PARENT, Transformation(), Transformation()});
+  add_entities(entities, NO_PARENT, 0, 0, max_depth);
+  m_world_bounds.resize(m_items.size());
+  for (size_t i=0; i < m_items.size(); ++i) {
+    m_world_bounds[i] = transform_box(m_frames[m_item_frames[i]].world, m_local_bounds[i]);
+  }
+  m_hierarchy = BoundingVolumeHierarchy(m_world_bounds);
+}
+
+
+void SpatialIndex::add_entities(const Entities& entities, size_t parent, size_t frame, size_t depth, size_t max_depth) {
+  for (Face face : entities.face_range()) {
+    add_item(SUFaceToDrawingElement(face.ref()), SURefType_Face, parent, frame, face.bounds());
+  }
+  for (Edge edge : entities.edge_range(false)) {
+    add_item(SUEdgeToDrawingElement(edge.ref()), SURefType_Edge, parent, frame, edge.bounds());
+  }
+  for (const Group& group : entities.group_range()) {
+    add_instance(group, SURefType_Group, parent, frame, depth, max_depth);
+  }
+  for (const ComponentInstance& instance : entities.instance_range()) {
+    add_instance(instance, SURefType_ComponentInstance, parent, frame, depth, max_depth);
+  }
+}
+
+
+void SpatialIndex::add_instance(const ComponentInstance& instance, SURefType type, size_t parent, size_t frame, size_t depth, size_t max_depth) {
+  const Transformation local = instance.transformation();
+  const size_t instance_frame = m_frames.size();
+  m_frames.push_back(Frame{instance.ref(), frame, local, m_frames[frame].world * local});
+  // The instance's bounds are kept in its own coordinates, so that they follow it when its transformation changes.
+  const Entities entities = instance.definition().entities();
+  const size_t index = add_item(SUComponentInstanceToDrawingElement(instance.ref()), type, parent, instance_frame, entities.bounding_box());
+  m_instance_items.emplace(instance.ref().ptr, index);
+  if (depth < max_depth) {
+    add_entities(entities, index, instance_frame, depth + 1, max_depth);
+  }
+  m_subtree_ends[index] = m_items.size();
+}
+
+
+size_t SpatialIndex::add_item(SUDrawingElementRef element, SURefType type, size_t parent, size_t frame, const SUBoundingBox3D& local_bounds) {
+  const size_t index = m_items.size();
+  m_items.push_back(Item{element, type, parent});
+  m_item_frames.push_back(frame);
+  m_subtree_ends.push_back(index + 1);
+  m_local_bounds.push_back(local_bounds);
+  return index;
+}
+
+
+size_t SpatialIndex::size() const {
+  return m_items.size();
+}
+
+
+const SpatialIndex::Item& SpatialIndex::item(size_t index) const {
+  if (index >= m_items.size()) {
+    throw std::out_of_range("CW::SpatialIndex::item(): index out of range");
+  }
+  return m_items[index];
+}
+
+
+BoundingBox3D SpatialIndex::bounds(size_t index) const {
+  item(index);
+  return BoundingBox3D(m_world_bounds[index]);
+}
+
+
+const Transformation& SpatialIndex::transformation(size_t index) const {
+  const Item& indexed = item(index);
+  const size_t frame = m_item_frames[index];
+  if (indexed.type == SURefType_Group || indexed.type == SURefType_ComponentInstance) {
+    return m_frames[m_frames[frame].parent].world;
+  }
+  return m_frames[frame].world;
+}
+
+
+InstancePath SpatialIndex::path(size_t index) const {
+  std::vector<size_t> ancestors;
+  for (size_t parent = item(index).parent; parent != NO_PARENT; parent = m_items[parent].parent) {
+    ancestors.push_back(parent);
+  }
+  InstancePath instance_path;
+  for (auto ancestor = ancestors.rbegin(); ancestor != ancestors.rend(); ++ancestor) {
+    instance_path.push(ComponentInstance(m_frames[m_item_frames[*ancestor]].instance));
+  }
+  const SUEntityRef entity = SUDrawingElementToEntity(m_items[index].element);
+  switch (m_items[index].type) {
+    case SURefType_Face:
+      instance_path.set_leaf(Face(SUFaceFromEntity(entity)));
+      break;
+    case SURefType_Edge:
+      instance_path.set_leaf(Edge(SUEdgeFromEntity(entity)));
+      break;
+    case SURefType_Group:
+      instance_path.set_leaf(Group(SUGroupFromEntity(entity)));
+      break;
+    default:
+      instance_path.set_leaf(ComponentInstance(SUComponentInstanceFromEntity(entity)));
+      break;
+  }
+  return instance_path;
+}
+
+
+template <typename BoxTest>
+std::vector<size_t> SpatialIndex::collect(BoxTest&& test) const {
+  std::vector<size_t> results;
+  m_hierarchy.traverse(test, [&](size_t index) {
+    if (test(m_world_bounds[index])) {
+      results.push_back(index);
+    }
+  });
+  return results;
+}
+
+
+std::vector<size_t> SpatialIndex::query(const BoundingBox3D& box) const {
+  const SUBoundingBox3D query_box = box;
+  return collect([&](const SUBoundingBox3D& bounds) {
+    return BoundingVolumeHierarchy::overlaps(bounds, query_box);
+  });
+}
+
+
+std::vector<size_t> SpatialIndex::query(const Point3D& centre, double radius) const {
+  if (!centre) {
+    throw std::invalid_argument("CW::SpatialIndex::query(): Point3D given is null");
+  }
+  const double radius_squared = radius * radius;
+  return collect([&](const SUBoundingBox3D& bounds) {
+    return squared_distance(bounds, centre) <= radius_squared;
+  });
+}
+
+
+std::vector<size_t> SpatialIndex::query(const std::vector<Plane3D>& planes) const {
+  return collect([&](const SUBoundingBox3D& bounds) {
+    return inside_planes(bounds, planes);
+  });
+}
+
+
+std::vector<size_t> SpatialIndex::query(const Camera& camera, double screen_aspect_ratio) const {
+  return query(frustum_planes(camera, screen_aspect_ratio));
+}
+
+
+std::vector<Plane3D> SpatialIndex::frustum_planes(const Camera& camera, double screen_aspect_ratio) {
+  if (!camera) {
+    throw std::logic_error("CW::SpatialIndex::frustum_planes(): Camera is null");
+  }
+  Point3D eye;
+  Point3D target;
+  Vector3D up;
+  camera.orientation(eye, target, up);
+  const Vector3D direction = (target - eye).unit();
+  const Vector3D right = direction.cross(up).unit();
+  const Vector3D true_up = right.cross(direction);
+  double aspect_ratio = screen_aspect_ratio;
+  SUResult res = SUCameraGetAspectRatio(camera.ref(), &aspect_ratio);
+  if (res != SU_ERROR_NONE) {
+    // The camera uses the aspect ratio of the screen.
+    aspect_ratio = screen_aspect_ratio;
+  }
+  if (!(aspect_ratio > 0.0)) {
+    throw std::invalid_argument("CW::SpatialIndex::frustum_planes(): aspect ratio must be positive");
+  }
+  const std::pair<double, double> clipping = camera.clipping_distances();
+  std::vector<Plane3D> planes;
+  planes.push_back(Plane3D(direction * -1.0, eye + (direction * clipping.first)));
+  planes.push_back(Plane3D(direction, eye + (direction * clipping.second)));
+  if (camera.perspective()) {
+    // Half the width and height of the view at unit distance from the eye.
+    const double half_angle = 0.5 * camera.fov() * std::acos(-1.0) / 180.0;
+    double half_height = std::tan(half_angle);
+    double half_width = half_height * aspect_ratio;
+    if (!camera.fov_is_height()) {
+      half_width = half_height;
+      half_height = half_width / aspect_ratio;
+    }
+    // Each side plane passes through the eye.  Its normal is perpendicular to the edge of the view, pointing away from the centre of the view.
+    const Vector3D edges[4] = {direction + (right * half_width), direction - (right * half_width),
+                               direction + (true_up * half_height), direction - (true_up * half_height)};
+    const Vector3D across[4] = {true_up, true_up, right, right};
+    const Vector3D outward[4] = {right, right * -1.0, true_up, true_up * -1.0};
+    for (size_t i=0; i < 4; ++i) {
+      Vector3D normal = edges[i].cross(across[i]);
+      if (normal.dot(outward[i]) < 0.0) {
+        normal = normal * -1.0;
+      }
+      planes.push_back(Plane3D(normal.unit(), eye));
+    }
+  }
+  else {
+    const double half_height = 0.5 * camera.orthographic_height();
+    const double half_width = half_height * aspect_ratio;
+    planes.push_back(Plane3D(right, eye + (right * half_width)));
+    planes.push_back(Plane3D(right * -1.0, eye - (right * half_width)));
+    planes.push_back(Plane3D(true_up, eye + (true_up * half_height)));
+    planes.push_back(Plane3D(true_up * -1.0, eye - (true_up * half_height)));
+  }
+  return planes;
+}
+
+
+void SpatialIndex::update_world(size_t index, std::vector<size_t>& changed) {
+  // Items are listed depth first, so the frame of each instance's parent is always updated before the instance.
+  for (size_t i=index; i < m_subtree_ends[index]; ++i) {
+    const SURefType type = m_items[i].type;
+    if (type == SURefType_Group || type == SURefType_ComponentInstance) {
+      Frame& frame = m_frames[m_item_frames[i]];
+      frame.world = m_frames[frame.parent].world * frame.local;
+    }
+    m_world_bounds[i] = transform_box(m_frames[m_item_frames[i]].world, m_local_bounds[i]);
+    changed.push_back(i);
+  }
+}
+
+
+size_t SpatialIndex::update(const ComponentInstance& instance) {
+  if (!instance) {
+    throw std::logic_error("CW::SpatialIndex::update(): ComponentInstance is null");
+  }
+  const auto range = m_instance_items.equal_range(instance.ref().ptr);
+  if (range.first == range.second) {
+    return 0;
+  }
+  const Transformation local = instance.transformation();
+  std::vector<size_t> changed;
+  size_t count = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    m_frames[m_item_frames[it->second]].local = local;
+    update_world(it->second, changed);
+    ++count;
+  }
+  m_hierarchy.refit(m_world_bounds, changed);
+  return count;
+}
+
+
+void SpatialIndex::update() {
+  for (size_t i=1; i < m_frames.size(); ++i) {
+    m_frames[i].local = ComponentInstance(m_frames[i].instance).transformation();
+    m_frames[i].world = m_frames[m_frames[i].parent].world * m_frames[i].local;
+  }
+  for (size_t i=0; i < m_items.size(); ++i) {
+    m_world_bounds[i] = transform_box(m_frames[m_item_frames[i]].world, m_local_bounds[i]);
+  }
+  m_hierarchy.refit(m_world_bounds);
+}
+
+} /* namespace CW */
@@ -0,0 +1,398 @@
+//
+//  TessellationCache.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SUAPI-CppWrapper/model/TessellationCache.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <SketchUpAPI/model/face.h>
+#include <SketchUpAPI/model/texture_writer.h>
+#include <SketchUpAPI/model/uv_helper.h>
+
+#include "SUAPI-CppWrapper/Color.hpp"
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/String.hpp"
+#include "SUAPI-CppWrapper/TessellationFileCache.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
+#include "SUAPI-CppWrapper/model/MeshHelper.hpp"
+#include "SUAPI-CppWrapper/model/Texture.hpp"
+
+#ifndef _unused
+#define _unused(x) ((void)(x))
+#endif
+
+namespace CW {
+
+namespace {
+
+/**
+* Changed whenever what content_hash() reads, or the layout of TessellatedMesh, changes, so that files written by older versions are not found.
+*/
+constexpr uint64_t CONTENT_HASH_VERSION = 1;
+
+/**
+* Hashes a sequence of 64 bit words, each mixed into the state with the splitmix64 finaliser.
+*/
+class ContentHasher {
+  private:
+  uint64_t m_state;
+
+  public:
+  explicit ContentHasher(uint64_t seed):
+    m_state(seed)
+  {}
+
+  void add(uint64_t word) {
+    uint64_t x = m_state ^ word;
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    m_state = x ^ (x >> 31);
+  }
+
+  void add(double value) {
+    // Negative zero is the same coordinate as zero.
+    if (value == 0.0) {
+      value = 0.0;
+    }
+    uint64_t word;
+    std::memcpy(&word, &value, sizeof(word));
+    add(word);
+  }
+
+  void add(const SUPoint3D& point) {
+    add(point.x);
+    add(point.y);
+    add(point.z);
+  }
+
+  void add(const std::string& string) {
+    add(static_cast<uint64_t>(string.size()));
+    for (size_t i=0; i < string.size(); i += sizeof(uint64_t)) {
+      uint64_t word = 0;
+      std::memcpy(&word, string.data() + i, std::min(sizeof(uint64_t), string.size() - i));
+      add(word);
+    }
+  }
+
+  uint64_t result() const {
+    return m_state;
+  }
+};
+
+
+/**
+* Returns the hash of the properties of a material that affect an exported mesh.
+* @param textured - set to true if the material has a texture.
+*/
+uint64_t material_hash(SUMaterialRef material_ref, bool& textured) {
+  const Material material(material_ref);
+  ContentHasher hasher(CONTENT_HASH_VERSION);
+  hasher.add(material.name().std_string());
+  hasher.add(static_cast<uint64_t>(material.type()));
+  const SUColor color = material.color().ref();
+  hasher.add((static_cast<uint64_t>(color.red) << 24) | (static_cast<uint64_t>(color.green) << 16) | (static_cast<uint64_t>(color.blue) << 8) | color.alpha);
+  hasher.add(material.opacity());
+  const Texture texture = material.texture();
+  textured = SUIsValid(texture.ref());
+  if (textured) {
+    hasher.add(texture.file_name().std_string());
+    hasher.add(static_cast<uint64_t>(texture.width()));
+    hasher.add(static_cast<uint64_t>(texture.height()));
+    hasher.add(texture.s_scale());
+    hasher.add(texture.t_scale());
+  }
+  return hasher.result();
+}
+
+
+/**
+* Returns the material on the front of a face, or an invalid reference if the front is unpainted.
+*/
+SUMaterialRef face_front_material(SUFaceRef face) {
+  SUMaterialRef material = SU_INVALID;
+  SUResult res = SUFaceGetFrontMaterial(face, &material);
+  if (res == SU_ERROR_NO_DATA) {
+    return SU_INVALID;
+  }
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return material;
+}
+
+
+/**
+* Returns the material on the back of a face, or an invalid reference if the back is unpainted.
+*/
+SUMaterialRef face_back_material(SUFaceRef face) {
+  SUMaterialRef material = SU_INVALID;
+  SUResult res = SUFaceGetBackMaterial(face, &material);
+  if (res == SU_ERROR_NO_DATA) {
+    return SU_INVALID;
+  }
+  assert(res == SU_ERROR_NONE); _unused(res);
+  return material;
+}
+
+
+/**
+* Tessellates the faces of the entities with a MeshHelper each, giving each pair of front and back materials a range.
+* @param material_index - called with each SUMaterialRef, to return its index in the caller's materials, or TessellatedMesh::NO_INDEX for SU_INVALID.
+*/
+template<typename MaterialIndex>
+TessellatedMesh tessellate_faces(const Entities& entities, MaterialIndex&& material_index) {
+  std::vector<TessellatedMesh::Vertex> vertices;
+  // The triangles of each pair of front and back materials, in the order the pairs were first found.
+  std::vector<TessellatedMesh::MaterialRange> ranges;
+  std::vector<std::vector<uint32_t>> range_indices;
+  std::unordered_map<uint64_t, size_t> range_lookup;
+  for (const Face& face : entities.face_range()) {
+    const MeshHelper mesh(face);
+    const std::vector<Point3D> points = mesh.vertices();
+    const std::vector<Vector3D> normals = mesh.normals();
+    const std::vector<Point3D> front_stq = mesh.front_stq_coords();
+    const std::vector<Point3D> back_stq = mesh.back_stq_coords();
+    const std::vector<size_t> indices = mesh.vertex_indices();
+    const uint32_t offset = static_cast<uint32_t>(vertices.size());
+    for (size_t i=0; i < points.size(); ++i) {
+      vertices.push_back(TessellatedMesh::Vertex{points[i], normals[i], front_stq[i], back_stq[i]});
+    }
+    const uint32_t front_index = material_index(face_front_material(face.ref()));
+    const uint32_t back_index = material_index(face_back_material(face.ref()));
+    const uint64_t key = (static_cast<uint64_t>(front_index) << 32) | back_index;
+    auto found = range_lookup.find(key);
+    if (found == range_lookup.end()) {
+      found = range_lookup.emplace(key, ranges.size()).first;
+      ranges.push_back(TessellatedMesh::MaterialRange{front_index, back_index, 0, 0});
+      range_indices.emplace_back();
+    }
+    std::vector<uint32_t>& face_indices = range_indices[found->second];
+    for (size_t index : indices) {
+      face_indices.push_back(offset + static_cast<uint32_t>(index));
+    }
+  }
+  std::vector<uint32_t> indices;
+  for (size_t r=0; r < ranges.size(); ++r) {
+    ranges[r].first_index = static_cast<uint32_t>(indices.size());
+    ranges[r].num_indices = static_cast<uint32_t>(range_indices[r].size());
+    indices.insert(indices.end(), range_indices[r].begin(), range_indices[r].end());
+  }
+  return TessellatedMesh(vertices, indices, ranges);
+}
+
+} // namespace
+
+
+double TessellationCache::Stats::hit_rate() const {
+  const size_t requests = hits + misses;
+  return requests == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(requests);
+}
+
+
+TessellationCache::TessellationCache():
+  m_hits(0),
+  m_misses(0)
+{}
+
+
+uint32_t TessellationCache::material_index(SUMaterialRef material) {
+  if (SUIsInvalid(material)) {
+    return TessellatedMesh::NO_INDEX;
+  }
+  auto found = m_material_lookup.find(material.ptr);
+  if (found != m_material_lookup.end()) {
+    return found->second;
+  }
+  const uint32_t index = static_cast<uint32_t>(m_materials.size());
+  m_materials.push_back(Material(material));
+  m_material_lookup.emplace(material.ptr, index);
+  return index;
+}
+
+
+const TessellatedMesh& TessellationCache::mesh(const ComponentDefinition& definition, uint64_t revision) {
+  if (!definition) {
+    throw std::logic_error("CW::TessellationCache::mesh(): ComponentDefinition is null");
+  }
+  auto found = m_entries.find(definition.ref().ptr);
+  if (found != m_entries.end() && found->second.revision == revision) {
+    ++m_hits;
+    return found->second.mesh;
+  }
+  ++m_misses;
+  TessellatedMesh mesh = tessellate(definition.entities());
+  if (found == m_entries.end()) {
+    found = m_entries.emplace(definition.ref().ptr, Entry{revision, std::move(mesh)}).first;
+  }
+  else {
+    found->second.revision = revision;
+    found->second.mesh = std::move(mesh);
+  }
+  return found->second.mesh;
+}
+
+
+TessellatedMesh TessellationCache::tessellate(const Entities& entities) {
+  return tessellate_faces(entities, [this](SUMaterialRef material) {
+    return material_index(material);
+  });
+}
+
+
+uint64_t TessellationCache::content_hash(const Entities& entities) {
+  const FaceData faces(entities.faces());
+  ContentHasher hasher(CONTENT_HASH_VERSION);
+  hasher.add(static_cast<uint64_t>(faces.size()));
+  // The hashes of the materials, and whether they are textured, as each is usually shared by many faces.
+  std::unordered_map<const void*, std::pair<uint64_t, bool>> material_hashes;
+  auto add_material = [&](SUMaterialRef material) {
+    if (SUIsInvalid(material)) {
+      hasher.add(static_cast<uint64_t>(0));
+      return false;
+    }
+    auto found = material_hashes.find(material.ptr);
+    if (found == material_hashes.end()) {
+      bool textured = false;
+      const uint64_t hash = material_hash(material, textured);
+      found = material_hashes.emplace(material.ptr, std::make_pair(hash, textured)).first;
+    }
+    hasher.add(found->second.first);
+    return found->second.second;
+  };
+  for (size_t i=0; i < faces.size(); ++i) {
+    const FaceData::FaceView face = faces[i];
+    const size_t num_loops = 1 + face.num_inner_loops();
+    hasher.add(static_cast<uint64_t>(num_loops));
+    for (size_t l=0; l < num_loops; ++l) {
+      const FaceData::LoopView loop = l == 0 ? face.outer_loop() : face.inner_loop(l - 1);
+      hasher.add(static_cast<uint64_t>(loop.size()));
+      for (size_t p=0; p < loop.size(); ++p) {
+        hasher.add(static_cast<SUPoint3D>(loop.point(p)));
+        // Soft and smooth edges may change the normals.
+        hasher.add(static_cast<uint64_t>(loop.edge(p).flags & (FaceData::EdgeSoft | FaceData::EdgeSmooth)));
+      }
+    }
+    const bool front_textured = add_material(face_front_material(face.face_ref()));
+    const bool back_textured = add_material(face_back_material(face.face_ref()));
+    if (!front_textured && !back_textured) {
+      continue;
+    }
+    // The texture coordinates of a textured side depend on how the texture was positioned on the face.  A face without a textured side has none, so its UV helper is not made.
+    SUTextureWriterRef texture_writer = SU_INVALID;
+    SUUVHelperRef uv_helper = SU_INVALID;
+    SUResult res = SUFaceGetUVHelper(face.face_ref(), front_textured, back_textured, texture_writer, &uv_helper);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    for (size_t l=0; l < num_loops; ++l) {
+      const FaceData::LoopView loop = l == 0 ? face.outer_loop() : face.inner_loop(l - 1);
+      for (const Point3D& point : loop) {
+        SUPoint3D su_point = point;
+        SUUVQ uvq{0.0, 0.0, 0.0};
+        if (front_textured) {
+          SUUVHelperGetFrontUVQ(uv_helper, &su_point, &uvq);
+          hasher.add(uvq.u);
+          hasher.add(uvq.v);
+          hasher.add(uvq.q);
+        }
+        if (back_textured) {
+          SUUVHelperGetBackUVQ(uv_helper, &su_point, &uvq);
+          hasher.add(uvq.u);
+          hasher.add(uvq.v);
+          hasher.add(uvq.q);
+        }
+      }
+    }
+    res = SUUVHelperRelease(&uv_helper);
+    assert(res == SU_ERROR_NONE);
+  }
+  return hasher.result();
+}
+
+
+TessellatedMesh TessellationCache::load_or_tessellate(const Entities& entities, TessellationFileCache& file_cache, std::vector<std::string>& material_names) {
+  const uint64_t hash = content_hash(entities);
+  TessellatedMesh mesh;
+  if (file_cache.find(hash, mesh, material_names)) {
+    return mesh;
+  }
+  material_names.clear();
+  std::unordered_map<const void*, uint32_t> material_lookup;
+  mesh = tessellate_faces(entities, [&](SUMaterialRef material) {
+    if (SUIsInvalid(material)) {
+      return TessellatedMesh::NO_INDEX;
+    }
+    auto found = material_lookup.find(material.ptr);
+    if (found == material_lookup.end()) {
+      found = material_lookup.emplace(material.ptr, static_cast<uint32_t>(material_names.size())).first;
+      material_names.push_back(Material(material).name().std_string());
+    }
+    return found->second;
+  });
+  file_cache.store(hash, mesh, material_names);
+  return mesh;
+}
+
+
+const std::vector<Material>& TessellationCache::materials() const {
+  return m_materials;
+}
+
+
+bool TessellationCache::contains(const ComponentDefinition& definition) const {
+  return m_entries.find(definition.ref().ptr) != m_entries.end();
+}
+
+
+void TessellationCache::erase(const ComponentDefinition& definition) {
+  m_entries.erase(definition.ref().ptr);
+}
+
+
+void TessellationCache::clear() {
+  m_entries.clear();
+  m_hits = 0;
+  m_misses = 0;
+}
+
+
+TessellationCache::Stats TessellationCache::stats() const {
+  Stats stats{m_hits, m_misses, m_entries.size(), 0, 0, 0};
+  for (const auto& entry : m_entries) {
+    stats.num_vertices += entry.second.mesh.num_vertices();
+    stats.num_triangles += entry.second.mesh.num_triangles();
+    stats.memory_usage += entry.second.mesh.size_bytes();
+  }
+  return stats;
+}
+
+} /* namespace CW */
@@ -0,0 +1,198 @@
+//
+//  VertexTree.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Macro for getting rid of unused variables commonly for assert checking
+#define _unused(x) ((void)(x))
+
+#include "SUAPI-CppWrapper/model/VertexTree.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <SketchUpAPI/model/edge.h>
+
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+
+namespace CW {
+
+namespace {
+
+/**
+* The vertices of a set of entities, in their own coordinates.
+*/
+struct EntitiesVertices {
+  std::vector<SUVertexRef> vertices;
+  std::vector<Point3D> positions;
+};
+
+/**
+* Collects the vertices at the ends of the edges, each once.  The C API is called directly, rather than through Edge::start() and Vertex::position(), as this is done for every vertex in the model.
+*/
+EntitiesVertices entities_vertices(const Entities& entities) {
+  EntitiesVertices result;
+  std::unordered_set<const void*> seen;
+  for (const Edge& edge : entities.edge_range(false)) {
+    SUVertexRef ends[2] = {SU_INVALID, SU_INVALID};
+    SUResult res = SUEdgeGetStartVertex(edge.ref(), &ends[0]);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    res = SUEdgeGetEndVertex(edge.ref(), &ends[1]);
+    assert(res == SU_ERROR_NONE); _unused(res);
+    for (SUVertexRef vertex : ends) {
+      if (!seen.insert(vertex.ptr).second) {
+        continue;
+      }
+      SUPoint3D position;
+      res = SUVertexGetPosition(vertex, &position);
+      assert(res == SU_ERROR_NONE); _unused(res);
+      result.vertices.push_back(vertex);
+      result.positions.push_back(Point3D(position));
+    }
+  }
+  return result;
+}
+
+/**
+* Adds the vertices of the entities, and of the groups and component instances in them, in world space.  The vertices of each definition are only fetched once.
+*/
+void add_vertices(const Entities& entities, const EntitiesVertices& local, const Transformation& world, size_t depth, size_t max_depth,
+                  std::unordered_map<const void*, EntitiesVertices>& definitions, std::vector<SUVertexRef>& vertices, std::vector<Point3D>& positions) {
+  vertices.insert(vertices.end(), local.vertices.begin(), local.vertices.end());
+  if (world.is_identity()) {
+    positions.insert(positions.end(), local.positions.begin(), local.positions.end());
+  }
+  else {
+    std::vector<Point3D> world_positions = local.positions;
+    world.transform_points(world_positions);
+    positions.insert(positions.end(), world_positions.begin(), world_positions.end());
+  }
+  if (depth >= max_depth) {
+    return;
+  }
+  auto add_instance = [&](const ComponentInstance& instance) {
+    const ComponentDefinition definition = instance.definition();
+    const Entities definition_entities = definition.entities();
+    auto found = definitions.find(definition.ref().ptr);
+    if (found == definitions.end()) {
+      found = definitions.emplace(definition.ref().ptr, entities_vertices(definition_entities)).first;
+    }
+    add_vertices(definition_entities, found->second, world * instance.transformation(), depth + 1, max_depth, definitions, vertices, positions);
+  };
+  for (const Group& group : entities.group_range()) {
+    add_instance(group);
+  }
+  for (const ComponentInstance& instance : entities.instance_range()) {
+    add_instance(instance);
+  }
+}
+
+} // namespace
+
+VertexTree::VertexTree()
+{}
+
+
+VertexTree::VertexTree(const Entities& entities, size_t max_depth, size_t num_threads) {
+  std::unordered_map<const void*, EntitiesVertices> definitions;
+  add_vertices(entities, entities_vertices(entities), Transformation(), 0, max_depth, definitions, m_vertices, m_positions);
+  m_tree = KdTree(m_positions, num_threads);
+}
+
+
+size_t VertexTree::size() const {
+  return m_vertices.size();
+}
+
+
+bool VertexTree::empty() const {
+  return m_vertices.empty();
+}
+
+
+const KdTree& VertexTree::tree() const {
+  return m_tree;
+}
+
+
+Vertex VertexTree::vertex(size_t index) const {
+  if (index >= m_vertices.size()) {
+    throw std::out_of_range("CW::VertexTree::vertex(): index out of range");
+  }
+  return Vertex(m_vertices[index]);
+}
+
+
+Point3D VertexTree::position(size_t index) const {
+  if (index >= m_vertices.size()) {
+    throw std::out_of_range("CW::VertexTree::position(): index out of range");
+  }
+  return m_positions[index];
+}
+
+
+Vertex VertexTree::nearest(const Point3D& point, double max_distance) const {
+  const size_t found = m_tree.nearest(point, max_distance);
+  return found == KdTree::NOT_FOUND ? Vertex() : Vertex(m_vertices[found]);
+}
+
+
+std::vector<Vertex> VertexTree::k_nearest(const Point3D& point, size_t k, double max_distance) const {
+  std::vector<Vertex> results;
+  for (size_t found : m_tree.k_nearest(point, k, max_distance)) {
+    results.push_back(Vertex(m_vertices[found]));
+  }
+  return results;
+}
+
+
+std::vector<Vertex> VertexTree::within(const Point3D& point, double radius) const {
+  std::vector<Vertex> results;
+  for (size_t found : m_tree.within(point, radius)) {
+    results.push_back(Vertex(m_vertices[found]));
+  }
+  return results;
+}
+
+
+std::vector<Vertex> VertexTree::nearest(const std::vector<Point3D>& points, double radius, size_t num_threads) const {
+  // The tree is searched in parallel, and the Vertex objects made afterwards, on this thread.
+  const std::vector<size_t> found = m_tree.nearest(points, radius, num_threads);
+  std::vector<Vertex> results;
+  results.reserve(found.size());
+  for (size_t index : found) {
+    results.push_back(index == KdTree::NOT_FOUND ? Vertex() : Vertex(m_vertices[index]));
+  }
+  return results;
+}
+
+} /* namespace CW */
@@ -0,0 +1,131 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "SUAPI-CppWrapper/BoundingVolumeHierarchy.hpp"
+
+
+namespace {
+
+std::vector<SUBoundingBox3D> random_boxes(size_t count, unsigned int seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> position(0.0, 1000.0);
+  std::uniform_real_distribution<double> size(0.0, 20.0);
+  std::vector<SUBoundingBox3D> boxes(count);
+  for (SUBoundingBox3D& box : boxes) {
+    box.min_point = SUPoint3D{position(generator), position(generator), position(generator)};
+    box.max_point = SUPoint3D{box.min_point.x + size(generator), box.min_point.y + size(generator), box.min_point.z + size(generator)};
+  }
+  return boxes;
+}
+
+std::vector<size_t> overlapping(const CW::BoundingVolumeHierarchy& hierarchy, const std::vector<SUBoundingBox3D>& boxes, const SUBoundingBox3D& query) {
+  std::vector<size_t> results;
+  hierarchy.traverse([&](const SUBoundingBox3D& bounds) {
+    return CW::BoundingVolumeHierarchy::overlaps(bounds, query);
+  }, [&](size_t item) {
+    if (CW::BoundingVolumeHierarchy::overlaps(boxes[item], query)) {
+      results.push_back(item);
+    }
+  });
+  std::sort(results.begin(), results.end());
+  return results;
+}
+
+std::vector<size_t> overlapping(const std::vector<SUBoundingBox3D>& boxes, const SUBoundingBox3D& query) {
+  std::vector<size_t> results;
+  for (size_t i=0; i < boxes.size(); ++i) {
+    if (CW::BoundingVolumeHierarchy::overlaps(boxes[i], query)) {
+      results.push_back(i);
+    }
+  }
+  return results;
+}
+
+} // namespace
+
+
+TEST(BoundingVolumeHierarchy, Structure)
+{
+  const std::vector<SUBoundingBox3D> boxes = random_boxes(1000, 1);
+  const CW::BoundingVolumeHierarchy hierarchy(boxes);
+  ASSERT_EQ(boxes.size(), hierarchy.size());
+  std::vector<size_t> items = hierarchy.items();
+  std::sort(items.begin(), items.end());
+  for (size_t i=0; i < items.size(); ++i) {
+    ASSERT_EQ(i, items[i]);
+  }
+  // Every node contains its children, and every leaf contains its items.
+  const std::vector<CW::BoundingVolumeHierarchy::Node>& nodes = hierarchy.nodes();
+  for (size_t i=0; i < nodes.size(); ++i) {
+    const CW::BoundingVolumeHierarchy::Node& node = nodes[i];
+    if (node.count == 0) {
+      ASSERT_GT(node.first, i);
+      for (size_t child : {node.first, node.first + 1}) {
+        SUBoundingBox3D expanded = node.bounds;
+        CW::BoundingVolumeHierarchy::expand(expanded, nodes[child].bounds);
+        ASSERT_EQ(0, std::memcmp(&expanded, &node.bounds, sizeof(SUBoundingBox3D)));
+      }
+    }
+    else {
+      for (size_t j=node.first; j < node.first + node.count; ++j) {
+        SUBoundingBox3D expanded = node.bounds;
+        CW::BoundingVolumeHierarchy::expand(expanded, boxes[hierarchy.items()[j]]);
+        ASSERT_EQ(0, std::memcmp(&expanded, &node.bounds, sizeof(SUBoundingBox3D)));
+      }
+    }
+  }
+}
+
+
+TEST(BoundingVolumeHierarchy, QueryMatchesBruteForce)
+{
+  const std::vector<SUBoundingBox3D> boxes = random_boxes(5000, 2);
+  const CW::BoundingVolumeHierarchy hierarchy(boxes);
+  for (const SUBoundingBox3D& query : random_boxes(100, 3)) {
+    SUBoundingBox3D larger = query;
+    larger.max_point = SUPoint3D{query.max_point.x + 50.0, query.max_point.y + 50.0, query.max_point.z + 50.0};
+    ASSERT_EQ(overlapping(boxes, larger), overlapping(hierarchy, boxes, larger));
+  }
+}
+
+
+TEST(BoundingVolumeHierarchy, Refit)
+{
+  std::vector<SUBoundingBox3D> boxes = random_boxes(2000, 4);
+  CW::BoundingVolumeHierarchy hierarchy(boxes);
+  CW::BoundingVolumeHierarchy fully_refit(boxes);
+  // Move some of the boxes a long way.
+  std::vector<size_t> changed;
+  for (size_t i=0; i < boxes.size(); i += 37) {
+    boxes[i].min_point.x += 500.0;
+    boxes[i].max_point.x += 500.0;
+    boxes[i].min_point.z -= 300.0;
+    changed.push_back(i);
+  }
+  hierarchy.refit(boxes, changed);
+  fully_refit.refit(boxes);
+  ASSERT_EQ(hierarchy.nodes().size(), fully_refit.nodes().size());
+  for (size_t i=0; i < hierarchy.nodes().size(); ++i) {
+    ASSERT_EQ(0, std::memcmp(&hierarchy.nodes()[i].bounds, &fully_refit.nodes()[i].bounds, sizeof(SUBoundingBox3D)));
+  }
+  for (const SUBoundingBox3D& query : random_boxes(100, 5)) {
+    ASSERT_EQ(overlapping(boxes, query), overlapping(hierarchy, boxes, query));
+  }
+}
+
+
+TEST(BoundingVolumeHierarchy, Degenerate)
+{
+  const CW::BoundingVolumeHierarchy empty(std::vector<SUBoundingBox3D>{});
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(overlapping(empty, {}, random_boxes(1, 6)[0]).empty());
+  // Coincident boxes cannot be divided, but must still be found.
+  const std::vector<SUBoundingBox3D> coincident(500, SUBoundingBox3D{SUPoint3D{1.0, 1.0, 1.0}, SUPoint3D{2.0, 2.0, 2.0}});
+  const CW::BoundingVolumeHierarchy hierarchy(coincident);
+  EXPECT_EQ(coincident.size(), overlapping(hierarchy, coincident, coincident[0]).size());
+  EXPECT_THROW(CW::BoundingVolumeHierarchy(coincident, 0), std::invalid_argument);
+}
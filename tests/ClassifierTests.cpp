@@ -0,0 +1,137 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/LoopClassifier.hpp"
+#include "SUAPI-CppWrapper/model/FaceClassifier.hpp"
+
+
+namespace {
+
+/**
+* A star shaped loop on a sloping plane, which has many edges crossing each band of the classifier.
+*/
+std::vector<CW::Point3D> star_loop(size_t num_spikes, double offset) {
+  std::vector<CW::Point3D> points;
+  const double pi = std::acos(-1.0);
+  for (size_t i=0; i < num_spikes * 2; ++i) {
+    const double angle = pi * static_cast<double>(i) / static_cast<double>(num_spikes);
+    const double radius = (i % 2 == 0) ? 100.0 : 40.0;
+    const double x = radius * std::cos(angle);
+    const double y = radius * std::sin(angle);
+    points.push_back(CW::Point3D(offset + x, offset + y, 0.5 * x));
+  }
+  return points;
+}
+
+std::vector<CW::Point3D> square_loop(double min_x, double min_y, double size) {
+  return {
+    CW::Point3D(min_x, min_y, 0.5 * min_x),
+    CW::Point3D(min_x, min_y + size, 0.5 * min_x),
+    CW::Point3D(min_x + size, min_y + size, 0.5 * (min_x + size)),
+    CW::Point3D(min_x + size, min_y, 0.5 * (min_x + size))
+  };
+}
+
+/**
+* Points near the loop: random points in its bounds, its vertices, points on and just off its edges, and points level with its vertices.
+*/
+std::vector<CW::Point3D> test_points(const std::vector<CW::Point3D>& loop_points, double offset) {
+  std::vector<CW::Point3D> points;
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> distribution(-110.0, 110.0);
+  for (size_t i=0; i < 2000; ++i) {
+    const double x = distribution(generator);
+    points.push_back(CW::Point3D(offset + x, offset + distribution(generator), 0.5 * x));
+  }
+  for (size_t i=0; i < loop_points.size(); ++i) {
+    const CW::Point3D& start = loop_points[i];
+    const CW::Point3D& end = loop_points[(i + 1) % loop_points.size()];
+    points.push_back(start);
+    for (double factor : {0.25, 0.5}) {
+      const CW::Point3D on_edge = start + ((end - start) * factor);
+      points.push_back(on_edge);
+      for (double shift : {0.0003, 0.0007, -0.0003, -0.0007}) {
+        points.push_back(CW::Point3D(on_edge.x + shift, on_edge.y, on_edge.z + 0.5 * shift));
+      }
+    }
+    points.push_back(CW::Point3D(start.x - 5.0, start.y, start.z - 2.5));
+    points.push_back(CW::Point3D(start.x + 5.0, start.y, start.z + 2.5));
+  }
+  points.push_back(CW::Point3D(offset, offset, 1.0));
+  return points;
+}
+
+} // namespace
+
+
+TEST(LoopClassifier, MatchesLoopClassifyPoint)
+{
+  for (double offset : {0.0, 1.0e6}) {
+    const std::vector<CW::Point3D> loop_points = star_loop(24, offset);
+    const CW::LoopClassifier classifier(loop_points);
+    ASSERT_EQ(loop_points.size(), classifier.size());
+    for (const CW::Point3D& point : test_points(loop_points, offset)) {
+      ASSERT_EQ(CW::Loop::classify_point(loop_points, point), classifier.classify(point)) << point;
+    }
+  }
+}
+
+
+TEST(LoopClassifier, Zigzag)
+{
+  // A serrated profile, with every tooth spanning the whole height of the loop.
+  constexpr size_t NUM_TEETH = 2000;
+  std::vector<CW::Point3D> loop_points = {CW::Point3D(0.0, -10.0, 0.0)};
+  for (size_t i=0; i <= NUM_TEETH * 2; ++i) {
+    const double x = static_cast<double>(i);
+    loop_points.push_back(CW::Point3D(x, (i % 2 == 0) ? 0.0 : 100.0, 0.5 * x));
+  }
+  loop_points.push_back(CW::Point3D(NUM_TEETH * 2.0, -10.0, NUM_TEETH * 1.0));
+  const CW::LoopClassifier classifier(loop_points);
+  // Holding each edge in every band it spans would need an entry for nearly every edge in every band.
+  EXPECT_LE(classifier.index_size(), 3 * classifier.size());
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> x_distribution(-1.0, NUM_TEETH * 2.0 + 1.0);
+  std::uniform_real_distribution<double> y_distribution(-11.0, 101.0);
+  std::vector<CW::Point3D> points;
+  for (size_t i=0; i < 200; ++i) {
+    const double x = x_distribution(generator);
+    points.push_back(CW::Point3D(x, y_distribution(generator), 0.5 * x));
+  }
+  points.insert(points.end(), loop_points.begin(), loop_points.begin() + 20);
+  points.push_back(CW::Point3D(1.5, 50.0, 0.75));
+  points.push_back(CW::Point3D(1.0, 50.0, 0.5));
+  for (const CW::Point3D& point : points) {
+    ASSERT_EQ(CW::Loop::classify_point(loop_points, point), classifier.classify(point)) << point;
+  }
+}
+
+
+TEST(LoopClassifier, Errors)
+{
+  const std::vector<CW::Point3D> two_points = {CW::Point3D(0.0, 0.0, 0.0), CW::Point3D(1.0, 0.0, 0.0)};
+  EXPECT_THROW(CW::LoopClassifier{two_points}, std::invalid_argument);
+  const CW::LoopClassifier classifier(square_loop(0.0, 0.0, 10.0));
+  EXPECT_THROW(classifier.classify(CW::Point3D()), std::invalid_argument);
+}
+
+
+TEST(FaceClassifier, Holes)
+{
+  const std::vector<CW::Point3D> outer_loop = square_loop(0.0, 0.0, 30.0);
+  const std::vector<std::vector<CW::Point3D>> inner_loops = {square_loop(5.0, 5.0, 5.0), square_loop(20.0, 20.0, 5.0)};
+  const CW::FaceClassifier classifier(outer_loop, inner_loops);
+  EXPECT_EQ(CW::FacePointClass::PointInside, classifier.classify(CW::Point3D(15.0, 15.0, 7.5)));
+  EXPECT_EQ(CW::FacePointClass::PointOutside, classifier.classify(CW::Point3D(7.5, 7.5, 3.75)));
+  EXPECT_EQ(CW::FacePointClass::PointOutside, classifier.classify(CW::Point3D(22.5, 22.5, 11.25)));
+  EXPECT_EQ(CW::FacePointClass::PointOutside, classifier.classify(CW::Point3D(35.0, 15.0, 17.5)));
+  EXPECT_EQ(CW::FacePointClass::PointOnVertex, classifier.classify(CW::Point3D(20.0, 25.0, 10.0)));
+  EXPECT_EQ(CW::FacePointClass::PointOnEdge, classifier.classify(CW::Point3D(5.0, 7.5, 2.5)));
+  EXPECT_EQ(CW::FacePointClass::PointOnEdge, classifier.classify(CW::Point3D(0.0, 15.0, 0.0)));
+  EXPECT_EQ(CW::FacePointClass::PointNotOnPlane, classifier.classify(CW::Point3D(15.0, 15.0, 8.5)));
+}
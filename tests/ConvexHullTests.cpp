@@ -0,0 +1,198 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SUAPI-CppWrapper/ConvexHull.hpp"
+
+namespace {
+
+/**
+* Adds the twelve triangles of an axis-aligned box to a mesh, facing outwards.
+*/
+void add_box(std::vector<CW::Point3D>& vertices, std::vector<size_t>& indices, const CW::Point3D& low, const CW::Point3D& high) {
+  const size_t first = vertices.size();
+  for (size_t i=0; i < 8; ++i) {
+    vertices.push_back(CW::Point3D((i & 1) ? high.x : low.x, (i & 2) ? high.y : low.y, (i & 4) ? high.z : low.z));
+  }
+  const size_t faces[6][4] = {{0, 2, 3, 1}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 6, 7, 3}, {0, 4, 6, 2}, {1, 3, 7, 5}};
+  for (const auto& face : faces) {
+    indices.insert(indices.end(), {first + face[0], first + face[1], first + face[2], first + face[0], first + face[2], first + face[3]});
+  }
+}
+
+/**
+* Rotates a point about an arbitrary axis through the origin.
+*/
+CW::Point3D rotate(const CW::Point3D& point) {
+  const double a = 0.5;
+  const double b = 0.3;
+  const CW::Point3D p1(point.x * std::cos(a) - point.y * std::sin(a), point.x * std::sin(a) + point.y * std::cos(a), point.z);
+  return CW::Point3D(p1.x, p1.y * std::cos(b) - p1.z * std::sin(b), p1.y * std::sin(b) + p1.z * std::cos(b));
+}
+
+} // namespace
+
+namespace CW {
+
+TEST(ConvexHull, CubeWithInteriorPoints) {
+  std::vector<Point3D> points;
+  std::mt19937 random(7);
+  std::uniform_real_distribution<double> coordinate(0.5, 9.5);
+  for (size_t i=0; i < 200; ++i) {
+    points.push_back(Point3D(coordinate(random), coordinate(random), coordinate(random)));
+  }
+  for (size_t i=0; i < 8; ++i) {
+    points.push_back(Point3D((i & 1) ? 10.0 : 0.0, (i & 2) ? 10.0 : 0.0, (i & 4) ? 10.0 : 0.0));
+  }
+  ConvexHull hull(points);
+  EXPECT_EQ(hull.vertices().size(), 8);
+  EXPECT_EQ(hull.indices().size(), 36);
+  EXPECT_NEAR(hull.volume(), 1000.0, 1e-9);
+  EXPECT_TRUE(hull.contains(Point3D(5.0, 5.0, 5.0)));
+  EXPECT_TRUE(hull.contains(Point3D(10.0, 10.0, 10.0)));
+  EXPECT_FALSE(hull.contains(Point3D(10.1, 5.0, 5.0)));
+}
+
+
+TEST(ConvexHull, CoplanarPointsOnSides) {
+  // Grids of points on each side of a cube are coplanar with the hull's faces, which quickhull must tolerate.
+  std::vector<Point3D> points;
+  for (int i=0; i <= 4; ++i) {
+    for (int j=0; j <= 4; ++j) {
+      const double u = i * 2.5;
+      const double v = j * 2.5;
+      points.insert(points.end(), {Point3D(u, v, 0.0), Point3D(u, v, 10.0), Point3D(u, 0.0, v), Point3D(u, 10.0, v), Point3D(0.0, u, v), Point3D(10.0, u, v)});
+    }
+  }
+  ConvexHull hull(points);
+  EXPECT_NEAR(hull.volume(), 1000.0, 1e-6);
+  for (const Point3D& point : points) {
+    EXPECT_TRUE(hull.contains(point));
+  }
+}
+
+
+TEST(ConvexHull, RandomPointsAreContained) {
+  std::vector<Point3D> points;
+  std::mt19937 random(11);
+  std::normal_distribution<double> coordinate(0.0, 50.0);
+  for (size_t i=0; i < 2000; ++i) {
+    points.push_back(Point3D(coordinate(random), coordinate(random), coordinate(random)));
+  }
+  ConvexHull hull(points);
+  EXPECT_GT(hull.volume(), 0.0);
+  for (const Point3D& point : points) {
+    EXPECT_TRUE(hull.contains(point));
+  }
+  // The hull of the hull's vertices is the same hull.
+  ConvexHull again(hull.vertices());
+  EXPECT_EQ(again.vertices().size(), hull.vertices().size());
+  EXPECT_NEAR(again.volume(), hull.volume(), hull.volume() * 1e-12);
+}
+
+
+TEST(ConvexHull, Degenerate) {
+  EXPECT_TRUE(ConvexHull().empty());
+  EXPECT_TRUE(ConvexHull(std::vector<Point3D>()).empty());
+  ConvexHull point({Point3D(1.0, 2.0, 3.0), Point3D(1.0, 2.0, 3.0)});
+  EXPECT_EQ(point.vertices().size(), 1);
+  EXPECT_TRUE(point.indices().empty());
+  ConvexHull line({Point3D(0.0, 0.0, 0.0), Point3D(1.0, 1.0, 1.0), Point3D(3.0, 3.0, 3.0)});
+  EXPECT_EQ(line.vertices().size(), 2);
+  EXPECT_TRUE(line.indices().empty());
+  EXPECT_DOUBLE_EQ(line.oriented_bounding_box().half_sizes[0], std::sqrt(27.0) / 2.0);
+  // Coplanar points give a flat hull with triangles on both sides.
+  ConvexHull flat({Point3D(0.0, 0.0, 1.0), Point3D(4.0, 0.0, 1.0), Point3D(2.0, 1.0, 1.0), Point3D(4.0, 3.0, 1.0), Point3D(0.0, 3.0, 1.0)});
+  EXPECT_EQ(flat.vertices().size(), 4);
+  EXPECT_EQ(flat.indices().size(), 12);
+  EXPECT_NEAR(flat.volume(), 0.0, 1e-12);
+  EXPECT_TRUE(flat.contains(Point3D(1.0, 1.0, 1.0)));
+  EXPECT_FALSE(flat.contains(Point3D(1.0, 1.0, 1.1)));
+  const OrientedBoundingBox box = flat.oriented_bounding_box();
+  EXPECT_NEAR(box.half_sizes[0] * box.half_sizes[1] * 4.0, 12.0, 1e-9);
+  EXPECT_NEAR(box.half_sizes[2], 0.0, 1e-12);
+}
+
+
+TEST(ConvexHull, SmallCube) {
+  // A cube a hundredth of an inch across, whose face normals are shorter than SketchUp's tolerance before normalisation.
+  std::vector<Point3D> points;
+  for (size_t i=0; i < 8; ++i) {
+    points.push_back(rotate(Point3D((i & 1) ? 0.01 : 0.0, (i & 2) ? 0.01 : 0.0, (i & 4) ? 0.01 : 0.0)));
+  }
+  points.push_back(rotate(Point3D(0.005, 0.005, 0.005)));
+  ConvexHull hull(points);
+  EXPECT_EQ(hull.vertices().size(), 8);
+  EXPECT_EQ(hull.indices().size(), 36);
+  EXPECT_NEAR(hull.volume(), 1e-6, 1e-15);
+  EXPECT_TRUE(hull.contains(rotate(Point3D(0.005, 0.005, 0.005))));
+  EXPECT_FALSE(hull.contains(rotate(Point3D(0.005, 0.005, 0.02))));
+  EXPECT_NEAR(hull.oriented_bounding_box().volume(), 1e-6, 1e-15);
+  // Coplanar and collinear points of the same size.
+  ConvexHull flat({Point3D(0.0, 0.0, 0.0), Point3D(0.01, 0.0, 0.0), Point3D(0.01, 0.01, 0.0), Point3D(0.0, 0.01, 0.0)});
+  EXPECT_EQ(flat.vertices().size(), 4);
+  EXPECT_EQ(flat.indices().size(), 12);
+  ConvexHull line({Point3D(0.0, 0.0, 0.0), Point3D(0.01, 0.0, 0.0)});
+  EXPECT_DOUBLE_EQ(line.oriented_bounding_box().half_sizes[0], 0.005);
+  // Decomposition of a small box.
+  std::vector<Point3D> box_vertices;
+  std::vector<size_t> box_indices;
+  add_box(box_vertices, box_indices, Point3D(0.0, 0.0, 0.0), Point3D(0.01, 0.01, 0.01));
+  const std::vector<ConvexHull> box_hulls = ConvexHull::decompose(box_vertices, box_indices);
+  ASSERT_EQ(box_hulls.size(), 1);
+  EXPECT_NEAR(box_hulls[0].volume(), 1e-6, 1e-15);
+}
+
+
+TEST(ConvexHull, OrientedBoundingBoxOfRotatedBox) {
+  std::vector<Point3D> points;
+  for (size_t i=0; i < 8; ++i) {
+    points.push_back(rotate(Point3D((i & 1) ? 4.0 : 0.0, (i & 2) ? 2.0 : 0.0, (i & 4) ? 1.0 : 0.0)));
+  }
+  ConvexHull hull(points);
+  const OrientedBoundingBox box = hull.oriented_bounding_box();
+  EXPECT_NEAR(box.volume(), 8.0, 1e-9);
+  for (const Point3D& corner : box.corners()) {
+    EXPECT_TRUE(hull.contains(corner));
+  }
+  EXPECT_NEAR(box.axes[0].cross(box.axes[1]).dot(box.axes[2]), 1.0, 1e-12);
+  const Point3D centre = rotate(Point3D(2.0, 1.0, 0.5));
+  EXPECT_NEAR(Vector3D(box.centre - centre).length(), 0.0, 1e-9);
+}
+
+
+TEST(ConvexHull, DecomposeLShape) {
+  // Two overlapping boxes form an L-shaped solid of volume 5, whose hull has volume 7.
+  std::vector<Point3D> vertices;
+  std::vector<size_t> indices;
+  add_box(vertices, indices, Point3D(0.0, 0.0, 0.0), Point3D(3.0, 1.0, 1.0));
+  add_box(vertices, indices, Point3D(0.0, 0.0, 0.0), Point3D(1.0, 3.0, 1.0));
+  EXPECT_NEAR(ConvexHull(vertices).volume(), 7.0, 1e-9);
+  const std::vector<ConvexHull> hulls = ConvexHull::decompose(vertices, indices);
+  ASSERT_GE(hulls.size(), 2);
+  EXPECT_LE(hulls.size(), 16);
+  double total = 0.0;
+  for (const ConvexHull& hull : hulls) {
+    total += hull.volume();
+  }
+  EXPECT_GT(total, 4.9);
+  EXPECT_LT(total, 5.6);
+  for (const Point3D& vertex : vertices) {
+    bool contained = false;
+    for (const ConvexHull& hull : hulls) {
+      contained = contained || hull.contains(vertex);
+    }
+    EXPECT_TRUE(contained);
+  }
+  // A convex solid is not split.
+  std::vector<Point3D> box_vertices;
+  std::vector<size_t> box_indices;
+  add_box(box_vertices, box_indices, Point3D(0.0, 0.0, 0.0), Point3D(2.0, 1.0, 1.0));
+  const std::vector<ConvexHull> box_hulls = ConvexHull::decompose(box_vertices, box_indices);
+  ASSERT_EQ(box_hulls.size(), 1);
+  EXPECT_NEAR(box_hulls[0].volume(), 2.0, 1e-9);
+}
+
+} /* namespace CW */
@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "SUAPI-CppWrapper/model/EntityRange.hpp"
+
+namespace {
+
+struct TestRef {
+  int id;
+};
+
+/**
+* Stands in for a wrapper class, constructed from a ref.
+*/
+struct TestWrapper {
+  int id;
+
+  TestWrapper(TestRef ref):
+    id(ref.id)
+  {}
+};
+
+std::vector<TestRef> make_refs(int count) {
+  std::vector<TestRef> refs = CW::RefBuffers<TestRef>::take();
+  for (int i=0; i < count; ++i) {
+    refs.push_back(TestRef{i});
+  }
+  return refs;
+}
+
+} // namespace
+
+namespace CW {
+
+TEST(EntityRange, Iterates) {
+  EntityRange<TestWrapper, TestRef> range(make_refs(5));
+  EXPECT_EQ(range.size(), 5);
+  EXPECT_FALSE(range.empty());
+  int expected = 0;
+  for (const TestWrapper& wrapper : range) {
+    EXPECT_EQ(wrapper.id, expected++);
+  }
+  EXPECT_EQ(range[3].id, 3);
+  std::vector<TestWrapper> wrappers = range.to_vector();
+  ASSERT_EQ(wrappers.size(), 5);
+  EXPECT_EQ(wrappers[4].id, 4);
+  int total = 0;
+  range.for_each([&total](const TestWrapper& wrapper) {
+    total += wrapper.id;
+  });
+  EXPECT_EQ(total, 10);
+}
+
+
+TEST(EntityRange, ReusesBuffers) {
+  const TestRef* data = nullptr;
+  {
+    EntityRange<TestWrapper, TestRef> range(make_refs(1000));
+    data = range.refs().data();
+  }
+  // The buffer of the destroyed range is given to the next, without allocating.
+  EntityRange<TestWrapper, TestRef> range(make_refs(10));
+  EXPECT_EQ(range.refs().data(), data);
+  EXPECT_GE(range.refs().capacity(), 1000);
+  // A range made while another is held has its own buffer.
+  EntityRange<TestWrapper, TestRef> nested(make_refs(3));
+  EXPECT_NE(nested.refs().data(), range.refs().data());
+  EXPECT_EQ(range.size(), 10);
+  EXPECT_EQ(nested.size(), 3);
+  EntityRange<TestWrapper, TestRef> moved(std::move(nested));
+  EXPECT_EQ(moved.size(), 3);
+}
+
+
+TEST(EntityRange, FreesLargeBuffers) {
+  {
+    EntityRange<TestWrapper, TestRef> range(make_refs(200000));
+    EXPECT_EQ(range.size(), 200000);
+  }
+  // The large buffer is not kept by the pool, so is not given to the next range.
+  EntityRange<TestWrapper, TestRef> range(make_refs(10));
+  EXPECT_LT(range.refs().capacity(), 200000);
+}
+
+TEST(EntityRange, As) {
+  EntityRange<TestWrapper, TestRef> range(make_refs(4));
+  const TestRef* data = range.refs().data();
+  // The refs are moved to a range of another type, without copying.
+  EntityRange<TestRef, TestRef> refs = std::move(range).as<TestRef>();
+  EXPECT_TRUE(range.empty());
+  ASSERT_EQ(refs.size(), 4);
+  EXPECT_EQ(refs.refs().data(), data);
+  EXPECT_EQ(refs[2].id, 2);
+}
+
+} /* namespace CW */
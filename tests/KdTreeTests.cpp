@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SUAPI-CppWrapper/KdTree.hpp"
+
+
+namespace {
+
+std::vector<CW::Point3D> random_points(size_t count, unsigned int seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<double> position(0.0, 100.0);
+  std::vector<CW::Point3D> points;
+  for (size_t i=0; i < count; ++i) {
+    // Round some coordinates, so that there are ties between points.
+    points.push_back(CW::Point3D(std::round(position(generator)), position(generator), std::round(position(generator) / 10.0)));
+  }
+  return points;
+}
+
+double distance(const CW::Point3D& a, const CW::Point3D& b) {
+  return CW::Vector3D(a - b).length();
+}
+
+/**
+* Returns the indices of the points sorted by distance from the query point, then by index.
+*/
+std::vector<size_t> by_distance(const std::vector<CW::Point3D>& points, const CW::Point3D& query) {
+  std::vector<size_t> indices(points.size());
+  for (size_t i=0; i < indices.size(); ++i) {
+    indices[i] = i;
+  }
+  std::vector<double> squared(points.size());
+  for (size_t i=0; i < points.size(); ++i) {
+    const CW::Vector3D offset(points[i] - query);
+    squared[i] = offset.dot(offset);
+  }
+  std::sort(indices.begin(), indices.end(), [&](size_t a, size_t b) {
+    return squared[a] < squared[b] || (squared[a] == squared[b] && a < b);
+  });
+  return indices;
+}
+
+} // namespace
+
+
+TEST(KdTree, Nearest)
+{
+  const std::vector<CW::Point3D> points = random_points(5000, 1);
+  const CW::KdTree tree(points, 4);
+  EXPECT_EQ(points.size(), tree.size());
+  const std::vector<CW::Point3D> queries = random_points(500, 2);
+  for (const CW::Point3D& query : queries) {
+    const std::vector<size_t> expected = by_distance(points, query);
+    EXPECT_EQ(expected[0], tree.nearest(query));
+    const double limit = distance(points[expected[0]], query) * 0.99;
+    EXPECT_EQ(CW::KdTree::NOT_FOUND, tree.nearest(query, limit));
+  }
+  // Every point finds itself, or an earlier point in the same place.
+  for (size_t i=0; i < points.size(); ++i) {
+    const size_t found = tree.nearest(points[i], 0.0);
+    ASSERT_NE(CW::KdTree::NOT_FOUND, found);
+    EXPECT_LE(found, i);
+    EXPECT_EQ(0.0, distance(points[found], points[i]));
+  }
+  // Batches give the same results on any number of threads.
+  for (size_t num_threads : {1u, 3u, 0u}) {
+    const std::vector<size_t> batch = tree.nearest(queries, 5.0, num_threads);
+    ASSERT_EQ(queries.size(), batch.size());
+    for (size_t i=0; i < queries.size(); ++i) {
+      EXPECT_EQ(tree.nearest(queries[i], 5.0), batch[i]);
+    }
+  }
+}
+
+
+TEST(KdTree, KNearestAndWithin)
+{
+  const std::vector<CW::Point3D> points = random_points(3000, 3);
+  const CW::KdTree tree(points, 1);
+  for (const CW::Point3D& query : random_points(100, 4)) {
+    const std::vector<size_t> expected = by_distance(points, query);
+    EXPECT_EQ(std::vector<size_t>(expected.begin(), expected.begin() + 10), tree.k_nearest(query, 10));
+    // A maximum distance cuts off the list.  It is enlarged slightly, as the square of a rounded distance may be less than the squared distance.
+    const double limit = distance(points[expected[4]], query) * (1.0 + 1e-12);
+    std::vector<size_t> limited = tree.k_nearest(query, 10, limit);
+    ASSERT_GE(limited.size(), 5u);
+    EXPECT_EQ(std::vector<size_t>(expected.begin(), expected.begin() + limited.size()), limited);
+    for (size_t index : limited) {
+      EXPECT_LE(distance(points[index], query), limit);
+    }
+
+    std::vector<size_t> found = tree.within(query, 8.0);
+    std::sort(found.begin(), found.end());
+    std::vector<size_t> in_radius;
+    for (size_t i=0; i < points.size(); ++i) {
+      const CW::Vector3D offset(points[i] - query);
+      if (offset.dot(offset) <= 64.0) {
+        in_radius.push_back(i);
+      }
+    }
+    EXPECT_EQ(in_radius, found);
+  }
+  EXPECT_EQ(points.size(), tree.k_nearest(CW::Point3D(0.0, 0.0, 0.0), points.size() + 10).size());
+}
+
+
+TEST(KdTree, Empty)
+{
+  const CW::KdTree tree;
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(CW::KdTree::NOT_FOUND, tree.nearest(CW::Point3D(1.0, 2.0, 3.0)));
+  EXPECT_TRUE(tree.k_nearest(CW::Point3D(1.0, 2.0, 3.0), 3).empty());
+  EXPECT_TRUE(tree.within(CW::Point3D(1.0, 2.0, 3.0), 10.0).empty());
+  EXPECT_THROW(CW::KdTree(std::vector<CW::Point3D>{CW::Point3D(false)}), std::invalid_argument);
+}
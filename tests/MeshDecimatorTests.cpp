@@ -0,0 +1,226 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "SUAPI-CppWrapper/MeshDecimator.hpp"
+
+namespace {
+
+/**
+* A grid of squares in the xy plane, each split into two triangles.  Each triangle's attribute is 1 where x is at least split_x, and 0 elsewhere.
+*/
+CW::MeshDecimator::Mesh grid(size_t size, double split_x = 1e9) {
+  CW::MeshDecimator::Mesh mesh;
+  for (size_t j=0; j <= size; ++j) {
+    for (size_t i=0; i <= size; ++i) {
+      mesh.vertices.push_back(CW::Point3D(static_cast<double>(i), static_cast<double>(j), 0.0));
+    }
+  }
+  for (size_t j=0; j < size; ++j) {
+    for (size_t i=0; i < size; ++i) {
+      const size_t a = (j * (size + 1)) + i;
+      const size_t attribute = static_cast<double>(i) >= split_x ? 1 : 0;
+      mesh.indices.insert(mesh.indices.end(), {a, a + 1, a + size + 2, a, a + size + 2, a + size + 1});
+      mesh.attributes.insert(mesh.attributes.end(), {attribute, attribute});
+    }
+  }
+  return mesh;
+}
+
+/**
+* A sphere of latitude and longitude bands.
+*/
+CW::MeshDecimator::Mesh sphere(double radius, size_t bands) {
+  CW::MeshDecimator::Mesh mesh;
+  const double pi = std::acos(-1.0);
+  mesh.vertices.push_back(CW::Point3D(0.0, 0.0, radius));
+  for (size_t j=1; j < bands; ++j) {
+    const double latitude = (pi * j) / bands;
+    for (size_t i=0; i < 2 * bands; ++i) {
+      const double longitude = (pi * i) / bands;
+      mesh.vertices.push_back(CW::Point3D(radius * std::sin(latitude) * std::cos(longitude), radius * std::sin(latitude) * std::sin(longitude), radius * std::cos(latitude)));
+    }
+  }
+  mesh.vertices.push_back(CW::Point3D(0.0, 0.0, -radius));
+  const size_t ring = 2 * bands;
+  const size_t bottom = mesh.vertices.size() - 1;
+  for (size_t i=0; i < ring; ++i) {
+    const size_t next = (i + 1) % ring;
+    mesh.indices.insert(mesh.indices.end(), {0, 1 + i, 1 + next});
+    mesh.indices.insert(mesh.indices.end(), {bottom, 1 + ((bands - 2) * ring) + next, 1 + ((bands - 2) * ring) + i});
+    for (size_t j=0; j + 2 < bands; ++j) {
+      const size_t a = 1 + (j * ring) + i;
+      const size_t b = 1 + (j * ring) + next;
+      mesh.indices.insert(mesh.indices.end(), {a, a + ring, b + ring, a, b + ring, b});
+    }
+  }
+  return mesh;
+}
+
+/**
+* Checks that every edge of the mesh is shared by exactly two triangles in opposite directions.
+*/
+void expect_closed(const CW::MeshDecimator::Mesh& mesh) {
+  std::map<std::pair<size_t, size_t>, int> uses;
+  for (size_t i=0; i < mesh.indices.size(); i += 3) {
+    for (size_t k=0; k < 3; ++k) {
+      ++uses[std::make_pair(mesh.indices[i + k], mesh.indices[i + ((k + 1) % 3)])];
+    }
+  }
+  for (const std::pair<const std::pair<size_t, size_t>, int>& use : uses) {
+    EXPECT_EQ(1, use.second);
+    EXPECT_EQ(1u, uses.count(std::make_pair(use.first.second, use.first.first)));
+  }
+}
+
+double area(const CW::MeshDecimator::Mesh& mesh) {
+  double total = 0.0;
+  for (size_t i=0; i < mesh.indices.size(); i += 3) {
+    const CW::Point3D& a = mesh.vertices[mesh.indices[i]];
+    total += CW::Vector3D(mesh.vertices[mesh.indices[i + 1]] - a).cross(mesh.vertices[mesh.indices[i + 2]] - a).length() / 2.0;
+  }
+  return total;
+}
+
+} // namespace
+
+namespace CW {
+
+TEST(MeshDecimator, FlatGrid)
+{
+  // A flat square reduces to two triangles without error, keeping its corners.
+  MeshDecimator decimator;
+  const std::vector<MeshDecimator::Mesh> levels = decimator.decimate(grid(20), {MeshDecimator::Target(0, 1e-6)});
+  ASSERT_EQ(1u, levels.size());
+  EXPECT_EQ(2u, levels[0].num_triangles());
+  EXPECT_EQ(4u, levels[0].vertices.size());
+  EXPECT_NEAR(400.0, area(levels[0]), 1e-6);
+  for (const Point3D& vertex : levels[0].vertices) {
+    EXPECT_NEAR(0.0, std::min(std::abs(vertex.x), std::abs(vertex.x - 20.0)), 1e-6);
+    EXPECT_NEAR(0.0, std::min(std::abs(vertex.y), std::abs(vertex.y - 20.0)), 1e-6);
+  }
+}
+
+
+TEST(MeshDecimator, Sphere)
+{
+  const MeshDecimator::Mesh mesh = sphere(100.0, 40);
+  MeshDecimator decimator;
+  const std::vector<MeshDecimator::Mesh> levels = decimator.decimate(mesh, {MeshDecimator::Target(0, 0.01), MeshDecimator::Target(1000), MeshDecimator::Target(200)});
+  ASSERT_EQ(3u, levels.size());
+  // Only the many thin triangles near the poles are within the small error bound.
+  EXPECT_LT(levels[0].num_triangles(), mesh.num_triangles());
+  EXPECT_GT(levels[0].num_triangles(), 1000u);
+  EXPECT_EQ(1000u, levels[1].num_triangles());
+  EXPECT_EQ(200u, levels[2].num_triangles());
+  for (const MeshDecimator::Mesh& level : levels) {
+    expect_closed(level);
+    for (const Point3D& vertex : level.vertices) {
+      EXPECT_NEAR(100.0, Vector3D(vertex).length(), 5.0);
+    }
+  }
+}
+
+
+TEST(MeshDecimator, SmallSphere)
+{
+  // The normals of the triangles of a sphere a tenth of an inch across are shorter than SketchUp's tolerance before normalisation.
+  const MeshDecimator::Mesh mesh = sphere(0.05, 20);
+  MeshDecimator decimator;
+  const std::vector<MeshDecimator::Mesh> levels = decimator.decimate(mesh, {MeshDecimator::Target(200)});
+  ASSERT_EQ(1u, levels.size());
+  EXPECT_EQ(200u, levels[0].num_triangles());
+  expect_closed(levels[0]);
+  for (const Point3D& vertex : levels[0].vertices) {
+    EXPECT_NEAR(0.05, Vector3D(vertex).length(), 0.0025);
+  }
+}
+
+
+TEST(MeshDecimator, AttributeBoundaries)
+{
+  // The boundary between the two attributes stays on the line x = 10.
+  MeshDecimator decimator;
+  const MeshDecimator::Mesh level = decimator.decimate(grid(20, 10.0), {MeshDecimator::Target(0, 1e-6)})[0];
+  EXPECT_LE(level.num_triangles(), 8u);
+  EXPECT_NEAR(400.0, area(level), 1e-6);
+  for (size_t t=0; t < level.num_triangles(); ++t) {
+    for (size_t k=0; k < 3; ++k) {
+      const double x = level.vertices[level.indices[(t * 3) + k]].x;
+      if (level.attributes[t] == 0) {
+        EXPECT_LE(x, 10.0 + 1e-6);
+      }
+      else {
+        EXPECT_GE(x, 10.0 - 1e-6);
+      }
+    }
+  }
+}
+
+
+TEST(MeshDecimator, EdgeFlags)
+{
+  // A sheet folded along y = 10, with a hard edge along the fold and soft edges between the other squares.
+  MeshDecimator::Mesh mesh = grid(20);
+  for (Point3D& vertex : mesh.vertices) {
+    if (vertex.y > 10.0) {
+      vertex.z = vertex.y - 10.0;
+    }
+  }
+  for (size_t j=0; j <= 20; ++j) {
+    for (size_t i=0; i < 20; ++i) {
+      const size_t a = (j * 21) + i;
+      MeshDecimator::Edge horizontal{a, a + 1};
+      horizontal.soft = horizontal.smooth = j != 10 && j != 0 && j != 20;
+      mesh.edges.push_back(horizontal);
+      MeshDecimator::Edge vertical{(i * 21) + j, (i * 21) + j + 21};
+      vertical.soft = vertical.smooth = j != 0 && j != 20;
+      mesh.edges.push_back(vertical);
+    }
+  }
+  MeshDecimator decimator;
+  const MeshDecimator::Mesh level = decimator.decimate(mesh, {MeshDecimator::Target(0, 1e-4)})[0];
+  EXPECT_LE(level.num_triangles(), 8u);
+  size_t hard_fold_edges = 0;
+  for (const MeshDecimator::Edge& edge : level.edges) {
+    const Point3D& start = level.vertices[edge.start];
+    const Point3D& end = level.vertices[edge.end];
+    if (std::abs(start.y - 10.0) < 1e-6 && std::abs(end.y - 10.0) < 1e-6) {
+      EXPECT_FALSE(edge.soft);
+      ++hard_fold_edges;
+    }
+  }
+  EXPECT_GE(hard_fold_edges, 1u);
+  // Every vertex is on one of the two planes of the sheet.
+  for (const Point3D& vertex : level.vertices) {
+    EXPECT_NEAR(std::max(0.0, vertex.y - 10.0), vertex.z, 1e-6);
+  }
+}
+
+
+TEST(MeshDecimator, Batch)
+{
+  const std::vector<MeshDecimator::Mesh> meshes = {sphere(50.0, 20), grid(10), sphere(80.0, 30)};
+  const std::vector<MeshDecimator::Target> targets = {MeshDecimator::Target(300), MeshDecimator::Target(100)};
+  const std::vector<std::vector<MeshDecimator::Mesh>> results = MeshDecimator::decimate(meshes, targets, 2);
+  ASSERT_EQ(meshes.size(), results.size());
+  MeshDecimator decimator;
+  for (size_t i=0; i < meshes.size(); ++i) {
+    const std::vector<MeshDecimator::Mesh> expected = decimator.decimate(meshes[i], targets);
+    ASSERT_EQ(expected.size(), results[i].size());
+    for (size_t j=0; j < expected.size(); ++j) {
+      EXPECT_EQ(expected[j].indices, results[i][j].indices);
+    }
+  }
+  MeshDecimator::Mesh invalid = grid(2);
+  invalid.indices.back() = 100;
+  EXPECT_THROW(decimator.decimate(invalid, targets), std::invalid_argument);
+  invalid.indices.pop_back();
+  EXPECT_THROW(decimator.decimate(invalid, targets), std::invalid_argument);
+}
+
+} /* namespace CW */
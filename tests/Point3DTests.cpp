@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+
+TEST(Point3D, NullPoint)
+{
+  CW::Point3D null_point;
+  ASSERT_TRUE(!null_point);
+  ASSERT_TRUE(!CW::Point3D(false));
+  ASSERT_FALSE(!CW::Point3D(true));
+  ASSERT_FALSE(!CW::Point3D(0.0, 0.0, 0.0));
+  ASSERT_EQ(CW::Point3D(), CW::Point3D(false));
+  ASSERT_NE(CW::Point3D(), CW::Point3D(true));
+}
+
+TEST(Point3D, CopyPreservesNull)
+{
+  CW::Point3D null_point(false);
+  CW::Point3D copy = null_point;
+  ASSERT_TRUE(!copy);
+  CW::Point3D point(1.0, 2.0, 3.0);
+  copy = point;
+  ASSERT_FALSE(!copy);
+  ASSERT_EQ(point, copy);
+}
+
+TEST(Point3D, CopyIsIndependent)
+{
+  CW::Point3D point(1.0, 2.0, 3.0);
+  CW::Point3D copy(point);
+  copy.x = 5.0;
+  ASSERT_DOUBLE_EQ(1.0, point.x);
+  ASSERT_DOUBLE_EQ(5.0, copy.x);
+}
+
+TEST(Point3D, SameLayoutAsSUPoint3D)
+{
+  std::vector<CW::Point3D> points{CW::Point3D(1.0, 2.0, 3.0), CW::Point3D(4.0, 5.0, 6.0)};
+  SUPoint3D su_points[2];
+  std::memcpy(su_points, points.data(), sizeof(su_points));
+  ASSERT_DOUBLE_EQ(4.0, su_points[1].x);
+  ASSERT_DOUBLE_EQ(5.0, su_points[1].y);
+  ASSERT_DOUBLE_EQ(6.0, su_points[1].z);
+  const SUPoint3D* su_point = points[0];
+  ASSERT_DOUBLE_EQ(3.0, su_point->z);
+}
+
+TEST(Point3D, ConversionFromNullVector)
+{
+  CW::Vector3D null_vector(false);
+  ASSERT_TRUE(!null_vector);
+  ASSERT_TRUE(!static_cast<CW::Point3D>(null_vector));
+  ASSERT_FALSE(!CW::Vector3D::zero_vector());
+}
+
+// The arithmetic core is constexpr, so it can be checked at compile time.
+static_assert(CW::Vector3D(1.0, 0.0, 0.0).cross(CW::Vector3D(0.0, 1.0, 0.0)) == CW::Vector3D(0.0, 0.0, 1.0), "cross product must be constexpr");
+static_assert(CW::Vector3D(1.0, 2.0, 3.0).dot(CW::Vector3D(4.0, 5.0, 6.0)) == 32.0, "dot product must be constexpr");
+static_assert(CW::Point3D(4.0, 5.0, 6.0) - CW::Point3D(1.0, 2.0, 3.0) == CW::Vector3D(3.0, 3.0, 3.0), "point subtraction must be constexpr");
+static_assert(!CW::Point3D(false) && !CW::Vector3D(), "null checks must be constexpr");
+static_assert(noexcept(CW::Vector3D().dot(CW::Vector3D())), "dot product must not throw");
+
+TEST(Point3D, TolerancePolicy)
+{
+  CW::Point3D point(1.0, 2.0, 3.0);
+  CW::Point3D close_point(1.0 + (CW::Point3D::EPSILON / 2.0), 2.0, 3.0);
+  ASSERT_EQ(point, close_point);
+  ASSERT_TRUE(point.equals(close_point));
+  ASSERT_FALSE(point.equals<CW::ExactTolerance>(close_point));
+  ASSERT_TRUE(point.equals<CW::ExactTolerance>(CW::Point3D(1.0, 2.0, 3.0)));
+  ASSERT_TRUE(CW::Point3D(false).equals<CW::ExactTolerance>(CW::Point3D(false)));
+  ASSERT_FALSE(point.equals<CW::ExactTolerance>(CW::Point3D(false)));
+
+  CW::Vector3D small_vector(CW::Vector3D::EPSILON / 2.0, 0.0, 0.0);
+  ASSERT_TRUE(small_vector.is_zero());
+  ASSERT_FALSE(small_vector.is_zero<CW::ExactTolerance>());
+  ASSERT_TRUE(CW::Vector3D::zero_vector().is_zero<CW::ExactTolerance>());
+}
+
+TEST(Point3D, PlaneDistance)
+{
+  CW::Plane3D plane(CW::Point3D(0.0, 0.0, 2.0), CW::Vector3D(0.0, 0.0, 3.0));
+  ASSERT_DOUBLE_EQ(1.0, plane.distance(CW::Point3D(5.0, 5.0, 3.0)));
+  ASSERT_DOUBLE_EQ(-2.0, plane.distance(CW::Point3D(0.0, 0.0, 0.0)));
+  CW::Point3D close_point(1.0, 1.0, 2.0 + (CW::Point3D::EPSILON / 2.0));
+  ASSERT_TRUE(plane.on_plane(close_point));
+  ASSERT_FALSE(plane.on_plane<CW::ExactTolerance>(close_point));
+  ASSERT_TRUE(plane.on_plane<CW::ExactTolerance>(CW::Point3D(1.0, 1.0, 2.0)));
+}
@@ -0,0 +1,265 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "SUAPI-CppWrapper/PolygonClipper.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/GeometryInputHelper.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "model/ModelTestUtility.hpp"
+
+namespace {
+
+using Operation = CW::PolygonClipper::Operation;
+
+CW::PolygonClipper::Polygon rectangle(double x0, double y0, double x1, double y1) {
+  return CW::PolygonClipper::Polygon({CW::Point3D(x0, y0, 0.0), CW::Point3D(x1, y0, 0.0), CW::Point3D(x1, y1, 0.0), CW::Point3D(x0, y1, 0.0)});
+}
+
+double total_area(const std::vector<CW::PolygonClipper::Polygon>& polygons) {
+  double area = 0.0;
+  for (const CW::PolygonClipper::Polygon& polygon : polygons) {
+    area += polygon.area();
+  }
+  return area;
+}
+
+/**
+* A star shaped polygon about the point, with vertices at random distances.  The polygons are large enough that vertices are rarely within SketchUp's tolerance of the other polygon's edges, where snapping would change the areas.
+*/
+CW::PolygonClipper::Polygon star(std::mt19937& generator, double x, double y, size_t num_points) {
+  std::uniform_real_distribution<double> radius(20.0, 100.0);
+  const double pi = std::acos(-1.0);
+  std::vector<CW::Point3D> outer_loop;
+  for (size_t i=0; i < num_points; ++i) {
+    const double angle = (2.0 * pi * i) / num_points;
+    const double r = radius(generator);
+    outer_loop.push_back(CW::Point3D(x + (r * std::cos(angle)), y + (r * std::sin(angle)), 0.0));
+  }
+  return CW::PolygonClipper::Polygon(outer_loop);
+}
+
+} // namespace
+
+namespace CW {
+
+TEST(PolygonClipper, OverlappingRectangles)
+{
+  PolygonClipper clipper;
+  const PolygonClipper::Polygon a = rectangle(0.0, 0.0, 10.0, 10.0);
+  const PolygonClipper::Polygon b = rectangle(5.0, 5.0, 15.0, 15.0);
+  std::vector<PolygonClipper::Polygon> result = clipper.clip(a, b, Operation::Union);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(8u, result[0].outer_loop.size());
+  EXPECT_NEAR(175.0, result[0].area(), 1e-9);
+  result = clipper.clip(a, b, Operation::Intersection);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(4u, result[0].outer_loop.size());
+  EXPECT_NEAR(25.0, result[0].area(), 1e-9);
+  result = clipper.clip(a, b, Operation::Difference);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(6u, result[0].outer_loop.size());
+  EXPECT_NEAR(75.0, result[0].area(), 1e-9);
+  result = clipper.clip(a, b, Operation::Xor);
+  EXPECT_EQ(2u, result.size());
+  EXPECT_NEAR(150.0, total_area(result), 1e-9);
+  // The outer loops are counter-clockwise about the normal.
+  for (const PolygonClipper::Polygon& polygon : result) {
+    const Point3D& p0 = polygon.outer_loop[0];
+    const Point3D& p1 = polygon.outer_loop[1];
+    const Point3D& p2 = polygon.outer_loop[2];
+    EXPECT_GT(Vector3D(p1 - p0).cross(p2 - p1).z, 0.0);
+  }
+  // Disjoint polygons
+  EXPECT_TRUE(clipper.clip(a, rectangle(20.0, 0.0, 30.0, 10.0), Operation::Intersection).empty());
+  EXPECT_EQ(2u, clipper.clip(a, rectangle(20.0, 0.0, 30.0, 10.0), Operation::Union).size());
+}
+
+
+TEST(PolygonClipper, SharedEdges)
+{
+  PolygonClipper clipper;
+  const PolygonClipper::Polygon a = rectangle(0.0, 0.0, 10.0, 10.0);
+  // Adjoining faces are merged into one, without the vertices between collinear edges.
+  std::vector<PolygonClipper::Polygon> result = clipper.clip(a, rectangle(10.0, 0.0, 20.0, 10.0), Operation::Union);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(4u, result[0].outer_loop.size());
+  EXPECT_NEAR(200.0, result[0].area(), 1e-9);
+  // A face sharing part of an edge
+  result = clipper.clip(a, rectangle(10.0, 2.0, 20.0, 8.0), Operation::Union);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(8u, result[0].outer_loop.size());
+  EXPECT_NEAR(160.0, result[0].area(), 1e-9);
+  // Identical faces
+  result = clipper.clip(a, a, Operation::Intersection);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_NEAR(100.0, result[0].area(), 1e-9);
+  EXPECT_TRUE(clipper.clip(a, a, Operation::Difference).empty());
+  EXPECT_TRUE(clipper.clip(a, a, Operation::Xor).empty());
+  // A face along one side of the other
+  result = clipper.clip(a, rectangle(0.0, 0.0, 4.0, 10.0), Operation::Difference);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(4u, result[0].outer_loop.size());
+  EXPECT_NEAR(60.0, result[0].area(), 1e-9);
+  // Points within tolerance of each other are merged.
+  const double offset = SketchUpTolerance::EPSILON / 10.0;
+  result = clipper.clip(a, rectangle(10.0 + offset, offset, 20.0, 10.0 - offset), Operation::Union);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(4u, result[0].outer_loop.size());
+}
+
+
+TEST(PolygonClipper, Holes)
+{
+  PolygonClipper clipper;
+  const PolygonClipper::Polygon a = rectangle(0.0, 0.0, 10.0, 10.0);
+  // Cutting a hole
+  std::vector<PolygonClipper::Polygon> result = clipper.clip(a, rectangle(4.0, 4.0, 6.0, 6.0), Operation::Difference);
+  ASSERT_EQ(1u, result.size());
+  ASSERT_EQ(1u, result[0].inner_loops.size());
+  EXPECT_EQ(4u, result[0].inner_loops[0].size());
+  EXPECT_NEAR(96.0, result[0].area(), 1e-9);
+  // Filling the hole again
+  result = clipper.clip(result[0], rectangle(4.0, 4.0, 6.0, 6.0), Operation::Union);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_TRUE(result[0].inner_loops.empty());
+  EXPECT_NEAR(100.0, result[0].area(), 1e-9);
+  // A polygon with a hole, crossed by a bar
+  const PolygonClipper::Polygon frame({Point3D(0.0, 0.0, 0.0), Point3D(10.0, 0.0, 0.0), Point3D(10.0, 10.0, 0.0), Point3D(0.0, 10.0, 0.0)},
+                                      {{Point3D(2.0, 2.0, 0.0), Point3D(2.0, 8.0, 0.0), Point3D(8.0, 8.0, 0.0), Point3D(8.0, 2.0, 0.0)}});
+  const PolygonClipper::Polygon bar = rectangle(-1.0, 4.0, 11.0, 6.0);
+  result = clipper.clip(frame, bar, Operation::Union);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(2u, result[0].inner_loops.size());
+  EXPECT_NEAR(64.0 + 24.0 - 8.0, result[0].area(), 1e-9);
+  result = clipper.clip(frame, bar, Operation::Intersection);
+  EXPECT_EQ(2u, result.size());
+  EXPECT_NEAR(8.0, total_area(result), 1e-9);
+  result = clipper.clip(frame, bar, Operation::Difference);
+  EXPECT_EQ(2u, result.size());
+  EXPECT_NEAR(56.0, total_area(result), 1e-9);
+  // A polygon inside the hole of the other
+  result = clipper.clip(frame, rectangle(3.0, 3.0, 7.0, 7.0), Operation::Union);
+  EXPECT_EQ(2u, result.size());
+  EXPECT_NEAR(80.0, total_area(result), 1e-9);
+}
+
+
+TEST(PolygonClipper, SmallPolygons)
+{
+  // Polygons a hundredth of an inch across, whose Newell normals are shorter than SketchUp's tolerance.
+  PolygonClipper clipper;
+  const PolygonClipper::Polygon a = rectangle(0.0, 0.0, 0.01, 0.01);
+  const PolygonClipper::Polygon b = rectangle(0.005, 0.005, 0.015, 0.015);
+  std::vector<PolygonClipper::Polygon> result = clipper.clip(a, b, Operation::Union);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(8u, result[0].outer_loop.size());
+  EXPECT_NEAR(0.000175, result[0].area(), 1e-12);
+  result = clipper.clip(a, b, Operation::Intersection);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_NEAR(0.000025, result[0].area(), 1e-12);
+  result = clipper.clip(a, rectangle(0.004, 0.004, 0.006, 0.006), Operation::Difference);
+  ASSERT_EQ(1u, result.size());
+  EXPECT_EQ(1u, result[0].inner_loops.size());
+  EXPECT_NEAR(0.000096, result[0].area(), 1e-12);
+}
+
+
+TEST(PolygonClipper, AreaIdentities)
+{
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> centre(-50.0, 50.0);
+  PolygonClipper clipper;
+  for (size_t i=0; i < 200; ++i) {
+    const PolygonClipper::Polygon a = star(generator, centre(generator), centre(generator), 5 + (i % 20));
+    const PolygonClipper::Polygon b = star(generator, centre(generator), centre(generator), 5 + (i % 13));
+    const double union_area = total_area(clipper.clip(a, b, Operation::Union));
+    const double intersection_area = total_area(clipper.clip(a, b, Operation::Intersection));
+    const double a_less_b = total_area(clipper.clip(a, b, Operation::Difference));
+    const double b_less_a = total_area(clipper.clip(b, a, Operation::Difference));
+    const double xor_area = total_area(clipper.clip(a, b, Operation::Xor));
+    const double tolerance = 1e-6;
+    EXPECT_NEAR(a.area() + b.area(), union_area + intersection_area, tolerance);
+    EXPECT_NEAR(a.area(), a_less_b + intersection_area, tolerance);
+    EXPECT_NEAR(b.area(), b_less_a + intersection_area, tolerance);
+    EXPECT_NEAR(union_area - intersection_area, xor_area, tolerance);
+    EXPECT_NEAR(union_area, total_area(clipper.clip(b, a, Operation::Union)), tolerance);
+  }
+}
+
+
+TEST(PolygonClipper, Batch)
+{
+  std::mt19937 generator(11);
+  std::vector<PolygonClipper::Polygon> subjects;
+  std::vector<PolygonClipper::Polygon> clips;
+  for (size_t i=0; i < 100; ++i) {
+    subjects.push_back(star(generator, 0.0, 0.0, 12));
+    clips.push_back(star(generator, 30.0, 10.0, 9));
+  }
+  const std::vector<std::vector<PolygonClipper::Polygon>> results = PolygonClipper::clip(subjects, clips, Operation::Union, 4);
+  ASSERT_EQ(subjects.size(), results.size());
+  PolygonClipper clipper;
+  for (size_t i=0; i < subjects.size(); ++i) {
+    const std::vector<PolygonClipper::Polygon> expected = clipper.clip(subjects[i], clips[i], Operation::Union);
+    ASSERT_EQ(expected.size(), results[i].size());
+    for (size_t j=0; j < expected.size(); ++j) {
+      EXPECT_EQ(expected[j].outer_loop, results[i][j].outer_loop);
+    }
+  }
+  clips.pop_back();
+  EXPECT_THROW(PolygonClipper::clip(subjects, clips, Operation::Union), std::invalid_argument);
+}
+
+
+TEST(PolygonClipper, InvalidPolygons)
+{
+  PolygonClipper clipper;
+  const PolygonClipper::Polygon a = rectangle(0.0, 0.0, 10.0, 10.0);
+  PolygonClipper::Polygon raised = rectangle(5.0, 5.0, 15.0, 15.0);
+  raised.outer_loop[2].z = 1.0;
+  EXPECT_THROW(clipper.clip(a, raised, Operation::Union), std::invalid_argument);
+  const PolygonClipper::Polygon line({Point3D(0.0, 0.0, 0.0), Point3D(10.0, 0.0, 0.0), Point3D(5.0, 0.0, 0.0)});
+  EXPECT_THROW(clipper.clip(line, a, Operation::Union), std::invalid_argument);
+  // A polygon with no area as the second polygon is ignored.
+  EXPECT_EQ(1u, clipper.clip(a, PolygonClipper::Polygon(), Operation::Union).size());
+}
+
+} /* namespace CW */
+
+
+namespace CW::Tests {
+
+// PolygonClipperFace test - the union of each face with itself is added back as the same face
+TEST_F(ModelLoad, PolygonClipperFace)
+{
+  ASSERT_FALSE(!m_model);
+  std::vector<Face> faces = m_model->entities().faces();
+  CW::GeometryInputPlus geom_input(m_model_copy);
+  PolygonClipper clipper;
+  double total_area = 0.0;
+  for (Face& face : faces) {
+    const PolygonClipper::Polygon polygon(face);
+    std::vector<PolygonClipper::Polygon> result = clipper.clip(polygon, polygon, PolygonClipper::Operation::Union);
+    ASSERT_EQ(1u, result.size());
+    EXPECT_EQ(face.inner_loops().size(), result[0].inner_loops.size());
+    EXPECT_NEAR(face.area(), result[0].area(), 1e-6);
+    result[0].add_to(geom_input);
+    total_area += face.area();
+  }
+  CW::Entities dest_entities = m_model_copy->entities();
+  dest_entities.fill(geom_input);
+  std::vector<Face> added_faces = dest_entities.faces();
+  EXPECT_EQ(faces.size(), added_faces.size());
+  double added_area = 0.0;
+  for (Face& face : added_faces) {
+    added_area += face.area();
+  }
+  EXPECT_NEAR(total_area, added_area, 1e-6);
+}
+
+} // namespace CW::Tests
@@ -0,0 +1,156 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Predicates.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+
+
+namespace {
+
+int sign(double value) {
+  return (value > 0.0) - (value < 0.0);
+}
+
+} // namespace
+
+
+TEST(Predicates, Orient2dSigns)
+{
+  SUPoint2D a{0.0, 0.0};
+  SUPoint2D b{1.0, 0.0};
+  SUPoint2D c{0.0, 1.0};
+  ASSERT_GT(CW::Predicates::orient2d(a, b, c), 0.0);
+  ASSERT_LT(CW::Predicates::orient2d(a, c, b), 0.0);
+  ASSERT_EQ(0.0, CW::Predicates::orient2d(a, b, SUPoint2D{2.0, 0.0}));
+  ASSERT_DOUBLE_EQ(1.0, CW::Predicates::orient2d(a, b, c));
+}
+
+TEST(Predicates, Orient2dNearlyCollinear)
+{
+  // Points q and r are on the line y = x, and p is moved from (0.5, 0.5) by a few ulps in each direction.  The exact determinant is 12 * (p.y - p.x), so its sign is known.
+  SUPoint2D q{12.0, 12.0};
+  SUPoint2D r{24.0, 24.0};
+  const double ulp = std::nextafter(0.5, 1.0) - 0.5;
+  for (int i=-8; i <= 8; ++i) {
+    for (int j=-8; j <= 8; ++j) {
+      SUPoint2D p{0.5 + (i * ulp), 0.5 + (j * ulp)};
+      ASSERT_EQ(sign(j - i), sign(CW::Predicates::orient2d(p, q, r))) << "i=" << i << " j=" << j;
+      ASSERT_EQ(sign(j - i), sign(CW::Predicates::orient2d(q, r, p))) << "i=" << i << " j=" << j;
+    }
+  }
+}
+
+TEST(Predicates, Orient3dFarFromOrigin)
+{
+  const double offset = 1.0e8;
+  CW::Point3D a(offset, offset, offset);
+  CW::Point3D b(offset + 1.0, offset, offset);
+  CW::Point3D c(offset, offset + 1.0, offset);
+  ASSERT_EQ(0.0, CW::Predicates::orient3d(a, b, c, CW::Point3D(offset + 3.0, offset + 7.0, offset)));
+  const double ulp = std::nextafter(offset, 2.0 * offset) - offset;
+  ASSERT_LT(CW::Predicates::orient3d(a, b, c, CW::Point3D(offset + 3.0, offset + 7.0, offset + ulp)), 0.0);
+  ASSERT_GT(CW::Predicates::orient3d(a, b, c, CW::Point3D(offset + 3.0, offset + 7.0, offset - ulp)), 0.0);
+}
+
+TEST(Predicates, InCircle)
+{
+  SUPoint2D a{1.0, 0.0};
+  SUPoint2D b{0.0, 1.0};
+  SUPoint2D c{-1.0, 0.0};
+  ASSERT_GT(CW::Predicates::incircle(a, b, c, SUPoint2D{0.0, 0.0}), 0.0);
+  ASSERT_LT(CW::Predicates::incircle(a, b, c, SUPoint2D{2.0, 0.0}), 0.0);
+  ASSERT_EQ(0.0, CW::Predicates::incircle(a, b, c, SUPoint2D{0.0, -1.0}));
+  // Reversing the orientation of the triangle reverses the sign.
+  ASSERT_LT(CW::Predicates::incircle(c, b, a, SUPoint2D{0.0, 0.0}), 0.0);
+  // Cocircular points far from the origin, which the floating point evaluation cannot resolve.
+  const double offset = 1048576.0;
+  SUPoint2D far_a{offset + 3.0, offset};
+  SUPoint2D far_b{offset, offset + 3.0};
+  SUPoint2D far_c{offset - 3.0, offset};
+  ASSERT_EQ(0.0, CW::Predicates::incircle(far_a, far_b, far_c, SUPoint2D{offset, offset - 3.0}));
+  const double ulp = std::nextafter(offset, 2.0 * offset) - offset;
+  ASSERT_GT(CW::Predicates::incircle(far_a, far_b, far_c, SUPoint2D{offset, offset - 3.0 + ulp}), 0.0);
+}
+
+TEST(Predicates, Projection)
+{
+  CW::Point3D point(1.0, 2.0, 3.0);
+  ASSERT_EQ(2u, CW::Predicates::dominant_axis(CW::Vector3D(0.1, -0.2, -1.0)));
+  ASSERT_EQ(0u, CW::Predicates::dominant_axis(CW::Vector3D(-1.0, 0.2, 0.5)));
+  ASSERT_EQ(1u, CW::Predicates::dominant_axis(CW::Vector3D(0.0, 1.0, 0.0)));
+  SUPoint2D projected = CW::Predicates::project(point, 0);
+  ASSERT_EQ(2.0, projected.x);
+  ASSERT_EQ(3.0, projected.y);
+  projected = CW::Predicates::project(point, 1);
+  ASSERT_EQ(3.0, projected.x);
+  ASSERT_EQ(1.0, projected.y);
+  // Counter-clockwise points about each axis remain counter-clockwise after projection.
+  for (size_t axis=0; axis < 3; ++axis) {
+    double origin[3] = {0.0, 0.0, 0.0};
+    double first[3] = {0.0, 0.0, 0.0};
+    double second[3] = {0.0, 0.0, 0.0};
+    first[(axis + 1) % 3] = 1.0;
+    second[(axis + 2) % 3] = 1.0;
+    ASSERT_GT(CW::Predicates::orient2d(
+      CW::Predicates::project(CW::Point3D(origin[0], origin[1], origin[2]), axis),
+      CW::Predicates::project(CW::Point3D(first[0], first[1], first[2]), axis),
+      CW::Predicates::project(CW::Point3D(second[0], second[1], second[2]), axis)), 0.0);
+  }
+}
+
+TEST(Predicates, ClassifyPointInLoop)
+{
+  // An L-shaped loop on a sloping plane, with a vertex level with the test points so that the ray passes through it.
+  std::vector<CW::Point3D> loop_points;
+  for (const double offset : {0.0, 2.0e7}) {
+    loop_points = {
+      CW::Point3D(offset, offset, 0.0),
+      CW::Point3D(offset + 20.0, offset, 10.0),
+      CW::Point3D(offset + 20.0, offset + 10.0, 10.0),
+      CW::Point3D(offset + 10.0, offset + 10.0, 5.0),
+      CW::Point3D(offset + 10.0, offset + 20.0, 5.0),
+      CW::Point3D(offset, offset + 20.0, 0.0)
+    };
+    ASSERT_EQ(CW::PointLoopClassify::PointInside, CW::Loop::classify_point(loop_points, CW::Point3D(offset + 5.0, offset + 10.0, 2.5)));
+    ASSERT_EQ(CW::PointLoopClassify::PointInside, CW::Loop::classify_point(loop_points, CW::Point3D(offset + 15.0, offset + 5.0, 7.5)));
+    ASSERT_EQ(CW::PointLoopClassify::PointOutside, CW::Loop::classify_point(loop_points, CW::Point3D(offset + 15.0, offset + 15.0, 7.5)));
+    ASSERT_EQ(CW::PointLoopClassify::PointOutside, CW::Loop::classify_point(loop_points, CW::Point3D(offset - 5.0, offset + 10.0, -2.5)));
+    ASSERT_EQ(CW::PointLoopClassify::PointOnVertex, CW::Loop::classify_point(loop_points, CW::Point3D(offset + 10.0, offset + 10.0, 5.0)));
+    ASSERT_EQ(CW::PointLoopClassify::PointOnEdge, CW::Loop::classify_point(loop_points, CW::Point3D(offset + 15.0, offset + 10.0, 7.5)));
+    ASSERT_EQ(CW::PointLoopClassify::PointOnEdge, CW::Loop::classify_point(loop_points, CW::Point3D(offset, offset + 5.0, 0.0)));
+    ASSERT_EQ(CW::PointLoopClassify::PointNotOnPlane, CW::Loop::classify_point(loop_points, CW::Point3D(offset + 5.0, offset + 10.0, 3.5)));
+  }
+}
+
+TEST(Predicates, LineIntersectionsFarFromOrigin)
+{
+  for (const double offset : {0.0, 1.0e7}) {
+    const CW::Point3D origin(offset, offset, offset);
+    // Crossing segments
+    CW::Point3D intersection = CW::Point3D::intersection_between_lines(origin, CW::Vector3D(10.0, 10.0, 0.0), origin + CW::Vector3D(0.0, 10.0, 0.0), CW::Vector3D(10.0, -10.0, 0.0));
+    ASSERT_EQ(origin + CW::Vector3D(5.0, 5.0, 0.0), intersection);
+    // Segments which would cross if they were longer
+    intersection = CW::Point3D::intersection_between_lines(origin, CW::Vector3D(4.0, 4.0, 0.0), origin + CW::Vector3D(0.0, 10.0, 0.0), CW::Vector3D(10.0, -10.0, 0.0));
+    ASSERT_TRUE(!intersection);
+    // Segments touching end to end
+    intersection = CW::Point3D::intersection_between_lines(origin, CW::Vector3D(5.0, 5.0, 0.0), origin + CW::Vector3D(0.0, 10.0, 0.0), CW::Vector3D(5.0, -5.0, 0.0));
+    ASSERT_EQ(origin + CW::Vector3D(5.0, 5.0, 0.0), intersection);
+    // Skew lines
+    intersection = CW::Point3D::intersection_between_lines(origin, CW::Vector3D(10.0, 10.0, 0.0), origin + CW::Vector3D(0.0, 10.0, 1.0), CW::Vector3D(10.0, -10.0, 0.0));
+    ASSERT_TRUE(!intersection);
+    // Collinear overlapping segments
+    intersection = CW::Point3D::intersection_between_lines(origin, CW::Vector3D(10.0, 0.0, 0.0), origin + CW::Vector3D(5.0, 0.0, 0.0), CW::Vector3D(10.0, 0.0, 0.0), true);
+    ASSERT_EQ(origin + CW::Vector3D(5.0, 0.0, 0.0), intersection);
+    // Parallel segments
+    intersection = CW::Point3D::intersection_between_lines(origin, CW::Vector3D(10.0, 0.0, 0.0), origin + CW::Vector3D(0.0, 1.0, 0.0), CW::Vector3D(10.0, 0.0, 0.0), true);
+    ASSERT_TRUE(!intersection);
+    // Ray crossing a segment in front of it, and pointing away from it
+    intersection = CW::Point3D::ray_line_intersection(origin, CW::Vector3D(0.0, 10.0, 10.0), origin + CW::Vector3D(-20.0, 5.0, 5.0), CW::Vector3D(1.0, 0.0, 0.0));
+    ASSERT_EQ(origin + CW::Vector3D(0.0, 5.0, 5.0), intersection);
+    intersection = CW::Point3D::ray_line_intersection(origin, CW::Vector3D(0.0, 10.0, 10.0), origin + CW::Vector3D(-20.0, 5.0, 5.0), CW::Vector3D(-1.0, 0.0, 0.0));
+    ASSERT_TRUE(!intersection);
+  }
+}
@@ -0,0 +1,219 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "SUAPI-CppWrapper/RayCaster.hpp"
+
+
+namespace {
+
+/**
+* Returns the mesh of a unit cube, with its triangles facing outwards.
+*/
+void unit_cube(std::vector<CW::Point3D>& vertices, std::vector<size_t>& indices) {
+  vertices.clear();
+  for (size_t i=0; i < 8; ++i) {
+    vertices.push_back(CW::Point3D((i & 1) ? 1.0 : 0.0, (i & 2) ? 1.0 : 0.0, (i & 4) ? 1.0 : 0.0));
+  }
+  // Each face is given as four corners, counter-clockwise when viewed from outside.
+  const size_t faces[6][4] = {{0, 2, 3, 1}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 6, 7, 3}, {0, 4, 6, 2}, {1, 3, 7, 5}};
+  indices.clear();
+  for (const auto& face : faces) {
+    indices.insert(indices.end(), {face[0], face[1], face[2], face[0], face[2], face[3]});
+  }
+}
+
+/**
+* Returns an affine transformation with the rotation about the z axis, scale in each axis, and translation.
+*/
+CW::Transformation transformation(double angle, double x_scale, double y_scale, double z_scale, const CW::Vector3D& translation) {
+  SUTransformation t{};
+  t.values[0] = std::cos(angle) * x_scale;
+  t.values[1] = std::sin(angle) * x_scale;
+  t.values[4] = -std::sin(angle) * y_scale;
+  t.values[5] = std::cos(angle) * y_scale;
+  t.values[10] = z_scale;
+  t.values[12] = translation.x;
+  t.values[13] = translation.y;
+  t.values[14] = translation.z;
+  t.values[15] = 1.0;
+  return CW::Transformation(t);
+}
+
+/**
+* Returns the distance to the nearest triangle hit by the ray, testing every triangle of every instance in world space.
+*/
+double brute_force_distance(const std::vector<std::vector<CW::Point3D>>& world_vertices, const std::vector<size_t>& indices, const CW::RayCaster::Ray& ray) {
+  const CW::Vector3D direction = ray.direction.unit();
+  double nearest = std::numeric_limits<double>::infinity();
+  for (const std::vector<CW::Point3D>& vertices : world_vertices) {
+    for (size_t i=0; i < indices.size(); i += 3) {
+      const CW::Point3D& v0 = vertices[indices[i]];
+      const CW::Vector3D edge1(vertices[indices[i + 1]] - v0);
+      const CW::Vector3D edge2(vertices[indices[i + 2]] - v0);
+      const CW::Vector3D p = direction.cross(edge2);
+      const double det = edge1.dot(p);
+      if (det == 0.0) {
+        continue;
+      }
+      const CW::Vector3D s(ray.origin - v0);
+      const double u = s.dot(p) / det;
+      const CW::Vector3D q = s.cross(edge1);
+      const double v = direction.dot(q) / det;
+      const double t = edge2.dot(q) / det;
+      if (u >= 0.0 && v >= 0.0 && u + v <= 1.0 && t > 0.0 && t < nearest) {
+        nearest = t;
+      }
+    }
+  }
+  return nearest;
+}
+
+} // namespace
+
+
+TEST(RayCaster, HitCube)
+{
+  std::vector<CW::Point3D> vertices;
+  std::vector<size_t> indices;
+  unit_cube(vertices, indices);
+  CW::RayCaster caster;
+  const size_t mesh = caster.add_mesh(vertices, indices);
+  const size_t instance = caster.add_instance(mesh, CW::Transformation());
+  caster.build();
+
+  const CW::RayCaster::Hit hit = caster.cast(CW::RayCaster::Ray{CW::Point3D(-5.0, 0.5, 0.25), CW::Vector3D(2.0, 0.0, 0.0)});
+  ASSERT_FALSE(!hit);
+  EXPECT_DOUBLE_EQ(5.0, hit.distance);
+  EXPECT_EQ(instance, hit.instance);
+  EXPECT_NEAR(-1.0, hit.normal.x, 1e-12);
+  EXPECT_NEAR(0.0, hit.normal.y, 1e-12);
+  EXPECT_NEAR(0.0, hit.normal.z, 1e-12);
+  // The triangle hit is on the face at x = 0.
+  EXPECT_EQ(0.0, vertices[indices[hit.triangle * 3]].x);
+  EXPECT_EQ(0.0, vertices[indices[(hit.triangle * 3) + 1]].x);
+  EXPECT_EQ(0.0, vertices[indices[(hit.triangle * 3) + 2]].x);
+
+  // From inside, the far side of the cube is hit, with its normal facing away from the ray.
+  const CW::RayCaster::Hit inside = caster.cast(CW::RayCaster::Ray{CW::Point3D(0.5, 0.5, 0.5), CW::Vector3D(0.0, 0.0, -1.0)});
+  ASSERT_FALSE(!inside);
+  EXPECT_DOUBLE_EQ(0.5, inside.distance);
+  EXPECT_NEAR(-1.0, inside.normal.z, 1e-12);
+
+  EXPECT_TRUE(!caster.cast(CW::RayCaster::Ray{CW::Point3D(-5.0, 0.5, 0.5), CW::Vector3D(-1.0, 0.0, 0.0)}));
+  EXPECT_TRUE(!caster.cast(CW::RayCaster::Ray{CW::Point3D(-5.0, 2.0, 0.5), CW::Vector3D(1.0, 0.0, 0.0)}));
+  EXPECT_TRUE(!caster.cast(CW::RayCaster::Ray{CW::Point3D(-5.0, 0.5, 0.5), CW::Vector3D(0.0, 0.0, 0.0)}));
+}
+
+
+TEST(RayCaster, TransformedInstances)
+{
+  std::vector<CW::Point3D> vertices;
+  std::vector<size_t> indices;
+  unit_cube(vertices, indices);
+  CW::RayCaster caster;
+  const size_t mesh = caster.add_mesh(vertices, indices);
+  const size_t near = caster.add_instance(mesh, transformation(0.0, 2.0, 3.0, 4.0, CW::Vector3D(10.0, 0.0, 0.0)));
+  const size_t far = caster.add_instance(mesh, transformation(M_PI / 4.0, 1.0, 1.0, 1.0, CW::Vector3D(20.0, 0.0, 0.0)));
+  EXPECT_THROW(caster.cast(CW::RayCaster::Ray{CW::Point3D(), CW::Vector3D(1.0, 0.0, 0.0)}), std::logic_error);
+  caster.build();
+  EXPECT_EQ(1u, caster.num_meshes());
+  EXPECT_EQ(2u, caster.num_instances());
+
+  // The scaled cube spans x from 10 to 12, y from 0 to 3 and z from 0 to 4.
+  const CW::RayCaster::Hit first = caster.cast(CW::RayCaster::Ray{CW::Point3D(0.0, 2.5, 3.5), CW::Vector3D(1.0, 0.0, 0.0)});
+  EXPECT_EQ(near, first.instance);
+  EXPECT_NEAR(10.0, first.distance, 1e-12);
+  EXPECT_NEAR(-1.0, first.normal.x, 1e-12);
+
+  // The rotated cube has a corner at (20, 0, 0), and faces with normals (-1, -1, 0) and (1, -1, 0) either side of it.
+  const CW::RayCaster::Hit second = caster.cast(CW::RayCaster::Ray{CW::Point3D(19.75, -5.0, 0.5), CW::Vector3D(0.0, 1.0, 0.0)});
+  EXPECT_EQ(far, second.instance);
+  EXPECT_NEAR(5.25, second.distance, 1e-12);
+  EXPECT_NEAR(-std::sqrt(0.5), second.normal.x, 1e-12);
+  EXPECT_NEAR(-std::sqrt(0.5), second.normal.y, 1e-12);
+  EXPECT_NEAR(0.0, second.normal.z, 1e-12);
+}
+
+
+TEST(RayCaster, MatchesBruteForce)
+{
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> position(0.0, 50.0);
+  std::uniform_real_distribution<double> offset(-2.0, 2.0);
+  std::uniform_real_distribution<double> unit(-1.0, 1.0);
+  std::vector<CW::Point3D> vertices;
+  std::vector<size_t> indices;
+  for (size_t i=0; i < 300; ++i) {
+    const CW::Point3D centre(position(generator), position(generator), position(generator));
+    for (size_t j=0; j < 3; ++j) {
+      indices.push_back(vertices.size());
+      vertices.push_back(centre + CW::Vector3D(offset(generator), offset(generator), offset(generator)));
+    }
+  }
+  CW::RayCaster caster;
+  const size_t mesh = caster.add_mesh(vertices, indices);
+  std::vector<std::vector<CW::Point3D>> world_vertices;
+  for (size_t i=0; i < 6; ++i) {
+    const CW::Transformation t = transformation(i * 0.7, 1.0 + (i * 0.1), 1.0, 1.0 - (i * 0.1), CW::Vector3D(i * 20.0, i * 5.0, 0.0));
+    caster.add_instance(mesh, t);
+    world_vertices.push_back(vertices);
+    t.transform_points(world_vertices.back());
+  }
+  caster.build();
+
+  std::vector<CW::RayCaster::Ray> rays;
+  for (size_t i=0; i < 1001; ++i) {
+    rays.push_back(CW::RayCaster::Ray{CW::Point3D(position(generator), position(generator), -20.0), CW::Vector3D(unit(generator) * 0.5, unit(generator) * 0.5, 1.0)});
+  }
+  size_t num_hits = 0;
+  std::vector<CW::RayCaster::Hit> single;
+  for (const CW::RayCaster::Ray& ray : rays) {
+    const CW::RayCaster::Hit hit = caster.cast(ray);
+    const double expected = brute_force_distance(world_vertices, indices, ray);
+    if (std::isinf(expected)) {
+      EXPECT_TRUE(!hit);
+    }
+    else {
+      ASSERT_FALSE(!hit);
+      EXPECT_NEAR(expected, hit.distance, 1e-9);
+      EXPECT_NEAR(1.0, hit.normal.length(), 1e-12);
+      ++num_hits;
+    }
+    single.push_back(hit);
+  }
+  EXPECT_GT(num_hits, 100u);
+
+  // Casting in packets and threads gives exactly the same results.
+  for (size_t num_threads : {1u, 3u, 0u}) {
+    const std::vector<CW::RayCaster::Hit> batch = caster.cast(rays, num_threads);
+    ASSERT_EQ(rays.size(), batch.size());
+    for (size_t i=0; i < rays.size(); ++i) {
+      EXPECT_EQ(single[i].instance, batch[i].instance);
+      EXPECT_EQ(single[i].triangle, batch[i].triangle);
+      EXPECT_EQ(single[i].distance, batch[i].distance);
+    }
+  }
+}
+
+
+TEST(RayCaster, InvalidInput)
+{
+  std::vector<CW::Point3D> vertices;
+  std::vector<size_t> indices;
+  unit_cube(vertices, indices);
+  CW::RayCaster caster;
+  EXPECT_THROW(caster.add_mesh(vertices, std::vector<size_t>{0, 1}), std::invalid_argument);
+  EXPECT_THROW(caster.add_mesh(vertices, std::vector<size_t>{0, 1, 8}), std::out_of_range);
+  EXPECT_THROW(caster.add_instance(0, CW::Transformation()), std::out_of_range);
+  const size_t mesh = caster.add_mesh(vertices, indices);
+  EXPECT_THROW(caster.add_instance(mesh, transformation(0.0, 1.0, 0.0, 1.0, CW::Vector3D())), std::invalid_argument);
+  // An empty scene hits nothing.
+  caster.build();
+  EXPECT_TRUE(caster.cast(std::vector<CW::RayCaster::Ray>(5, CW::RayCaster::Ray{CW::Point3D(), CW::Vector3D(1.0, 0.0, 0.0)})).size() == 5);
+  EXPECT_TRUE(!caster.cast(CW::RayCaster::Ray{CW::Point3D(), CW::Vector3D(1.0, 0.0, 0.0)}));
+}
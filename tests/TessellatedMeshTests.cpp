@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "SUAPI-CppWrapper/TessellatedMesh.hpp"
+
+namespace {
+
+CW::TessellatedMesh::Vertex vertex(double x, double y) {
+  return CW::TessellatedMesh::Vertex{SUPoint3D{x, y, 0.0}, SUVector3D{0.0, 0.0, 1.0}, SUPoint3D{x / 10.0, y / 10.0, 1.0}, SUPoint3D{-x / 10.0, y / 10.0, 1.0}};
+}
+
+} // namespace
+
+
+TEST(TessellatedMesh, Empty)
+{
+  CW::TessellatedMesh mesh;
+  EXPECT_TRUE(mesh.empty());
+  EXPECT_EQ(0u, mesh.num_vertices());
+  EXPECT_EQ(0u, mesh.num_triangles());
+  EXPECT_EQ(0u, mesh.num_ranges());
+  EXPECT_EQ(0u, mesh.size_bytes());
+}
+
+
+TEST(TessellatedMesh, Layout)
+{
+  // Two squares of two triangles each, the second with a material.
+  std::vector<CW::TessellatedMesh::Vertex> vertices;
+  for (double x : {0.0, 20.0}) {
+    vertices.insert(vertices.end(), {vertex(x, 0.0), vertex(x + 10.0, 0.0), vertex(x + 10.0, 10.0), vertex(x, 10.0)});
+  }
+  const std::vector<uint32_t> indices = {0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7};
+  const std::vector<CW::TessellatedMesh::MaterialRange> ranges = {{CW::TessellatedMesh::NO_INDEX, CW::TessellatedMesh::NO_INDEX, 0, 6}, {0, CW::TessellatedMesh::NO_INDEX, 6, 6}};
+  CW::TessellatedMesh mesh(vertices, indices, ranges);
+  EXPECT_FALSE(mesh.empty());
+  ASSERT_EQ(8u, mesh.num_vertices());
+  ASSERT_EQ(12u, mesh.num_indices());
+  EXPECT_EQ(4u, mesh.num_triangles());
+  ASSERT_EQ(2u, mesh.num_ranges());
+  for (size_t i=0; i < vertices.size(); ++i) {
+    EXPECT_EQ(vertices[i].position.x, mesh.vertices()[i].position.x);
+    EXPECT_EQ(vertices[i].normal.z, mesh.vertices()[i].normal.z);
+    EXPECT_EQ(vertices[i].front_stq.x, mesh.vertices()[i].front_stq.x);
+    EXPECT_EQ(vertices[i].back_stq.x, mesh.vertices()[i].back_stq.x);
+  }
+  EXPECT_EQ(indices, std::vector<uint32_t>(mesh.indices(), mesh.indices() + mesh.num_indices()));
+  EXPECT_EQ(0u, mesh.ranges()[1].front_material);
+  EXPECT_EQ(6u, mesh.ranges()[1].first_index);
+  // The whole mesh is in one buffer, with the vertices aligned for their doubles.
+  const unsigned char* begin = static_cast<const unsigned char*>(mesh.data());
+  const unsigned char* end = begin + mesh.size_bytes();
+  EXPECT_GE(reinterpret_cast<const unsigned char*>(mesh.vertices()), begin);
+  EXPECT_LE(reinterpret_cast<const unsigned char*>(mesh.ranges() + mesh.num_ranges()), end);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(mesh.vertices()) % alignof(double));
+
+  // Copies have their own buffer.
+  CW::TessellatedMesh copy = mesh;
+  EXPECT_NE(mesh.data(), copy.data());
+  EXPECT_EQ(indices, std::vector<uint32_t>(copy.indices(), copy.indices() + copy.num_indices()));
+}
+
+
+TEST(TessellatedMesh, InvalidInput)
+{
+  const std::vector<CW::TessellatedMesh::Vertex> vertices = {vertex(0.0, 0.0), vertex(1.0, 0.0), vertex(1.0, 1.0)};
+  EXPECT_THROW(CW::TessellatedMesh(vertices, {0, 1, 3}, {}), std::invalid_argument);
+  EXPECT_THROW(CW::TessellatedMesh(vertices, {0, 1, 2}, {{0, 0, 0, 6}}), std::invalid_argument);
+}
+
+
+TEST(TessellatedMesh, View)
+{
+  const std::vector<CW::TessellatedMesh::Vertex> vertices = {vertex(0.0, 0.0), vertex(1.0, 0.0), vertex(1.0, 1.0)};
+  const CW::TessellatedMesh mesh(vertices, {0, 1, 2}, {{0, CW::TessellatedMesh::NO_INDEX, 0, 3}});
+  auto buffer = std::make_shared<std::vector<uint64_t>>(mesh.size_bytes() / sizeof(uint64_t));
+  std::memcpy(buffer->data(), mesh.data(), mesh.size_bytes());
+  const CW::TessellatedMesh view = CW::TessellatedMesh::view(buffer->data(), mesh.size_bytes(), buffer);
+  EXPECT_EQ(buffer->data(), view.data());
+  EXPECT_EQ(mesh.size_bytes(), view.size_bytes());
+  ASSERT_EQ(3u, view.num_vertices());
+  EXPECT_EQ(1.0, view.vertices()[2].position.y);
+  EXPECT_EQ(2u, view.indices()[2]);
+  ASSERT_EQ(1u, view.num_ranges());
+  EXPECT_EQ(3u, view.ranges()[0].num_indices);
+
+  // The buffer is kept alive by the view and its copies.
+  const CW::TessellatedMesh copy = view;
+  EXPECT_EQ(view.data(), copy.data());
+  EXPECT_EQ(3u, buffer.use_count());
+
+  EXPECT_THROW(CW::TessellatedMesh::view(buffer->data(), mesh.size_bytes() - sizeof(uint64_t), buffer), std::invalid_argument);
+  EXPECT_THROW(CW::TessellatedMesh::view(reinterpret_cast<const unsigned char*>(buffer->data()) + 4, mesh.size_bytes(), buffer), std::invalid_argument);
+}
@@ -0,0 +1,175 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "SUAPI-CppWrapper/TessellatedMesh.hpp"
+#include "SUAPI-CppWrapper/TessellationFileCache.hpp"
+
+namespace {
+
+/**
+* A directory removed at the end of each test.
+*/
+class TessellationFileCacheTest : public ::testing::Test {
+  protected:
+  std::filesystem::path m_directory;
+
+  void SetUp() override {
+    const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+    m_directory = std::filesystem::temp_directory_path() / (std::string("cw_tessellation_cache_") + info->name());
+    std::filesystem::remove_all(m_directory);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(m_directory);
+  }
+
+  size_t num_files() const {
+    return static_cast<size_t>(std::distance(std::filesystem::directory_iterator(m_directory), std::filesystem::directory_iterator()));
+  }
+};
+
+/**
+* Returns a square of two triangles at the given height, with its material at index 0.
+*/
+CW::TessellatedMesh square(double z) {
+  std::vector<CW::TessellatedMesh::Vertex> vertices;
+  for (const SUPoint3D& point : {SUPoint3D{0.0, 0.0, z}, SUPoint3D{1.0, 0.0, z}, SUPoint3D{1.0, 1.0, z}, SUPoint3D{0.0, 1.0, z}}) {
+    vertices.push_back(CW::TessellatedMesh::Vertex{point, SUVector3D{0.0, 0.0, 1.0}, SUPoint3D{point.x, point.y, 1.0}, SUPoint3D{-point.x, point.y, 1.0}});
+  }
+  return CW::TessellatedMesh(vertices, {0, 1, 2, 0, 2, 3}, {{0, CW::TessellatedMesh::NO_INDEX, 0, 6}});
+}
+
+} // namespace
+
+
+TEST_F(TessellationFileCacheTest, StoreAndFind)
+{
+  CW::TessellationFileCache cache(m_directory.string(), 1 << 20);
+  CW::TessellatedMesh mesh;
+  std::vector<std::string> names;
+  EXPECT_FALSE(cache.find(1, mesh, names));
+  ASSERT_TRUE(cache.store(1, square(5.0), {"Brick"}));
+  EXPECT_TRUE(cache.contains(1));
+  ASSERT_TRUE(cache.find(1, mesh, names));
+  ASSERT_EQ(4u, mesh.num_vertices());
+  EXPECT_EQ(5.0, mesh.vertices()[2].position.z);
+  EXPECT_EQ(2u, mesh.num_triangles());
+  ASSERT_EQ(1u, mesh.num_ranges());
+  EXPECT_EQ(0u, mesh.ranges()[0].front_material);
+  EXPECT_EQ(std::vector<std::string>{"Brick"}, names);
+
+  // The mesh is a view of the file, and stays valid once the file is removed.
+  cache.erase(1);
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_EQ(1.0, mesh.vertices()[2].position.y);
+
+  // An empty mesh is kept too.
+  ASSERT_TRUE(cache.store(2, CW::TessellatedMesh(), {}));
+  ASSERT_TRUE(cache.find(2, mesh, names));
+  EXPECT_TRUE(mesh.empty());
+  EXPECT_TRUE(names.empty());
+
+  const CW::TessellationFileCache::Stats stats = cache.stats();
+  EXPECT_EQ(2u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+  EXPECT_EQ(2u, stats.stores);
+  EXPECT_EQ(1u, stats.num_entries);
+  EXPECT_EQ(1u, num_files());
+}
+
+
+TEST_F(TessellationFileCacheTest, Reopen)
+{
+  {
+    CW::TessellationFileCache cache(m_directory.string(), 1 << 20);
+    ASSERT_TRUE(cache.store(0xfedcba9876543210, square(1.0), {"Glass", "Steel"}));
+  }
+  CW::TessellationFileCache cache(m_directory.string(), 1 << 20);
+  EXPECT_EQ(1u, cache.stats().num_entries);
+  CW::TessellatedMesh mesh;
+  std::vector<std::string> names;
+  ASSERT_TRUE(cache.find(0xfedcba9876543210, mesh, names));
+  EXPECT_EQ(1.0, mesh.vertices()[0].position.z);
+  EXPECT_EQ((std::vector<std::string>{"Glass", "Steel"}), names);
+}
+
+
+TEST_F(TessellationFileCacheTest, LeastRecentlyUsedEviction)
+{
+  CW::TessellationFileCache cache(m_directory.string(), 1 << 20, 2);
+  ASSERT_TRUE(cache.store(1, square(1.0), {"A"}));
+  ASSERT_TRUE(cache.store(2, square(2.0), {"B"}));
+  CW::TessellatedMesh mesh;
+  std::vector<std::string> names;
+  // Using the first makes the second the least recently used.
+  ASSERT_TRUE(cache.find(1, mesh, names));
+  ASSERT_TRUE(cache.store(3, square(3.0), {"C"}));
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(3));
+  EXPECT_EQ(1u, cache.stats().evictions);
+  EXPECT_EQ(2u, num_files());
+
+  // The size limit is kept as well.
+  const uint64_t size_bytes = cache.stats().size_bytes / 2;
+  CW::TessellationFileCache small(m_directory.string(), size_bytes);
+  EXPECT_EQ(1u, small.stats().num_entries);
+  EXPECT_EQ(1u, num_files());
+  EXPECT_FALSE(small.store(4, CW::TessellatedMesh(std::vector<CW::TessellatedMesh::Vertex>(100, square(0.0).vertices()[0]), {}, {}), {}));
+}
+
+
+TEST_F(TessellationFileCacheTest, CorruptFile)
+{
+  CW::TessellationFileCache cache(m_directory.string(), 1 << 20);
+  ASSERT_TRUE(cache.store(7, square(1.0), {"Brick"}));
+  const std::filesystem::path file = m_directory / "0000000000000007.tess";
+  ASSERT_TRUE(std::filesystem::exists(file));
+  std::filesystem::resize_file(file, std::filesystem::file_size(file) - 8);
+  CW::TessellatedMesh mesh;
+  std::vector<std::string> names;
+  EXPECT_FALSE(cache.find(7, mesh, names));
+  EXPECT_FALSE(cache.contains(7));
+  EXPECT_FALSE(std::filesystem::exists(file));
+  EXPECT_EQ(1u, cache.stats().misses);
+
+  // A file of the right size with an index past the vertices is not valid either.
+  const CW::TessellatedMesh mesh_to_store = square(1.0);
+  ASSERT_TRUE(cache.store(7, mesh_to_store, {"Brick"}));
+  // The file's header is 40 bytes, and is followed by the mesh's buffer.
+  const size_t index_offset = 40 + static_cast<size_t>(reinterpret_cast<const unsigned char*>(mesh_to_store.indices()) - static_cast<const unsigned char*>(mesh_to_store.data()));
+  {
+    std::fstream stream(file, std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(static_cast<std::streamoff>(index_offset));
+    const uint32_t index = 4;
+    stream.write(reinterpret_cast<const char*>(&index), sizeof(index));
+  }
+  EXPECT_FALSE(cache.find(7, mesh, names));
+  EXPECT_FALSE(std::filesystem::exists(file));
+}
+
+
+TEST_F(TessellationFileCacheTest, Report)
+{
+  CW::TessellationFileCache cache(m_directory.string(), 1 << 20);
+  ASSERT_TRUE(cache.store(1, square(1.0), {"Brick"}));
+  CW::TessellatedMesh mesh;
+  std::vector<std::string> names;
+  cache.find(1, mesh, names);
+  cache.find(2, mesh, names);
+  EXPECT_DOUBLE_EQ(0.5, cache.stats().hit_rate());
+  std::ostringstream report;
+  cache.write_report(report);
+  EXPECT_NE(std::string::npos, report.str().find("hit rate:  50%"));
+
+  cache.clear();
+  EXPECT_EQ(0u, cache.stats().num_entries);
+  EXPECT_EQ(0u, cache.stats().size_bytes);
+  EXPECT_EQ(0u, num_files());
+}
@@ -0,0 +1,263 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+
+
+namespace {
+
+CW::Transformation test_transformation() {
+  CW::Transformation rotation(CW::Point3D(1.0, 2.0, 3.0), CW::Vector3D(1.0, 1.0, 0.5), 0.7);
+  CW::Transformation scale(2.0, 0.5, 3.0);
+  CW::Transformation translation(CW::Vector3D(10.0, -5.0, 2.5));
+  return translation * (rotation * scale);
+}
+
+std::vector<CW::Point3D> test_points(size_t count) {
+  std::vector<CW::Point3D> points;
+  points.reserve(count);
+  for (size_t i=0; i < count; ++i) {
+    double value = static_cast<double>(i);
+    points.push_back(CW::Point3D(value * 0.5, -value, std::sin(value)));
+  }
+  return points;
+}
+
+std::vector<CW::Transformation> classification_transformations() {
+  SUTransformation shear = {{1.0, 0.0, 0.0, 0.0,
+                             0.5, 1.0, 0.0, 0.0,
+                             0.0, 0.2, 1.0, 0.0,
+                             1.0, 2.0, 3.0, 1.0}};
+  SUTransformation homogenous_scale = {{1.0, 0.0, 0.0, 0.0,
+                                        0.0, 1.0, 0.0, 0.0,
+                                        0.0, 0.0, 1.0, 0.0,
+                                        4.0, 5.0, 6.0, 0.25}};
+  SUTransformation perspective = {{1.0, 0.0, 0.0, 0.0,
+                                   0.0, 1.0, 0.0, 0.0,
+                                   0.0, 0.0, 1.0, 0.1,
+                                   1.0, 0.0, 0.0, 1.0}};
+  CW::Transformation rotation(CW::Point3D(1.0, 2.0, 3.0), CW::Vector3D(1.0, 1.0, 0.5), 0.7);
+  return {
+    CW::Transformation(),
+    CW::Transformation(CW::Vector3D(10.0, -5.0, 2.5)),
+    rotation,
+    CW::Transformation(2.0),
+    CW::Transformation(2.0, 0.5, 3.0),
+    CW::Transformation(-1.0, 1.0, 1.0),
+    CW::Transformation(CW::Point3D(3.0, 2.0, 1.0), 1.5),
+    CW::Transformation(shear),
+    CW::Transformation(homogenous_scale),
+    CW::Transformation(perspective),
+    rotation * CW::Transformation(-1.0, 1.0, 1.0)
+  };
+}
+
+} // namespace
+
+
+TEST(Transformation, TransformPointsMatchesPerPointTransform)
+{
+  CW::Transformation transformation = test_transformation();
+  std::vector<CW::Point3D> points = test_points(37);
+  std::vector<CW::Point3D> transformed = points;
+  transformation.transform_points(transformed);
+  for (size_t i=0; i < points.size(); ++i) {
+    CW::Point3D expected = transformation * points[i];
+    ASSERT_NEAR(expected.x, transformed[i].x, 1e-9);
+    ASSERT_NEAR(expected.y, transformed[i].y, 1e-9);
+    ASSERT_NEAR(expected.z, transformed[i].z, 1e-9);
+  }
+}
+
+TEST(Transformation, TransformPointsHomogenousScale)
+{
+  SUTransformation su_transformation = {{1.0, 0.0, 0.0, 0.0,
+                                         0.0, 1.0, 0.0, 0.0,
+                                         0.0, 0.0, 1.0, 0.0,
+                                         2.0, 4.0, 6.0, 0.5}};
+  CW::Transformation transformation(su_transformation);
+  std::vector<CW::Point3D> points{CW::Point3D(1.0, 1.0, 1.0)};
+  transformation.transform_points(points);
+  ASSERT_EQ(CW::Point3D(6.0, 10.0, 14.0), points[0]);
+}
+
+TEST(Transformation, TransformPointsKeepsNullPoints)
+{
+  CW::Transformation transformation = test_transformation();
+  std::vector<CW::Point3D> points{CW::Point3D(1.0, 2.0, 3.0), CW::Point3D(false)};
+  transformation.transform_points(points);
+  ASSERT_FALSE(!points[0]);
+  ASSERT_TRUE(!points[1]);
+}
+
+TEST(Transformation, TransformPointsEmpty)
+{
+  std::vector<CW::Point3D> points;
+  test_transformation().transform_points(points);
+  ASSERT_TRUE(points.empty());
+}
+
+TEST(Transformation, TransformVectorsIgnoresTranslation)
+{
+  CW::Transformation transformation = test_transformation();
+  std::vector<CW::Vector3D> vectors{CW::Vector3D(1.0, 0.0, 0.0), CW::Vector3D(0.3, -2.0, 5.0)};
+  std::vector<CW::Vector3D> transformed = vectors;
+  transformation.transform_vectors(transformed);
+  for (size_t i=0; i < vectors.size(); ++i) {
+    CW::Vector3D expected = transformation * vectors[i];
+    ASSERT_NEAR(expected.x, transformed[i].x, 1e-9);
+    ASSERT_NEAR(expected.y, transformed[i].y, 1e-9);
+    ASSERT_NEAR(expected.z, transformed[i].z, 1e-9);
+  }
+}
+
+TEST(Transformation, TransformNormalsRemainPerpendicular)
+{
+  // A plane containing the two tangent vectors, with its normal.
+  CW::Vector3D tangent_a(1.0, 1.0, 0.0);
+  CW::Vector3D tangent_b(0.0, 1.0, 1.0);
+  CW::Transformation transformation = test_transformation();
+  std::vector<CW::Vector3D> normals{tangent_a.cross(tangent_b).unit()};
+  std::vector<CW::Vector3D> tangents{tangent_a, tangent_b};
+  transformation.transform_normals(normals);
+  transformation.transform_vectors(tangents);
+  ASSERT_NEAR(1.0, normals[0].length(), 1e-9);
+  ASSERT_NEAR(0.0, normals[0].dot(tangents[0]), 1e-9);
+  ASSERT_NEAR(0.0, normals[0].dot(tangents[1]), 1e-9);
+  // The normal must keep facing the same side as the transformed plane.
+  ASSERT_GT(normals[0].dot(tangents[0].cross(tangents[1])), 0.0);
+}
+
+TEST(Transformation, TransformNormalsMirror)
+{
+  CW::Transformation mirror(-1.0, 1.0, 1.0);
+  std::vector<CW::Vector3D> normals{CW::Vector3D(1.0, 0.0, 0.0), CW::Vector3D(0.0, 0.0, 1.0)};
+  mirror.transform_normals(normals);
+  ASSERT_EQ(CW::Vector3D(-1.0, 0.0, 0.0), normals[0]);
+  ASSERT_EQ(CW::Vector3D(0.0, 0.0, 1.0), normals[1]);
+}
+
+TEST(Transformation, MultiplyMatchesCAPI)
+{
+  std::vector<CW::Transformation> transformations = classification_transformations();
+  for (const CW::Transformation& lhs : transformations) {
+    for (const CW::Transformation& rhs : transformations) {
+      SUTransformation expected;
+      SUTransformationMultiply(lhs, rhs, &expected);
+      ASSERT_TRUE((lhs * rhs).equal(CW::Transformation(expected), 1e-9)) << lhs << rhs;
+    }
+  }
+}
+
+TEST(Transformation, InverseMatchesCAPI)
+{
+  for (const CW::Transformation& transformation : classification_transformations()) {
+    SUTransformation expected;
+    SUTransformationGetInverse(transformation, &expected);
+    CW::Transformation inverse = transformation.inverse();
+    ASSERT_TRUE(inverse.equal(CW::Transformation(expected), 1e-9)) << transformation;
+    ASSERT_TRUE((transformation * inverse).normalize().is_identity()) << transformation;
+  }
+}
+
+TEST(Transformation, IsIdentityMatchesCAPI)
+{
+  for (const CW::Transformation& transformation : classification_transformations()) {
+    bool expected = false;
+    SUTransformationIsIdentity(transformation, &expected);
+    ASSERT_EQ(expected, transformation.is_identity()) << transformation;
+  }
+}
+
+TEST(Transformation, InverseOfSingularThrows)
+{
+  CW::Transformation flatten(1.0, 1.0, 0.0);
+  ASSERT_THROW(flatten.inverse(), std::logic_error);
+}
+
+TEST(Transformation, Classification)
+{
+  CW::Transformation rotation(CW::Point3D(1.0, 2.0, 3.0), CW::Vector3D(0.0, 0.0, 1.0), 0.3);
+  CW::Transformation translation(CW::Vector3D(1.0, 2.0, 3.0));
+  CW::Transformation mirror(-1.0, 1.0, 1.0);
+  ASSERT_TRUE(CW::Transformation().is_identity());
+  ASSERT_TRUE(translation.is_translation());
+  ASSERT_FALSE(translation.is_identity());
+  ASSERT_TRUE(rotation.is_rigid());
+  ASSERT_FALSE(rotation.is_translation());
+  ASSERT_TRUE(CW::Transformation(2.0).is_uniform_scale());
+  ASSERT_FALSE(CW::Transformation(2.0).is_rigid());
+  ASSERT_FALSE(CW::Transformation(2.0, 1.0, 1.0).is_uniform_scale());
+  ASSERT_TRUE(mirror.is_mirrored());
+  ASSERT_TRUE((rotation * mirror).is_mirrored());
+  ASSERT_FALSE((mirror * mirror).is_mirrored());
+  ASSERT_TRUE((rotation * translation).is_rigid());
+  ASSERT_TRUE((rotation * rotation.inverse()).is_identity());
+  ASSERT_DOUBLE_EQ(-1.0, mirror.determinant());
+  SUTransformation scale = {{2.0, 0.0, 0.0, 0.0,
+                             0.0, 2.0, 0.0, 0.0,
+                             0.0, 0.0, 2.0, 0.0,
+                             0.0, 0.0, 0.0, 1.0}};
+  ASSERT_DOUBLE_EQ(8.0, CW::Transformation(scale).determinant());
+}
+
+TEST(Transformation, ModifiedMatrixIsReclassified)
+{
+  CW::Transformation transformation;
+  ASSERT_TRUE(transformation.is_identity());
+  transformation[12] = 5.0;
+  ASSERT_FALSE(transformation.is_identity());
+  ASSERT_TRUE(transformation.is_translation());
+  ASSERT_EQ(CW::Point3D(5.0, 0.0, 0.0), transformation.origin());
+}
+
+TEST(Transformation, Decompose)
+{
+  std::vector<CW::Transformation> transformations = classification_transformations();
+  for (size_t i=0; i < transformations.size(); ++i) {
+    CW::Vector3D translation;
+    CW::Transformation rotation;
+    CW::Vector3D scale;
+    bool exact = transformations[i].decompose(translation, rotation, scale);
+    ASSERT_TRUE(rotation.is_rigid());
+    ASSERT_FALSE(rotation.is_mirrored());
+    if (exact) {
+      CW::Transformation recomposed = CW::Transformation(translation) * rotation * CW::Transformation(scale.x, scale.y, scale.z);
+      ASSERT_TRUE(recomposed.equal(CW::Transformation(transformations[i]).normalize(), 1e-9)) << transformations[i];
+    }
+  }
+  CW::Vector3D translation;
+  CW::Transformation rotation;
+  CW::Vector3D scale;
+  ASSERT_TRUE(CW::Transformation(-2.0, 3.0, 4.0).decompose(translation, rotation, scale));
+  ASSERT_EQ(CW::Vector3D(-2.0, 3.0, 4.0), scale);
+  ASSERT_TRUE(rotation.is_identity());
+  ASSERT_FALSE(transformations[7].decompose(translation, rotation, scale)); // shear
+}
+
+TEST(Transformation, DecomposeZeroScale)
+{
+  for (const CW::Transformation& transformation : {CW::Transformation(1.0, 1.0, 0.0), CW::Transformation(0.0, 2.0, 3.0), CW::Transformation(2.0, 0.0, 0.0), CW::Transformation(0.0, 0.0, 0.0)}) {
+    CW::Vector3D translation;
+    CW::Transformation rotation;
+    CW::Vector3D scale;
+    ASSERT_FALSE(transformation.decompose(translation, rotation, scale)) << transformation;
+    for (size_t i=0; i < 16; ++i) {
+      ASSERT_FALSE(std::isnan(rotation[i])) << transformation;
+    }
+    ASSERT_TRUE(rotation.is_rigid()) << transformation;
+    ASSERT_FALSE(rotation.is_mirrored()) << transformation;
+    // The scales and rotation still give back the transformation.
+    CW::Transformation recomposed = CW::Transformation(translation) * rotation * CW::Transformation(scale.x, scale.y, scale.z);
+    ASSERT_TRUE(recomposed.equal(transformation, 1e-9)) << transformation;
+  }
+  CW::Vector3D translation;
+  CW::Transformation rotation;
+  CW::Vector3D scale;
+  CW::Transformation(1.0, 1.0, 0.0).decompose(translation, rotation, scale);
+  ASSERT_EQ(CW::Vector3D(1.0, 1.0, 0.0), scale);
+  ASSERT_TRUE(rotation.is_identity());
+}
@@ -0,0 +1,172 @@
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "SUAPI-CppWrapper/Triangulator.hpp"
+
+namespace {
+
+/**
+* Checks that the triangles cover the polygon: their indices are in range, each is counter-clockwise about the normal, and their areas sum to the area of the polygon.
+*/
+void expect_covers(const CW::Triangulator::Polygon& polygon, const std::vector<size_t>& indices, double area) {
+  ASSERT_EQ(0u, indices.size() % 3);
+  double total = 0.0;
+  for (size_t i=0; i < indices.size(); i += 3) {
+    ASSERT_LT(indices[i], polygon.vertices.size());
+    ASSERT_LT(indices[i + 1], polygon.vertices.size());
+    ASSERT_LT(indices[i + 2], polygon.vertices.size());
+    const CW::Vector3D cross = CW::Vector3D(polygon.vertices[indices[i + 1]] - polygon.vertices[indices[i]]).cross(polygon.vertices[indices[i + 2]] - polygon.vertices[indices[i]]);
+    // Slivers at nearly collinear vertices may round to slightly negative areas here, though they are counter-clockwise when computed exactly.
+    EXPECT_GE(cross.dot(polygon.normal), -1e-9);
+    total += cross.length() / 2.0;
+  }
+  EXPECT_NEAR(area, total, area * 1e-9);
+}
+
+/**
+* A wall of the given width and height in the xz plane, facing -y, with a grid of windows.
+*/
+CW::Triangulator::Polygon facade(size_t columns, size_t rows) {
+  const double width = columns * 100.0;
+  const double height = rows * 120.0;
+  std::vector<CW::Point3D> outer_loop = {CW::Point3D(0.0, 0.0, 0.0), CW::Point3D(width, 0.0, 0.0), CW::Point3D(width, 0.0, height), CW::Point3D(0.0, 0.0, height)};
+  std::vector<std::vector<CW::Point3D>> inner_loops;
+  for (size_t i=0; i < columns; ++i) {
+    for (size_t j=0; j < rows; ++j) {
+      const double x = (i * 100.0) + 30.0;
+      const double z = (j * 120.0) + 30.0;
+      inner_loops.push_back({CW::Point3D(x, 0.0, z), CW::Point3D(x, 0.0, z + 60.0), CW::Point3D(x + 40.0, 0.0, z + 60.0), CW::Point3D(x + 40.0, 0.0, z)});
+    }
+  }
+  return CW::Triangulator::Polygon(outer_loop, inner_loops);
+}
+
+} // namespace
+
+
+TEST(Triangulator, ConvexAndConcave)
+{
+  CW::Triangulator triangulator;
+  CW::Triangulator::Polygon square({CW::Point3D(0.0, 0.0, 0.0), CW::Point3D(10.0, 0.0, 0.0), CW::Point3D(10.0, 10.0, 0.0), CW::Point3D(0.0, 10.0, 0.0)});
+  EXPECT_NEAR(1.0, square.normal.z, 1e-12);
+  std::vector<size_t> indices = triangulator.triangulate(square);
+  EXPECT_EQ(6u, indices.size());
+  expect_covers(square, indices, 100.0);
+
+  // The same square facing down gives triangles counter-clockwise about -z.
+  CW::Triangulator::Polygon reversed({CW::Point3D(0.0, 10.0, 0.0), CW::Point3D(10.0, 10.0, 0.0), CW::Point3D(10.0, 0.0, 0.0), CW::Point3D(0.0, 0.0, 0.0)});
+  EXPECT_NEAR(-1.0, reversed.normal.z, 1e-12);
+  expect_covers(reversed, triangulator.triangulate(reversed), 100.0);
+
+  // An L shape on a sloping plane, with a collinear vertex.
+  std::vector<CW::Point3D> l_shape;
+  for (const CW::Point3D& point : {CW::Point3D(0.0, 0.0, 0.0), CW::Point3D(10.0, 0.0, 0.0), CW::Point3D(20.0, 0.0, 0.0), CW::Point3D(20.0, 10.0, 0.0),
+                                   CW::Point3D(10.0, 10.0, 0.0), CW::Point3D(10.0, 20.0, 0.0), CW::Point3D(0.0, 20.0, 0.0)}) {
+    l_shape.push_back(CW::Point3D(point.x, point.y * 0.6, point.y * 0.8));
+  }
+  CW::Triangulator::Polygon sloping(l_shape);
+  indices = triangulator.triangulate(sloping);
+  EXPECT_EQ(15u, indices.size());
+  expect_covers(sloping, indices, 300.0);
+}
+
+
+TEST(Triangulator, Holes)
+{
+  CW::Triangulator triangulator;
+  CW::Triangulator::Polygon framed({CW::Point3D(0.0, 0.0, 0.0), CW::Point3D(10.0, 0.0, 0.0), CW::Point3D(10.0, 10.0, 0.0), CW::Point3D(0.0, 10.0, 0.0)},
+                                   {{CW::Point3D(2.0, 2.0, 0.0), CW::Point3D(2.0, 8.0, 0.0), CW::Point3D(8.0, 8.0, 0.0), CW::Point3D(8.0, 2.0, 0.0)}});
+  std::vector<size_t> indices = triangulator.triangulate(framed);
+  // n + 2h - 2 triangles.
+  EXPECT_EQ(8u * 3, indices.size());
+  expect_covers(framed, indices, 64.0);
+
+  // Enough vertices to index them along the z-order curve.  The bridges between windows in line with each other merge collinear edges, so there are fewer triangles.
+  CW::Triangulator::Polygon wall = facade(12, 8);
+  indices = triangulator.triangulate(wall);
+  EXPECT_LE(indices.size(), (wall.vertices.size() + (2 * 96) - 2) * 3);
+  expect_covers(wall, indices, (1200.0 * 960.0) - (96 * 40.0 * 60.0));
+
+  // Appending reuses the indices, and gives the same triangles.
+  std::vector<size_t> appended = {1, 2, 3};
+  triangulator.triangulate(wall, appended);
+  EXPECT_EQ(indices, std::vector<size_t>(appended.begin() + 3, appended.end()));
+}
+
+
+TEST(Triangulator, SmallPolygons)
+{
+  // The Newell normal of a 0.01" square is far shorter than SketchUp's tolerance, though the square is valid geometry.
+  CW::Triangulator triangulator;
+  CW::Triangulator::Polygon square({CW::Point3D(0.0, 0.0, 0.0), CW::Point3D(0.01, 0.0, 0.0), CW::Point3D(0.01, 0.01, 0.0), CW::Point3D(0.0, 0.01, 0.0)});
+  EXPECT_NEAR(1.0, square.normal.z, 1e-12);
+  expect_covers(square, triangulator.triangulate(square), 0.0001);
+  CW::Triangulator::Polygon framed({CW::Point3D(0.0, 0.0, 0.0), CW::Point3D(0.0, 0.0, 0.01), CW::Point3D(0.0, 0.01, 0.01), CW::Point3D(0.0, 0.01, 0.0)},
+                                   {{CW::Point3D(0.0, 0.003, 0.003), CW::Point3D(0.0, 0.007, 0.003), CW::Point3D(0.0, 0.007, 0.007), CW::Point3D(0.0, 0.003, 0.007)}});
+  EXPECT_NEAR(-1.0, framed.normal.x, 1e-12);
+  const std::vector<size_t> indices = triangulator.triangulate(framed);
+  EXPECT_EQ(8u * 3, indices.size());
+  expect_covers(framed, indices, 0.0001 - 0.000016);
+}
+
+TEST(Triangulator, RandomStarPolygons)
+{
+  // Star shaped polygons are always simple, and have many reflex vertices.  Midpoints are added to some edges, to give nearly collinear vertices.
+  const double pi = std::acos(-1.0);
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<double> radius(1.0, 10.0);
+  std::uniform_int_distribution<size_t> size(3, 300);
+  std::bernoulli_distribution split(0.3);
+  CW::Triangulator triangulator;
+  for (size_t test=0; test < 200; ++test) {
+    std::vector<CW::Point3D> corners;
+    for (size_t i=0, count=size(generator); i < count; ++i) {
+      const double angle = 2.0 * pi * static_cast<double>(i) / static_cast<double>(count);
+      const double r = radius(generator);
+      corners.push_back(CW::Point3D(r * std::cos(angle), r * std::sin(angle), 0.0));
+    }
+    std::vector<CW::Point3D> points;
+    for (size_t i=0; i < corners.size(); ++i) {
+      points.push_back(corners[i]);
+      if (split(generator)) {
+        const CW::Point3D& next = corners[(i + 1) % corners.size()];
+        points.push_back(CW::Point3D((corners[i].x + next.x) / 2.0, (corners[i].y + next.y) / 2.0, 0.0));
+      }
+    }
+    const size_t n = points.size();
+    double area = 0.0;
+    for (size_t i=0, j=n - 1; i < n; j = i++) {
+      area += (points[j].x * points[i].y) - (points[i].x * points[j].y);
+    }
+    area = std::abs(area) / 2.0;
+    CW::Triangulator::Polygon polygon(points);
+    std::vector<size_t> indices = triangulator.triangulate(polygon);
+    EXPECT_LE(indices.size(), (n - 2) * 3);
+    expect_covers(polygon, indices, area);
+  }
+}
+
+
+TEST(Triangulator, Batch)
+{
+  std::vector<CW::Triangulator::Polygon> polygons;
+  for (size_t i=1; i < 40; ++i) {
+    polygons.push_back(facade(i % 7 + 1, i % 5 + 1));
+  }
+  std::vector<std::vector<size_t>> results = CW::Triangulator::triangulate(polygons, 3);
+  ASSERT_EQ(polygons.size(), results.size());
+  CW::Triangulator triangulator;
+  for (size_t i=0; i < polygons.size(); ++i) {
+    EXPECT_EQ(triangulator.triangulate(polygons[i]), results[i]);
+  }
+
+  CW::Triangulator::Polygon invalid = polygons[0];
+  invalid.loop_ends.back() += 1;
+  EXPECT_THROW(triangulator.triangulate(invalid), std::invalid_argument);
+  polygons.push_back(CW::Triangulator::Polygon({CW::Point3D(0.0, 0.0, 0.0), CW::Point3D(1.0, 0.0, 0.0), CW::Point3D(2.0, 0.0, 0.0)}));
+  EXPECT_THROW(CW::Triangulator::triangulate(polygons, 3), std::invalid_argument);
+}
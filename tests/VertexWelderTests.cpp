@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "SUAPI-CppWrapper/VertexWelder.hpp"
+
+
+TEST(VertexWelder, WeldsWithinTolerance)
+{
+  CW::VertexWelder welder;
+  EXPECT_EQ(CW::VertexWelder::NOT_FOUND, welder.find(CW::Point3D(0.0, 0.0, 0.0)));
+  EXPECT_EQ(0u, welder.weld(CW::Point3D(0.0, 0.0, 0.0), 0));
+  // Points either side of cell boundaries are still welded.
+  EXPECT_EQ(0u, welder.weld(CW::Point3D(0.0004, -0.0004, 0.0004), 1));
+  EXPECT_EQ(0u, welder.weld(CW::Point3D(-0.0004, 0.0004, -0.0004), 1));
+  EXPECT_EQ(1u, welder.weld(CW::Point3D(0.0006, 0.0, 0.0), 1));
+  EXPECT_EQ(2u, welder.weld(CW::Point3D(100.0, -200.0, 300.0), 2));
+  EXPECT_EQ(2u, welder.weld(CW::Point3D(100.0003, -200.0003, 299.9997), 3));
+  EXPECT_EQ(3u, welder.size());
+  // Where several points are equal, the first inserted is found.
+  EXPECT_EQ(0u, welder.find(CW::Point3D(0.0003, 0.0, 0.0)));
+  EXPECT_EQ(CW::VertexWelder::NOT_FOUND, welder.find(CW::Point3D(false)));
+  EXPECT_THROW(welder.insert(CW::Point3D(false), 4), std::invalid_argument);
+  welder.clear();
+  EXPECT_EQ(0u, welder.size());
+  EXPECT_EQ(CW::VertexWelder::NOT_FOUND, welder.find(CW::Point3D(0.0, 0.0, 0.0)));
+}
+
+
+TEST(VertexWelder, MatchesBruteForce)
+{
+  // Points clustered on a coarse grid, so that many are within tolerance of each other and many are just outside it.
+  std::mt19937 generator(3);
+  std::uniform_int_distribution<int> grid(-20, 20);
+  std::uniform_real_distribution<double> jitter(-0.0008, 0.0008);
+  CW::VertexWelder welder;
+  std::vector<CW::Point3D> inserted;
+  for (size_t i=0; i < 5000; ++i) {
+    const CW::Point3D point((grid(generator) * 0.001) + jitter(generator), (grid(generator) * 0.001) + jitter(generator), grid(generator) * 0.01);
+    size_t expected = CW::VertexWelder::NOT_FOUND;
+    for (size_t j=0; j < inserted.size(); ++j) {
+      if (inserted[j] == point) {
+        expected = j;
+        break;
+      }
+    }
+    const size_t welded = welder.weld(point, inserted.size());
+    if (expected == CW::VertexWelder::NOT_FOUND) {
+      ASSERT_EQ(inserted.size(), welded);
+      inserted.push_back(point);
+    }
+    else {
+      ASSERT_EQ(expected, welded);
+    }
+  }
+  EXPECT_EQ(inserted.size(), welder.size());
+  EXPECT_LT(inserted.size(), 5000u);
+}
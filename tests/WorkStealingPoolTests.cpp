@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "SUAPI-CppWrapper/WorkStealingPool.hpp"
+
+
+TEST(WorkStealingPool, PushedTasks)
+{
+  // Each task of depth d pushes two tasks of depth d + 1, making a complete binary tree.
+  const size_t max_depth = 14;
+  CW::WorkStealingPool<size_t> pool(4);
+  EXPECT_EQ(4u, pool.num_threads());
+  std::vector<size_t> thread_counts(pool.num_threads(), 0);
+  pool.submit(0);
+  pool.run([&](size_t& depth, CW::WorkStealingPool<size_t>::Worker& worker) {
+    ++thread_counts[worker.index()];
+    if (depth < max_depth) {
+      worker.push(depth + 1);
+      worker.push(depth + 1);
+    }
+  });
+  size_t total = 0;
+  for (size_t count : thread_counts) {
+    total += count;
+  }
+  EXPECT_EQ((size_t(1) << (max_depth + 1)) - 1, total);
+}
+
+
+TEST(WorkStealingPool, ProducedTasks)
+{
+  CW::WorkStealingPool<std::pair<size_t, size_t>> pool(3);
+  std::vector<size_t> results(1000, 0);
+  pool.run(
+    [&]() {
+      for (size_t i=0; i < results.size(); ++i) {
+        pool.submit(std::pair<size_t, size_t>(i, i * i));
+      }
+    },
+    [&](std::pair<size_t, size_t>& task, CW::WorkStealingPool<std::pair<size_t, size_t>>::Worker&) {
+      results[task.first] = task.second + 1;
+    });
+  for (size_t i=0; i < results.size(); ++i) {
+    EXPECT_EQ((i * i) + 1, results[i]);
+  }
+}
+
+
+TEST(WorkStealingPool, SingleThread)
+{
+  CW::WorkStealingPool<int> pool(1);
+  std::vector<int> order;
+  for (int i=0; i < 3; ++i) {
+    pool.submit(i);
+  }
+  pool.run([&](int& task, CW::WorkStealingPool<int>::Worker& worker) {
+    order.push_back(task);
+    if (task == 0) {
+      worker.push(10);
+    }
+  });
+  // Submitted tasks are taken oldest first, and pushed tasks before them.
+  EXPECT_EQ((std::vector<int>{0, 10, 1, 2}), order);
+}
+
+
+TEST(WorkStealingPool, Exceptions)
+{
+  CW::WorkStealingPool<int> pool(4);
+  std::atomic<int> run_count(0);
+  for (int i=0; i < 100; ++i) {
+    pool.submit(i);
+  }
+  EXPECT_THROW(pool.run([&](int& task, CW::WorkStealingPool<int>::Worker&) {
+    ++run_count;
+    if (task == 5) {
+      throw std::runtime_error("task failed");
+    }
+  }), std::runtime_error);
+  EXPECT_LE(run_count.load(), 100);
+  // The pool can be run again after a failure.
+  pool.submit(1);
+  EXPECT_NO_THROW(pool.run([](int&, CW::WorkStealingPool<int>::Worker&) {}));
+}
+
+
+TEST(WorkStealingPool, ParallelForChunks)
+{
+  // Each index is visited once, in chunks that end at the count.
+  std::vector<int> visits(1003, 0);
+  CW::parallel_for_chunks(visits.size(), 10, 4, [&](size_t begin, size_t end) {
+    EXPECT_EQ(0u, begin % 10);
+    EXPECT_EQ(std::min(begin + 10, visits.size()), end);
+    for (size_t i=begin; i < end; ++i) {
+      ++visits[i];
+    }
+  });
+  EXPECT_EQ(std::vector<int>(visits.size(), 1), visits);
+  // Each thread makes its local value once, and reuses it across its chunks.
+  std::atomic<int> num_locals(0);
+  std::vector<size_t> sums(visits.size(), 0);
+  CW::parallel_for_chunks(visits.size(), 1, 3, [&]() { ++num_locals; return std::vector<size_t>(); }, [&](std::vector<size_t>& buffer, size_t begin, size_t end) {
+    buffer.assign(end - begin, begin);
+    sums[begin] = buffer.size() + buffer[0];
+  });
+  EXPECT_LE(num_locals.load(), 3);
+  for (size_t i=0; i < sums.size(); ++i) {
+    EXPECT_EQ(i + 1, sums[i]);
+  }
+  CW::parallel_for_chunks(0, 10, 4, [](size_t, size_t) {
+    FAIL();
+  });
+  EXPECT_THROW(CW::parallel_for_chunks(visits.size(), 10, 4, [](size_t begin, size_t) {
+    if (begin == 500) {
+      throw std::runtime_error("chunk failed");
+    }
+  }), std::runtime_error);
+}
@@ -0,0 +1,136 @@
+//
+//  BillOfMaterialsTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/BillOfMaterials.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/DefinitionGraph.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/ModelWalker.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, BillOfMaterialsOccurrences)
+{
+  CW::DefinitionGraph graph = m_model->definition_graph();
+  CW::BillOfMaterials bill(*m_model, graph);
+  ASSERT_EQ(graph.num_nodes(), bill.size());
+  EXPECT_EQ(1u, bill[0].num_occurrences);
+  // The occurrences agree with those found by walking the model.
+  CW::ModelWalker walker(*m_model);
+  const std::vector<size_t> walker_counts = walker.occurrence_counts();
+  for (size_t i=1; i < walker.num_nodes(); ++i) {
+    const uint32_t node = graph.node(walker.definition(i));
+    ASSERT_NE(CW::DefinitionGraph::NO_NODE, node);
+    EXPECT_EQ(walker_counts[i], bill[node].num_occurrences);
+  }
+  for (size_t i=1; i < bill.size(); ++i) {
+    CW::ComponentDefinition definition = graph.definition(static_cast<uint32_t>(i));
+    EXPECT_EQ(definition.ref().ptr, bill[i].definition.ptr);
+    EXPECT_EQ(definition.name().std_string(), bill[i].name);
+    CW::Entities entities = definition.entities();
+    EXPECT_EQ(entities.faces().size(), bill[i].num_faces);
+    EXPECT_EQ(entities.edges(false).size(), bill[i].num_edges);
+    EXPECT_GE(bill[i].num_triangles, bill[i].num_faces);
+  }
+  const CW::BillOfMaterials::Row totals = bill.totals();
+  EXPECT_EQ(walker.node(0).total_faces, totals.num_faces);
+  EXPECT_THROW(bill[bill.size()], std::out_of_range);
+}
+
+
+TEST_F(ModelLoad, BillOfMaterialsMaterialAreas)
+{
+  CW::BillOfMaterials bill(*m_model);
+  for (size_t i=0; i < bill.size(); ++i) {
+    double area = 0.0;
+    for (const CW::BillOfMaterials::MaterialArea& material_area : bill.material_areas(i)) {
+      if (material_area.material != CW::BillOfMaterials::NO_INDEX) {
+        ASSERT_LT(material_area.material, bill.materials().size());
+      }
+      area += material_area.area;
+    }
+    EXPECT_NEAR(bill[i].area, area, 1e-6 * (1.0 + bill[i].area));
+  }
+  double top_level_area = 0.0;
+  for (const CW::Face& face : m_model->entities().face_range()) {
+    top_level_area += face.area();
+  }
+  EXPECT_NEAR(top_level_area, bill[0].area, 1e-6 * (1.0 + top_level_area));
+}
+
+
+TEST_F(ModelLoad, BillOfMaterialsExport)
+{
+  CW::BillOfMaterials bill(*m_model);
+  std::ostringstream csv;
+  bill.write_csv(csv);
+  size_t num_lines = 0;
+  std::string line;
+  std::istringstream csv_lines(csv.str());
+  while (std::getline(csv_lines, line)) {
+    ++num_lines;
+  }
+  EXPECT_EQ(bill.size() + 1, num_lines);
+  EXPECT_EQ(0u, csv.str().find("definition,occurrences,"));
+
+  size_t num_material_areas = 0;
+  for (size_t i=0; i < bill.size(); ++i) {
+    num_material_areas += bill.material_areas(i).size();
+  }
+  std::ostringstream material_csv;
+  bill.write_material_csv(material_csv);
+  num_lines = 0;
+  std::istringstream material_lines(material_csv.str());
+  while (std::getline(material_lines, line)) {
+    ++num_lines;
+  }
+  EXPECT_EQ(num_material_areas + 1, num_lines);
+
+  std::ostringstream json;
+  bill.write_json(json);
+  const std::string text = json.str();
+  EXPECT_EQ('[', text.front());
+  EXPECT_EQ("]\n", text.substr(text.size() - 2));
+  size_t num_objects = 0;
+  for (size_t found = text.find("{\"definition\":"); found != std::string::npos; found = text.find("{\"definition\":", found + 1)) {
+    ++num_objects;
+  }
+  EXPECT_EQ(bill.size(), num_objects);
+}
+
+} // namespace CW::Tests
@@ -0,0 +1,103 @@
+//
+//  ConvexHullCacheTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/ConvexHullCache.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/GeometryInput.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, ConvexHullCacheDefinitions)
+{
+  CW::ConvexHullCache cache;
+  std::vector<CW::ComponentDefinition> definitions = m_model->definitions();
+  for (CW::ComponentDefinition& definition : definitions) {
+    const CW::ConvexHull& hull = cache.hull(definition);
+    // The result is cached, so the same hull is returned again.
+    EXPECT_EQ(&hull, &cache.hull(definition));
+    if (hull.indices().empty()) {
+      continue;
+    }
+    const CW::OrientedBoundingBox& box = cache.oriented_bounding_box(definition);
+    EXPECT_GE(box.volume(), hull.volume() - 1e-6);
+    for (const CW::Point3D& corner : box.corners()) {
+      EXPECT_FALSE(!corner);
+    }
+  }
+  EXPECT_EQ(definitions.size(), cache.size());
+  EXPECT_THROW(cache.hull(CW::ComponentDefinition()), std::logic_error);
+  cache.clear();
+  EXPECT_EQ((size_t)0, cache.size());
+}
+
+
+TEST_F(ModelLoad, ConvexHullCacheInstances)
+{
+  CW::ConvexHullCache cache;
+  std::vector<CW::ComponentInstance> instances = m_model->entities().instances();
+  for (CW::ComponentInstance& instance : instances) {
+    const CW::ConvexHull definition_hull = cache.hull(instance.definition());
+    const CW::ConvexHull hull = cache.hull(instance);
+    EXPECT_EQ(definition_hull.vertices().size(), hull.vertices().size());
+    for (const CW::ConvexHull& part : cache.decomposition(instance)) {
+      EXPECT_FALSE(part.empty());
+    }
+  }
+  // The hull of the model contains the hull of each instance.
+  const CW::ConvexHull model_hull = cache.hull(m_model->entities());
+  for (CW::ComponentInstance& instance : instances) {
+    for (const CW::Point3D& vertex : cache.hull(instance).vertices()) {
+      EXPECT_TRUE(model_hull.contains(vertex));
+    }
+  }
+}
+
+
+TEST_F(ModelLoad, ConvexHullCacheProxyGroup)
+{
+  // The hull of the model is added as a proxy group in the copy of the model.
+  CW::ConvexHullCache cache;
+  const CW::ConvexHull hull = cache.hull(m_model->entities());
+  ASSERT_FALSE(hull.indices().empty());
+  CW::Group proxy = m_model_copy->entities().add_group();
+  CW::GeometryInput geom_input;
+  const size_t num_faces = hull.add_to(geom_input);
+  EXPECT_GE(num_faces, (size_t)4);
+  proxy.entities().fill(geom_input);
+  EXPECT_EQ(num_faces, proxy.entities().faces().size());
+}
+
+} // namespace CW::Tests
@@ -0,0 +1,73 @@
+//
+//  DefinitionDecimatorTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/DefinitionDecimator.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/String.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, DefinitionDecimatorLevels)
+{
+  std::vector<CW::ComponentDefinition> definitions = m_model->definitions();
+  std::vector<CW::DefinitionDecimator> decimators;
+  for (CW::ComponentDefinition& definition : definitions) {
+    if (!definition.entities().faces().empty()) {
+      decimators.push_back(CW::DefinitionDecimator(definition));
+    }
+  }
+  ASSERT_FALSE(decimators.empty());
+  const std::vector<CW::MeshDecimator::Target> targets = {CW::MeshDecimator::Target(0, CW::Point3D::EPSILON), CW::MeshDecimator::Target(100)};
+  std::vector<std::vector<CW::MeshDecimator::Mesh>> levels = CW::DefinitionDecimator::decimate(decimators, targets, 2);
+  ASSERT_EQ(decimators.size(), levels.size());
+  for (size_t i=0; i < decimators.size(); ++i) {
+    const CW::MeshDecimator::Mesh& mesh = decimators[i].mesh();
+    EXPECT_GT(mesh.num_triangles(), (size_t)0);
+    EXPECT_FALSE(decimators[i].styles().empty());
+    ASSERT_EQ(targets.size(), levels[i].size());
+    EXPECT_LE(levels[i][0].num_triangles(), mesh.num_triangles());
+    EXPECT_LE(levels[i][1].num_triangles(), levels[i][0].num_triangles());
+    for (size_t attribute : levels[i][1].attributes) {
+      EXPECT_LT(attribute, decimators[i].styles().size());
+    }
+  }
+
+  // The coarsest level of the first definition is written back into a new definition, one face per triangle.  Triangles too small for SketchUp may be dropped.
+  CW::ComponentDefinition lod = decimators[0].create_definition(levels[0][1], *m_model, CW::String("LOD"));
+  ASSERT_FALSE(!lod);
+  EXPECT_GT(lod.entities().faces().size(), (size_t)0);
+  EXPECT_LE(lod.entities().faces().size(), levels[0][1].num_triangles());
+}
+
+} // namespace CW::Tests
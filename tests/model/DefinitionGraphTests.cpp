@@ -0,0 +1,120 @@
+//
+//  DefinitionGraphTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/DefinitionGraph.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/ModelWalker.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, DefinitionGraphMatchesModel)
+{
+  CW::DefinitionGraph graph = m_model->definition_graph();
+  const std::vector<CW::ComponentDefinition> definitions = m_model->definitions();
+  const std::vector<CW::ComponentDefinition> group_definitions = m_model->group_definitions();
+  ASSERT_EQ(1 + definitions.size() + group_definitions.size(), graph.num_nodes());
+  EXPECT_TRUE(!graph.definition(0));
+  for (size_t i=0; i < definitions.size(); ++i) {
+    EXPECT_EQ(i + 1, graph.node(definitions[i]));
+    EXPECT_EQ(definitions[i].ref().ptr, graph.definition(static_cast<uint32_t>(i + 1)).ref().ptr);
+  }
+  EXPECT_EQ(CW::DefinitionGraph::NO_NODE, graph.node(CW::ComponentDefinition()));
+
+  for (uint32_t node=0; node < graph.num_nodes(); ++node) {
+    CW::Entities entities = node == 0 ? m_model->entities() : graph.definition(node).entities();
+    EXPECT_EQ(entities.faces().size(), graph.num_faces(node));
+    const CW::IdRange children = graph.children(node);
+    const CW::IdRange counts = graph.instance_counts(node);
+    ASSERT_EQ(children.size(), counts.size());
+    // Each child is listed once, with the number of its instances.
+    EXPECT_EQ(children.size(), std::set<uint32_t>(children.begin(), children.end()).size());
+    size_t num_instances = 0;
+    for (size_t i=0; i < children.size(); ++i) {
+      num_instances += counts[i];
+      const CW::IdRange parents = graph.parents(children[i]);
+      EXPECT_EQ(1, std::count(parents.begin(), parents.end(), node));
+    }
+    EXPECT_EQ(entities.groups().size() + entities.instances().size(), num_instances);
+  }
+}
+
+
+TEST_F(ModelLoad, DefinitionGraphTopologicalOrder)
+{
+  CW::DefinitionGraph graph(*m_model);
+  ASSERT_TRUE(graph.is_acyclic());
+  EXPECT_TRUE(graph.find_cycle().empty());
+  const std::vector<uint32_t>& order = graph.topological_order();
+  ASSERT_EQ(graph.num_nodes(), order.size());
+  EXPECT_EQ(0u, order[0]);
+  std::vector<size_t> positions(graph.num_nodes(), graph.num_nodes());
+  for (size_t i=0; i < order.size(); ++i) {
+    positions[order[i]] = i;
+  }
+  for (uint32_t node=0; node < graph.num_nodes(); ++node) {
+    for (uint32_t child : graph.children(node)) {
+      EXPECT_LT(positions[node], positions[child]);
+    }
+  }
+}
+
+
+TEST_F(ModelLoad, DefinitionGraphBottomUp)
+{
+  CW::DefinitionGraph graph = m_model->definition_graph();
+  std::vector<size_t> num_computed(graph.num_nodes(), 0);
+  // The faces in one occurrence of each node, including those of its instances.
+  const std::vector<size_t> total_faces = graph.bottom_up<size_t>([&](uint32_t node, const std::vector<size_t>& results) {
+    ++num_computed[node];
+    size_t total = graph.num_faces(node);
+    const CW::IdRange children = graph.children(node);
+    const CW::IdRange counts = graph.instance_counts(node);
+    for (size_t i=0; i < children.size(); ++i) {
+      total += results[children[i]] * counts[i];
+    }
+    return total;
+  }, 4);
+  ASSERT_EQ(graph.num_nodes(), total_faces.size());
+  for (size_t count : num_computed) {
+    EXPECT_EQ(1u, count);
+  }
+  EXPECT_EQ(CW::ModelWalker(*m_model).node(0).total_faces, total_faces[0]);
+}
+
+} // namespace CW::Tests
@@ -0,0 +1,91 @@
+//
+//  DrawingElementTableTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/DrawingElementTable.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/EntityRefs.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, DrawingElementTableMatchesElements)
+{
+  CW::Entities entities = m_model->entities();
+  std::vector<CW::Face> faces = entities.faces();
+  CW::DrawingElementTable table(*m_model);
+  table.reserve(faces.size());
+  table.add_all(faces);
+  ASSERT_EQ(faces.size(), table.size());
+  std::vector<CW::Material> materials = m_model->materials();
+  std::vector<CW::Layer> layers = m_model->layers();
+  ASSERT_GE(table.material_dictionary().size(), materials.size());
+  ASSERT_GE(table.layer_dictionary().size(), layers.size());
+  for (size_t i=0; i < materials.size(); ++i) {
+    EXPECT_EQ(materials[i].ref().ptr, table.material_dictionary()[i].ref().ptr);
+  }
+  for (size_t i=0; i < faces.size(); ++i) {
+    EXPECT_EQ(faces[i].material().ref().ptr, table.material(i).ref().ptr);
+    EXPECT_EQ(faces[i].layer().ref().ptr, table.layer(i).ref().ptr);
+    EXPECT_EQ(faces[i].hidden(), table.hidden(i));
+    EXPECT_EQ(faces[i].casts_shadows(), table.casts_shadows(i));
+    EXPECT_EQ(faces[i].receives_shadows(), table.receives_shadows(i));
+    EXPECT_EQ(faces[i].bounds().min(), table.bounds(i).min());
+    EXPECT_EQ(faces[i].bounds().max(), table.bounds(i).max());
+  }
+  size_t num_with_layer = 0;
+  for (size_t count : table.layer_counts()) {
+    num_with_layer += count;
+  }
+  EXPECT_LE(num_with_layer, faces.size());
+  EXPECT_THROW(table.material(faces.size()), std::out_of_range);
+}
+
+
+TEST_F(ModelLoad, DrawingElementTableColumns)
+{
+  CW::Entities entities = m_model->entities();
+  CW::DrawingElementTable table(*m_model, CW::DrawingElementTable::ColumnLayer | CW::DrawingElementTable::ColumnFlags);
+  table.add_all(entities.instance_range().as<CW::InstanceRef>());
+  table.add_all(entities.group_range());
+  EXPECT_EQ(entities.instance_range().size() + entities.group_range().size(), table.size());
+  EXPECT_EQ(table.size(), table.layer_indices().size());
+  EXPECT_EQ(table.size(), table.flags().size());
+  EXPECT_THROW(table.material_indices(), std::logic_error);
+  EXPECT_THROW(table.bounds(), std::logic_error);
+  EXPECT_THROW(table.material_dictionary(), std::logic_error);
+}
+
+} // namespace CW::Tests
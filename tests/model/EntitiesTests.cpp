@@ -0,0 +1,89 @@
+//
+//  EntitiesTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, EntitiesRangesMatchVectors)
+{
+  std::vector<CW::Entities> sources = {m_model->entities()};
+  for (const CW::ComponentDefinition& definition : m_model->definitions()) {
+    sources.push_back(definition.entities());
+  }
+  for (const CW::Entities& entities : sources) {
+    const std::vector<CW::Face> faces = entities.faces();
+    CW::EntityRange<CW::Face, SUFaceRef> face_range = entities.face_range();
+    ASSERT_EQ(faces.size(), face_range.size());
+    size_t i = 0;
+    for (const CW::Face& face : face_range) {
+      EXPECT_EQ(faces[i++].ref().ptr, face.ref().ptr);
+    }
+    const std::vector<CW::Edge> edges = entities.edges(false);
+    ASSERT_EQ(edges.size(), entities.edge_range(false).size());
+    EXPECT_EQ(entities.edges(true).size(), entities.edge_range().size());
+    EXPECT_EQ(entities.instances().size(), entities.instance_range().size());
+    EXPECT_EQ(entities.groups().size(), entities.group_range().size());
+    size_t num_visited = 0;
+    entities.for_each_edge([&](const CW::Edge& edge) {
+      EXPECT_EQ(edges[num_visited++].ref().ptr, edge.ref().ptr);
+    }, false);
+    EXPECT_EQ(edges.size(), num_visited);
+  }
+}
+
+
+TEST_F(ModelLoad, EntitiesRangesNested)
+{
+  // A range held while ranges over other entities are made keeps its own refs.
+  CW::Entities entities = m_model->entities();
+  const std::vector<CW::ComponentInstance> instances = entities.instances();
+  CW::EntityRange<CW::ComponentInstance, SUComponentInstanceRef> range = entities.instance_range();
+  ASSERT_EQ(instances.size(), range.size());
+  size_t i = 0;
+  for (const CW::ComponentInstance& instance : range) {
+    size_t num_faces = 0;
+    instance.definition().entities().for_each_face([&num_faces](const CW::Face&) {
+      ++num_faces;
+    });
+    EXPECT_EQ(instance.definition().entities().faces().size(), num_faces);
+    EXPECT_EQ(instances[i++].ref().ptr, instance.ref().ptr);
+  }
+  EXPECT_THROW(CW::Entities().face_range(), std::logic_error);
+}
+
+} // namespace CW::Tests
@@ -0,0 +1,106 @@
+//
+//  EntityRefsTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/EntityRefs.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+#include "SUAPI-CppWrapper/model/Vertex.hpp"
+
+namespace CW::Tests {
+
+static_assert(std::is_trivially_copyable<CW::FaceRef>::value, "FaceRef is trivially copyable");
+
+TEST_F(ModelLoad, EntityRefsMatchWrappers)
+{
+  CW::Entities entities = m_model->entities();
+  std::vector<CW::Face> faces = entities.faces();
+  size_t i = 0;
+  for (CW::FaceRef face : entities.face_range().as<CW::FaceRef>()) {
+    CW::Face& wrapper = faces[i++];
+    EXPECT_EQ(wrapper.ref().ptr, face.ref().ptr);
+    EXPECT_DOUBLE_EQ(wrapper.area(), face.area());
+    EXPECT_EQ(wrapper.normal(), face.normal());
+    EXPECT_EQ(wrapper.num_inner_loops(), face.num_inner_loops());
+    EXPECT_EQ(wrapper.vertices().size(), face.vertices().size());
+    EXPECT_EQ(wrapper.material().ref().ptr, face.material().ref().ptr);
+    EXPECT_EQ(wrapper.back_material().ref().ptr, face.back_material().ref().ptr);
+    EXPECT_EQ(wrapper.layer().ref().ptr, face.layer().ref().ptr);
+    EXPECT_EQ(wrapper.hidden(), face.hidden());
+    EXPECT_EQ(static_cast<CW::Face>(face).ref().ptr, wrapper.ref().ptr);
+    // Each edge of the face bounds the face, and each vertex is at the end of edges.
+    for (CW::EdgeRef edge : face.edges()) {
+      const std::vector<CW::FaceRef> edge_faces = edge.faces();
+      EXPECT_NE(std::find(edge_faces.begin(), edge_faces.end(), face), edge_faces.end());
+      const CW::Edge edge_wrapper = static_cast<CW::Edge>(edge);
+      EXPECT_EQ(edge_wrapper.start().ref().ptr, edge.start().ref().ptr);
+      EXPECT_EQ(edge_wrapper.soft(), edge.soft());
+      EXPECT_EQ(edge_wrapper.smooth(), edge.smooth());
+      EXPECT_NEAR(edge.vector().length(), edge.length(), 1e-12);
+      EXPECT_EQ(edge.start().position(), static_cast<CW::Vertex>(edge.start()).position());
+      EXPECT_FALSE(edge.start().edges().empty());
+    }
+  }
+  EXPECT_EQ(faces.size(), i);
+}
+
+
+TEST_F(ModelLoad, EntityRefsInstances)
+{
+  CW::Entities entities = m_model->entities();
+  std::vector<CW::ComponentInstance> instances = entities.instances();
+  size_t i = 0;
+  for (CW::InstanceRef instance : entities.instance_range().as<CW::InstanceRef>()) {
+    const CW::ComponentInstance& wrapper = instances[i++];
+    EXPECT_EQ(wrapper.ref().ptr, instance.ref().ptr);
+    EXPECT_EQ(wrapper.definition().ref().ptr, instance.definition().ref().ptr);
+    EXPECT_EQ(wrapper.transformation(), instance.transformation());
+    EXPECT_EQ(wrapper.name(), instance.name());
+  }
+  for (CW::InstanceRef group : entities.group_range().as<CW::InstanceRef>()) {
+    EXPECT_FALSE(!group);
+    EXPECT_FALSE(!group.definition());
+  }
+  CW::FaceRef null_face;
+  EXPECT_TRUE(!null_face);
+  EXPECT_THROW(null_face.area(), std::logic_error);
+}
+
+} // namespace CW::Tests
@@ -0,0 +1,148 @@
+//
+//  FaceDataTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/FaceData.hpp"
+#include "SUAPI-CppWrapper/model/Layer.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/LoopInput.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+
+namespace CW::Tests {
+
+namespace {
+
+/**
+* Creates a detached 10x10 square face with a 2x2 square hole in the middle.
+*/
+CW::Face square_with_hole() {
+  std::vector<CW::Point3D> outer = {
+    CW::Point3D(0, 0, 0),
+    CW::Point3D(10, 0, 0),
+    CW::Point3D(10, 10, 0),
+    CW::Point3D(0, 10, 0)
+  };
+  CW::Face face(outer);
+  std::vector<CW::Point3D> inner = {
+    CW::Point3D(4, 4, 0),
+    CW::Point3D(4, 6, 0),
+    CW::Point3D(6, 6, 0),
+    CW::Point3D(6, 4, 0)
+  };
+  CW::LoopInput inner_loop_input;
+  for (size_t i=0; i < inner.size(); ++i) {
+    inner_loop_input.add_vertex_index(i);
+  }
+  face.add_inner_loop(inner, inner_loop_input);
+  return face;
+}
+
+} // namespace
+
+TEST(FaceDataTest, SnapshotMatchesFace)
+{
+  CW::Face face = square_with_hole();
+  ASSERT_FALSE(!face);
+  CW::FaceData data(face);
+  ASSERT_EQ(1u, data.size());
+  CW::FaceData::FaceView face_data = data[0];
+  EXPECT_EQ(face.ref().ptr, face_data.face_ref().ptr);
+  EXPECT_EQ(face.outer_loop().points(), face_data.outer_loop().points());
+  ASSERT_EQ(face.num_inner_loops(), face_data.num_inner_loops());
+  EXPECT_EQ(face.inner_loops()[0].points(), face_data.inner_loop(0).points());
+  EXPECT_EQ(8u, face_data.num_points());
+  EXPECT_EQ(8u, data.num_points());
+  EXPECT_EQ(face.normal(), face_data.plane().normal());
+  std::vector<CW::Edge> edges = face.outer_loop().edges();
+  for (size_t i=0; i < edges.size(); ++i) {
+    EXPECT_EQ(edges[i].hidden(), face_data.outer_loop().edge(i).hidden());
+    EXPECT_EQ(edges[i].soft(), face_data.outer_loop().edge(i).soft());
+    EXPECT_EQ(edges[i].smooth(), face_data.outer_loop().edge(i).smooth());
+  }
+  EXPECT_TRUE(!face_data.material());
+  EXPECT_THROW(face_data.inner_loop(1), std::out_of_range);
+  EXPECT_THROW(data[1], std::out_of_range);
+  EXPECT_THROW(CW::FaceData(CW::Face()), std::invalid_argument);
+}
+
+
+TEST(FaceDataTest, CopyAndTransformKeepInnerLoops)
+{
+  CW::Face face = square_with_hole();
+  ASSERT_FALSE(!face);
+  CW::Face face_copy = face.copy();
+  ASSERT_FALSE(!face_copy);
+  EXPECT_EQ(1u, face_copy.num_inner_loops());
+  EXPECT_NEAR(face.area(), face_copy.area(), 0.001);
+
+  CW::Transformation translation(CW::Vector3D(0, 0, 5));
+  CW::Face moved = face * translation;
+  ASSERT_FALSE(!moved);
+  EXPECT_EQ(1u, moved.num_inner_loops());
+  EXPECT_NEAR(face.area(), moved.area(), 0.001);
+  EXPECT_EQ(CW::Point3D(0, 0, 5), moved.outer_loop().points()[0]);
+}
+
+
+TEST_F(ModelLoad, FaceDataBatchMatchesFaces)
+{
+  CW::Entities entities = m_model->entities();
+  std::vector<CW::Face> faces = entities.faces();
+  CW::FaceData data(faces);
+  ASSERT_EQ(faces.size(), data.size());
+  size_t num_points = 0;
+  for (size_t i=0; i < faces.size(); ++i) {
+    CW::FaceData::FaceView face_data = data[i];
+    EXPECT_EQ(faces[i].ref().ptr, face_data.face_ref().ptr);
+    EXPECT_EQ(faces[i].outer_loop().points(), face_data.outer_loop().points());
+    std::vector<CW::Loop> inner_loops = faces[i].inner_loops();
+    ASSERT_EQ(inner_loops.size(), face_data.num_inner_loops());
+    for (size_t j=0; j < inner_loops.size(); ++j) {
+      EXPECT_EQ(inner_loops[j].points(), face_data.inner_loop(j).points());
+    }
+    EXPECT_EQ(faces[i].material().ref().ptr, face_data.material().ref().ptr);
+    EXPECT_EQ(faces[i].back_material().ref().ptr, face_data.back_material().ref().ptr);
+    EXPECT_EQ(faces[i].layer().ref().ptr, face_data.layer().ref().ptr);
+    std::vector<CW::Edge> edges = faces[i].outer_loop().edges();
+    for (size_t j=0; j < edges.size(); ++j) {
+      EXPECT_EQ(edges[j].material().ref().ptr, face_data.outer_loop().edge(j).material.ptr);
+      EXPECT_EQ(edges[j].layer().ref().ptr, face_data.outer_loop().edge(j).layer.ptr);
+    }
+    num_points += face_data.num_points();
+  }
+  EXPECT_EQ(num_points, data.num_points());
+}
+
+} // namespace CW::Tests
@@ -26,6 +26,7 @@
 
 #include "ModelTestUtility.hpp"
 #include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/FaceClassifier.hpp"
 #include "SUAPI-CppWrapper/model/Edge.hpp"
 #include "SUAPI-CppWrapper/model/Vertex.hpp"
 #include "SUAPI-CppWrapper/model/Loop.hpp"
@@ -99,6 +100,25 @@ TEST(FaceTest, OuterLoop) {
   EXPECT_FALSE(!loop);
 }
 
+TEST(FaceTest, ClassifyPoint) {
+  std::vector<CW::Point3D> points = {
+    CW::Point3D(0, 0, 0),
+    CW::Point3D(10, 0, 0),
+    CW::Point3D(10, 10, 0),
+    CW::Point3D(0, 10, 0)
+  };
+  CW::Face face(points);
+  ASSERT_FALSE(!face);
+
+  CW::FaceClassifier classifier(face);
+  EXPECT_EQ(CW::FacePointClass::PointInside, classifier.classify(CW::Point3D(5, 5, 0)));
+  EXPECT_EQ(CW::FacePointClass::PointOnEdge, classifier.classify(CW::Point3D(5, 0, 0)));
+  EXPECT_EQ(CW::FacePointClass::PointOnVertex, classifier.classify(CW::Point3D(10, 10, 0)));
+  EXPECT_EQ(CW::FacePointClass::PointOutside, classifier.classify(CW::Point3D(15, 5, 0)));
+  EXPECT_EQ(CW::FacePointClass::PointNotOnPlane, classifier.classify(CW::Point3D(5, 5, 1)));
+  EXPECT_EQ(classifier.classify(CW::Point3D(5, 5, 0)), face.classify_point(CW::Point3D(5, 5, 0)));
+}
+
 TEST(FaceTest, Copy) {
   std::vector<CW::Point3D> points = {
     CW::Point3D(0, 0, 0),
@@ -165,9 +185,8 @@ TEST_F(FaceModelTest, CopyFaces) {
   // Verify each copied face has positive area
   for (size_t i = 0; i < copied_faces.size(); ++i) {
     EXPECT_GT(copied_faces[i].area(), 0.0);
-    // Note: inner loops are not copied, so areas may differ for faces with holes.
-    // Copied area should be >= source area (no holes means larger or equal area).
-    EXPECT_GE(copied_faces[i].area(), source_faces[i].area() - 0.001);
+    // Inner loops are copied, so the copied area should match the source area.
+    EXPECT_NEAR(copied_faces[i].area(), source_faces[i].area(), 0.001);
   }
 
   SaveModel("Faces");
@@ -152,6 +152,77 @@ TEST_F(ModelLoad, GeometryInputMaterials)
 
 
 
+// GeometryInputWeldVertices test - faces copied with vertex welding share the vertices at their corners
+TEST_F(ModelLoad, GeometryInputWeldVertices)
+{
+  using namespace CW;
+  ASSERT_FALSE(!m_model);
+  std::vector<Face> faces = m_model->entities().faces();
+  size_t num_points = 0;
+  for (Face& face : faces) {
+    num_points += face.outer_loop().points().size();
+    for (Loop& loop : face.inner_loops()) {
+      num_points += loop.points().size();
+    }
+  }
+
+  CW::GeometryInputPlus geom_input(m_model_copy);
+  geom_input.load_materials(m_model->materials());
+  geom_input.load_layers(m_model->layers());
+  EXPECT_FALSE(geom_input.weld_vertices());
+  geom_input.weld_vertices(true);
+  EXPECT_TRUE(geom_input.weld_vertices());
+  for (Face& face : faces) {
+    geom_input.add_face(face, true);
+  }
+  // Faces of the model share their corners, so fewer vertices are added than points given.
+  GeometryInput::WeldStatistics statistics = geom_input.weld_statistics();
+  EXPECT_EQ(num_points, statistics.points);
+  EXPECT_LT(statistics.vertices, statistics.points);
+  EXPECT_EQ(statistics.vertices, geom_input.counts()[0]);
+  EXPECT_GT(statistics.ratio(), 0.0);
+
+  // The faces are the same as those copied without welding.
+  CW::Entities dest_entities = m_model_copy->entities();
+  dest_entities.fill(geom_input);
+  std::vector<Face> added_faces = dest_entities.faces();
+  EXPECT_EQ(faces.size(), added_faces.size());
+  SortFacesByProperties(faces);
+  SortFacesByProperties(added_faces);
+  for (size_t i = 0; i < faces.size() && i < added_faces.size(); ++i) {
+    FacesAreEqual(faces[i], added_faces[i]);
+  }
+}
+
+
+
+// GeometryInputWeldVerticesCopy test - copies of a GeometryInput add to the same vertices, so give consistent indices
+TEST_F(ModelLoad, GeometryInputWeldVerticesCopy)
+{
+  using namespace CW;
+  GeometryInput geom_input;
+  geom_input.weld_vertices(true);
+  GeometryInput copy = geom_input;
+  EXPECT_TRUE(copy.weld_vertices());
+  EXPECT_EQ(0u, geom_input.add_vertex(Point3D(0.0, 0.0, 0.0)));
+  EXPECT_EQ(1u, copy.add_vertex(Point3D(10.0, 0.0, 0.0)));
+  EXPECT_EQ(2u, geom_input.add_vertex(Point3D(10.0, 10.0, 0.0)));
+  EXPECT_EQ(3u, copy.add_vertex(Point3D(0.0, 10.0, 0.0)));
+  // Points welded through either copy give the index of the vertex at that point.
+  EXPECT_EQ(1u, geom_input.add_vertex(Point3D(10.0, 0.0, 0.0)));
+  EXPECT_EQ(2u, copy.add_vertex(Point3D(10.0, 10.0, 0.0)));
+  EXPECT_EQ(4u, geom_input.counts()[0]);
+  EXPECT_EQ(6u, copy.weld_statistics().points);
+
+  // Disabling welding on one copy disables it for both.
+  copy.weld_vertices(false);
+  EXPECT_FALSE(geom_input.weld_vertices());
+  EXPECT_EQ(4u, geom_input.add_vertex(Point3D(0.0, 0.0, 0.0)));
+  EXPECT_EQ(5u, copy.add_vertex(Point3D(0.0, 0.0, 0.0)));
+  EXPECT_EQ(6u, copy.counts()[0]);
+}
+
+
 // GeometryInputFace test - use GeometryInput to add faces into a model
 TEST_F(ModelLoad, GeometryInputFace)
 {
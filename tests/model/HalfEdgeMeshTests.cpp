@@ -0,0 +1,105 @@
+//
+//  HalfEdgeMeshTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/HalfEdgeMesh.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/Vertex.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, HalfEdgeMeshMatchesTopology)
+{
+  CW::Entities entities = m_model->entities();
+  std::vector<CW::Face> faces = entities.faces();
+  CW::HalfEdgeMesh mesh(entities);
+  ASSERT_EQ(faces.size(), mesh.num_faces());
+  EXPECT_EQ(entities.edges(false).size(), mesh.num_edges());
+  EXPECT_GT(mesh.memory_usage(), 0u);
+  for (size_t f=0; f < faces.size(); ++f) {
+    const uint32_t face_id = mesh.face_id(faces[f]);
+    ASSERT_EQ(f, face_id);
+    EXPECT_EQ(faces[f].ref().ptr, mesh.face(face_id).ref().ptr);
+    ASSERT_EQ(faces[f].num_inner_loops() + 1, mesh.num_face_loops(face_id));
+    const uint32_t loop_id = mesh.outer_loop(face_id);
+    std::vector<CW::Vertex> vertices = faces[f].outer_loop().vertices();
+    ASSERT_EQ(vertices.size(), mesh.loop_size(loop_id));
+    for (size_t i=0; i < vertices.size(); ++i) {
+      const uint32_t half_edge = mesh.loop_half_edge(loop_id) + static_cast<uint32_t>(i);
+      EXPECT_EQ(mesh.vertex_id(vertices[i]), mesh.origin(half_edge));
+      EXPECT_EQ(mesh.vertex_id(vertices[(i + 1) % vertices.size()]), mesh.destination(half_edge));
+      EXPECT_EQ(half_edge, mesh.previous(mesh.next(half_edge)));
+      EXPECT_EQ(face_id, mesh.half_edge_face(half_edge));
+    }
+  }
+  for (CW::Edge& edge : entities.edges(false)) {
+    const uint32_t edge_id = mesh.edge_id(edge);
+    ASSERT_NE(CW::HalfEdgeMesh::NO_ID, edge_id);
+    EXPECT_EQ(mesh.vertex_id(edge.start()), mesh.edge_start(edge_id));
+    EXPECT_EQ(mesh.vertex_id(edge.end()), mesh.edge_end(edge_id));
+    std::vector<CW::Face> edge_faces = edge.faces();
+    const CW::IdRange half_edges = mesh.edge_half_edges(edge_id);
+    ASSERT_EQ(edge_faces.size(), half_edges.size());
+    for (uint32_t half_edge : half_edges) {
+      const CW::Face face = mesh.face(mesh.half_edge_face(half_edge));
+      EXPECT_NE(edge_faces.end(), std::find_if(edge_faces.begin(), edge_faces.end(), [&](const CW::Face& other) { return other.ref().ptr == face.ref().ptr; }));
+      EXPECT_EQ(half_edges.size() > 1, mesh.partner(half_edge) != CW::HalfEdgeMesh::NO_ID);
+    }
+    const CW::IdRange start_edges = mesh.vertex_edges(mesh.edge_start(edge_id));
+    EXPECT_NE(start_edges.end(), std::find(start_edges.begin(), start_edges.end(), edge_id));
+  }
+}
+
+
+TEST_F(ModelLoad, HalfEdgeMeshComponents)
+{
+  CW::Entities entities = m_model->entities();
+  CW::HalfEdgeMesh single_thread(entities, 1);
+  CW::HalfEdgeMesh mesh(entities);
+  size_t num_components = 0;
+  std::vector<uint32_t> components = mesh.connected_components(num_components);
+  ASSERT_EQ(mesh.num_faces(), components.size());
+  EXPECT_LE(num_components, mesh.num_faces());
+  for (uint32_t h=0; h < mesh.num_half_edges(); ++h) {
+    EXPECT_EQ(single_thread.partner(h), mesh.partner(h));
+    const uint32_t partner = mesh.partner(h);
+    if (partner != CW::HalfEdgeMesh::NO_ID) {
+      EXPECT_EQ(components[mesh.half_edge_face(h)], components[mesh.half_edge_face(partner)]);
+    }
+  }
+  EXPECT_THROW(mesh.face(static_cast<uint32_t>(mesh.num_faces())), std::out_of_range);
+}
+
+} // namespace CW::Tests
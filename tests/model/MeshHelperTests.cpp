@@ -29,6 +29,7 @@
 #include "SUAPI-CppWrapper/model/Face.hpp"
 #include "SUAPI-CppWrapper/model/Entities.hpp"
 #include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Triangulator.hpp"
 
 namespace CW::Tests {
 
@@ -172,4 +173,34 @@ TEST(MeshHelperTest, MoveAssignment)
   EXPECT_EQ(mesh2.num_triangles(), num_tris);
 }
 
+// Test the native triangulator covers each face as MeshHelper does
+TEST_F(ModelLoad, TriangulatorMatchesMeshHelper)
+{
+  std::vector<CW::Face> faces = m_model->entities().faces();
+  ASSERT_GT(faces.size(), 0u);
+  std::vector<CW::Triangulator::Polygon> polygons;
+  CW::Triangulator triangulator;
+  for (const CW::Face& face : faces) {
+    CW::Triangulator::Polygon polygon(face);
+    std::vector<size_t> indices = triangulator.triangulate(polygon);
+    CW::MeshHelper mesh(face);
+    EXPECT_LE(indices.size(), mesh.num_triangles() * 3);
+    // The triangles face the same way as the face, and cover its area.
+    double area = 0.0;
+    for (size_t i=0; i < indices.size(); i += 3) {
+      CW::Vector3D cross = CW::Vector3D(polygon.vertices[indices[i + 1]] - polygon.vertices[indices[i]]).cross(polygon.vertices[indices[i + 2]] - polygon.vertices[indices[i]]);
+      EXPECT_GE(cross.dot(face.normal()), -1e-9);
+      area += cross.length() / 2.0;
+    }
+    EXPECT_NEAR(face.area(), area, 1e-6 * face.area());
+    polygons.push_back(polygon);
+  }
+  // The polygons, once fetched, can be triangulated on several threads.
+  std::vector<std::vector<size_t>> results = CW::Triangulator::triangulate(polygons, 2);
+  ASSERT_EQ(polygons.size(), results.size());
+  for (size_t i=0; i < polygons.size(); ++i) {
+    EXPECT_EQ(triangulator.triangulate(polygons[i]), results[i]);
+  }
+}
+
 } // namespace CW::Tests
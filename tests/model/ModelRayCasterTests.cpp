@@ -0,0 +1,86 @@
+//
+//  ModelRayCasterTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/ModelRayCaster.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/InstancePath.hpp"
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, ModelRayCasterRaytest)
+{
+  CW::ModelRayCaster caster(*m_model);
+  std::vector<CW::Group> groups = m_model->entities().groups();
+  ASSERT_GT(groups.size(), (size_t)0);
+
+  // A ray straight down onto the middle of each box hits its top face.
+  std::vector<CW::RayCaster::Ray> rays;
+  for (CW::Group& group : groups) {
+    CW::BoundingBox3D bounds = group.bounds();
+    CW::Point3D above((bounds.min().x + bounds.max().x) / 2.0, (bounds.min().y + bounds.max().y) / 2.0, bounds.max().z + 10.0);
+    CW::ModelRayCaster::Hit hit = caster.raytest(above, CW::Vector3D(0.0, 0.0, -2.0));
+    ASSERT_FALSE(!hit);
+    EXPECT_NEAR(10.0, hit.distance, 1e-6);
+    EXPECT_NEAR(bounds.max().z, hit.point.z, 1e-6);
+    EXPECT_NEAR(1.0, std::abs(hit.normal.z), 1e-9);
+    EXPECT_GE(hit.path.depth(), (size_t)1);
+    EXPECT_TRUE(hit.path.contains(hit.face));
+    rays.push_back(CW::RayCaster::Ray{above, CW::Vector3D(0.0, 0.0, -1.0)});
+  }
+
+  // Rays away from the model hit nothing.
+  CW::BoundingBox3D model_bounds = m_model->entities().bounding_box();
+  CW::Point3D beside(model_bounds.max().x + 10.0, model_bounds.max().y, model_bounds.max().z);
+  EXPECT_TRUE(!caster.raytest(beside, CW::Vector3D(1.0, 0.0, 0.0)));
+  rays.push_back(CW::RayCaster::Ray{beside, CW::Vector3D(1.0, 0.0, 0.0)});
+
+  // Batches give the same faces as single rays.
+  std::vector<CW::RayCaster::Hit> hits = caster.cast(rays, 2);
+  ASSERT_EQ(rays.size(), hits.size());
+  for (size_t i=0; i < rays.size(); ++i) {
+    CW::ModelRayCaster::Hit single = caster.raytest(rays[i].origin, rays[i].direction);
+    CW::ModelRayCaster::Hit resolved = caster.resolve(rays[i], hits[i]);
+    EXPECT_EQ(!single, !resolved);
+    if (!!single) {
+      EXPECT_TRUE(single.face == resolved.face);
+      EXPECT_EQ(single.distance, resolved.distance);
+    }
+  }
+
+  // Null entities are rejected.
+  EXPECT_THROW(CW::ModelRayCaster{CW::Entities()}, std::logic_error);
+}
+
+} // namespace CW::Tests
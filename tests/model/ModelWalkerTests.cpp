@@ -0,0 +1,147 @@
+//
+//  ModelWalkerTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/ComponentInstance.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/InstancePath.hpp"
+#include "SUAPI-CppWrapper/model/ModelWalker.hpp"
+
+namespace CW::Tests {
+
+namespace {
+
+/**
+* Counts the occurrences and faces below the entities by recursing through their groups and instances.
+*/
+void count_recursively(const CW::Entities& entities, size_t& num_occurrences, size_t& num_faces) {
+  ++num_occurrences;
+  num_faces += entities.faces().size();
+  auto count_instance = [&](const CW::ComponentInstance& instance) {
+    count_recursively(instance.definition().entities(), num_occurrences, num_faces);
+  };
+  for (const CW::Group& group : entities.group_range()) {
+    count_instance(group);
+  }
+  for (const CW::ComponentInstance& instance : entities.instance_range()) {
+    count_instance(instance);
+  }
+}
+
+} // namespace
+
+
+TEST_F(ModelLoad, ModelWalkerWalk)
+{
+  CW::ModelWalker walker(*m_model);
+  size_t expected_occurrences = 0;
+  size_t expected_faces = 0;
+  count_recursively(m_model->entities(), expected_occurrences, expected_faces);
+  ASSERT_GE(walker.num_nodes(), 1u);
+  EXPECT_TRUE(!walker.definition(0));
+  EXPECT_EQ(expected_faces, walker.node(0).total_faces);
+
+  std::vector<size_t> counts(walker.num_nodes(), 0);
+  size_t num_faces = 0;
+  walker.walk([&](const CW::ModelWalker::Occurrence& occurrence, const CW::InstancePath& path) {
+    ++counts[occurrence.node];
+    num_faces += walker.node(occurrence.node).num_faces;
+    EXPECT_EQ(occurrence.path.size(), path.depth());
+    // The accumulated transformation is the product of the instances' transformations.
+    CW::Transformation expected;
+    for (SUComponentInstanceRef instance : occurrence.path) {
+      expected = expected * CW::ComponentInstance(instance).transformation();
+    }
+    EXPECT_TRUE(expected == occurrence.transformation);
+  });
+  EXPECT_EQ(expected_faces, num_faces);
+  EXPECT_EQ(walker.occurrence_counts(), counts);
+  size_t num_occurrences = 0;
+  for (size_t count : counts) {
+    num_occurrences += count;
+  }
+  EXPECT_EQ(expected_occurrences, num_occurrences);
+  EXPECT_THROW(walker.node(walker.num_nodes()), std::out_of_range);
+  EXPECT_THROW(CW::ModelWalker{CW::Entities()}, std::logic_error);
+}
+
+
+TEST_F(ModelLoad, ModelWalkerWalkParallel)
+{
+  CW::ModelWalker walker(*m_model, 4);
+  EXPECT_EQ(4u, walker.num_threads());
+  std::vector<std::vector<size_t>> thread_counts(walker.num_threads(), std::vector<size_t>(walker.num_nodes(), 0));
+  std::vector<CW::ModelWalker::Occurrence> deepest(walker.num_threads());
+  walker.walk_parallel([&](const CW::ModelWalker::Occurrence& occurrence, size_t thread_index) {
+    ++thread_counts[thread_index][occurrence.node];
+    if (occurrence.path.size() >= deepest[thread_index].path.size()) {
+      deepest[thread_index] = occurrence;
+    }
+  });
+  std::vector<size_t> counts(walker.num_nodes(), 0);
+  for (const std::vector<size_t>& thread_count : thread_counts) {
+    for (size_t i=0; i < counts.size(); ++i) {
+      counts[i] += thread_count[i];
+    }
+  }
+  EXPECT_EQ(walker.occurrence_counts(), counts);
+  // The instance paths of the occurrences are made afterwards on this thread.
+  for (const CW::ModelWalker::Occurrence& occurrence : deepest) {
+    EXPECT_EQ(occurrence.path.size(), walker.instance_path(occurrence).depth());
+  }
+}
+
+
+TEST_F(ModelLoad, ModelWalkerMapDefinitions)
+{
+  CW::ModelWalker walker(*m_model, 4);
+  std::vector<size_t> doubled_faces = walker.map_definitions(
+    [&](size_t index) {
+      return walker.entities(index).faces().size();
+    },
+    [](size_t& num_faces) {
+      return num_faces * 2;
+    });
+  ASSERT_EQ(walker.num_nodes(), doubled_faces.size());
+  for (size_t i=0; i < walker.num_nodes(); ++i) {
+    EXPECT_EQ(walker.node(i).num_faces * 2, doubled_faces[i]);
+    if (i > 0) {
+      EXPECT_EQ(walker.node(i).definition.ptr, walker.definition(i).ref().ptr);
+    }
+  }
+}
+
+} // namespace CW::Tests
@@ -0,0 +1,97 @@
+//
+//  PolygonMeshTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/Edge.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/Loop.hpp"
+#include "SUAPI-CppWrapper/model/Material.hpp"
+#include "SUAPI-CppWrapper/model/PolygonMesh.hpp"
+#include "SUAPI-CppWrapper/model/Vertex.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, PolygonMeshMatchesFaces)
+{
+  CW::Entities entities = m_model->entities();
+  std::vector<CW::Face> faces = entities.faces();
+  CW::PolygonMesh mesh(entities);
+  ASSERT_EQ(faces.size(), mesh.num_faces());
+  size_t num_loop_vertices = 0;
+  for (size_t f=0; f < faces.size(); ++f) {
+    std::vector<CW::Loop> loops = faces[f].loops();
+    const uint32_t first_loop = mesh.face_loops()[f];
+    ASSERT_EQ(loops.size(), mesh.face_loops()[f + 1] - first_loop);
+    for (size_t i=0; i < loops.size(); ++i) {
+      std::vector<CW::Point3D> points = loops[i].points();
+      const uint32_t start = mesh.loop_starts()[first_loop + i];
+      ASSERT_EQ(points.size(), mesh.loop_starts()[first_loop + i + 1] - start);
+      for (size_t j=0; j < points.size(); ++j) {
+        EXPECT_EQ(points[j], CW::Point3D(mesh.points()[mesh.indices()[start + j]]));
+      }
+      num_loop_vertices += points.size();
+    }
+    const uint32_t material = mesh.face_materials()[f];
+    if (material == CW::PolygonMesh::NO_INDEX) {
+      EXPECT_TRUE(!faces[f].material());
+    }
+    else {
+      EXPECT_EQ(faces[f].material().ref().ptr, mesh.materials()[material].ref().ptr);
+    }
+  }
+  // Each vertex is stored once, however many loops and edges share it.
+  EXPECT_LE(mesh.num_points(), num_loop_vertices + (mesh.num_edges() * 2));
+  std::vector<CW::Edge> edges = entities.edges(false);
+  ASSERT_EQ(edges.size(), mesh.num_edges());
+  for (size_t i=0; i < edges.size(); ++i) {
+    EXPECT_EQ(edges[i].start().position(), CW::Point3D(mesh.points()[mesh.edges()[i * 2]]));
+    EXPECT_EQ(edges[i].end().position(), CW::Point3D(mesh.points()[mesh.edges()[(i * 2) + 1]]));
+    EXPECT_EQ(edges[i].soft(), (mesh.edge_flags()[i] & CW::FaceData::EdgeSoft) != 0);
+  }
+}
+
+
+TEST_F(ModelLoad, PolygonMeshRecursive)
+{
+  CW::Entities entities = m_model->entities();
+  CW::PolygonMesh flat_mesh(entities);
+  CW::PolygonMesh nested_mesh(entities, true);
+  EXPECT_GE(nested_mesh.num_faces(), flat_mesh.num_faces());
+  EXPECT_GE(nested_mesh.num_points(), flat_mesh.num_points());
+  EXPECT_EQ(nested_mesh.num_loops() + 1, nested_mesh.loop_starts().size());
+  EXPECT_EQ(nested_mesh.indices().size(), nested_mesh.loop_starts().back());
+  for (uint32_t index : nested_mesh.indices()) {
+    ASSERT_LT(index, nested_mesh.num_points());
+  }
+}
+
+} // namespace CW::Tests
@@ -0,0 +1,128 @@
+//
+//  SpatialIndexTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/SpatialIndex.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Group.hpp"
+#include "SUAPI-CppWrapper/model/InstancePath.hpp"
+#include "SUAPI-CppWrapper/Geometry.hpp"
+#include "SUAPI-CppWrapper/Transformation.hpp"
+
+namespace CW::Tests {
+
+namespace {
+
+/**
+* Returns the indices of every entity in the index whose bounds overlap the box, by testing each one.
+*/
+std::vector<size_t> overlapping(const CW::SpatialIndex& index, const CW::BoundingBox3D& box) {
+  std::vector<size_t> results;
+  for (size_t i=0; i < index.size(); ++i) {
+    if (CW::BoundingVolumeHierarchy::overlaps(index.bounds(i), box)) {
+      results.push_back(i);
+    }
+  }
+  return results;
+}
+
+std::vector<size_t> sorted(std::vector<size_t> values) {
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+} // namespace
+
+
+TEST_F(ModelLoad, SpatialIndexQueries)
+{
+  CW::Entities entities = m_model->entities();
+  CW::SpatialIndex index(entities);
+  ASSERT_GT(index.size(), (size_t)0);
+
+  // The whole model is found by a box containing it.
+  CW::BoundingBox3D model_bounds = entities.bounding_box();
+  std::vector<size_t> everything = index.query(model_bounds);
+  EXPECT_EQ(overlapping(index, model_bounds), sorted(everything));
+
+  // A box around the centre of the model finds the same entities as testing each one.
+  CW::Point3D centre = (model_bounds.min() + model_bounds.max()) / 2.0;
+  CW::Vector3D half_size = (model_bounds.max() - model_bounds.min()) / 4.0;
+  CW::BoundingBox3D middle(centre - half_size, centre + half_size);
+  EXPECT_EQ(overlapping(index, middle), sorted(index.query(middle)));
+
+  // Every entity found by a sphere is within the sphere's bounding box.
+  const double radius = half_size.length();
+  CW::Vector3D diagonal(radius, radius, radius);
+  std::vector<size_t> in_sphere = index.query(centre, radius);
+  std::vector<size_t> in_box = overlapping(index, CW::BoundingBox3D(centre - diagonal, centre + diagonal));
+  for (size_t found : in_sphere) {
+    EXPECT_TRUE(std::binary_search(in_box.begin(), in_box.end(), found));
+  }
+
+  // Entities at the top level have no parent, and an empty path.
+  for (size_t i=0; i < index.size(); ++i) {
+    if (index.item(i).parent == CW::SpatialIndex::NO_PARENT) {
+      EXPECT_TRUE(index.transformation(i).is_identity());
+      EXPECT_EQ((size_t)0, index.path(i).depth());
+    }
+  }
+}
+
+
+TEST_F(ModelLoad, SpatialIndexUpdate)
+{
+  CW::Entities entities = m_model_copy->entities();
+  std::vector<CW::Group> groups = m_model->entities().groups();
+  ASSERT_GT(groups.size(), (size_t)0);
+  CW::Group group = entities.add_group(groups[0].definition(), groups[0].transformation());
+  CW::SpatialIndex index(entities);
+
+  // Move the group, and refit the index.
+  CW::Transformation moved = CW::Transformation(CW::Vector3D(1000.0, 0.0, 0.0)) * group.transformation();
+  group.transformation(moved);
+  EXPECT_EQ((size_t)1, index.update(group));
+
+  // The refitted index matches one built from scratch.
+  CW::SpatialIndex rebuilt(entities);
+  ASSERT_EQ(rebuilt.size(), index.size());
+  for (size_t i=0; i < index.size(); ++i) {
+    CW::BoundingBox3D refitted_bounds = index.bounds(i);
+    CW::BoundingBox3D rebuilt_bounds = rebuilt.bounds(i);
+    EXPECT_TRUE(refitted_bounds.min() == rebuilt_bounds.min());
+    EXPECT_TRUE(refitted_bounds.max() == rebuilt_bounds.max());
+  }
+  CW::BoundingBox3D group_bounds = rebuilt.bounds(0);
+  EXPECT_EQ(sorted(rebuilt.query(group_bounds)), sorted(index.query(group_bounds)));
+}
+
+} // namespace CW::Tests
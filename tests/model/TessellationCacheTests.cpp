@@ -0,0 +1,149 @@
+//
+//  TessellationCacheTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/TessellatedMesh.hpp"
+#include "SUAPI-CppWrapper/TessellationFileCache.hpp"
+#include "SUAPI-CppWrapper/model/ComponentDefinition.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Face.hpp"
+#include "SUAPI-CppWrapper/model/MeshHelper.hpp"
+#include "SUAPI-CppWrapper/model/TessellationCache.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, TessellationCacheMatchesMeshHelper)
+{
+  CW::TessellationCache cache;
+  CW::Entities entities = m_model->entities();
+  const CW::TessellatedMesh mesh = cache.tessellate(entities);
+  size_t num_vertices = 0;
+  size_t num_triangles = 0;
+  for (const CW::Face& face : entities.face_range()) {
+    const CW::MeshHelper helper(face);
+    num_vertices += helper.num_vertices();
+    num_triangles += helper.num_triangles();
+  }
+  EXPECT_EQ(num_vertices, mesh.num_vertices());
+  EXPECT_EQ(num_triangles, mesh.num_triangles());
+  // The ranges cover every index once.
+  size_t num_range_indices = 0;
+  for (size_t r=0; r < mesh.num_ranges(); ++r) {
+    const CW::TessellatedMesh::MaterialRange& range = mesh.ranges()[r];
+    EXPECT_EQ(num_range_indices, range.first_index);
+    EXPECT_EQ(0u, range.num_indices % 3);
+    num_range_indices += range.num_indices;
+    if (range.front_material != CW::TessellatedMesh::NO_INDEX) {
+      EXPECT_LT(range.front_material, cache.materials().size());
+    }
+  }
+  EXPECT_EQ(mesh.num_indices(), num_range_indices);
+  for (size_t i=0; i < mesh.num_indices(); ++i) {
+    ASSERT_LT(mesh.indices()[i], mesh.num_vertices());
+  }
+}
+
+
+TEST_F(ModelLoad, TessellationCacheHitsAndRevisions)
+{
+  std::vector<CW::ComponentDefinition> definitions = m_model->definitions();
+  ASSERT_FALSE(definitions.empty());
+  CW::TessellationCache cache;
+  for (const CW::ComponentDefinition& definition : definitions) {
+    EXPECT_FALSE(cache.contains(definition));
+    cache.mesh(definition);
+  }
+  const CW::TessellatedMesh& first = cache.mesh(definitions[0]);
+  const CW::TessellatedMesh& again = cache.mesh(definitions[0]);
+  EXPECT_EQ(&first, &again);
+  CW::TessellationCache::Stats stats = cache.stats();
+  EXPECT_EQ(definitions.size(), stats.misses);
+  EXPECT_EQ(2u, stats.hits);
+  EXPECT_EQ(definitions.size(), stats.num_meshes);
+  EXPECT_GT(stats.hit_rate(), 0.0);
+  EXPECT_GE(stats.memory_usage, stats.num_vertices * sizeof(CW::TessellatedMesh::Vertex));
+
+  // A new revision makes the mesh again.
+  const size_t num_triangles = cache.mesh(definitions[0]).num_triangles();
+  EXPECT_EQ(num_triangles, cache.mesh(definitions[0], 1).num_triangles());
+  EXPECT_EQ(definitions.size() + 1, cache.stats().misses);
+
+  cache.erase(definitions[0]);
+  EXPECT_FALSE(cache.contains(definitions[0]));
+  cache.clear();
+  stats = cache.stats();
+  EXPECT_EQ(0u, stats.num_meshes);
+  EXPECT_EQ(0u, stats.hits + stats.misses);
+  EXPECT_EQ(0.0, stats.hit_rate());
+  EXPECT_THROW(cache.mesh(CW::ComponentDefinition()), std::logic_error);
+}
+
+
+TEST_F(ModelLoad, TessellationCacheFileCache)
+{
+  std::vector<CW::ComponentDefinition> definitions = m_model->definitions();
+  ASSERT_FALSE(definitions.empty());
+  const CW::Entities entities = definitions[0].entities();
+  // The hash depends only on the content, so is the same each time.
+  const uint64_t hash = CW::TessellationCache::content_hash(entities);
+  EXPECT_EQ(hash, CW::TessellationCache::content_hash(definitions[0].entities()));
+  if (definitions.size() > 1 && definitions[0].entities().faces().size() != definitions[1].entities().faces().size()) {
+    EXPECT_NE(hash, CW::TessellationCache::content_hash(definitions[1].entities()));
+  }
+
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "cw_tessellation_cache_model";
+  std::filesystem::remove_all(directory);
+  {
+    CW::TessellationFileCache file_cache(directory.string(), 1 << 26);
+    std::vector<std::string> names;
+    const CW::TessellatedMesh made = CW::TessellationCache::load_or_tessellate(entities, file_cache, names);
+    EXPECT_EQ(1u, file_cache.stats().misses);
+    EXPECT_TRUE(file_cache.contains(hash));
+    std::vector<std::string> loaded_names;
+    const CW::TessellatedMesh loaded = CW::TessellationCache::load_or_tessellate(entities, file_cache, loaded_names);
+    EXPECT_EQ(1u, file_cache.stats().hits);
+    EXPECT_EQ(names, loaded_names);
+    ASSERT_EQ(made.size_bytes(), loaded.size_bytes());
+    EXPECT_EQ(made.num_triangles(), loaded.num_triangles());
+    for (size_t r=0; r < loaded.num_ranges(); ++r) {
+      if (loaded.ranges()[r].front_material != CW::TessellatedMesh::NO_INDEX) {
+        EXPECT_LT(loaded.ranges()[r].front_material, loaded_names.size());
+      }
+    }
+  }
+  std::filesystem::remove_all(directory);
+}
+
+} // namespace CW::Tests
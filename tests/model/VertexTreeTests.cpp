@@ -0,0 +1,90 @@
+//
+//  VertexTreeTests.cpp
+//
+// Sketchup C++ Wrapper for C API
+// MIT License
+//
+// Copyright (c) 2026 Tom Kaneko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "ModelTestUtility.hpp"
+#include "SUAPI-CppWrapper/model/VertexTree.hpp"
+#include "SUAPI-CppWrapper/model/Entities.hpp"
+#include "SUAPI-CppWrapper/model/Vertex.hpp"
+#include "SUAPI-CppWrapper/Geometry.hpp"
+
+namespace CW::Tests {
+
+TEST_F(ModelLoad, VertexTreeNearest)
+{
+  CW::VertexTree tree(m_model->entities());
+  ASSERT_GT(tree.size(), (size_t)0);
+
+  // Each vertex is found at its own position, and the batch search agrees with single searches.
+  std::vector<CW::Point3D> points;
+  for (size_t i=0; i < tree.size(); ++i) {
+    CW::Point3D position = tree.position(i);
+    CW::Vertex nearest = tree.nearest(position, CW::Point3D::EPSILON);
+    ASSERT_FALSE(!nearest);
+    EXPECT_FALSE(tree.within(position).empty());
+    points.push_back(position);
+  }
+  CW::BoundingBox3D bounds = m_model->entities().bounding_box();
+  CW::Point3D far_away(bounds.max().x + 100.0, bounds.max().y, bounds.max().z);
+  points.push_back(far_away);
+  EXPECT_TRUE(!tree.nearest(far_away, 1.0));
+
+  std::vector<CW::Vertex> snapped = tree.nearest(points, CW::Point3D::EPSILON, 2);
+  ASSERT_EQ(points.size(), snapped.size());
+  for (size_t i=0; i < points.size(); ++i) {
+    CW::Vertex single = tree.nearest(points[i], CW::Point3D::EPSILON);
+    EXPECT_EQ(!single, !snapped[i]);
+    if (!!single) {
+      EXPECT_TRUE(single == snapped[i]);
+    }
+  }
+  EXPECT_TRUE(!snapped.back());
+
+  // The k nearest vertices are in order of distance, and the vertices nearer than the last are all among them.
+  std::vector<size_t> k_nearest = tree.tree().k_nearest(points[0], 4);
+  ASSERT_EQ((size_t)4, k_nearest.size());
+  EXPECT_EQ((size_t)4, tree.k_nearest(points[0], 4).size());
+  EXPECT_LE((tree.position(k_nearest[0]) - points[0]).length(), CW::Point3D::EPSILON);
+  for (size_t i=1; i < k_nearest.size(); ++i) {
+    EXPECT_LE((tree.position(k_nearest[i - 1]) - points[0]).length(), (tree.position(k_nearest[i]) - points[0]).length());
+  }
+  double last_distance = (tree.position(k_nearest.back()) - points[0]).length();
+  for (size_t index : tree.tree().within(points[0], last_distance * 0.999)) {
+    EXPECT_NE(k_nearest.end(), std::find(k_nearest.begin(), k_nearest.end(), index));
+  }
+  EXPECT_THROW(tree.vertex(tree.size()), std::out_of_range);
+
+  // Without descending into groups, only the loose geometry of the model is included.
+  CW::VertexTree top_level(m_model->entities(), 0);
+  EXPECT_LE(top_level.size(), tree.size());
+}
+
+} // namespace CW::Tests